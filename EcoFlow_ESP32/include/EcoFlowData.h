@@ -10,15 +10,11 @@
 struct EcoFlowData {
     char serialNumber[32];      // Device serial number
     uint8_t batteryPercent;     // Battery level 0-100%
-    char cpuId[32];             // CPU ID
+    char macAddress[18];        // BLE MAC "aa:bb:cc:dd:ee:ff", sent as TAG_ECOFLOW_ADDRESS
     int rssi;                   // Signal strength
     unsigned long timestamp;    // Last update time
     bool valid;                 // Data is valid
 };
 
-// ESP-NOW packet to send to Master ESP32
-struct EcoFlowPacket {
-    EcoFlowData ecoflow;
-    uint32_t packetId;
-    unsigned long senderTime;
-};
+// Sent to the Master as TAG_ECOFLOW / TAG_ECOFLOW_SERIAL / TAG_ECOFLOW_ADDRESS
+// sections of an MSG_TELEMETRY frame, see Shared/EspNowProtocol.h
@@ -4,14 +4,15 @@
 #include <esp_now.h>
 #include <WiFi.h>
 #include "EcoFlowData.h"
+#include "EspNowProtocol.h"
 
 // Master ESP32 MAC Address - CHANGE THIS to your Master ESP32 MAC!
 uint8_t masterMAC[] = {0x7C, 0x87, 0xCE, 0x31, 0xFE, 0x50};
 
 // EcoFlow data
 EcoFlowData ecoflowData;
-EcoFlowPacket packet;
-uint32_t packetCounter = 0;
+uint16_t packetCounter = 0;
+DeltaEncoder encoder;           // Keyframe the Master holds, see EspNowProtocol.h
 
 bool deviceFound = false;
 BLEScan* pBLEScan;
@@ -97,7 +98,7 @@ class MyAdvertisedDeviceCallbacks: public BLEAdvertisedDeviceCallbacks {
                     if (parseEcoFlowBeacon((uint8_t*)data, mfgData.length(), &ecoflowData)) {
                         Serial.println("  ✓ EcoFlow beacon parsed!");
                         ecoflowData.rssi = advertisedDevice.getRSSI();
-                        strncpy(ecoflowData.cpuId, mac.c_str(), sizeof(ecoflowData.cpuId) - 1);
+                        strncpy(ecoflowData.macAddress, mac.c_str(), sizeof(ecoflowData.macAddress) - 1);
                         deviceFound = true;
                     }
                 }
@@ -183,7 +184,7 @@ void loop() {
     Serial.println("\n========== ECOFLOW STATUS ==========");
     if (deviceFound && ecoflowData.valid) {
         Serial.println("Status: ONLINE ✓");
-        Serial.printf("MAC/CPU ID:       %s\n", ecoflowData.cpuId);
+        Serial.printf("MAC Address:      %s\n", ecoflowData.macAddress);
         Serial.printf("Serial Number:    %s\n", ecoflowData.serialNumber);
         Serial.printf("Battery Level:    %d%%\n", ecoflowData.batteryPercent);
         Serial.printf("Signal Strength:  %d dBm\n", ecoflowData.rssi);
@@ -193,14 +194,31 @@ void loop() {
     }
     Serial.println("====================================\n");
 
-    // Prepare and send ESP-NOW packet
-    memset(&packet, 0, sizeof(packet));
-    memcpy(&packet.ecoflow, &ecoflowData, sizeof(EcoFlowData));
-    packet.packetId = packetCounter++;
-    packet.senderTime = millis();
+    // Prepare and send ESP-NOW frame: a keyframe every ESPNOW_KEYFRAME_EVERY
+    // frames (or when the strings change), otherwise only the fields that
+    // differ from it
+    uint8_t frame[ESPNOW_MAX_FRAME];
+    FrameWriter writer(frame, MSG_TELEMETRY, SRC_ECOFLOW);
+    uint32_t text = espnowCrc16((const uint8_t*)ecoflowData.serialNumber, strnlen(ecoflowData.serialNumber, sizeof(ecoflowData.serialNumber)));
+    text = text << 16 | espnowCrc16((const uint8_t*)ecoflowData.macAddress, strnlen(ecoflowData.macAddress, sizeof(ecoflowData.macAddress)));
+    bool key = encoder.begin(writer, packetCounter, text);
+    writer.beginSection(TAG_SENDER_TIME).u32(millis()).endSection();
+    int32_t values[] = {
+        ecoflowData.batteryPercent,
+        constrain(ecoflowData.rssi, -128, 127),
+        ecoflowData.valid ? SECTION_VALID : 0
+    };
+    encoder.section(writer, TAG_ECOFLOW, values);
+    if (key) {
+        writer.beginSection(TAG_ECOFLOW_SERIAL).str(ecoflowData.serialNumber, sizeof(ecoflowData.serialNumber)).endSection();
+        writer.beginSection(TAG_ECOFLOW_ADDRESS).str(ecoflowData.macAddress, sizeof(ecoflowData.macAddress)).endSection();
+    }
+    size_t frameLen = writer.finish(packetCounter);
 
-    Serial.printf("[ESP-NOW] Sending packet #%d...\n", packet.packetId);
-    esp_err_t result = esp_now_send(masterMAC, (uint8_t*)&packet, sizeof(packet));
+    Serial.printf("[ESP-NOW] Sending frame #%u (%u bytes, %u sections, %s)...\n",
+                 packetCounter, (unsigned)frameLen, writer.sections(), key ? "keyframe" : "delta");
+    packetCounter++;
+    esp_err_t result = esp_now_send(masterMAC, frame, frameLen);
 
     if (result == ESP_OK) {
         Serial.println("[ESP-NOW] Packet queued for transmission");
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <Arduino.h>
+#include <WebServer.h>
+
+/**
+ * Streams a response to the browser using chunked transfer-encoding.
+ * Output is collected in a fixed-size buffer and sent one chunk at a
+ * time, so heap use per request stays constant however big the page is.
+ *
+ * Accepts the same `+=` calls as String, so page builders can swap
+ *     String html; ... server.send(200, "text/html", html);
+ * for
+ *     ChunkedResponse html(server); html.begin(200, "text/html"); ... html.end();
+ */
+class ChunkedResponse : public Print {
+public:
+    static const size_t BUFFER_SIZE = 1024;
+
+    explicit ChunkedResponse(WebServer& server) : _server(server), _used(0), _sent(0), _started(false) {}
+    ~ChunkedResponse() { end(); }
+
+    // Send status line and headers; body follows as chunks
+    void begin(int code, const char* contentType) {
+        _server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+        _server.send(code, contentType, "");
+        _started = true;
+    }
+
+    // Flush remaining bytes and send the terminating zero-length chunk
+    void end() {
+        if (!_started) return;
+        sendBuffer();
+        _server.sendContent("");
+        _started = false;
+    }
+
+    size_t write(uint8_t c) override {
+        if (_used == BUFFER_SIZE) sendBuffer();
+        _buffer[_used++] = (char)c;
+        return 1;
+    }
+
+    size_t write(const uint8_t* data, size_t size) override {
+        size_t remaining = size;
+        while (remaining > 0) {
+            if (_used == BUFFER_SIZE) sendBuffer();
+            size_t n = min(remaining, BUFFER_SIZE - _used);
+            memcpy(_buffer + _used, data, n);
+            _used += n;
+            data += n;
+            remaining -= n;
+        }
+        return size;
+    }
+    using Print::write;
+
+    ChunkedResponse& operator+=(const char* s) { write((const uint8_t*)s, strlen(s)); return *this; }
+    ChunkedResponse& operator+=(const String& s) { write((const uint8_t*)s.c_str(), s.length()); return *this; }
+    ChunkedResponse& operator+=(char c) { write((uint8_t)c); return *this; }
+
+    // Total body bytes produced so far (sent + buffered)
+    size_t length() const { return _sent + _used; }
+
+private:
+    void sendBuffer() {
+        if (_used == 0) return;
+        _server.sendContent(_buffer, _used);
+        _sent += _used;
+        _used = 0;
+    }
+
+    WebServer& _server;
+    char _buffer[BUFFER_SIZE];
+    size_t _used;
+    size_t _sent;
+    bool _started;
+};
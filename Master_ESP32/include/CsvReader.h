@@ -0,0 +1,246 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/**
+ * Streaming RFC 4180 CSV tokenizer. Bytes are pushed in arbitrary chunks
+ * (an upload buffer at a time) and each complete record is handed to a
+ * callback, so the file is never held in memory as a whole.
+ *
+ *     CsvReader csv;
+ *     csv.feed(chunk, len, [](const CsvRecord& r) { ... });
+ *     ...
+ *     csv.finish(sameCallback);
+ *
+ * Quoted fields may contain separators, doubled quotes and line breaks.
+ * Records end at LF, CRLF or a lone CR. A leading UTF-8 BOM is skipped.
+ * Whitespace around unquoted fields (and outside the quotes of quoted ones)
+ * is trimmed, matching what spreadsheet exports produce in practice.
+ *
+ * With separator 0 the first line is buffered and whichever of ',' or ';'
+ * occurs more often in it is used (Excel writes ';' in some locales).
+ *
+ * A record is limited to MAX_RECORD bytes of field data and MAX_FIELDS
+ * fields; anything beyond that is dropped and the record is flagged as
+ * malformed. Plain C++, no Arduino dependencies.
+ */
+
+struct CsvRecord {
+    uint32_t line;          // Physical line the record starts on (1-based)
+    uint8_t count;          // Number of fields
+    bool malformed;         // Over the size limits, or an unterminated quote at end of input
+    const char* const* fields;
+
+    const char* field(size_t i) const { return i < count ? fields[i] : ""; }
+
+    // True for empty lines and lines made only of separators
+    bool blank() const {
+        for (size_t i = 0; i < count; i++) {
+            if (fields[i][0]) return false;
+        }
+        return true;
+    }
+};
+
+class CsvReader {
+public:
+    static const size_t MAX_RECORD = 512;
+    static const size_t MAX_FIELDS = 16;
+
+    explicit CsvReader(char separator = 0) { reset(separator); }
+
+    void reset(char separator = 0) {
+        _separator = separator;
+        _pendingUsed = 0;
+        _pendingQuotes = false;
+        _bom = 0;
+        _line = 1;
+        _afterCR = false;
+        _inQuotes = false;
+        _quoteClosed = false;
+        startRecord();
+    }
+
+    char separator() const { return _separator; }
+
+    template <typename F>
+    void feed(const char* data, size_t len, F onRecord) {
+        for (size_t i = 0; i < len; i++) {
+            char c = data[i];
+            if (_bom < 3) {
+                static const char BOM[] = "\xEF\xBB\xBF";
+                if (c == BOM[_bom]) {
+                    _bom++;
+                    continue;
+                }
+                _bom = 3;   // No BOM (a partial match is invalid UTF-8 anyway)
+            }
+            if (_separator) {
+                consume(c, onRecord);
+            } else {
+                detect(c, onRecord);
+            }
+        }
+    }
+
+    // End of input: emit a final record that has no trailing line break
+    template <typename F>
+    void finish(F onRecord) {
+        if (!_separator) replayPending(onRecord);
+        if (_dirty) {
+            if (_inQuotes) _malformed = true;
+            endField();
+            emit(onRecord);
+        }
+    }
+
+private:
+    template <typename F>
+    void detect(char c, F onRecord) {
+        if (_pendingUsed < sizeof(_pending)) _pending[_pendingUsed++] = c;
+        if (c == '"') _pendingQuotes = !_pendingQuotes;
+        bool lineEnd = !_pendingQuotes && (c == '\n' || c == '\r');
+        if (lineEnd || _pendingUsed == sizeof(_pending)) replayPending(onRecord);
+    }
+
+    template <typename F>
+    void replayPending(F onRecord) {
+        size_t commas = 0, semicolons = 0;
+        for (size_t i = 0; i < _pendingUsed; i++) {
+            if (_pending[i] == ',') commas++;
+            else if (_pending[i] == ';') semicolons++;
+        }
+        _separator = semicolons > commas ? ';' : ',';
+        for (size_t i = 0; i < _pendingUsed; i++) consume(_pending[i], onRecord);
+        _pendingUsed = 0;
+    }
+
+    template <typename F>
+    void consume(char c, F onRecord) {
+        if (_afterCR) {
+            _afterCR = false;
+            if (c == '\n') return;      // Second half of CRLF
+        }
+        _dirty = true;
+
+        if (_inQuotes) {
+            if (c == '"') {
+                _inQuotes = false;
+                _quoteClosed = true;
+                _quotedEnd = _used;
+                return;
+            }
+            if (c == '\n') _line++;
+            append(c);
+            return;
+        }
+
+        if (c == '"') {
+            if (_quoteClosed) {             // "" inside a quoted field
+                append('"');
+                _inQuotes = true;
+                _quoteClosed = false;
+                return;
+            }
+            if (_used == _fieldStart) {     // Opening quote
+                _inQuotes = true;
+                return;
+            }
+            append(c);                      // Stray quote in an unquoted field: keep it
+            return;
+        }
+        _quoteClosed = false;
+
+        if (c == _separator) {
+            endField();
+        } else if (c == '\n' || c == '\r') {
+            endField();
+            emit(onRecord);
+            _line++;
+            _afterCR = c == '\r';
+        } else {
+            append(c);
+        }
+    }
+
+    void append(char c) {
+        bool space = c == ' ' || c == '\t';
+        if (space && !_inQuotes && _used == _fieldStart && !_quoteClosed) return;   // Leading whitespace
+        if (_used - terminators() >= MAX_RECORD) {
+            _malformed = true;
+            return;
+        }
+        _buffer[_used++] = c;
+    }
+
+    void endField() {
+        if (!_inQuotes) {
+            while (_used > _fieldStart && _used > _quotedEnd &&
+                   (_buffer[_used - 1] == ' ' || _buffer[_used - 1] == '\t')) {
+                _used--;
+            }
+        }
+        if (_count < MAX_FIELDS) {
+            _buffer[_used++] = '\0';
+            _starts[_count++] = _fieldStart;
+        } else {
+            _used = _fieldStart;    // Drop the extra field
+            _malformed = true;
+        }
+        _fieldStart = _used;
+        _quotedEnd = _used;
+        _quoteClosed = false;
+    }
+
+    template <typename F>
+    void emit(F onRecord) {
+        _inQuotes = false;
+        const char* fields[MAX_FIELDS];
+        for (size_t i = 0; i < _count; i++) fields[i] = _buffer + _starts[i];
+
+        CsvRecord record;
+        record.line = _recordLine;
+        record.count = _count;
+        record.malformed = _malformed;
+        record.fields = fields;
+        onRecord(record);
+
+        startRecord();
+        _recordLine = _line + 1;
+    }
+
+    void startRecord() {
+        _used = 0;
+        _count = 0;
+        _fieldStart = 0;
+        _quotedEnd = 0;
+        _malformed = false;
+        _dirty = false;
+        _recordLine = _line;
+    }
+
+    // Terminators already written for completed fields (not counted against MAX_RECORD)
+    size_t terminators() const { return _count; }
+
+    char _separator;
+    char _pending[MAX_RECORD];      // First line, while detecting the separator
+    size_t _pendingUsed;
+    bool _pendingQuotes;
+    uint8_t _bom;
+
+    char _buffer[MAX_RECORD + MAX_FIELDS];     // Field data plus a terminator per field
+    uint16_t _starts[MAX_FIELDS];
+    size_t _used;
+    size_t _fieldStart;
+    size_t _quotedEnd;              // Trailing-whitespace trim stops at a closing quote
+    uint8_t _count;
+    uint32_t _line;
+    uint32_t _recordLine;
+    bool _afterCR;
+    bool _inQuotes;
+    bool _quoteClosed;
+    bool _malformed;
+    bool _dirty;                    // Current record has consumed any input
+};
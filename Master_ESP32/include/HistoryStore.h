@@ -0,0 +1,127 @@
+#pragma once
+
+#include <Arduino.h>
+#include <functional>
+#include "TelemetryCodec.h"
+
+/**
+ * On-device history of BMV/MPPT/IP22 readings in three tiers:
+ *   tier 0: 10 s averages, last hour       (RAM ring)
+ *   tier 1: 1 min averages, last 24 h      (RAM ring, shrinks to fit the budget)
+ *   tier 2: 15 min averages, last 30 days  (SPIFFS, one append-only segment per day,
+ *                                           delta-encoded with TelemetryCodec)
+ *
+ * Values are stored fixed-point (value * scale) in an int16, so one row of
+ * all series costs 2 bytes per series. RAM use is fixed at compile time and
+ * capped by HISTORY_RAM_BUDGET (override with -DHISTORY_RAM_BUDGET=...).
+ */
+
+enum HistorySeries {
+    HIST_BMV_VOLTAGE = 0,
+    HIST_BMV_CURRENT,
+    HIST_BMV_SOC,
+    HIST_MPPT_POWER,
+    HIST_IP22_CURRENT,
+    HIST_SERIES_COUNT
+};
+
+struct HistorySeriesInfo {
+    const char* name;       // As used in /api/history?series=
+    const char* unit;
+    uint16_t scale;         // Stored value = round(value * scale)
+};
+
+extern const HistorySeriesInfo HISTORY_SERIES[HIST_SERIES_COUNT];
+
+#define HISTORY_MISSING INT16_MIN   // No reading in that interval
+static_assert(HISTORY_MISSING == TELEMETRY_MISSING, "segment codec must keep MISSING rows");
+
+#define HISTORY_TIER_COUNT 3
+#define HISTORY_TIER_PERSISTED 2    // Tier written to SPIFFS
+#define HISTORY_DAYS 30             // SPIFFS retention
+#define HISTORY_DIR "/hist"
+
+#ifndef HISTORY_RAM_BUDGET
+#define HISTORY_RAM_BUDGET 20480    // Bytes for the RAM tiers
+#endif
+
+// Row storage per RAM tier (tier 1 takes whatever the budget leaves after tier 0)
+#define HISTORY_ROW_BYTES (HIST_SERIES_COUNT * 2)
+#define HISTORY_TIER0_SLOTS 360
+#define HISTORY_TIER1_MAX_SLOTS 1440
+#define HISTORY_TIER1_SLOTS ((HISTORY_RAM_BUDGET / HISTORY_ROW_BYTES - HISTORY_TIER0_SLOTS) < HISTORY_TIER1_MAX_SLOTS \
+                             ? (HISTORY_RAM_BUDGET / HISTORY_ROW_BYTES - HISTORY_TIER0_SLOTS) : HISTORY_TIER1_MAX_SLOTS)
+
+static_assert(HISTORY_RAM_BUDGET / HISTORY_ROW_BYTES > HISTORY_TIER0_SLOTS + 60,
+              "HISTORY_RAM_BUDGET too small for the 10 s tier plus an hour of 1 min samples");
+
+class HistoryStore {
+public:
+    static const uint16_t TIER_INTERVAL[HISTORY_TIER_COUNT];    // Seconds per row
+
+    // Emits one (timestamp, stored value) pair; value may be HISTORY_MISSING
+    typedef std::function<void(uint32_t t, int16_t value)> Visitor;
+
+    /**
+     * Load state from SPIFFS: drop segments past retention and restart the
+     * clock after the newest stored row, so timestamps keep increasing across
+     * reboots. Call after SPIFFS.begin().
+     */
+    void begin();
+
+    // History clock in seconds. Uses the time source if one is set, otherwise
+    // seconds since boot offset by the last persisted timestamp
+    uint32_t now() const;
+    void setTimeSource(uint32_t (*source)()) { _timeSource = source; }
+
+    // Feed one reading; present[i] false skips series i (device offline)
+    void addSample(const float* values, const bool* present);
+
+    // Pick the finest tier that still covers `from`
+    uint8_t tierFor(uint32_t from) const;
+
+    // Visit rows of one series in [from, to], oldest first
+    void query(uint8_t series, uint8_t tier, uint32_t from, uint32_t to, const Visitor& visit) const;
+
+    static int seriesIndex(const String& name);
+    static size_t ramBytes() { return sizeof(_tier0Rows) + sizeof(_tier1Rows); }
+
+private:
+    struct Accumulator {
+        uint32_t slotStart;
+        bool open;
+        float sum[HIST_SERIES_COUNT];
+        uint16_t count[HIST_SERIES_COUNT];
+    };
+
+    struct Ring {
+        int16_t* rows;      // slots x HIST_SERIES_COUNT
+        uint16_t slots;
+        uint16_t head;      // Next row to write
+        uint16_t used;
+        uint32_t newest;    // Timestamp of the newest row
+    };
+
+    void closeSlot(uint8_t tier);
+    void pushRing(Ring& ring, uint16_t interval, uint32_t t, const int16_t* row);
+    void appendSegment(uint32_t t, const int16_t* row);
+    void pruneSegments(uint32_t today);
+    uint32_t primeEncoder(uint32_t day);
+    static bool readSegment(uint32_t day, const std::function<void(uint32_t, const int16_t*)>& visit);
+    void querySegments(uint8_t series, uint32_t from, uint32_t to, const Visitor& visit) const;
+    static String segmentPath(uint32_t day);
+
+    static int16_t _tier0Rows[HISTORY_TIER0_SLOTS * HIST_SERIES_COUNT];
+    static int16_t _tier1Rows[HISTORY_TIER1_SLOTS * HIST_SERIES_COUNT];
+
+    Ring _rings[2] = {
+        {_tier0Rows, HISTORY_TIER0_SLOTS, 0, 0, 0},
+        {_tier1Rows, HISTORY_TIER1_SLOTS, 0, 0, 0},
+    };
+    Accumulator _acc[HISTORY_TIER_COUNT] = {};
+    uint32_t _clockBase = 0;
+    uint32_t _lastPrunedDay = 0;
+    TelemetryEncoder _encoder{HIST_SERIES_COUNT};   // Delta chain of the segment being appended
+    uint32_t _encoderDay = UINT32_MAX;
+    uint32_t (*_timeSource)() = nullptr;
+};
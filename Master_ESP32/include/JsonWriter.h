@@ -0,0 +1,174 @@
+#pragma once
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+/**
+ * Streaming JSON writer. Tokens go straight to `Out` (anything with
+ * write(const uint8_t*, size_t), e.g. ChunkedResponse), so a response is
+ * serialised without building a String or a document first.
+ *
+ *     ChunkedResponse out(server);
+ *     out.begin(200, "application/json");
+ *     JsonWriter<ChunkedResponse> json(out);
+ *     json.beginObject().member("ok", 3).key("items").beginArray();
+ *     ...
+ *     json.endArray().endObject();
+ *     out.end();
+ *
+ * Commas are inserted automatically. Strings are escaped (quotes,
+ * backslashes, control characters); UTF-8 passes through unchanged.
+ * Non-finite floats are written as null. Nesting is limited to 32 levels.
+ * Plain C++, no Arduino dependencies, so it can be benchmarked on the host.
+ */
+template <typename Out>
+class JsonWriter {
+public:
+    explicit JsonWriter(Out& out) : _out(out) {}
+
+    JsonWriter& beginObject() { return open('{'); }
+    JsonWriter& endObject() { return close('}'); }
+    JsonWriter& beginArray() { return open('['); }
+    JsonWriter& endArray() { return close(']'); }
+
+    JsonWriter& key(const char* k) {
+        separate();
+        string(k);
+        put(':');
+        _afterKey = true;
+        return *this;
+    }
+
+    JsonWriter& value(const char* s) {
+        separate();
+        if (s) string(s);
+        else raw("null");
+        return *this;
+    }
+    JsonWriter& value(bool b) {
+        separate();
+        raw(b ? "true" : "false");
+        return *this;
+    }
+    JsonWriter& value(int v) { return value((long)v); }
+    JsonWriter& value(unsigned int v) { return value((unsigned long)v); }
+    JsonWriter& value(long v) {
+        separate();
+        unsigned long mag = v < 0 ? 0UL - (unsigned long)v : (unsigned long)v;
+        if (v < 0) put('-');
+        number(mag);
+        return *this;
+    }
+    JsonWriter& value(unsigned long v) {
+        separate();
+        number(v);
+        return *this;
+    }
+    JsonWriter& value(double v, int decimals = 2) {
+        separate();
+        if (!isfinite(v)) {
+            raw("null");
+        } else {
+            char buf[24];
+            int n = snprintf(buf, sizeof(buf), "%.*f", decimals, v);
+            write(buf, n > 0 && n < (int)sizeof(buf) ? n : 0);
+        }
+        return *this;
+    }
+    JsonWriter& null() {
+        separate();
+        raw("null");
+        return *this;
+    }
+
+    // Pre-formatted JSON (a number or literal the caller has already produced)
+    JsonWriter& rawValue(const char* json) {
+        separate();
+        raw(json);
+        return *this;
+    }
+
+    template <typename T>
+    JsonWriter& member(const char* k, T v) { return key(k).value(v); }
+    JsonWriter& member(const char* k, double v, int decimals) { return key(k).value(v, decimals); }
+
+private:
+    static const int MAX_DEPTH = 32;
+
+    JsonWriter& open(char c) {
+        separate();
+        put(c);
+        if (_depth < MAX_DEPTH) _hasItems &= ~(1UL << _depth);
+        _depth++;
+        return *this;
+    }
+
+    JsonWriter& close(char c) {
+        if (_depth > 0) _depth--;
+        put(c);
+        return *this;
+    }
+
+    // Comma before every element except the first in its container
+    void separate() {
+        if (_afterKey) {
+            _afterKey = false;
+            return;
+        }
+        if (_depth == 0 || _depth > MAX_DEPTH) return;
+        uint32_t bit = 1UL << (_depth - 1);
+        if (_hasItems & bit) put(',');
+        _hasItems |= bit;
+    }
+
+    void number(unsigned long v) {
+        char buf[20];       // Enough for 64-bit longs on the host
+        int n = sizeof(buf);
+        do {
+            buf[--n] = '0' + v % 10;
+            v /= 10;
+        } while (v);
+        write(buf + n, sizeof(buf) - n);
+    }
+
+    void string(const char* s) {
+        put('"');
+        const char* run = s;
+        for (; *s; s++) {
+            uint8_t c = (uint8_t)*s;
+            if (c >= 0x20 && c != '"' && c != '\\') continue;
+            write(run, s - run);
+            run = s + 1;
+            switch (c) {
+                case '"': raw("\\\""); break;
+                case '\\': raw("\\\\"); break;
+                case '\n': raw("\\n"); break;
+                case '\r': raw("\\r"); break;
+                case '\t': raw("\\t"); break;
+                case '\b': raw("\\b"); break;
+                case '\f': raw("\\f"); break;
+                default: {
+                    static const char hex[] = "0123456789abcdef";
+                    char esc[6] = {'\\', 'u', '0', '0', hex[c >> 4], hex[c & 15]};
+                    write(esc, sizeof(esc));
+                }
+            }
+        }
+        write(run, s - run);
+        put('"');
+    }
+
+    void raw(const char* s) { write(s, strlen(s)); }
+    void put(char c) { _out.write((const uint8_t*)&c, 1); }
+    void write(const char* s, size_t n) {
+        if (n) _out.write((const uint8_t*)s, n);
+    }
+
+    Out& _out;
+    uint32_t _hasItems = 0;     // Bit per nesting level: container already has an element
+    uint8_t _depth = 0;
+    bool _afterKey = false;
+};
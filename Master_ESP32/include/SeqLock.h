@@ -0,0 +1,58 @@
+#pragma once
+
+#include <atomic>
+#include <stdint.h>
+#include <string.h>
+#include <type_traits>
+
+/**
+ * Sequence lock holding the latest value of a plain struct.
+ * One writer calls store(); any number of readers call load() and always get
+ * a copy from a single store, never half of one and half of the next. The
+ * writer never waits. A reader retries if a store overlaps its copy.
+ *
+ * Readers spin while a store is in progress, so don't read from a
+ * higher-priority task pinned to the same core as the writer.
+ * Only uses <atomic>, so it builds on the host as well as the ESP32.
+ */
+template <typename T>
+class SeqLock {
+    static_assert(std::is_trivially_copyable<T>::value, "SeqLock needs a plain (memcpy-able) type");
+
+public:
+    SeqLock() { memset(&_value, 0, sizeof(T)); }
+
+    // Writer side (single writer only)
+    void store(const T& value) {
+        uint32_t seq = _seq.load(std::memory_order_relaxed);
+        _seq.store(seq + 1, std::memory_order_relaxed);     // Odd: write in progress
+        std::atomic_thread_fence(std::memory_order_release);
+        memcpy(&_value, &value, sizeof(T));
+        _seq.store(seq + 2, std::memory_order_release);
+    }
+
+    // Reader side: returns a consistent copy
+    T load() const {
+        T copy;
+        for (;;) {
+            uint32_t before = _seq.load(std::memory_order_acquire);
+            if ((before & 1) == 0) {
+                memcpy(&copy, &_value, sizeof(T));
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (_seq.load(std::memory_order_relaxed) == before) return copy;
+            }
+            _retries.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    // Number of completed stores
+    uint32_t version() const { return _seq.load(std::memory_order_acquire) / 2; }
+
+    // Reads that had to retry because they overlapped a store
+    uint32_t retries() const { return _retries.load(std::memory_order_relaxed); }
+
+private:
+    T _value;
+    std::atomic<uint32_t> _seq{0};
+    mutable std::atomic<uint32_t> _retries{0};
+};
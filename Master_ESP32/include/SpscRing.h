@@ -0,0 +1,59 @@
+#pragma once
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * Lock-free single-producer / single-consumer ring buffer.
+ * Exactly one task calls push() (e.g. the ESP-NOW receive callback) and
+ * exactly one other task calls pop(). No locks, no heap, never blocks.
+ * When the ring is full push() drops the new item and counts an overrun.
+ *
+ * Only uses <atomic>, so it builds on the host as well as the ESP32.
+ * N must be a power of two.
+ */
+template <typename T, size_t N>
+class SpscRing {
+    static_assert(N >= 2 && (N & (N - 1)) == 0, "SpscRing size must be a power of two");
+
+public:
+    // Producer side
+    bool push(const T& item) {
+        uint32_t head = _head.load(std::memory_order_relaxed);
+        uint32_t tail = _tail.load(std::memory_order_acquire);
+        if (head - tail == N) {
+            _overruns.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        _items[head & (N - 1)] = item;
+        _head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side
+    bool pop(T& out) {
+        uint32_t tail = _tail.load(std::memory_order_relaxed);
+        uint32_t head = _head.load(std::memory_order_acquire);
+        if (head == tail) return false;
+        out = _items[tail & (N - 1)];
+        _tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Either side (a snapshot; may be stale by the time it's used)
+    size_t size() const {
+        return _head.load(std::memory_order_acquire) - _tail.load(std::memory_order_acquire);
+    }
+    bool empty() const { return size() == 0; }
+    static constexpr size_t capacity() { return N; }
+
+    // Items dropped because the consumer fell behind
+    uint32_t overruns() const { return _overruns.load(std::memory_order_relaxed); }
+
+private:
+    T _items[N];
+    std::atomic<uint32_t> _head{0};     // Next slot to write, producer only
+    std::atomic<uint32_t> _tail{0};     // Next slot to read, consumer only
+    std::atomic<uint32_t> _overruns{0};
+};
@@ -0,0 +1,1171 @@
+// Generated by tools/embed_assets.py from web/ - do not edit by hand
+#pragma once
+
+#include <Arduino.h>
+
+struct StaticAsset {
+    const char* path;          // URL path, e.g. /static/inventory.js
+    const char* contentType;
+    const uint8_t* data;       // gzip-compressed body
+    size_t length;
+    const char* etag;          // Short content hash, also used as ?v= cache buster
+};
+
+// dashboard.css: 3503 bytes, 1246 gzipped
+static const uint8_t ASSET_DASHBOARD_CSS[] PROGMEM = {
+    0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x95,0x57,0x4d,0x8f,0xea,0x36,
+    0x14,0xdd,0xcf,0xaf,0x48,0x85,0x9e,0xde,0x50,0x11,0xe4,0x7c,0x02,0xc9,0xa6,0xed,
+    0xa2,0x52,0x17,0x5d,0x3d,0x75,0xd1,0xe5,0x4d,0xec,0x04,0x6b,0x92,0x38,0x72,0xcc,
+    0x00,0x2f,0xe2,0xbf,0xf7,0xda,0xf9,0x20,0x61,0x18,0x86,0x8a,0x81,0x21,0xfe,0x38,
+    0xe7,0xda,0x3e,0xf7,0x5c,0xf3,0x6b,0x6b,0x1f,0x59,0xf2,0xc6,0x95,0xad,0xc4,0x21,
+    0xdd,0xdb,0x29,0x14,0x85,0x38,0xa8,0xa8,0x12,0x15,0x8b,0x87,0xae,0x43,0xc3,0xa4,
+    0xdd,0xb0,0x82,0xa5,0x7d,0xc7,0x6d,0xc3,0xe5,0x25,0x11,0xf4,0xdc,0x26,0x90,0xbe,
+    0xe5,0x52,0x1c,0x2a,0x1a,0x2d,0x08,0x21,0x71,0x2a,0x0a,0x21,0xa3,0x45,0x96,0x65,
+    0x71,0x26,0x2a,0x65,0x67,0x50,0xf2,0xe2,0x1c,0xd9,0x50,0xd7,0x05,0xb3,0x9b,0x73,
+    0xa3,0x58,0xb9,0xfa,0xa3,0xe0,0xd5,0xdb,0xdf,0x90,0xfe,0x30,0x8f,0x7f,0xe2,0xb8,
+    0xd5,0xf7,0x1f,0x2c,0x17,0xcc,0xfa,0xe7,0xaf,0xef,0xab,0xdf,0x25,0x87,0x62,0xd5,
+    0x40,0xd5,0x20,0x9f,0xe4,0x59,0x5c,0x82,0xcc,0x79,0x15,0x91,0xb8,0x06,0x4a,0x79,
+    0x95,0x47,0xdb,0xfa,0x14,0x23,0x04,0xb3,0xf7,0x8c,0xe7,0x7b,0x15,0x39,0x6b,0xaf,
+    0x63,0x6b,0xf8,0x4f,0x16,0x39,0x41,0x7d,0xba,0xbc,0xac,0xd3,0x69,0x6c,0x7a,0x34,
+    0x48,0x3b,0x97,0x40,0x39,0xab,0xd4,0xab,0xe3,0x05,0x94,0xe5,0xab,0x85,0x03,0xfa,
+    0x65,0x91,0x6f,0xf8,0xd5,0x71,0x2c,0x87,0x90,0x6f,0xcb,0x81,0x0f,0x59,0xac,0x2b,
+    0xa7,0x43,0x90,0x34,0x11,0x92,0xe2,0x36,0x68,0x94,0x43,0x13,0x39,0xee,0xb5,0xa9,
+    0x60,0x99,0x8a,0x3c,0x9c,0xd1,0x88,0x82,0x53,0x6b,0xe1,0x79,0x1e,0x76,0x9d,0xec,
+    0x66,0x0f,0x54,0x1c,0x23,0x62,0xf9,0xd8,0x17,0xe2,0x5b,0xe6,0x09,0xbc,0x92,0x95,
+    0x79,0xad,0xbd,0x65,0x5c,0x8b,0x86,0x2b,0x2e,0xaa,0x48,0xb2,0x02,0x14,0x7f,0x67,
+    0x3a,0xf4,0xb5,0xa8,0x74,0xc4,0xed,0x04,0xdc,0xee,0x77,0xd6,0xcf,0xfc,0x07,0xc0,
+    0x9b,0xdd,0xca,0xf5,0xfd,0x15,0xfe,0x23,0x6b,0x77,0x69,0xa0,0x8e,0x20,0xab,0x7b,
+    0x40,0xd9,0x96,0x3c,0x00,0x72,0x83,0x60,0xe5,0x78,0xa1,0x89,0xb2,0x07,0x4a,0x25,
+    0x06,0x8a,0x62,0xb9,0x0b,0xe6,0xba,0x5f,0x80,0x79,0xbe,0xfe,0x1b,0xc1,0x58,0xc9,
+    0x64,0xce,0xaa,0xf4,0x7c,0x0f,0x0d,0x48,0xf6,0x00,0xcd,0xd9,0xe8,0xcd,0xd3,0x98,
+    0x23,0x9a,0xc8,0xb2,0xcf,0xf6,0x2b,0x0c,0xc3,0x58,0xd4,0x90,0x72,0x75,0x8e,0xc8,
+    0x3a,0xb8,0xbc,0xec,0xdd,0x76,0x10,0x94,0x45,0x34,0xea,0x54,0x3a,0x6b,0x12,0xb0,
+    0x72,0x10,0x31,0xa5,0x34,0xa6,0xbc,0xa9,0x0b,0x38,0x47,0x59,0xc1,0x4e,0x31,0x14,
+    0x3c,0xaf,0x6c,0x8e,0x9a,0x6d,0xa2,0x14,0x65,0xc4,0x64,0x9c,0x43,0x6d,0xe4,0x68,
+    0x30,0x8e,0x9d,0x1c,0x43,0x42,0x30,0x2a,0x9e,0x8a,0xaa,0x9d,0x42,0x7b,0x88,0x9c,
+    0xf1,0x02,0x67,0x45,0x54,0x8a,0xba,0x5f,0xdd,0x2b,0xb1,0x50,0x46,0x66,0x85,0x33,
+    0x69,0x04,0x4b,0xbd,0xb4,0xf7,0x19,0x82,0x8e,0x6d,0x4a,0x94,0x88,0x82,0x0e,0x6a,
+    0xf5,0x8d,0x5a,0x67,0x59,0x31,0x6a,0x17,0x13,0xc2,0xda,0x7e,0x90,0xaf,0x6e,0x19,
+    0x96,0xc7,0x8d,0xde,0xec,0xa4,0x10,0xe9,0x5b,0xfc,0x44,0xde,0xa0,0x0a,0x57,0x0b,
+    0x97,0xba,0xcb,0x61,0xaf,0x74,0xee,0xcf,0x8e,0x6c,0xb6,0xa8,0xa9,0x2c,0x3d,0xb3,
+    0xae,0x5e,0x96,0x5f,0x33,0xa1,0x4c,0x57,0x0b,0x1a,0x92,0x27,0x99,0xa6,0xba,0xed,
+    0x99,0xae,0xba,0x7d,0x82,0xcd,0x75,0x91,0x8d,0x5c,0xd9,0xb4,0x91,0x3d,0x66,0x1b,
+    0x84,0xdd,0xb3,0x4d,0x84,0xfd,0x35,0x1d,0x0a,0x7d,0xb5,0xd8,0x12,0xfa,0x24,0xdd,
+    0x54,0xf9,0x86,0x0e,0x25,0xa6,0x10,0xaf,0x9d,0xa9,0x54,0x4b,0x52,0x7b,0xe0,0x1d,
+    0xb9,0xe2,0x94,0x5c,0x72,0x3a,0x8e,0xd7,0x0f,0xb1,0xfe,0xb0,0x71,0x10,0xb6,0x28,
+    0xa6,0xd3,0xe6,0x50,0x56,0x68,0x6e,0x99,0xb4,0xf0,0x6d,0xd0,0x74,0xea,0x19,0xb3,
+    0xbb,0x8a,0x91,0xac,0x77,0x46,0x8d,0x48,0x18,0x39,0x5a,0xed,0x08,0x30,0x0f,0x43,
+    0x7f,0xd8,0x94,0x4b,0x2c,0x18,0xda,0xde,0x3a,0x5c,0x1c,0x59,0x40,0xc2,0x8a,0xb6,
+    0x5f,0xef,0x6e,0xb7,0x9b,0x81,0x6e,0x11,0xb3,0x13,0xb4,0x9d,0x08,0xa5,0x44,0x19,
+    0xb9,0x37,0xc9,0x15,0x98,0xe4,0x7a,0x87,0xe2,0xc0,0xda,0xdb,0x62,0x33,0xcd,0xe1,
+    0x4f,0xe6,0xac,0xdf,0x45,0xa1,0x20,0x1f,0xe7,0xfa,0x90,0x8d,0x5d,0xe9,0x41,0x4a,
+    0xbd,0x9b,0x57,0xd8,0xb1,0xab,0x16,0x47,0x26,0xc7,0x0e,0xb8,0xc2,0xe9,0x7d,0x1b,
+    0xda,0x89,0x99,0x90,0x00,0x45,0xf8,0x69,0x5d,0xf4,0x7d,0x7f,0x4c,0x45,0xb7,0x73,
+    0xb2,0x9b,0x54,0x0c,0x6f,0xf6,0x36,0xdc,0x5e,0x5d,0x08,0x00,0x86,0x2d,0x31,0x45,
+    0xa6,0xab,0x6e,0x86,0x05,0xcb,0xc4,0x33,0x2a,0x73,0xb7,0x28,0x6a,0x27,0x74,0x46,
+    0x95,0xe9,0x1a,0x02,0x15,0x2f,0xc1,0x9c,0x4c,0x7d,0x28,0x1a,0x66,0xb9,0x8d,0xc5,
+    0xab,0x8c,0x57,0x78,0x90,0x23,0x7c,0xba,0x37,0xbc,0xf9,0x53,0x24,0xfe,0x16,0x49,
+    0xbc,0xf0,0x4a,0x02,0xd9,0x63,0x92,0xdf,0xde,0xd8,0x39,0x93,0x50,0xb2,0xc6,0x32,
+    0xbd,0x2d,0x56,0x61,0x5d,0x80,0xdb,0xc1,0xae,0x9d,0x4b,0x30,0x79,0x22,0xeb,0xcd,
+    0x05,0x27,0x95,0x8c,0x72,0x78,0x2d,0x71,0x37,0x8e,0x9c,0xaa,0x7d,0xb4,0x09,0xd1,
+    0xc7,0x96,0x6d,0x77,0x1b,0x99,0x16,0x6b,0xcb,0xe4,0x40,0x09,0xa7,0x7e,0xa0,0xe3,
+    0x12,0x62,0x1a,0x7a,0xef,0x87,0x83,0x12,0x53,0xd9,0x84,0xfd,0xad,0xe1,0x7e,0xf5,
+    0x77,0xbf,0xac,0xfe,0x3d,0x8d,0xaf,0x61,0xb0,0xc6,0x4c,0x05,0xe9,0x04,0x1f,0x64,
+    0xdd,0xb1,0xdd,0xab,0x11,0x37,0xae,0xef,0xe2,0xd4,0x21,0x8a,0x21,0x0f,0x27,0x99,
+    0x6f,0x92,0x9d,0x98,0x26,0x93,0xd9,0x9f,0xa4,0xab,0x63,0x70,0xbb,0xd4,0xbb,0xc9,
+    0xb7,0x31,0x9b,0x66,0x11,0x9b,0xf6,0x4e,0xca,0xd3,0xf1,0x9b,0x49,0x34,0x5e,0x57,
+    0x55,0x2e,0x2f,0x70,0xdd,0x77,0x5c,0xfd,0x2f,0xbc,0xac,0x85,0x54,0x50,0xa9,0xf8,
+    0x06,0xf1,0xda,0x73,0x79,0xf9,0xf4,0x24,0x2d,0xa8,0xa8,0xf5,0x2a,0xa4,0x16,0x57,
+    0x27,0x9d,0x02,0x5b,0x9a,0x14,0x6a,0x76,0x7b,0xca,0xdb,0xc9,0x76,0x0c,0xc7,0x16,
+    0x7e,0xb8,0xb4,0x69,0xae,0x35,0x14,0x4c,0x2a,0x3b,0x01,0xd9,0x8e,0xf7,0xad,0x8c,
+    0x9f,0x18,0x8d,0x95,0xa8,0xf1,0x62,0x69,0x12,0x8b,0xc4,0xd2,0xb8,0x05,0x89,0x7f,
+    0xda,0xbc,0xa2,0xda,0xd8,0x74,0xad,0x99,0xb1,0x69,0x49,0x29,0x76,0x52,0xb6,0xf1,
+    0xd6,0xe1,0x12,0x30,0xb3,0xc5,0x1b,0xef,0xc1,0xcb,0x40,0xac,0x24,0x5e,0x66,0x33,
+    0x21,0xcb,0xc8,0x7c,0xd3,0x3e,0xfb,0xef,0xab,0xdd,0x5d,0x36,0x4d,0x4b,0x17,0xd1,
+    0x38,0xcc,0xc2,0xf2,0xdf,0x58,0x0c,0x1a,0x16,0xa3,0x27,0x35,0x98,0x4d,0xb5,0xe0,
+    0xbd,0x7f,0x8f,0x2b,0x59,0x37,0x7b,0x71,0x6c,0xef,0x42,0x93,0xe5,0x6c,0x60,0x85,
+    0xdd,0xcf,0x95,0x3f,0xd7,0x4d,0x83,0x80,0x69,0xb3,0x00,0xcf,0x87,0x69,0x55,0x9a,
+    0x01,0xa6,0x98,0x3b,0xfc,0x39,0xef,0x61,0x90,0x78,0x04,0x9d,0x21,0x85,0x2d,0x10,
+    0x7f,0x5a,0xc4,0x67,0x88,0xfa,0x36,0xf0,0xa4,0xd1,0x64,0xbb,0x8d,0xe7,0x84,0x1a,
+    0x39,0xd8,0x92,0xf4,0xf3,0x18,0xff,0x47,0xd5,0x67,0x19,0x5a,0x34,0x5e,0x68,0x68,
+    0xea,0x86,0x6e,0x38,0x2b,0xc6,0x37,0x0e,0x66,0x1b,0x82,0xc7,0x3e,0xd6,0x8d,0xf9,
+    0xd2,0xcd,0xb6,0x97,0xee,0x27,0x54,0x1f,0x33,0xa4,0xfa,0xf2,0x3f,0x68,0xdb,0xd6,
+    0xba,0xf4,0x8d,0x7a,0xff,0x03,0xb5,0xf3,0xcd,0x66,0xaf,0x0d,0x00,0x00,
+};
+#define ASSET_URL_DASHBOARD_CSS "/static/dashboard.css?v=928045e1"
+
+// dashboard.js: 7196 bytes, 2742 gzipped
+static const uint8_t ASSET_DASHBOARD_JS[] PROGMEM = {
+    0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xad,0x59,0xeb,0x72,0xdb,0xb8,
+    0x15,0xfe,0xef,0xa7,0x60,0x94,0x49,0x40,0x8e,0x28,0xea,0xe2,0x4b,0xbc,0x92,0x29,
+    0x8f,0x9d,0xb5,0x9b,0x74,0x9c,0x38,0xb3,0x72,0x37,0xd3,0xd9,0xee,0x0f,0x90,0x04,
+    0x25,0xc6,0x14,0xc1,0x05,0x41,0xc9,0xaa,0xed,0xbf,0x7d,0x80,0x3e,0x49,0x9f,0xa1,
+    0x8f,0xd2,0x27,0xe9,0x39,0x00,0xaf,0xb6,0x9c,0x38,0x69,0xc7,0x33,0x16,0x09,0x9c,
+    0x73,0x70,0xf0,0x9d,0x2b,0xc0,0x28,0x34,0x49,0xc6,0xc4,0x2a,0xf2,0xd9,0x67,0x2e,
+    0xae,0x99,0x20,0x46,0x94,0x18,0x09,0x5d,0x45,0x73,0x2a,0xb9,0xb0,0x6e,0x77,0xaa,
+    0x67,0xa7,0x45,0xe7,0x08,0x36,0x8f,0x32,0xc9,0x84,0x49,0xfa,0xd9,0xda,0xf9,0x92,
+    0x11,0xcb,0xf1,0xa9,0xf4,0x17,0x26,0x73,0xa7,0x3e,0x4f,0x32,0x1e,0x33,0x27,0xe6,
+    0x73,0x93,0xcc,0x3e,0x1b,0x9a,0x56,0x50,0x19,0xf1,0xc4,0x08,0x69,0x14,0xb3,0x80,
+    0x58,0xd6,0x64,0xe7,0x7e,0x27,0xcc,0x13,0x5f,0x8d,0x66,0x0b,0xbe,0x3e,0x89,0x99,
+    0x90,0xa6,0xdc,0xa4,0xcc,0x5e,0xb2,0x2c,0xa3,0x73,0x66,0x07,0xb9,0xe6,0x72,0x77,
+    0x07,0x83,0x01,0x68,0x13,0x33,0x69,0x78,0x54,0xb8,0x01,0xf7,0xf3,0x25,0x4b,0xa4,
+    0x33,0x67,0xf2,0x2c,0x66,0xf8,0x78,0xba,0x79,0x1f,0x98,0x84,0xa2,0x8c,0x53,0x2a,
+    0x08,0x88,0x8f,0x42,0xf3,0x05,0x10,0x5b,0xb7,0x2d,0x0e,0x5f,0x30,0x2a,0x59,0xc1,
+    0x64,0x92,0x20,0x5a,0x01,0x2d,0x50,0x38,0x51,0xe0,0xd6,0xec,0x6a,0xc4,0x8f,0x69,
+    0x96,0x7d,0xa4,0x4b,0x56,0x4c,0xf4,0x3c,0x9c,0xa9,0x24,0x79,0x3c,0xd8,0x38,0x34,
+    0x4d,0x59,0x12,0xbc,0x5d,0x44,0x71,0x60,0xe2,0x62,0x93,0xfb,0x9d,0xa7,0x58,0x0d,
+    0xd2,0xc5,0xcd,0xe9,0xc5,0x92,0x84,0x89,0x77,0x57,0x1f,0x2e,0xdc,0x62,0xab,0x93,
+    0x9d,0xb6,0x5c,0x25,0xe0,0x02,0x60,0x73,0x68,0x50,0xee,0xab,0x47,0x01,0xac,0x15,
+    0xc3,0xbd,0x65,0x4c,0x5e,0x45,0x4b,0xc6,0x73,0x69,0x9a,0x96,0x3b,0xad,0x96,0xac,
+    0x39,0x10,0x51,0x62,0xd9,0x43,0xc0,0x4d,0x41,0x81,0x4b,0xbb,0xae,0x4b,0x12,0x2e,
+    0x96,0x34,0x26,0xd6,0xed,0x03,0x11,0xb7,0x6d,0x19,0x82,0x2d,0xf9,0x8a,0x95,0x62,
+    0x1e,0x2d,0xf8,0x94,0xb2,0x25,0x5b,0x5b,0x5f,0x7b,0x1f,0xb5,0xb8,0xaf,0xcc,0x59,
+    0xa2,0xc4,0x13,0x3f,0x8e,0xfc,0x6b,0x57,0xad,0x5f,0xe8,0xf8,0xa2,0xa1,0xe3,0x3a,
+    0x4a,0x02,0xbe,0x06,0x3f,0xf2,0x15,0x9b,0xb3,0x10,0x2c,0x74,0x49,0x7f,0xc9,0x93,
+    0x08,0x3c,0x92,0x4c,0xee,0xd1,0x87,0xfa,0x7d,0xe3,0x02,0x56,0x31,0x02,0x2a,0xe9,
+    0xd8,0x48,0x79,0x1c,0x1b,0x7d,0x9a,0x46,0xfd,0x18,0x07,0x69,0x12,0x18,0x29,0xfa,
+    0xa5,0x21,0x17,0xcc,0xf0,0xa9,0x08,0x32,0xf4,0xf0,0x34,0xa6,0x3e,0xab,0xbd,0x2f,
+    0x92,0x6c,0x69,0xc6,0xd4,0x63,0xb1,0xed,0xc7,0x99,0xbd,0xa2,0xb1,0x75,0x2b,0x98,
+    0xcc,0x45,0x62,0x74,0x8e,0xc0,0x43,0x0c,0xb5,0x41,0x97,0x20,0x1d,0x99,0x36,0x47,
+    0x14,0x13,0x99,0x76,0xba,0xea,0xa1,0xdb,0x39,0xea,0xc3,0x64,0x8b,0x02,0x84,0xe5,
+    0xac,0xd3,0x35,0x41,0xf0,0x31,0x01,0x17,0x80,0xdf,0x31,0x21,0x56,0xb7,0x83,0x5c,
+    0x30,0x59,0xf1,0xa8,0xff,0x1d,0x40,0x66,0x05,0xae,0x72,0x79,0x7e,0x7e,0xf1,0xfe,
+    0xe3,0x99,0xdb,0x5a,0x7e,0x45,0xa6,0xbd,0x5e,0x63,0x85,0x4c,0x6e,0x62,0x70,0xb0,
+    0x90,0x27,0xb2,0x97,0x45,0x7f,0x67,0xe3,0x81,0xf3,0x13,0x5b,0x4e,0x7c,0x1e,0x73,
+    0x31,0x7e,0x79,0x78,0x78,0x48,0xa6,0x97,0x61,0x18,0x47,0x09,0x2b,0x85,0x2b,0xd9,
+    0xb3,0xab,0x93,0xab,0xb3,0x99,0x7b,0x3b,0x18,0x77,0x8e,0xb2,0x94,0x26,0xa5,0x78,
+    0x8f,0x06,0x73,0xa6,0x58,0x8e,0xfa,0x38,0x3e,0xed,0xd8,0xa3,0x6d,0x24,0x06,0x4f,
+    0xc8,0x74,0x06,0x06,0x00,0xb7,0xad,0x28,0x77,0xb7,0x52,0xfa,0x0b,0x2a,0xe6,0x51,
+    0x32,0x27,0xd3,0xd3,0x3c,0xbe,0xae,0x88,0xf7,0xbe,0x41,0x7c,0xe2,0x65,0x5c,0xa4,
+    0x68,0x9a,0x8a,0x65,0xff,0x49,0x4d,0xce,0x63,0x4e,0x65,0x49,0x07,0x1e,0x51,0xe7,
+    0x14,0x26,0xdf,0x82,0xc1,0xcd,0x28,0xb0,0x63,0xb6,0x02,0xdb,0xa2,0xaf,0xda,0x99,
+    0x84,0xf0,0x87,0x54,0x82,0x48,0xf8,0x4f,0x26,0x92,0x28,0xb0,0x26,0x98,0x3f,0x7c,
+    0x4b,0xfb,0xc1,0x64,0xc7,0x6f,0xc6,0xb4,0x0f,0x86,0x54,0x32,0x35,0xa2,0x9e,0xeb,
+    0x3b,0x7f,0xe4,0x4c,0x6c,0x66,0x2c,0x66,0x3e,0x20,0x63,0x12,0x15,0x18,0x44,0x09,
+    0xf1,0xea,0x68,0x07,0xe7,0xc6,0x71,0xab,0x31,0xa4,0x06,0xb4,0x98,0x6c,0x8b,0x18,
+    0xa5,0xae,0x96,0x93,0xbd,0x7e,0x9d,0xb5,0x44,0x99,0x6a,0xf2,0xee,0x0e,0xdc,0xc9,
+    0x6a,0xcc,0xb8,0xd5,0x70,0x2b,0xc5,0x7a,0xcb,0xd5,0x05,0xaa,0x6c,0x7a,0xd6,0x2d,
+    0xae,0x26,0x5d,0xcf,0x91,0x72,0xae,0x92,0x83,0xe7,0x64,0xdc,0x3f,0x72,0x87,0x83,
+    0xbb,0x3b,0x53,0x4e,0x07,0xaf,0x5f,0xcb,0x23,0x48,0xb9,0x56,0xb1,0x79,0x83,0x00,
+    0x30,0x62,0xce,0x12,0x7f,0x43,0x9a,0xe4,0xa3,0x26,0xf9,0x41,0x83,0xdc,0x17,0x91,
+    0x8c,0x7c,0x88,0xe0,0x26,0xf5,0x7e,0x93,0x7a,0x38,0x6a,0x90,0xaf,0xa9,0x48,0x80,
+    0xb4,0x7c,0x85,0xb8,0xae,0xb5,0x4e,0x7d,0xa9,0xb5,0x4e,0xab,0x90,0x4c,0x51,0xd1,
+    0xe3,0x86,0x4e,0xe3,0x14,0x75,0x39,0xae,0x97,0xc5,0x81,0x7d,0x18,0x50,0x82,0xc7,
+    0x6d,0x81,0x10,0xc2,0xe9,0x0c,0x03,0xc7,0x0c,0xa2,0x30,0xb4,0x21,0x58,0x02,0xf0,
+    0x06,0x50,0x13,0x5f,0xa7,0x20,0xb9,0x52,0xcb,0xa3,0xfe,0xf5,0x5c,0xf0,0x3c,0x09,
+    0xc6,0x18,0x43,0x54,0xf4,0xe6,0x82,0x06,0x11,0x96,0x8d,0xe1,0xee,0x7e,0xc0,0xe6,
+    0xf6,0xcb,0x70,0x34,0xb2,0x5f,0x06,0x98,0xdc,0x8a,0xa0,0x0b,0xc3,0x50,0x6f,0x5a,
+    0x4b,0xdb,0xff,0x2e,0x61,0x87,0x03,0x10,0x76,0x50,0x0b,0x83,0x9a,0x57,0xc3,0x82,
+    0x8a,0x36,0xf7,0x11,0x8a,0x08,0x22,0xe0,0x14,0x72,0xe3,0x75,0x91,0xba,0xbc,0xb9,
+    0x0d,0x09,0x37,0xa7,0xb1,0x0d,0x9e,0x5f,0x6e,0xac,0x95,0xc6,0xca,0x84,0x11,0xb3,
+    0x9b,0xf1,0x70,0x22,0xd9,0x0d,0xa4,0xe8,0x38,0x9a,0x27,0x63,0x1f,0xf4,0x60,0x62,
+    0xd2,0x50,0xb2,0xd3,0xf5,0xe6,0xdd,0xce,0x24,0x85,0x5a,0x02,0x21,0x39,0x3e,0x4c,
+    0x6f,0x26,0x1e,0x17,0x01,0x13,0x3d,0x54,0x3b,0xcf,0x70,0x04,0x33,0xd8,0x4e,0xe7,
+    0x71,0x3a,0xdc,0x96,0x98,0xde,0xec,0x43,0x66,0x5a,0xaa,0x00,0xef,0x79,0x5c,0x4a,
+    0xbe,0x1c,0xef,0x69,0x09,0xad,0xcc,0xf9,0x50,0x20,0x5a,0xab,0xa7,0x52,0xe8,0x16,
+    0xa9,0x43,0x67,0x0f,0x84,0xaa,0xf7,0x35,0x8b,0xe6,0x0b,0x39,0xf6,0x10,0x24,0xbd,
+    0xca,0x78,0x94,0xde,0x18,0x83,0x6a,0x03,0xb0,0x98,0xf1,0x78,0x13,0x07,0x30,0x12,
+    0x44,0x19,0x94,0x83,0xcd,0x38,0x4a,0xd0,0x30,0x3d,0x0f,0x11,0x9d,0x74,0xba,0xb5,
+    0x9f,0x7c,0xa0,0x72,0xe1,0x50,0x2f,0x33,0x35,0xba,0x3d,0x40,0xd7,0xd2,0xf0,0xea,
+    0x24,0xae,0x87,0xbb,0x9d,0x7f,0xff,0xeb,0xed,0x57,0x36,0x01,0x5c,0x29,0x8f,0x12,
+    0xf9,0x34,0x3a,0x85,0xd5,0x29,0xa5,0x25,0x50,0x92,0xa7,0x1a,0xa5,0xff,0xfc,0xe3,
+    0x9f,0x46,0xa7,0x0b,0x22,0x1a,0xab,0xd4,0x05,0xa3,0xf2,0x09,0x01,0xad,0x08,0x13,
+    0x58,0x0d,0xcd,0xa0,0x48,0x71,0x9e,0x1b,0x38,0x10,0xf9,0x3a,0x10,0x75,0xe0,0xc7,
+    0x2b,0xb7,0x91,0x0b,0x74,0xea,0x81,0x44,0xe0,0x9a,0x2a,0x1f,0x60,0x80,0xaa,0x87,
+    0xa3,0xe1,0xde,0xde,0xc0,0x3a,0x56,0xbb,0x0f,0x63,0x0e,0xd9,0x48,0x0d,0xf7,0xc1,
+    0x41,0xbb,0x64,0x01,0x09,0x50,0xbf,0xbf,0x52,0xef,0x4b,0x08,0xb3,0x5e,0x8f,0xa8,
+    0x3e,0x41,0x25,0x5d,0x02,0x4b,0x10,0x3b,0x5e,0x41,0x1a,0xe2,0x0a,0x58,0x62,0xb7,
+    0x30,0x81,0x1e,0x51,0x82,0xd3,0xb5,0xab,0xe9,0x0a,0xea,0x64,0xbc,0x52,0x65,0x32,
+    0x5e,0xd5,0x55,0x52,0x25,0x10,0x47,0xf2,0xf3,0xe8,0x86,0x05,0x26,0x2c,0xd7,0x79,
+    0xf5,0xb8,0xce,0xce,0x21,0x1e,0x94,0x43,0xaa,0x62,0x4e,0x7e,0xe5,0xb1,0x84,0xfa,
+    0x44,0x6c,0xb2,0x2a,0x9f,0x3c,0x67,0x55,0x09,0x19,0x81,0xce,0xbf,0x82,0x7c,0x4d,
+    0xfc,0x36,0x17,0x02,0x95,0xb1,0x89,0x5f,0x3e,0x79,0x0e,0x6d,0x11,0x9f,0x54,0xc4,
+    0xd8,0x06,0x01,0xd2,0x4b,0x1a,0x25,0x58,0xac,0x6c,0x42,0x6c,0x80,0xa1,0x12,0x05,
+    0xbd,0x2f,0x54,0x94,0x40,0x8d,0x83,0x90,0x45,0x25,0x65,0x88,0x52,0x16,0xb8,0xa7,
+    0x96,0xfd,0xb0,0x17,0x62,0x71,0xc6,0x8c,0x36,0x72,0x84,0xeb,0xca,0x4d,0xec,0xa2,
+    0x15,0x28,0x0c,0xb5,0x04,0x7b,0x2e,0xd3,0x54,0x2a,0x83,0x2e,0xad,0x8a,0x09,0xc7,
+    0x90,0xeb,0xf9,0x58,0x23,0x58,0x4b,0x67,0xdd,0xed,0x7c,0xfe,0x11,0x30,0x97,0xdf,
+    0x03,0xe6,0xf2,0x49,0x30,0xff,0x1a,0xb1,0x38,0x30,0x24,0x0f,0xe8,0x06,0x18,0x52,
+    0xbe,0x86,0x23,0x08,0x90,0x5f,0xaf,0x17,0x2d,0x86,0xeb,0xcf,0x8f,0x81,0x03,0x32,
+    0x55,0xe8,0x5c,0x77,0x74,0x4c,0xc8,0x58,0x77,0x35,0xbf,0x15,0x83,0xbf,0x03,0x5c,
+    0x6d,0x54,0x4b,0x80,0xb6,0xc3,0x9a,0x02,0xac,0x51,0x3a,0x1a,0x29,0x58,0xd3,0x1a,
+    0x56,0x1c,0xfb,0x7e,0x58,0x53,0x67,0xdd,0x72,0xd7,0x1f,0x42,0x38,0xfd,0x1e,0x84,
+    0xd3,0x2d,0x08,0x9b,0xa9,0x83,0x99,0x67,0x3a,0x38,0x2e,0x1c,0x17,0x5e,0x80,0x47,
+    0xaa,0x1f,0x3d,0xd7,0xd4,0x92,0x40,0x66,0x21,0x96,0x8e,0xba,0x36,0xd0,0x05,0xb4,
+    0xe9,0x53,0xd0,0x96,0x20,0x6d,0x87,0x96,0x01,0xb4,0xcc,0xe7,0x90,0x42,0xd6,0x0a,
+    0x5d,0xa6,0xb3,0x10,0x8b,0xdd,0xaa,0xb6,0x33,0x07,0x1e,0xad,0x46,0xf2,0x28,0xe8,
+    0x89,0xcd,0xe2,0xef,0x4e,0x20,0x2c,0x56,0x09,0x84,0xc5,0x75,0x02,0x51,0xf2,0x9f,
+    0x93,0x35,0x7e,0x99,0xcd,0xde,0x37,0x61,0x65,0x8e,0xc8,0xb2,0xa8,0x4b,0x8c,0xe0,
+    0x74,0x89,0x88,0x32,0x3c,0x05,0x47,0x34,0x3e,0x7e,0xde,0xb1,0x60,0xa6,0x88,0x9f,
+    0x38,0x13,0x6c,0x2d,0x04,0x87,0x28,0x09,0x15,0xd6,0xeb,0x3c,0xb0,0xc4,0x16,0xe3,
+    0x3c,0x4e,0x1f,0x15,0x76,0x4f,0x19,0x24,0x04,0x83,0xe8,0xee,0x41,0xd9,0x23,0xd4,
+    0xf6,0xc0,0x86,0xc5,0x55,0xc9,0x7e,0x49,0x6f,0xea,0x9a,0x17,0x3a,0x31,0x0b,0xe5,
+    0x89,0xae,0x7c,0xfa,0x65,0x86,0xf5,0xaf,0x41,0x20,0xb0,0xf4,0x56,0x14,0xea,0x0d,
+    0x49,0x4a,0xf3,0xfb,0xdc,0x0d,0xd1,0x01,0x1a,0xe6,0xd5,0xab,0x13,0xbb,0x6c,0xb9,
+    0x9a,0xad,0x5b,0xd1,0x38,0x55,0xcd,0xdb,0x56,0xe3,0x6b,0x01,0xba,0x56,0x67,0x15,
+    0x90,0x65,0x25,0xc7,0xfe,0x66,0x32,0xa7,0xa9,0xea,0x5a,0xbe,0xe4,0x99,0x8c,0xc2,
+    0x4d,0xaf,0xf0,0x97,0x31,0x9c,0x13,0x7c,0xe0,0x64,0x72,0xcd,0x58,0xa2,0x4c,0xdf,
+    0xec,0xa4,0xc8,0xc5,0xd9,0xf9,0x15,0x40,0x27,0xe6,0x1e,0x35,0xdf,0xfc,0x64,0x8f,
+    0xf6,0xf6,0x6c,0xf8,0x19,0x38,0x83,0x7d,0x8b,0xd8,0x4d,0x30,0xec,0x0a,0x0c,0xfb,
+    0x39,0xcd,0xdd,0x1e,0x0d,0xed,0x97,0xa3,0xc3,0xa0,0xd5,0xdc,0x59,0x0f,0x16,0xff,
+    0xe5,0xfd,0x9f,0xde,0x55,0xab,0x1f,0x1c,0xda,0xc3,0x37,0x03,0x7b,0xb4,0xbf,0x5f,
+    0x2f,0xdf,0x80,0xda,0xae,0xa1,0x7e,0x96,0x02,0x03,0x68,0x76,0x5f,0x0e,0x82,0x47,
+    0x0a,0x3c,0xaf,0x33,0xfc,0x6a,0x1f,0x38,0xc1,0xa8,0xf3,0xf9,0xf1,0x73,0xd4,0x18,
+    0x1d,0x42,0xc7,0x3c,0x3c,0x18,0x5a,0x60,0xda,0x06,0x39,0x34,0xbf,0xf8,0x57,0x06,
+    0x6c,0xbb,0x7f,0x8a,0xc0,0x76,0xda,0xd6,0x5b,0x9b,0xc0,0xc3,0x47,0x9d,0xe5,0x08,
+    0x7b,0xa6,0xbf,0xe5,0xb7,0xc3,0xf3,0xdd,0xbd,0xdd,0xfb,0xed,0x4d,0x99,0x12,0xfa,
+    0x74,0xbf,0x7a,0xb8,0xff,0xa0,0xb5,0x3c,0x18,0x0c,0xaa,0x7d,0x16,0x08,0xee,0x85,
+    0x7b,0xb0,0x8b,0xe2,0x65,0x77,0x77,0x57,0x6b,0x7f,0xf6,0xf6,0xf2,0x2b,0x2b,0x62,
+    0x0a,0xcd,0xb3,0xed,0x4d,0x20,0xac,0xf8,0xb5,0x15,0x0e,0x0e,0x0e,0x4a,0x7c,0x34,
+    0xd1,0xe5,0x47,0x98,0x84,0xd8,0x7e,0x94,0x14,0x9e,0x6b,0xd5,0xa6,0x01,0x46,0x50,
+    0xfc,0xbe,0xb3,0xdb,0xff,0x1f,0xec,0xb2,0x3f,0x38,0xfd,0x3f,0xda,0xa5,0x44,0x8b,
+    0x86,0x64,0x7a,0x7a,0x72,0xf5,0xe3,0xf0,0xd7,0x2d,0xb8,0x42,0x39,0x74,0x3c,0x2a,
+    0x5d,0x17,0xf2,0xd3,0x05,0x19,0x17,0x2f,0xc3,0x63,0xf2,0x01,0x60,0x7f,0xf7,0x10,
+    0xf4,0x27,0xf3,0x71,0x99,0xec,0xb6,0xa5,0x63,0xdd,0xb0,0x9f,0x73,0x8e,0x37,0xa9,
+    0x56,0x71,0x9b,0x75,0x32,0xd7,0xf7,0x56,0x79,0x2a,0xb1,0xd5,0xbc,0x66,0x2c,0x85,
+    0xd3,0x5f,0x9e,0x48,0x30,0x8d,0x51,0x24,0x2e,0x98,0x0c,0xa0,0x16,0x67,0x0f,0x7b,
+    0xff,0x52,0x94,0x3a,0xd1,0xe2,0x0d,0x98,0x93,0x5e,0xcb,0xcc,0x75,0x5d,0xb0,0x31,
+    0x0b,0x61,0xf5,0xa0,0xba,0xd0,0x50,0x37,0x0e,0x51,0xe2,0x33,0xb7,0xd1,0xe2,0x9b,
+    0x3f,0x83,0x54,0x27,0xe1,0x6b,0xd3,0xea,0x21,0xfb,0x89,0xb4,0xfa,0x43,0xbc,0x7b,
+    0xb5,0xa1,0x27,0x71,0x95,0x40,0x78,0xe8,0x2a,0x3e,0x3b,0x4f,0xf5,0x48,0x9e,0xea,
+    0x01,0x2d,0x13,0x5a,0xb9,0xac,0x29,0x32,0x4f,0xfb,0x87,0x07,0x7b,0x28,0x62,0xc1,
+    0x73,0xd1,0x9a,0x82,0xb9,0x57,0x7a,0xae,0xbf,0x7b,0xa0,0x2e,0x2a,0x9f,0xbc,0xd8,
+    0x0d,0xd5,0xc6,0x88,0xa5,0xaf,0x39,0xae,0xc0,0x95,0x5d,0xf2,0x09,0xb6,0x36,0xc6,
+    0xb3,0x42,0xb9,0x4f,0x28,0xd4,0x77,0x78,0x30,0xc1,0x8b,0xa9,0x83,0xc1,0x31,0x6a,
+    0x4a,0x32,0x32,0x6e,0xac,0x08,0x43,0xfd,0xe2,0xc0,0x62,0x29,0xea,0xbf,0xa4,0x28,
+    0xc1,0x44,0xa5,0xa1,0x51,0xc2,0x9f,0x2e,0x09,0x0c,0xa2,0x2a,0xad,0xd2,0x17,0xce,
+    0x3a,0xa4,0x30,0xcc,0x07,0xbc,0x70,0x30,0xa8,0x11,0xe6,0x71,0x6c,0x64,0x09,0x4d,
+    0xb3,0x05,0x97,0x06,0x17,0x60,0x2d,0xa3,0x0f,0x8d,0x4c,0x22,0x33,0x23,0x60,0xd0,
+    0xbe,0x19,0x70,0xce,0xe3,0xfa,0xc6,0x51,0x77,0x12,0x86,0xea,0x9c,0x14,0x3c,0xa8,
+    0xac,0x7b,0x7b,0x6f,0x6b,0x74,0xdd,0x41,0xe3,0xc2,0x8a,0xa6,0x69,0xbc,0xa9,0x4e,
+    0x6f,0x21,0xa8,0x8b,0x0c,0xd7,0x78,0x61,0x59,0xde,0x51,0xfc,0x76,0xfd,0xfb,0xeb,
+    0xd7,0x78,0x4d,0xca,0x43,0x03,0x5f,0xf0,0x46,0x97,0x7b,0x5f,0x98,0x2f,0x89,0x85,
+    0x12,0x71,0xe8,0x52,0xbd,0x3b,0xe0,0xf4,0x10,0xea,0x66,0x31,0x7a,0x77,0x07,0x6b,
+    0x22,0x47,0xd9,0xbd,0x95,0xd4,0x38,0x86,0xfb,0x2b,0xf4,0xa9,0xed,0x3f,0x69,0x9c,
+    0x26,0x71,0x52,0xb9,0x67,0xb9,0x83,0xd3,0x3c,0xdb,0xb8,0x21,0x05,0x41,0x93,0xa6,
+    0x0b,0x86,0x82,0x65,0x0b,0xc5,0x51,0x7b,0x20,0x92,0x96,0x4e,0x57,0xb1,0x4a,0x91,
+    0x23,0x27,0xc3,0x2f,0x06,0xa4,0xba,0xae,0x25,0xf6,0xad,0x4f,0xfd,0x05,0x1b,0x93,
+    0x84,0x43,0xa8,0x72,0xc1,0xc8,0xbd,0xe5,0x00,0x8e,0x89,0x29,0xdc,0xa9,0x70,0xbe,
+    0x64,0x3c,0x31,0xad,0x62,0xa4,0x42,0xab,0xf1,0xe5,0xe1,0x16,0xc8,0xc1,0xcb,0x69,
+    0x1c,0x6f,0xf4,0xa5,0xf6,0x03,0x5d,0xef,0xcb,0x18,0xfb,0x04,0xba,0x32,0xa1,0x4c,
+    0x54,0x5a,0x2e,0xcd,0xb3,0x05,0xd8,0x49,0x30,0xba,0x9c,0xe8,0x6b,0xe4,0x28,0x34,
+    0x22,0x49,0x32,0x23,0x4f,0xe8,0x8a,0x46,0x90,0x93,0x62,0x86,0xd6,0x46,0x26,0xfc,
+    0x18,0x02,0xfc,0x51,0xa6,0x9c,0x41,0x1f,0x21,0x80,0x05,0xcf,0x86,0xc2,0x4d,0x60,
+    0xa8,0x79,0x0f,0x29,0xa9,0x90,0x9f,0x60,0x16,0xe2,0x17,0x70,0xc1,0x6b,0xc5,0x8a,
+    0x16,0x2f,0xb5,0x1a,0xa0,0x4d,0x6a,0x21,0x90,0x3f,0xde,0x63,0x92,0x86,0x5e,0xd1,
+    0x6c,0xd0,0xd8,0xa3,0x81,0xba,0x4b,0xbf,0x7f,0x20,0xbf,0x01,0xfa,0x8b,0xe2,0xda,
+    0xfc,0x0c,0xf7,0x35,0x03,0x1f,0xf6,0xa1,0xe5,0x6e,0x2b,0x31,0x29,0xec,0xa1,0x0d,
+    0xca,0x32,0x37,0x61,0x6b,0xa3,0x41,0x0f,0x36,0xd1,0xa8,0xe0,0xd5,0x3f,0xcb,0x1c,
+    0x9e,0x14,0x9f,0x29,0xdc,0x72,0x55,0x6c,0xe3,0x6b,0x7f,0xfd,0xf3,0xec,0xf2,0xa3,
+    0x93,0x52,0x91,0x31,0x68,0x91,0xf1,0x22,0x1e,0xba,0xbf,0xfb,0x82,0x93,0x09,0xc1,
+    0x45,0xcd,0xa7,0x00,0x80,0x09,0xc0,0x39,0xd8,0xcc,0xf4,0x01,0xce,0x6d,0x2c,0xed,
+    0xbc,0xbd,0xb8,0x9c,0x9d,0xfd,0x6c,0x3d,0x50,0x58,0x5d,0xf5,0x17,0x1b,0x83,0x96,
+    0x90,0xd3,0xa0,0x29,0x72,0xa7,0x81,0xc1,0xa4,0x8d,0x5c,0x9d,0x15,0x6d,0x95,0xc8,
+    0x26,0xea,0x23,0x52,0x94,0x7d,0xd4,0x1f,0xb6,0xf0,0xe3,0xd2,0x8b,0x2a,0xeb,0x28,
+    0xaf,0x10,0x4c,0xdc,0xdd,0x3d,0x1a,0x82,0xc4,0x13,0xb0,0x9b,0xcb,0xd0,0x7c,0xf8,
+    0x51,0x82,0x43,0x1b,0x16,0x25,0x96,0xeb,0xf6,0x86,0x5f,0x63,0xab,0x3f,0x5b,0x58,
+    0xd3,0x6f,0x51,0x16,0x25,0xe3,0xdb,0x84,0x51,0x82,0xc0,0x71,0xb1,0x51,0xb4,0xfa,
+    0x93,0x57,0x73,0x6b,0x55,0xb2,0x87,0x09,0xf5,0x49,0xe6,0x0a,0x52,0x87,0x55,0x7f,
+    0x6c,0xab,0xc6,0x6c,0xf5,0xf4,0x41,0x1b,0x19,0x83,0x64,0xb2,0xf3,0x5f,0x19,0xe1,
+    0x3d,0x2e,0x1c,0x1c,0x00,0x00,
+};
+#define ASSET_URL_DASHBOARD_JS "/static/dashboard.js?v=49c416b4"
+
+// fridge.css: 2407 bytes, 858 gzipped
+static const uint8_t ASSET_FRIDGE_CSS[] PROGMEM = {
+    0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xb5,0x55,0xcb,0x8e,0x9b,0x30,
+    0x14,0xdd,0xe7,0x2b,0x90,0x46,0xd5,0xcc,0x54,0x21,0x02,0x42,0x32,0x8c,0xd9,0xb4,
+    0x5d,0x54,0xea,0xa2,0xab,0x51,0x3f,0xc0,0x80,0x4d,0xdc,0x80,0x8d,0x8c,0x69,0x92,
+    0x41,0xf9,0xf7,0x5e,0x83,0x9d,0xf0,0xc8,0x8c,0xaa,0x91,0xaa,0x2c,0x1c,0xe0,0xbe,
+    0xcf,0xb9,0xc7,0x9f,0x5b,0xf7,0x40,0x92,0x3d,0x53,0xae,0x12,0x4d,0xba,0x73,0x53,
+    0x5c,0x14,0xa2,0x51,0x88,0x0b,0x4e,0x62,0xfb,0xa9,0xa9,0x89,0x74,0x6b,0x52,0x90,
+    0xd4,0x7c,0x98,0xbe,0x38,0x2f,0x12,0x91,0x9d,0xda,0x04,0xa7,0xfb,0x5c,0x8a,0x86,
+    0x67,0xe8,0xce,0xf3,0xbc,0x38,0x15,0x85,0x90,0xe8,0x8e,0x52,0x1a,0x53,0xc1,0x95,
+    0x4b,0x71,0xc9,0x8a,0x13,0x72,0x71,0x55,0x15,0xc4,0xad,0x4f,0xb5,0x22,0xe5,0xf2,
+    0x5b,0xc1,0xf8,0xfe,0x27,0x4e,0x5f,0xba,0xc7,0xef,0x60,0xb7,0xbc,0x7f,0x21,0xb9,
+    0x20,0xce,0xaf,0x1f,0xf7,0xcb,0xaf,0x92,0xe1,0x62,0x59,0x63,0x5e,0x43,0x3e,0xc9,
+    0x68,0x5c,0x62,0x99,0x33,0x8e,0xbc,0xb8,0xc2,0x59,0xc6,0x78,0x8e,0x7c,0xaf,0x3a,
+    0x9e,0x17,0xb8,0x35,0xc9,0x42,0x4c,0x63,0x45,0x8e,0xca,0xcd,0x48,0x2a,0x24,0x56,
+    0x4c,0xf0,0xbe,0x66,0x6b,0x1f,0x55,0x47,0xc7,0xdf,0x56,0xc7,0x78,0x58,0x6d,0x10,
+    0x04,0x71,0x22,0x64,0x06,0x6d,0x49,0x9c,0xb1,0xa6,0x46,0x21,0x58,0x64,0xac,0xae,
+    0x0a,0x7c,0x42,0x8c,0x43,0x8d,0xc4,0x4d,0x0a,0x91,0xee,0x6d,0x01,0x1b,0x9d,0x75,
+    0xf5,0x0a,0x91,0x5b,0x6b,0x46,0x0b,0x72,0x8c,0x73,0x5c,0x75,0x25,0x59,0x3b,0x1f,
+    0x0c,0x1d,0x4f,0x9b,0xa6,0x58,0x66,0xad,0xb6,0x41,0xfe,0xb5,0xf8,0x8d,0x2e,0x64,
+    0x94,0xb8,0x73,0xee,0x3a,0xc0,0x05,0xcb,0x39,0x4a,0x09,0x57,0x44,0xc6,0x69,0x23,
+    0x6b,0xe8,0xaf,0x12,0xac,0x7b,0xec,0x7d,0x50,0x00,0xc1,0x6b,0x51,0xb0,0xcc,0xb9,
+    0x0b,0xc3,0xd0,0x66,0x59,0x01,0x34,0x23,0x30,0x7c,0xac,0x7f,0x43,0x3c,0x4c,0xce,
+    0xeb,0xd0,0x2e,0xbe,0x0d,0x9f,0x7a,0xd3,0x48,0xff,0xac,0xf7,0x7a,0xbd,0x9e,0x78,
+    0x67,0x59,0xa6,0xbd,0x01,0xbd,0xaa,0xed,0x70,0xae,0xd9,0x2b,0x41,0x01,0x29,0x7b,
+    0xd4,0x0f,0x84,0xe5,0x3b,0x85,0x12,0x51,0x64,0x76,0x28,0xa1,0x9d,0x49,0x81,0x13,
+    0x48,0x76,0x75,0xf2,0x56,0xd1,0x06,0xfc,0x4c,0xe0,0x28,0x8a,0x8c,0x87,0x9b,0x08,
+    0xa5,0x44,0x89,0xb6,0xdd,0xd4,0x6b,0x68,0xb8,0x4b,0xcf,0x15,0x06,0x60,0x64,0x6b,
+    0xc2,0x06,0x9e,0x89,0x6b,0x0c,0x0e,0x12,0x98,0x06,0x9f,0x2b,0x51,0xb3,0x8e,0x08,
+    0x92,0x14,0xc0,0x88,0x3f,0x64,0x04,0xce,0xda,0x1b,0x04,0x6d,0x0f,0x2c,0x53,0x3b,
+    0x00,0xc1,0xfb,0x14,0xef,0xfa,0xc2,0xfd,0x60,0x86,0xd1,0x84,0x3e,0x9a,0x1d,0x58,
+    0xba,0xb9,0xfe,0x0a,0x68,0x3d,0x28,0xe1,0x48,0xed,0xba,0x84,0x2d,0x48,0x60,0xda,
+    0xfa,0xa4,0xf4,0x09,0x4e,0x78,0xa0,0x9e,0xa7,0x4f,0xbc,0xe9,0xcf,0x10,0xce,0xc7,
+    0xcb,0xa6,0xe9,0x7a,0xb1,0xc4,0x3c,0x25,0x3d,0x69,0x61,0x15,0x75,0x70,0xb3,0x64,
+    0xa6,0x46,0x84,0xac,0xb9,0xe9,0x53,0xed,0x9a,0x32,0x69,0xdf,0x8a,0xd1,0x77,0x14,
+    0x6a,0x5a,0x99,0x8e,0xba,0xff,0xef,0x76,0x64,0x19,0x63,0x68,0xb6,0x1e,0xd0,0x0c,
+    0xf6,0x6b,0xc2,0xc5,0xd9,0x78,0x87,0x95,0x96,0xe2,0x15,0x72,0xf0,0x9c,0x98,0x2a,
+    0xff,0x77,0x35,0x90,0x5b,0x13,0xd1,0x35,0x4b,0xd9,0xce,0x37,0xe9,0xca,0x36,0x7f,
+    0x15,0x01,0xd9,0x2c,0x17,0x3a,0xf2,0xcc,0x28,0x6b,0xe3,0x75,0x4c,0xad,0xc7,0xbb,
+    0xfe,0xbb,0xa9,0x15,0xa3,0xa7,0x8e,0x88,0x10,0x1b,0xd5,0x15,0x4e,0x41,0x26,0x88,
+    0x3a,0x10,0xc2,0xe3,0x7f,0x60,0xb5,0x12,0x95,0x11,0x12,0x25,0xf2,0x1c,0x34,0x51,
+    0x8a,0xc3,0xfb,0x72,0x12,0x74,0x72,0x32,0xcb,0xdc,0xb7,0xa6,0xe3,0x24,0x8a,0xb7,
+    0x43,0x75,0x71,0x82,0x1b,0x12,0x73,0x65,0xf4,0x44,0x41,0xa6,0xd0,0xce,0xa7,0x57,
+    0x42,0xd9,0x3d,0x86,0x51,0xbf,0x37,0x3a,0xe3,0x4a,0xf0,0x0f,0xe8,0x4d,0xef,0x49,
+    0xe9,0x07,0xc4,0x86,0x41,0xe3,0xed,0x10,0xc8,0xcd,0x05,0x48,0x2b,0x15,0x66,0xae,
+    0x37,0x14,0x86,0x94,0xf0,0x81,0x32,0x4e,0xc5,0x58,0x38,0x26,0xaa,0x3c,0xec,0xc7,
+    0xf7,0x27,0x23,0x84,0x5b,0x64,0x04,0xf0,0x33,0xe4,0xbf,0x21,0xda,0x17,0xc4,0x75,
+    0x46,0xdd,0xaa,0x25,0x1b,0x29,0x9d,0xeb,0xfd,0xb8,0xdd,0x8e,0x48,0xe9,0xdf,0x8a,
+    0x75,0x5e,0x7c,0x29,0x49,0xc6,0xf0,0xc3,0x15,0x80,0xa7,0x2d,0x54,0xf1,0xd8,0xf6,
+    0x77,0xef,0x18,0xf3,0x9e,0x31,0x47,0x63,0xf8,0xec,0x0d,0x18,0xe4,0x39,0xb8,0x51,
+    0x42,0xdf,0x98,0xc3,0x1b,0xd4,0xf1,0xc7,0x1d,0xf9,0xdd,0x90,0xfa,0x3b,0xeb,0x62,
+    0x17,0xf5,0x77,0xde,0x54,0xe8,0xcd,0x44,0x67,0x62,0xde,0xc7,0x30,0xba,0x6a,0x97,
+    0x7d,0x33,0x10,0xdb,0x37,0x84,0xcc,0x74,0x37,0x90,0x88,0x27,0x6f,0xec,0x75,0x5b,
+    0x54,0x6e,0x78,0x8c,0xa4,0x60,0x58,0x72,0x30,0x58,0x7c,0x7b,0x43,0x0f,0xf7,0x7c,
+    0xda,0xc5,0x78,0xaf,0xb6,0x7a,0xc6,0xb7,0x06,0x36,0xe3,0xe5,0x56,0xbf,0x3e,0x2f,
+    0xfe,0x02,0x15,0x34,0x79,0x9e,0x67,0x09,0x00,0x00,
+};
+#define ASSET_URL_FRIDGE_CSS "/static/fridge.css?v=bf683500"
+
+// fridge.js: 4413 bytes, 1592 gzipped
+static const uint8_t ASSET_FRIDGE_JS[] PROGMEM = {
+    0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xa5,0x57,0x5d,0x6e,0xdb,0x46,
+    0x10,0x7e,0xf7,0x29,0x36,0x08,0xe0,0x25,0x41,0x99,0x92,0x1c,0x17,0x28,0xc4,0xd2,
+    0x46,0xac,0xb8,0x68,0x50,0x27,0x29,0x12,0x07,0x05,0x6a,0xf8,0x61,0x4d,0x2e,0x25,
+    0xc6,0x2b,0xae,0xb0,0xbb,0xb4,0xac,0x28,0xba,0x48,0x9f,0x7a,0x84,0x9e,0xa1,0x47,
+    0xe9,0x49,0x3a,0xb3,0x4b,0x52,0x94,0x2c,0xc9,0x49,0xfa,0x22,0xed,0xef,0xec,0x37,
+    0x33,0xdf,0xfc,0x30,0x2b,0x8b,0xc4,0xe4,0xb2,0x20,0x9a,0x0b,0x9e,0x98,0x3f,0x64,
+    0xc1,0xbd,0xcf,0xf0,0xe3,0x2f,0x92,0x52,0x29,0x5e,0xd8,0x95,0x18,0x57,0xa2,0x72,
+    0x9a,0x32,0xc3,0x5f,0xe5,0x7a,0x2a,0xd8,0xdc,0xf3,0xa3,0xe5,0x41,0x56,0x5f,0x76,
+    0x5b,0x57,0x7c,0x32,0xf5,0xee,0x99,0xf0,0x17,0x79,0xe6,0xb5,0xaf,0xc7,0x54,0xf0,
+    0xcc,0x50,0x7f,0x81,0x7f,0x78,0x2a,0x9e,0x32,0xa5,0xf9,0xeb,0xc2,0xd8,0xe3,0xd1,
+    0x92,0x0b,0xcd,0x17,0x2a,0x1f,0x8d,0xb7,0xee,0xee,0x79,0x98,0xa5,0x9f,0x4a,0x6d,
+    0x2f,0x79,0x29,0x17,0x86,0xf9,0x8b,0x7b,0xa6,0x48,0xc1,0x67,0xb8,0x14,0xed,0x82,
+    0x51,0xed,0xc7,0x6f,0x98,0x19,0x87,0x13,0xf6,0xe0,0x1d,0x1d,0xf7,0x3a,0x6e,0x92,
+    0x17,0x1e,0x8c,0x6b,0x9c,0x81,0x13,0xea,0x47,0x0d,0xf0,0x5a,0xb4,0x83,0xfc,0xa4,
+    0xa0,0x46,0xa7,0x46,0xd2,0x4a,0xcb,0x46,0xd4,0x93,0x86,0x6d,0xb6,0x16,0xa9,0x4c,
+    0xca,0x09,0xe8,0x13,0x8e,0xb8,0xb9,0x10,0x1c,0x87,0xe7,0xf3,0xd7,0xa9,0x67,0x35,
+    0x1b,0x32,0x95,0x52,0x3f,0x4c,0x04,0xd3,0xfa,0x2d,0x9b,0xf0,0x78,0x8b,0xf2,0x67,
+    0xf4,0x73,0x02,0xc7,0xd0,0xdd,0x74,0x50,0x8d,0xcb,0x02,0x67,0xd1,0xc1,0x4e,0xe1,
+    0x16,0xf3,0x13,0xd2,0xed,0x99,0xbd,0xe2,0xd1,0x33,0x06,0x15,0xdf,0x06,0xab,0x36,
+    0xf0,0xa0,0xb1,0x4f,0xb4,0x13,0x8e,0x16,0x79,0xca,0x15,0x60,0x01,0x7a,0x94,0x3c,
+    0x36,0x7b,0x0f,0xe3,0x2e,0xda,0x0f,0x8e,0xe7,0x45,0xc1,0xd5,0x15,0x7f,0x30,0xf6,
+    0x4a,0x40,0xff,0xf9,0x7b,0x48,0xdb,0xc6,0xd6,0xdc,0x31,0xc9,0x91,0x08,0x39,0xbf,
+    0x15,0x6a,0x6f,0xd0,0x8f,0xbe,0x55,0x97,0x03,0x3d,0x96,0xb3,0x0f,0x86,0x99,0x52,
+    0x7b,0xf4,0x03,0x37,0x26,0x2f,0x46,0x56,0x00,0x57,0xb0,0xa6,0x78,0x18,0x86,0xd4,
+    0x8f,0x10,0x40,0x3e,0xe1,0xb2,0x34,0x5e,0x0d,0x0a,0xc0,0xcc,0xf2,0x22,0x95,0xb3,
+    0x50,0xc8,0x84,0xe1,0x4a,0x38,0x56,0x3c,0x8b,0x69,0x37,0x53,0x79,0x3a,0xe2,0xdd,
+    0x64,0x92,0x9e,0x59,0xa8,0x34,0xc0,0xbf,0x80,0x1e,0x5a,0x5c,0x34,0xb0,0x66,0x59,
+    0x76,0xfa,0xbd,0xde,0x1a,0xa3,0x8c,0x1c,0x8d,0x04,0xbf,0x48,0x24,0x48,0xe6,0x89,
+    0x44,0x4c,0x3c,0x6e,0x06,0x31,0xed,0x83,0x0f,0x7b,0xe0,0xbb,0x3e,0xdd,0x6d,0x53,
+    0x38,0x7e,0x6e,0x8a,0x35,0x32,0x50,0x73,0x6b,0x0a,0x42,0x03,0x6f,0x43,0x94,0x2c,
+    0x40,0x96,0xcc,0x32,0xea,0x6f,0x58,0xda,0x21,0xd8,0x66,0x96,0x8b,0xe1,0x3b,0x32,
+    0x91,0xe9,0xff,0xb0,0x09,0x60,0x38,0xd3,0x16,0x04,0x0d,0x6a,0x3c,0x5b,0x4c,0xe1,
+    0x52,0xde,0x39,0x33,0x9e,0xe0,0xf7,0x1c,0xd2,0xd6,0x2d,0x33,0x97,0x38,0x8a,0xed,
+    0x7c,0xb7,0xfe,0x78,0x6e,0xbb,0xf6,0xf6,0x62,0x1c,0xf7,0xd6,0x14,0x3f,0xd8,0x27,
+    0xe8,0xcd,0x5e,0x41,0xfd,0xaf,0x17,0xf4,0xcb,0x5e,0x41,0xc7,0x7b,0x5c,0x81,0x16,
+    0xd8,0xee,0x0a,0x10,0x6b,0xb8,0x9a,0x93,0xa9,0x92,0x86,0xdb,0xf3,0xdf,0xef,0x94,
+    0x4a,0xd6,0x99,0x03,0x44,0x83,0xda,0xd8,0xdb,0x1c,0xb3,0x82,0x32,0xd1,0xa3,0x4e,
+    0x22,0x85,0x54,0x2e,0x28,0x75,0xbc,0x3b,0x2b,0xd8,0x0b,0x00,0x0e,0xb2,0xbe,0x06,
+    0x75,0x5a,0xe1,0x0e,0x42,0x22,0x1d,0x6a,0x33,0x17,0x3c,0xbc,0x65,0xc9,0xdd,0x48,
+    0xc9,0xb2,0x48,0x87,0x28,0x36,0xb6,0xc2,0xbf,0x7c,0xa1,0xcf,0x8f,0x4f,0x7e,0xa4,
+    0xcd,0xa9,0xd4,0x65,0xdc,0x98,0xde,0x82,0x36,0x77,0x90,0x25,0x5a,0xe8,0x40,0x2b,
+    0xc5,0xf5,0x18,0x14,0xae,0x46,0x97,0xf9,0x3d,0xb7,0x69,0xbb,0xdb,0x25,0x38,0x26,
+    0x90,0xb3,0xd9,0x80,0x4c,0xa5,0x10,0xa4,0xcb,0xa6,0x79,0x57,0xe0,0x22,0x2b,0xd2,
+    0x2a,0x9d,0x83,0x04,0x96,0x82,0x79,0x35,0x99,0xe5,0x66,0x0c,0x46,0x84,0x05,0x21,
+    0xed,0x92,0x4d,0x92,0x78,0xfc,0xbc,0xd4,0xf3,0x38,0x63,0x50,0x64,0xa2,0x47,0x2f,
+    0xbb,0xf7,0x16,0x07,0xa0,0x68,0x7d,0xd4,0x57,0x1c,0xd2,0x48,0x11,0x35,0x57,0x8d,
+    0x2a,0xf1,0x26,0x37,0xc9,0xd8,0xa3,0x0d,0x08,0xda,0x59,0x24,0x2c,0x19,0xf3,0x01,
+    0x2d,0xe4,0x91,0x36,0x52,0x71,0xba,0xf4,0x43,0x33,0xe6,0x85,0xa7,0xe2,0x53,0x15,
+    0x7e,0xd2,0xe8,0xc8,0x6a,0x25,0x8d,0x4f,0x17,0x16,0x4f,0x16,0xa7,0xa1,0x73,0xe2,
+    0x1e,0x06,0x62,0xd2,0x7b,0x2b,0x67,0x6b,0x69,0x96,0x5e,0xc2,0x22,0x92,0x30,0x3b,
+    0xcb,0x42,0x3c,0xf0,0x32,0x31,0x25,0x13,0x83,0x9e,0x5f,0x25,0xdf,0x27,0x4a,0xce,
+    0x23,0x79,0xef,0x71,0xb5,0x16,0x68,0x8f,0x3c,0x92,0x88,0x80,0xf3,0x22,0x93,0xbb,
+    0x89,0xe2,0x54,0x79,0x0d,0x67,0x30,0xa4,0xc0,0x88,0x19,0x34,0x2c,0x30,0x6b,0x47,
+    0x4f,0x86,0x0b,0x34,0xb2,0xcb,0x6d,0x7d,0x98,0x36,0x95,0x13,0x07,0x00,0x23,0x0d,
+    0xd9,0x08,0x32,0xae,0x26,0x6c,0x24,0xb1,0x92,0xd8,0x9e,0xe0,0x91,0x28,0x0c,0xb9,
+    0x47,0x92,0xfe,0xfd,0xf3,0x2f,0xf2,0xb3,0x05,0x42,0x60,0x5f,0xe4,0x05,0x47,0x01,
+    0xe0,0x0c,0x88,0x1d,0x70,0x19,0x07,0xdb,0xc3,0x04,0x60,0x30,0x21,0xe6,0x9e,0xe7,
+    0xc3,0x7c,0x83,0x16,0x4b,0x00,0xbf,0x3c,0xa8,0x62,0x8e,0xa5,0xe9,0xc5,0x3d,0x68,
+    0x78,0x99,0x6b,0xc3,0xe1,0x11,0xf0,0x07,0x10,0x8a,0x76,0x5a,0xd1,0x09,0x31,0x0b,
+    0x2d,0x15,0x57,0x50,0x34,0xbd,0x16,0x91,0x3a,0xc7,0x3d,0x1b,0x7d,0xbe,0x33,0x1d,
+    0x90,0x23,0xb9,0x1b,0x42,0x78,0x98,0xb8,0xd7,0x5a,0xb9,0x9a,0x4f,0x41,0x15,0xda,
+    0x5a,0x81,0xf8,0x54,0x26,0x7e,0x05,0x96,0x08,0x0b,0x39,0x03,0xfa,0xaf,0x68,0x6a,
+    0xf7,0x3f,0x5a,0x2b,0x21,0x4d,0x57,0x22,0x83,0xc0,0xda,0x7b,0xb5,0x70,0xda,0x3f,
+    0x5e,0x4f,0x3c,0xee,0x16,0x31,0x2e,0xb9,0x90,0x23,0x32,0x15,0x9c,0x69,0x5e,0x33,
+    0x9f,0x4c,0x58,0x51,0xa2,0x45,0x68,0x87,0x3e,0xcf,0x4e,0x4e,0xc0,0x81,0x15,0xf1,
+    0x97,0x0d,0xd7,0xab,0x74,0x53,0xa7,0x83,0x9d,0xec,0x86,0x18,0xad,0x09,0xee,0x3c,
+    0x9a,0xd6,0xf1,0x06,0x61,0xfc,0x92,0x24,0x72,0x32,0xc1,0x90,0xcd,0x24,0x54,0xfa,
+    0x71,0xae,0x31,0x51,0xba,0xaa,0x3d,0x66,0x86,0xcc,0x98,0x06,0x4c,0x9f,0x20,0x27,
+    0xf2,0x94,0x48,0xec,0x38,0xef,0xb9,0x22,0x2f,0x87,0xbf,0xc2,0x54,0xe7,0x45,0x02,
+    0x2a,0x8c,0x39,0x99,0x02,0x3d,0x08,0x3a,0x82,0xa7,0x2e,0xb0,0x93,0x18,0x9f,0x0d,
+    0x81,0x1c,0x66,0xe8,0xe4,0x77,0xa0,0x7e,0xeb,0x78,0x81,0xc5,0x7a,0x70,0xdd,0xef,
+    0x1c,0xdf,0x74,0xa0,0x60,0x0d,0xae,0x5f,0xdc,0x74,0x20,0x3f,0x0e,0xae,0x4f,0x6e,
+    0x96,0xd7,0x8d,0x03,0x6e,0xac,0xf5,0x44,0x72,0x78,0x28,0x92,0x10,0xcc,0x51,0x0a,
+    0xf3,0x2c,0xa6,0xf2,0x8e,0x1e,0x1e,0xa2,0x14,0xa0,0x57,0xca,0x1f,0xde,0xe1,0x89,
+    0x10,0xe6,0xfe,0x69,0xdc,0xb3,0x27,0x01,0xc4,0x1b,0xfd,0xd3,0xca,0x53,0x47,0x2b,
+    0xff,0x05,0x7d,0x74,0xfe,0xa2,0xdd,0x9d,0x34,0xa2,0xa1,0x80,0x57,0x6e,0x80,0x32,
+    0x5e,0x51,0x35,0xcd,0x53,0x52,0x48,0xcc,0x57,0x7a,0x2a,0xc1,0x38,0x47,0x8d,0x99,
+    0x84,0x84,0xc8,0x60,0x19,0xf0,0x0b,0xe2,0x02,0x1f,0x35,0xa8,0x92,0xd1,0x01,0x25,
+    0x46,0xe5,0x5c,0x43,0xe9,0xa9,0x64,0x34,0x66,0x43,0x0b,0xd5,0xd7,0x3d,0xae,0x94,
+    0xac,0xae,0xda,0x61,0x40,0xfd,0x2d,0x3e,0xae,0xc9,0x63,0xe9,0x18,0xdb,0xde,0x0e,
+    0xda,0x79,0x47,0x4a,0xd7,0x88,0x5d,0xed,0x6a,0xca,0x9c,0xe1,0x61,0x08,0xb5,0x6d,
+    0x60,0x27,0x36,0x7f,0xc0,0xcc,0x71,0xb2,0x75,0x3d,0xe6,0x0f,0x53,0x0b,0x11,0x67,
+    0xfe,0xa2,0x66,0x87,0x4d,0xa9,0x6d,0xb2,0x5e,0xad,0xfa,0xb7,0x9a,0x42,0xcf,0x10,
+    0xf4,0x09,0x3b,0xb1,0x35,0xd6,0x7e,0x23,0x90,0x0d,0xcc,0xe0,0x5e,0xea,0x72,0xb7,
+    0xa5,0x60,0x88,0xbd,0x0a,0x74,0x4a,0x03,0x68,0xba,0xfc,0xd5,0xcb,0xd0,0x1d,0xed,
+    0x79,0xb8,0xee,0x90,0xbe,0xfe,0x55,0x20,0x53,0xf5,0xaa,0x7d,0x14,0xa6,0xab,0xb7,
+    0xa0,0xfc,0xef,0x79,0xeb,0xfc,0x51,0x0b,0xb0,0xfd,0x55,0x94,0x5d,0x6d,0xd8,0x5c,
+    0xb3,0xa5,0x3f,0x80,0x28,0x82,0x92,0x33,0x07,0x7e,0x41,0x6d,0x4d,0xb8,0x6d,0xcb,
+    0xbc,0xa2,0x14,0xa2,0x43,0x41,0x54,0x15,0xb8,0xd6,0xdd,0x6b,0x65,0xb5,0xd3,0xff,
+    0xc1,0xf5,0x07,0x36,0xbd,0xb6,0xb1,0xfd,0xce,0x72,0x1b,0x92,0x18,0xa3,0xee,0x6d,
+    0x68,0x4f,0x88,0x47,0x83,0x56,0xca,0xa1,0x5d,0xc8,0x31,0x88,0x14,0xeb,0xfb,0x5a,
+    0xe7,0xd2,0x4a,0x53,0x75,0x12,0x5c,0x4f,0xc0,0xfb,0xcf,0xda,0xf4,0x8b,0xcc,0x83,
+    0xaf,0x55,0x36,0xd1,0xf8,0x39,0x47,0x3e,0xbe,0xbf,0xfc,0xc0,0x99,0x4a,0xc6,0xbf,
+    0xd9,0x35,0x6f,0xb3,0x23,0xd2,0x76,0xd3,0x55,0x1d,0x77,0x2d,0x1c,0x33,0x50,0x04,
+    0x3b,0x77,0xea,0xc3,0x37,0xf7,0x2a,0xd7,0x5a,0x6e,0x47,0x6d,0x26,0xae,0x3e,0x8b,
+    0xab,0xab,0x50,0xd8,0xbc,0x2a,0x06,0xfc,0xe8,0x5b,0x3f,0x30,0xda,0x1a,0xbd,0xe8,
+    0xad,0x0c,0x4c,0x36,0xa0,0xd9,0x3e,0x7a,0x03,0x1b,0x72,0x38,0x6a,0x51,0x35,0x6e,
+    0x03,0xaa,0x2e,0x44,0xdf,0xd4,0xda,0x7f,0x2d,0x1a,0xdb,0x3c,0x6e,0xa0,0x41,0x6e,
+    0x47,0x2d,0x32,0x6f,0xb7,0x53,0x7d,0x33,0xfa,0xce,0x3e,0x77,0x1b,0xc2,0xff,0x00,
+    0x6d,0x70,0x77,0xb3,0x3d,0x11,0x00,0x00,
+};
+#define ASSET_URL_FRIDGE_JS "/static/fridge.js?v=b01d36e0"
+
+// inventory.css: 6881 bytes, 1805 gzipped
+static const uint8_t ASSET_INVENTORY_CSS[] PROGMEM = {
+    0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xad,0x59,0x4b,0x93,0xa3,0x36,
+    0x10,0xbe,0xef,0xaf,0x20,0x35,0x87,0xb5,0xb7,0x8c,0x8b,0x87,0xc1,0x0c,0xbe,0x24,
+    0x39,0xa4,0x2a,0x87,0x9c,0xb6,0x72,0xc8,0x51,0x80,0xb0,0x15,0x63,0x44,0x81,0x3c,
+    0x33,0x0e,0xb5,0xff,0x3d,0x2d,0x09,0xb0,0x24,0xe4,0xb1,0x67,0x6a,0x77,0x6a,0xbd,
+    0x1e,0x68,0xb5,0xfa,0xf9,0xe9,0x53,0xef,0xb7,0xfe,0x84,0xda,0x3d,0xa9,0x53,0x6f,
+    0xd7,0xa0,0xa2,0x20,0xf5,0x1e,0xbe,0x65,0xf4,0xcd,0xed,0xc8,0x7f,0xfc,0x97,0x8c,
+    0xb6,0x05,0x6e,0x5d,0x78,0xb2,0x73,0x5f,0x71,0x76,0x24,0xcc,0x65,0xf4,0x9c,0x1f,
+    0xdc,0x1c,0x55,0x15,0x3d,0xb3,0xb4,0xa6,0x35,0x9e,0x5e,0x9d,0x3b,0x90,0xed,0x70,
+    0x85,0xf3,0xe1,0x85,0xf9,0xe0,0xc7,0x97,0x8c,0x16,0x97,0x3e,0x43,0xf9,0x71,0xdf,
+    0xd2,0x73,0x5d,0xa4,0x4f,0x9e,0xe7,0xed,0x72,0x5a,0xd1,0x36,0x7d,0x2a,0xcb,0x72,
+    0x57,0xd2,0x9a,0xb9,0x25,0x3a,0x91,0xea,0x92,0xba,0xa8,0x69,0x2a,0xec,0x76,0x97,
+    0x8e,0xe1,0xd3,0xea,0xf7,0x8a,0xd4,0xc7,0xbf,0x50,0xfe,0x5d,0xfc,0xfa,0x07,0xc8,
+    0xad,0xbe,0x7e,0xc7,0x7b,0x8a,0x9d,0xbf,0xff,0xfc,0xba,0xfa,0xad,0x25,0xa8,0x5a,
+    0x75,0xa8,0xee,0x60,0xbf,0x96,0x94,0x93,0x3b,0x49,0xf3,0xb6,0x83,0x95,0xd8,0x3d,
+    0x60,0xb2,0x3f,0xb0,0xd4,0x5f,0x87,0x72,0x13,0xf0,0x10,0xa7,0x7e,0xd4,0xbc,0xfd,
+    0xf8,0xb2,0x3e,0x60,0x04,0x6e,0xf6,0x0c,0xbf,0x31,0x17,0x55,0x64,0x5f,0xa7,0x39,
+    0xae,0x19,0x6e,0x27,0x2d,0xbe,0x07,0x6a,0x14,0xb3,0xb9,0x46,0xd4,0xba,0xfb,0x16,
+    0x15,0x04,0x24,0x17,0x7e,0x18,0x15,0x78,0xbf,0x7a,0xf2,0x11,0xff,0x81,0x7f,0x7d,
+    0x7f,0xb9,0x1b,0x82,0xc7,0x65,0xce,0x9d,0x30,0x44,0x06,0x1b,0xc2,0xc9,0x18,0x3d,
+    0xa5,0x7e,0xa0,0x6c,0xee,0x1c,0xfc,0x5e,0xb1,0x6b,0x1d,0xe2,0xd3,0x6e,0xcc,0x0d,
+    0x08,0x31,0x94,0x75,0x7d,0x41,0xba,0xa6,0x42,0x97,0x74,0xdf,0x92,0x62,0xc7,0x3f,
+    0x5c,0x88,0x04,0x3c,0x61,0xd8,0x85,0x10,0x9e,0x4f,0x75,0x97,0xb6,0xb8,0xc1,0x88,
+    0x2d,0xc2,0x95,0x5f,0xb6,0xcb,0xdd,0x1e,0x35,0xb6,0x7d,0xa5,0xd3,0xa0,0xb2,0x9f,
+    0xfc,0x03,0x53,0x9c,0x44,0xf7,0xb1,0xdd,0x67,0x68,0x11,0x44,0xd1,0x6a,0xfc,0xeb,
+    0xad,0x27,0xa7,0x64,0x7a,0xe7,0x0e,0x9a,0x99,0x9c,0x82,0xbc,0xcb,0xcf,0x6d,0x07,
+    0xaf,0x1a,0x4a,0x44,0x60,0xe7,0xa1,0x66,0x2d,0x24,0x8f,0x30,0x42,0xeb,0x14,0x6a,
+    0xcb,0xf1,0xd6,0x41,0x27,0x75,0xbc,0xca,0xc4,0x45,0x50,0x28,0x66,0x22,0xc7,0x80,
+    0x94,0x15,0x7e,0xdb,0xf1,0x0f,0xb7,0x20,0x2d,0x14,0x1b,0x57,0x22,0x23,0xb2,0x13,
+    0x7b,0xb8,0x04,0x02,0xd5,0x8d,0x3b,0xf1,0xa8,0x6c,0xc6,0x10,0xac,0x11,0x88,0xbf,
+    0xe0,0xfe,0x81,0xe4,0xc6,0xf1,0x16,0x63,0x48,0xee,0x36,0xde,0x64,0x28,0x58,0xca,
+    0x3e,0x39,0xa0,0x82,0xbe,0xa6,0x9e,0x03,0x0a,0x1d,0xee,0xa8,0x23,0xc2,0xe6,0x7b,
+    0xc1,0xca,0x0f,0xe2,0x55,0x10,0x6e,0x20,0x6c,0x9b,0x25,0xec,0x95,0x83,0x2f,0xa0,
+    0x6d,0x4a,0xa2,0xec,0x87,0xf1,0xf1,0x68,0xc6,0xf8,0x36,0xab,0x68,0x7e,0xe4,0xaf,
+    0xfb,0x8f,0x56,0xdd,0x50,0x34,0x90,0x0d,0xe7,0xda,0xd4,0x3c,0xbf,0x46,0xba,0xd4,
+    0x47,0x15,0x2e,0x59,0x1a,0xc2,0x8a,0x8e,0x56,0xa4,0x70,0x9e,0xc2,0x30,0x9c,0x7b,
+    0x17,0x8f,0xce,0x79,0x2b,0xf1,0xb3,0x0e,0x85,0x5b,0x88,0xb9,0x43,0xfb,0x68,0xd9,
+    0xb0,0xc4,0x5d,0x37,0xe6,0xdd,0x42,0xf3,0x12,0xb3,0x7d,0x44,0x07,0x1a,0x75,0xec,
+    0xdd,0xf4,0xc0,0xa2,0x32,0x18,0xad,0x65,0x84,0x55,0x58,0xeb,0x35,0x1f,0x7a,0x4d,
+    0x2d,0xb5,0x8c,0x56,0xc5,0xee,0x9e,0x37,0xbc,0x8a,0x84,0x05,0x46,0x65,0x73,0xf9,
+    0xd4,0x1f,0xf6,0xca,0xc1,0x41,0xd6,0xdf,0x69,0xaa,0x68,0x39,0x85,0x46,0x54,0x91,
+    0x25,0x57,0xbc,0x83,0xae,0x16,0x7b,0xeb,0x24,0x9a,0xe0,0x41,0xba,0x2e,0x2d,0x99,
+    0xba,0x6f,0xda,0xbe,0x66,0x2d,0xad,0xba,0xfe,0x61,0x67,0x54,0x9d,0xe8,0xcc,0x28,
+    0x28,0xc2,0x6f,0x0d,0xaa,0x0b,0x97,0x80,0x32,0x35,0x6a,0x9b,0x69,0x43,0x8b,0x4f,
+    0xdb,0xa5,0x11,0x16,0xd0,0xc3,0x37,0xd4,0x0d,0xf9,0xf7,0xdc,0x31,0x52,0x5e,0xdc,
+    0xa1,0x07,0xd2,0xae,0x41,0x39,0x76,0x33,0xcc,0x5e,0x31,0xae,0xdf,0xad,0x20,0xef,
+    0x7e,0x05,0x45,0xf7,0x01,0x38,0x16,0x20,0xc0,0x77,0x70,0x6b,0x74,0x82,0x9a,0x10,
+    0xa9,0xdb,0xe9,0x4e,0x82,0x44,0xc7,0x10,0x3b,0x77,0x6e,0xc6,0x6a,0x23,0x92,0x57,
+    0x24,0xb9,0x8a,0x4c,0x98,0x1a,0xe9,0xb9,0xb4,0x41,0x66,0xac,0xa5,0x55,0x08,0xab,
+    0x75,0x18,0xf3,0xb3,0x51,0xaf,0x2e,0x0a,0x21,0x22,0xec,0x02,0x25,0x10,0x69,0xbb,
+    0x8e,0xf8,0x31,0xbe,0xf7,0xf5,0xfe,0xf5,0x38,0xb8,0xdb,0xba,0x42,0xf4,0xb0,0xa2,
+    0x86,0x1e,0xb5,0xd3,0x39,0x08,0xf2,0x28,0xc2,0x7a,0x61,0x29,0xd2,0x15,0x7d,0xd5,
+    0xc4,0xcb,0xe8,0x19,0x7b,0xd9,0x4d,0x71,0x20,0x0c,0x9a,0x38,0x2e,0x37,0xf0,0xe7,
+    0xa6,0x78,0x7e,0xc0,0xf9,0x11,0x17,0xda,0x92,0x30,0x4b,0x82,0x32,0xbe,0xb9,0x04,
+    0xbc,0x37,0x57,0xdc,0x71,0x81,0xa1,0x23,0x24,0x4b,0x5b,0x91,0x64,0x51,0xfe,0xce,
+    0x1e,0x50,0x01,0x28,0xab,0x8c,0x5d,0xe2,0x6c,0x1b,0x24,0x9e,0x92,0x9e,0xcd,0x98,
+    0xb9,0x9a,0xf2,0x83,0x0e,0x22,0x85,0x0b,0xd0,0x53,0x92,0x8a,0x71,0x42,0x05,0x75,
+    0x72,0x95,0xdd,0xda,0x0e,0x3f,0x4d,0x78,0x9e,0x5e,0xb1,0xa2,0xa4,0xed,0x29,0xed,
+    0x80,0x8b,0xe1,0x85,0xb7,0x7e,0x8e,0xb4,0x23,0x89,0xd4,0x1d,0x66,0x90,0x78,0x7e,
+    0xb2,0x6f,0xec,0xd0,0xcd,0xe3,0xcb,0x57,0x70,0x27,0x9a,0x79,0x65,0x0f,0xfc,0x64,
+    0x12,0xab,0x50,0x86,0xab,0x87,0xa0,0xc4,0xa8,0x6b,0xc0,0xe5,0xa9,0x75,0xf9,0x29,
+    0xa2,0x02,0xb7,0xd2,0x09,0xf7,0x1b,0xda,0xc6,0x11,0x6e,0x36,0x48,0x3c,0xb3,0x3d,
+    0x3d,0xa0,0x6e,0x41,0xea,0x06,0x78,0xeb,0x50,0x5b,0x4b,0xb5,0x61,0xee,0xa2,0xf4,
+    0x63,0x2d,0x15,0x2c,0x67,0x1b,0x3b,0x62,0xd3,0xfe,0x95,0x14,0xec,0x90,0xfa,0xdc,
+    0xd7,0x91,0xc4,0xc4,0xf3,0x03,0x04,0xe5,0x3c,0x92,0xee,0x50,0x7e,0x92,0x74,0x0c,
+    0x30,0xd5,0x09,0xa8,0x44,0x40,0x03,0x5a,0x20,0xee,0x6f,0x23,0x15,0x82,0xba,0x7b,
+    0xc1,0x6d,0x09,0x35,0x96,0x1e,0x48,0x51,0x00,0x76,0x2a,0x81,0xba,0xca,0x41,0xbc,
+    0xc2,0x6e,0xae,0x69,0x00,0x78,0x28,0x68,0x45,0x65,0x08,0xbc,0x5c,0x64,0x5f,0x45,
+    0x7f,0x45,0xeb,0x54,0x7e,0xa3,0xd2,0x51,0x89,0x33,0x5f,0x21,0xaa,0xb4,0xa5,0xd0,
+    0x41,0x78,0xe1,0x27,0x1e,0x50,0x16,0x88,0xd0,0xaf,0x27,0x5c,0x10,0xe4,0x2c,0xf8,
+    0x9e,0x32,0x2e,0x50,0x16,0x01,0x14,0xea,0xb2,0x37,0x0d,0x5c,0xdd,0x32,0x42,0x50,
+    0x28,0xd8,0xbb,0xa6,0xee,0xf5,0xe9,0x4a,0xff,0xd5,0xf9,0x66,0xae,0x70,0x7e,0x21,
+    0xa7,0x86,0xb6,0x0c,0xd5,0x0c,0xd6,0x22,0xc1,0x16,0x6f,0x60,0xbb,0x72,0x64,0x30,
+    0xda,0x0c,0xc7,0x30,0xa7,0x99,0xaf,0x2d,0xbc,0xe5,0x1f,0x9a,0x86,0xf1,0x00,0xb1,
+    0xb0,0x2e,0x1b,0xfa,0x8b,0x36,0x30,0x4e,0xd4,0x3b,0xf0,0x7f,0x02,0x4b,0x86,0x2a,
+    0x0a,0x64,0x7e,0xae,0xbb,0xaf,0x9b,0x96,0x80,0xb1,0x97,0xcf,0x50,0x59,0x0d,0xeb,
+    0x14,0x95,0x1d,0x86,0x90,0x17,0x86,0x52,0x6b,0xcd,0x1b,0x70,0x79,0x3e,0x09,0x53,
+    0x3e,0x75,0x63,0xb1,0x51,0x3d,0x79,0x65,0x19,0xd4,0xba,0x5c,0xd3,0x07,0x74,0x6f,
+    0xac,0xba,0x85,0x52,0xc7,0x53,0xd4,0xe6,0xa8,0x2d,0xfa,0xbb,0x37,0xa0,0x29,0xbb,
+    0xd1,0x9c,0xa7,0x71,0xed,0xb3,0xab,0x8d,0xb1,0x83,0xb3,0x7e,0x41,0xd5,0x59,0x65,
+    0xa0,0x81,0x8d,0x7f,0x0e,0x46,0xda,0x6c,0x74,0xd6,0x12,0x8a,0x67,0x8c,0xf0,0x0a,
+    0x7e,0x09,0x2c,0x39,0x41,0xf7,0x08,0x79,0xa3,0xb2,0xed,0x17,0x25,0x11,0x9d,0x78,
+    0x16,0xf9,0xa1,0xcc,0x26,0x5d,0xfd,0x83,0x37,0x44,0xed,0x9a,0x31,0x85,0xcc,0x02,
+    0x77,0x36,0x4c,0x7f,0x88,0xae,0xc6,0xba,0x61,0xe9,0x81,0x83,0xe0,0x03,0x5c,0xfb,
+    0x8a,0x49,0xe2,0x1b,0x2f,0x98,0x7f,0x16,0x2e,0x98,0x69,0x00,0x3c,0x87,0xf7,0x20,
+    0xb2,0x9e,0x9c,0xd3,0xa6,0x82,0x28,0x8b,0xb6,0x87,0x75,0x2d,0xa9,0x8f,0x80,0xc5,
+    0x9f,0xbf,0x94,0x0a,0xb8,0x99,0x3a,0x3c,0x31,0x22,0x6f,0x32,0xf0,0x30,0x30,0x47,
+    0x1b,0x9a,0xf4,0xec,0x9a,0x63,0x83,0x97,0xf9,0x35,0xfc,0x26,0xa5,0x7f,0xd6,0x1d,
+    0x6f,0xb9,0x8e,0x11,0xf0,0x3e,0xd7,0xe6,0x81,0xe1,0x1f,0x23,0x15,0xfe,0x68,0x79,
+    0x25,0x6a,0x75,0x05,0xb6,0xee,0x13,0x11,0x3d,0x8c,0x33,0x04,0x90,0x78,0x20,0x3f,
+    0xe6,0xc5,0x64,0xea,0x63,0xdd,0x58,0x60,0xcb,0xce,0x9a,0x7f,0x71,0x65,0x47,0x0f,
+    0x10,0x28,0x19,0xe7,0x5c,0x1a,0xce,0x67,0x9b,0xb8,0x24,0xcd,0x16,0xe5,0x67,0x66,
+    0x13,0x97,0xa4,0x79,0x2e,0xce,0xe0,0x80,0xad,0x6c,0x0b,0x24,0x65,0x9e,0x2f,0x10,
+    0x14,0xe5,0x23,0x06,0x71,0x72,0xfd,0x21,0x8b,0x04,0xb5,0xb6,0xad,0x90,0x0c,0x9b,
+    0x0f,0x60,0xf8,0x2b,0x13,0xcc,0x7c,0xff,0xce,0xd5,0x52,0x47,0x28,0xb3,0xae,0x23,
+    0xcf,0x1b,0x35,0x9b,0x40,0xeb,0x27,0x86,0xac,0x40,0x5a,0xb3,0x87,0xba,0x03,0x6d,
+    0xdc,0x9f,0x79,0x5b,0x0d,0x7e,0xca,0x6d,0x35,0x31,0xa6,0x1d,0x9b,0x71,0xda,0xa1,
+    0x9a,0x2c,0xaf,0x64,0x57,0x29,0xd7,0xcc,0xe9,0x55,0x52,0xdc,0xc6,0xe6,0x92,0x53,
+    0x36,0x33,0x54,0xec,0x71,0xaf,0x4d,0x26,0x3c,0xfb,0x89,0x67,0xa4,0xce,0x00,0x99,
+    0x51,0xd5,0x9d,0xdb,0xa2,0xa7,0x48,0x3e,0x72,0x51,0x04,0x80,0x61,0x97,0x77,0x46,
+    0xb6,0x21,0xb7,0x4c,0xbb,0x0d,0x48,0xca,0xb9,0xb8,0x22,0xec,0x36,0x4e,0x38,0xdf,
+    0x94,0x43,0x69,0x6d,0x14,0x2a,0xce,0xf6,0x2b,0x35,0xf5,0x05,0x1b,0x9e,0xe6,0xb1,
+    0x0e,0x9f,0x8c,0xa8,0x5e,0xc7,0xea,0x14,0x59,0xe5,0x07,0x37,0xc7,0xbb,0x31,0x3e,
+    0x8d,0x53,0xdd,0x77,0xf1,0x32,0x7e,0x9f,0x16,0x05,0xf3,0x49,0xee,0x34,0x42,0x52,
+    0xb6,0x03,0x6a,0xc0,0x35,0x48,0x83,0xf2,0x71,0xe6,0xcf,0x15,0x1a,0x33,0x42,0x7d,
+    0xa0,0xa7,0xea,0xbc,0x3d,0x3c,0x8b,0x06,0xed,0xca,0x7a,0x39,0xf6,0xd2,0x06,0x21,
+    0x1b,0x63,0x82,0xf5,0x6c,0x0e,0xb0,0x92,0xd9,0x75,0x63,0x16,0x60,0xd1,0x93,0xda,
+    0x0c,0xe8,0xce,0x3c,0x47,0x8d,0x80,0x7d,0x48,0x13,0xcf,0xa3,0x25,0xb9,0xd4,0xfc,
+    0xe2,0xab,0x59,0xcf,0x9d,0x56,0xfe,0x8b,0xc1,0xb1,0xde,0x95,0xf5,0x6b,0x5f,0xa2,
+    0x5c,0xfb,0x12,0x83,0xbb,0x6b,0xd5,0x67,0x64,0x4e,0xe1,0xfc,0x1b,0x4f,0xa3,0xc1,
+    0x82,0x8f,0x19,0xe9,0xbb,0xc3,0x34,0xd7,0x81,0x8c,0xc4,0x1d,0x36,0xf9,0x2c,0xa5,
+    0x26,0x20,0xd4,0xcc,0x9b,0xc1,0xd2,0x6d,0xb0,0x50,0x75,0x6e,0x65,0x54,0x4d,0x0a,
+    0x61,0x2f,0x7f,0xa8,0xfa,0x91,0x12,0xcd,0x39,0x82,0x12,0xf8,0x9b,0x48,0x2f,0x6a,
+    0xe1,0xc7,0x97,0xff,0x01,0x79,0xce,0x0b,0xc2,0xe1,0x1a,0x00,0x00,
+};
+#define ASSET_URL_INVENTORY_CSS "/static/inventory.css?v=77e531e2"
+
+// inventory.js: 50741 bytes, 8471 gzipped
+static const uint8_t ASSET_INVENTORY_JS[] PROGMEM = {
+    0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xed,0x3d,0x5d,0x73,0xdc,0xc8,
+    0x71,0xef,0xfc,0x15,0x20,0xaf,0x42,0x2c,0xb2,0xcb,0xd5,0x92,0x14,0x55,0x77,0xbb,
+    0x02,0x59,0x3c,0x1e,0xaf,0xcc,0x84,0x27,0xaa,0x44,0x5e,0x52,0x29,0x89,0x49,0x81,
+    0x8b,0x59,0x2e,0x4e,0x58,0x60,0x0d,0x60,0xf9,0x61,0x92,0x55,0x79,0xf1,0x9b,0x13,
+    0xa7,0xec,0xca,0x8b,0x1d,0xd7,0x55,0xe5,0xc1,0x6f,0x79,0xcf,0xef,0xf1,0x1f,0xc8,
+    0xfd,0x84,0x74,0xcf,0x37,0x06,0x1f,0xfb,0x41,0x9e,0x28,0xc9,0x3c,0x5b,0xd2,0x02,
+    0x98,0xe9,0x99,0xee,0xe9,0xe9,0xee,0xe9,0xe9,0xe9,0x09,0x49,0x66,0x11,0x3f,0xc8,
+    0x82,0xe8,0x7c,0xcf,0xcb,0xc8,0x79,0x9c,0x5c,0xbb,0x6b,0xeb,0xbd,0xa5,0x50,0xbd,
+    0x3f,0x88,0x7c,0x72,0x55,0x78,0x99,0xee,0xc5,0x51,0x3a,0x19,0x79,0x67,0x21,0x71,
+    0x07,0x5e,0x98,0x92,0xde,0xd2,0x60,0x12,0xf5,0xb3,0x20,0x8e,0xac,0x20,0x23,0xa3,
+    0x03,0xbf,0xd1,0xf7,0xb2,0x16,0xfe,0x74,0x6e,0x68,0xcd,0x24,0xbe,0x74,0xa3,0x49,
+    0x18,0xb6,0xfa,0x71,0x94,0x79,0x41,0x44,0x12,0xd7,0x8f,0xfb,0x93,0x11,0x89,0xb2,
+    0xf6,0x39,0xc9,0xf6,0x43,0x82,0x3f,0xbf,0xbe,0x86,0x9a,0x36,0x54,0xb5,0x9b,0xf0,
+    0x97,0xd3,0x5b,0x0a,0x06,0x0d,0x59,0xc1,0x41,0x18,0xf2,0xa9,0xfd,0xcb,0x09,0x49,
+    0xae,0x8f,0x49,0x48,0xfa,0x59,0x9c,0xec,0x86,0x61,0xc3,0x6e,0x63,0x7b,0xb6,0xf3,
+    0x16,0xff,0x39,0xa5,0x75,0x97,0xa1,0x0a,0xad,0x26,0xdb,0xca,0xd5,0x82,0x2a,0xe9,
+    0x30,0x1e,0xaf,0x61,0x85,0xb7,0xbe,0x97,0x79,0x6b,0xd0,0xaa,0xbb,0x42,0x1b,0x6f,
+    0xda,0x2b,0xa7,0xec,0x1d,0x7e,0xc5,0x97,0xf8,0x2f,0xbe,0xb5,0x1d,0x46,0x8c,0xc0,
+    0x77,0x01,0xf4,0x0e,0xfc,0x41,0x0c,0x76,0xb3,0x2c,0x09,0xce,0x26,0x19,0x69,0xd8,
+    0xac,0x96,0x6f,0x3b,0x5d,0xc4,0xb8,0xb7,0x94,0x90,0x6c,0x92,0x00,0x61,0xfc,0xd5,
+    0xd5,0xc0,0x5f,0x76,0x5d,0xbb,0x63,0xef,0x8c,0xbd,0x24,0x25,0x07,0x51,0xd6,0x08,
+    0x7c,0x5e,0xec,0x2e,0x4f,0xc2,0x37,0x64,0x60,0xd2,0x10,0x1a,0x34,0x89,0xab,0x01,
+    0xdf,0xb1,0xe1,0x3b,0xf4,0xd2,0xef,0x22,0x01,0x5d,0x8e,0xc4,0x2a,0xed,0x3d,0xeb,
+    0x3c,0x34,0x01,0xe4,0x4b,0x33,0x6b,0xef,0x17,0xfb,0x7b,0x7f,0xff,0x2f,0x47,0xaf,
+    0x8f,0xdd,0xb7,0x76,0x7f,0x48,0xfa,0xef,0xed,0x96,0x3d,0xf6,0xe8,0x3f,0x99,0xf7,
+    0x9e,0xd8,0xa7,0x0c,0xc1,0x31,0x89,0x7c,0x18,0xed,0xa3,0x71,0xea,0xbe,0x3d,0x6d,
+    0x9d,0x79,0x59,0x7f,0x78,0x12,0x8c,0x60,0xe4,0xe8,0x40,0xd2,0xe7,0x6f,0xe2,0x88,
+    0x68,0x8f,0x7b,0x43,0x18,0x1b,0xf7,0x75,0x12,0x8f,0x82,0x94,0xb4,0x13,0x92,0xc6,
+    0xe1,0x05,0x69,0x38,0x1a,0x77,0x00,0xfd,0x27,0xe4,0x68,0xdc,0x88,0xc7,0x2d,0x1f,
+    0xea,0x02,0x66,0x5a,0x2b,0xea,0x67,0x7b,0x10,0x84,0x19,0x49,0x1a,0xb1,0xbb,0x1d,
+    0xbf,0xed,0x9c,0x02,0xd1,0xe2,0x31,0xfc,0x7b,0x7b,0x1b,0xbf,0x5d,0xe7,0x4f,0xeb,
+    0xa7,0x00,0x57,0xab,0x31,0x9e,0xa4,0x43,0x00,0xcb,0x98,0x86,0xc2,0x56,0x3d,0xc4,
+    0x47,0xc6,0x10,0x0a,0x0b,0x47,0x43,0x28,0x25,0x19,0xfe,0x88,0x27,0x59,0x63,0x10,
+    0x02,0x1c,0x80,0xd7,0xda,0xd8,0xea,0x38,0xfa,0xa0,0x88,0x0f,0x0d,0xe8,0x73,0x3f,
+    0x24,0x5e,0x22,0x6a,0x68,0x20,0x7b,0x06,0x91,0x18,0x1d,0xe3,0x1c,0x6a,0x14,0x6f,
+    0x57,0xf6,0x4d,0xc7,0x01,0xc8,0xdc,0xcb,0x93,0x95,0x76,0x1a,0xea,0xb7,0x43,0x12,
+    0x9d,0x67,0x43,0xd7,0xed,0x38,0x7c,0xc0,0x15,0xbd,0x7b,0x4b,0x1a,0xed,0xd5,0xcf,
+    0x76,0x36,0x24,0x51,0xa3,0xe1,0xb8,0xdb,0x03,0x02,0xef,0x1a,0xf6,0x33,0x6f,0x1c,
+    0x3c,0x0b,0xa2,0x0b,0x98,0x06,0x30,0xd1,0x9f,0xd1,0x92,0x76,0xeb,0x66,0x44,0xb2,
+    0x61,0x0c,0x4c,0xf3,0xfa,0xe8,0xf8,0xc4,0x6e,0x0d,0x89,0xe7,0x93,0x24,0xed,0xde,
+    0xd8,0x30,0xc5,0x33,0x28,0xba,0x76,0x72,0x3d,0x26,0x76,0xd7,0xf6,0xc6,0xe3,0x30,
+    0x00,0x96,0x02,0x52,0x3c,0xfb,0x21,0x8d,0x23,0xfb,0xae,0x75,0x16,0xfb,0xd7,0xdd,
+    0xbf,0x3b,0x3e,0x7a,0xd5,0x4e,0x81,0xf7,0xa3,0xf3,0x60,0x70,0x8d,0x7d,0x75,0xee,
+    0x1c,0x87,0x35,0x9e,0xb8,0xdb,0x37,0x6c,0x1a,0xb6,0xe3,0xf7,0x4e,0xd2,0xce,0xc8,
+    0x55,0xd6,0xe0,0xdf,0x32,0x77,0xdb,0x0b,0x49,0x92,0x35,0xec,0xef,0xc7,0x30,0x61,
+    0x88,0x35,0xf0,0x82,0x90,0xf8,0x5d,0xcb,0x6e,0x66,0x8e,0x36,0x88,0xf8,0x17,0x70,
+    0xd0,0x9d,0xd3,0xee,0x63,0x87,0x29,0x42,0x65,0x15,0x6d,0x47,0x4d,0x06,0x8d,0x36,
+    0x77,0x4b,0x97,0x41,0xe4,0xc3,0x14,0xf5,0x7c,0x7f,0x1f,0x51,0x3f,0x0c,0x52,0x40,
+    0x0b,0x58,0x0b,0x38,0xfe,0x9c,0x0c,0x03,0x9f,0xd8,0x2d,0x84,0x49,0x3b,0xaa,0xb1,
+    0x13,0x23,0xb8,0x13,0x79,0x17,0xc1,0xb9,0x07,0x04,0x6b,0xa7,0xf0,0xed,0x6b,0xe2,
+    0xc1,0x0c,0xaa,0x22,0xa5,0x41,0x0a,0x05,0xcc,0xc1,0xfe,0x6b,0x93,0xa0,0x1f,0xc6,
+    0x29,0xd9,0x07,0x59,0xfa,0x5d,0xec,0x7b,0x61,0x83,0x4f,0xef,0x11,0x3e,0x54,0x4b,
+    0x45,0x22,0xca,0xdb,0x8c,0x3a,0xb4,0xb8,0x73,0x43,0xff,0x81,0xa9,0x36,0x8a,0xe9,
+    0x4c,0x63,0x14,0x00,0xb4,0x0d,0x68,0x86,0xdc,0x7b,0x9b,0x66,0xd7,0x21,0xf9,0x5b,
+    0x77,0x65,0x1c,0xa7,0x01,0xf6,0xa9,0x3b,0x08,0xae,0x88,0xcf,0x84,0x9b,0x04,0x6e,
+    0xc0,0xbe,0x33,0x30,0xd8,0xf5,0xfd,0x79,0x10,0xf0,0x78,0xf1,0x8f,0xa1,0xff,0x3e,
+    0x40,0xca,0xc8,0x01,0x08,0xc5,0x6f,0x41,0x58,0x49,0x2c,0x98,0xba,0x19,0x04,0xc9,
+    0xa8,0x61,0x7f,0x43,0x8b,0x58,0xd9,0x30,0x48,0xa9,0x40,0xde,0xb1,0x4e,0xf0,0x67,
+    0xdf,0x8b,0xa2,0x38,0xb3,0xce,0x88,0x35,0x89,0x90,0x37,0xdb,0xc0,0x78,0x37,0x4b,
+    0x62,0x8a,0x29,0x9e,0x60,0xad,0xee,0x30,0xc9,0x8b,0xc2,0xdc,0x50,0xb4,0x2d,0x5d,
+    0xc1,0x9a,0x13,0x86,0xce,0x97,0x1b,0x93,0x4d,0x98,0x34,0xe9,0x4f,0x92,0x04,0xda,
+    0x38,0xf1,0xce,0xaa,0xb5,0x5a,0xe6,0x9d,0xb5,0x3d,0xc0,0xf4,0x82,0x08,0x65,0x05,
+    0x6f,0x98,0x2a,0xdf,0x4d,0x12,0xef,0xba,0x3d,0x00,0xac,0x1b,0x0a,0x52,0x1b,0xd4,
+    0x11,0xfc,0x7a,0x15,0xfb,0xa4,0xdd,0x1f,0x06,0xa1,0x0f,0x4f,0x4e,0x3b,0xc0,0x0a,
+    0x47,0x03,0xad,0x1c,0x00,0xd3,0x44,0x25,0x4e,0x1b,0xd0,0x9f,0x97,0xf0,0xa1,0x21,
+    0xe0,0x3b,0xad,0xf5,0x0e,0xca,0x4d,0x02,0x46,0xc1,0x0d,0x9f,0xa7,0x9c,0x92,0x62,
+    0x9e,0xf6,0xee,0xee,0xf0,0x8f,0x1a,0x8c,0xd4,0xbb,0xa0,0x43,0x81,0xa8,0x0a,0x5e,
+    0x8a,0xbc,0x11,0xa9,0x9f,0x0b,0x6b,0x58,0xc4,0x76,0xda,0x17,0x5e,0x38,0x21,0x6d,
+    0x98,0x75,0x23,0x41,0xa1,0x88,0x5c,0x4a,0x73,0x46,0xea,0xd9,0x7a,0x58,0x7d,0x5e,
+    0x5e,0xc0,0x63,0x5c,0xb4,0x8c,0x4d,0x38,0x02,0x8d,0x57,0xf0,0xa0,0x0d,0x3f,0x19,
+    0x8d,0x33,0x28,0xaf,0x38,0x36,0x90,0x63,0xac,0xdb,0x47,0x1c,0x9f,0x2c,0x41,0xec,
+    0x93,0x29,0x28,0xf1,0x52,0xa2,0x17,0x2e,0xd8,0x0a,0x59,0x32,0x21,0x36,0xed,0x8d,
+    0x86,0x16,0x68,0x40,0x83,0x9d,0x78,0x33,0xf8,0xf6,0xb5,0x97,0x78,0xa3,0xd4,0x9d,
+    0x89,0xef,0xc0,0x40,0xa0,0x94,0xb6,0x9b,0x24,0xea,0xc3,0xe8,0x7f,0xff,0xe6,0x60,
+    0x2f,0x1e,0x8d,0x81,0xaf,0x81,0x64,0x14,0x7b,0x28,0x11,0x02,0x1f,0xa5,0x07,0xd1,
+    0x09,0x47,0xc1,0x6e,0x36,0x78,0x3f,0x77,0x58,0xef,0xba,0x36,0xb5,0x01,0x91,0xd5,
+    0x8a,0xf3,0x80,0x91,0x57,0x92,0x03,0x26,0x84,0xea,0x63,0x29,0xd7,0x33,0x49,0x72,
+    0x41,0xe6,0x44,0x23,0xf3,0x12,0x20,0x29,0x74,0x4e,0x23,0x13,0x1f,0x1b,0xab,0xd8,
+    0x2b,0x6c,0x80,0x1a,0x76,0x8b,0x29,0xc0,0xab,0xb5,0xcb,0xcb,0xcb,0xb5,0x41,0x9c,
+    0x8c,0xd6,0x26,0x49,0xc8,0x48,0xe7,0x0b,0x8d,0xa8,0x3a,0x7f,0x27,0x26,0x42,0x36,
+    0x04,0x2b,0x11,0xf9,0xd2,0xda,0x4f,0x12,0x9c,0xa1,0xc8,0xea,0xda,0x84,0x58,0xba,
+    0xd3,0x48,0x51,0x3d,0xff,0x17,0x9a,0xfe,0x0f,0x39,0xfb,0x17,0x98,0xfc,0x14,0x61,
+    0x1c,0x50,0x18,0x2c,0x2a,0x47,0xad,0x2c,0xa6,0x94,0x50,0x53,0x0e,0x05,0x02,0xd7,
+    0xee,0x04,0xf0,0xd7,0x2b,0xa2,0x39,0x40,0xda,0x23,0x92,0xa6,0xa0,0xac,0x99,0x16,
+    0x65,0xd0,0x99,0x81,0xfa,0x91,0x73,0xfa,0xd8,0xe4,0xf2,0xcf,0x6c,0x68,0xf3,0x4c,
+    0x4c,0x07,0x47,0x0c,0xcf,0xa3,0xc9,0xab,0x5e,0xa9,0x2e,0xc6,0x4f,0x55,0xa2,0xe7,
+    0xaf,0x4b,0xf2,0xbc,0xa1,0xb4,0xc8,0x0d,0xdb,0x93,0xe8,0x79,0x6c,0xd1,0x53,0xcb,
+    0xb4,0x9f,0xb9,0x14,0x29,0x61,0x48,0x2a,0x47,0x96,0x0c,0x0b,0xf1,0x15,0xcc,0x2e,
+    0x29,0x5c,0x67,0x33,0x13,0x61,0xc5,0x51,0x6d,0x25,0xf6,0x67,0x37,0x11,0x11,0x4e,
+    0x89,0x85,0x38,0x93,0x5d,0x87,0x75,0x0d,0xb3,0x6e,0x01,0xdb,0x52,0x63,0x39,0xe5,
+    0xdd,0xa1,0xfd,0x59,0x4c,0xaf,0xf1,0x1e,0x95,0xf1,0x1d,0x74,0xd8,0x64,0x3a,0x2f,
+    0xbd,0x8e,0xfa,0x56,0xc9,0xe2,0x44,0xad,0x00,0x3f,0xb9,0xb5,0x09,0x6d,0xd8,0xf5,
+    0x2e,0x3d,0xd0,0x61,0xc2,0x33,0xd1,0xe3,0xa3,0xf1,0x2d,0xe5,0x45,0x94,0x16,0x40,
+    0x0c,0x2a,0x39,0x98,0x5b,0x82,0xad,0x5c,0x0a,0x6c,0xb9,0xff,0xcb,0x49,0x30,0x46,
+    0x5c,0x3f,0x0a,0xae,0xfc,0xa0,0xbc,0xf5,0xc4,0x40,0xf7,0x63,0x20,0x68,0x00,0x48,
+    0xa0,0xe4,0x5a,0x9d,0x3f,0xa5,0x9f,0x10,0x18,0x17,0xce,0x02,0x0d,0xdb,0x0f,0x2e,
+    0x10,0x7f,0xe6,0xe3,0x40,0xd7,0xaf,0xf4,0xaf,0x88,0x97,0xd4,0x47,0xe2,0xda,0x79,
+    0x17,0x49,0x2f,0x8b,0xc7,0xdd,0x0e,0x08,0xfd,0x41,0x06,0xff,0x5c,0x06,0x7e,0x36,
+    0xec,0x02,0x56,0x7f,0xd3,0x1b,0x92,0xe0,0x7c,0x98,0xb1,0xdf,0x67,0x5e,0xff,0xfd,
+    0x79,0x12,0x4f,0x22,0xbf,0x9b,0x9c,0x9f,0x79,0x8d,0x4e,0x8b,0xfe,0xaf,0xfd,0xa5,
+    0xd3,0xf3,0x83,0x74,0x1c,0x7a,0xd7,0xdd,0x41,0x48,0xae,0x00,0xdd,0xe0,0x3c,0xa2,
+    0xd6,0x4c,0xda,0xed,0x43,0xaf,0x40,0xa2,0xfc,0x30,0x49,0xb3,0x60,0x70,0x8d,0x86,
+    0x30,0xda,0x30,0xe2,0xf5,0xaf,0xd6,0x28,0xc1,0x11,0x7c,0xc7,0xee,0x29,0xf4,0xb8,
+    0xa9,0x33,0x13,0x96,0xbc,0xac,0xc0,0x4b,0xeb,0xe4,0x17,0x1b,0x1b,0x1b,0xbd,0x31,
+    0x10,0x00,0x74,0x6e,0x77,0xa3,0x33,0xbe,0xea,0x9d,0xc5,0x09,0x18,0x53,0x6b,0x89,
+    0xe7,0x07,0x93,0x14,0x5a,0x85,0x57,0x0c,0xd7,0xaf,0x00,0xbd,0x91,0x07,0x66,0x14,
+    0x7d,0x7a,0xde,0xc1,0x2f,0xfd,0x38,0x04,0x7d,0xff,0xc5,0x60,0x30,0xb0,0x8d,0xa6,
+    0x82,0x28,0x22,0xc9,0x2f,0x4e,0xbe,0x3b,0x74,0xed,0x97,0xc3,0x4d,0x8b,0xb5,0xbc,
+    0x32,0x02,0x8b,0x2f,0x88,0xba,0x1d,0xab,0x63,0xad,0x6f,0x8d,0xaf,0xac,0xce,0xca,
+    0x36,0x8c,0xa2,0xa5,0x86,0xd1,0x42,0x77,0xc6,0xcb,0x67,0xc3,0xcd,0xed,0x4a,0x80,
+    0x4d,0x80,0x08,0xc8,0xe5,0x41,0xae,0x9d,0xc5,0x59,0x16,0x8f,0xba,0x08,0x75,0x65,
+    0xfb,0x65,0xe8,0x9d,0x91,0x50,0x94,0x10,0x84,0x3f,0x0b,0xe3,0xfe,0xfb,0x5e,0xbe,
+    0x3c,0x2d,0x8e,0x6d,0x5a,0x38,0xd9,0xbb,0x2f,0x9f,0xd1,0x9a,0xf5,0x8d,0x07,0xd1,
+    0x78,0x02,0x1c,0x0c,0x26,0xa6,0xbb,0x82,0xdc,0xbb,0x82,0xfb,0x0b,0x2b,0x42,0x38,
+    0xad,0x88,0x66,0x35,0x0e,0x11,0x04,0xfe,0x52,0xd2,0xb7,0xbb,0x0e,0xd8,0xa7,0x71,
+    0x18,0xf8,0xd6,0x17,0xcf,0x9f,0x3f,0xd7,0xf9,0xe6,0x8b,0xcd,0xcd,0x4d,0x8d,0xb0,
+    0xc6,0x80,0x3c,0x87,0x0e,0x5b,0x80,0x4e,0x9f,0x0c,0xe3,0x10,0xde,0xbb,0x2b,0xfb,
+    0xc8,0x26,0xcc,0x4a,0xa3,0xed,0x6f,0xbf,0x7c,0x06,0xe4,0xf9,0x90,0xf4,0x3b,0x8c,
+    0x99,0x8d,0x3d,0x1b,0xf9,0x52,0x2a,0x90,0x24,0xcd,0xb8,0x42,0xfd,0x00,0x64,0xdb,
+    0x7e,0x19,0x8f,0xa9,0xf0,0x60,0x2e,0xa2,0x15,0xba,0x22,0x5d,0xd9,0xfe,0xe9,0xc7,
+    0x3f,0xfe,0xce,0xfa,0x7a,0x72,0x6d,0xed,0x7b,0xfd,0xa1,0x75,0x92,0x04,0xe3,0x97,
+    0xcf,0x58,0x41,0xb3,0x02,0xae,0x64,0xb1,0xfc,0x1f,0xfe,0x60,0x1d,0xa2,0x5d,0x60,
+    0x05,0x91,0xc5,0x2d,0x03,0x55,0xe5,0x19,0xc3,0xef,0x5e,0xa3,0x80,0x13,0x71,0xee,
+    0x51,0x10,0x26,0xf4,0x42,0xa3,0x20,0x14,0xd7,0x07,0x19,0x86,0xc5,0x48,0x94,0x93,
+    0x9f,0xe7,0xde,0x98,0xc9,0x26,0x53,0x6a,0xe2,0xd7,0x35,0x12,0xf9,0x2b,0xf5,0x70,
+    0xcf,0x26,0x40,0xb8,0xc8,0x8a,0xa3,0x3e,0x2c,0x10,0xdf,0xbb,0x2b,0x86,0x4e,0x95,
+    0x64,0xd0,0x70,0xb7,0xd6,0x5f,0x20,0x01,0x34,0x54,0x5f,0xbc,0x78,0x21,0x08,0x12,
+    0xe1,0x86,0x54,0x01,0x57,0x9d,0x10,0xa0,0x2e,0x53,0xf8,0x3d,0x8e,0x03,0x9c,0xaf,
+    0x38,0x5c,0x51,0x9f,0x84,0x2f,0x9f,0xb1,0x9e,0xcc,0xd7,0xdb,0x12,0xab,0x7e,0xb6,
+    0x1e,0x6f,0x6c,0xf4,0xb7,0xb6,0xc8,0x6c,0x9d,0x06,0x7d,0x63,0x74,0xba,0x37,0x80,
+    0xce,0xad,0x5d,0x32,0x75,0x77,0x06,0xe2,0x87,0x49,0x6f,0x26,0xb2,0x67,0xc1,0x23,
+    0x37,0xde,0x6d,0x58,0x9d,0xc3,0x40,0xed,0xa1,0x61,0xd1,0xd0,0xeb,0x48,0xdd,0x2c,
+    0xf0,0x6d,0x10,0x87,0x2d,0xde,0xc0,0xe2,0x63,0x2e,0x03,0xd7,0x65,0xfb,0x14,0xa6,
+    0x29,0x74,0xd7,0x5b,0x92,0xfa,0x10,0x17,0xf6,0xc5,0x36,0x1c,0xad,0x44,0xc9,0x46,
+    0x38,0xcc,0x83,0xb5,0x2c,0xc8,0x42,0xb4,0x31,0x07,0x71,0x82,0x22,0xa1,0x81,0x9b,
+    0xc6,0xfb,0x61,0x2b,0xf0,0xaf,0xe8,0x6e,0x17,0x37,0x36,0x4f,0x40,0xf2,0xbb,0xf4,
+    0x0b,0x35,0x61,0x04,0xbe,0x39,0x93,0x14,0x88,0x0e,0xdf,0x79,0x29,0xd3,0x1a,0xc3,
+    0xa6,0x68,0x09,0x5b,0x6c,0xd7,0xd3,0xd2,0x60,0xdf,0x29,0xe0,0xf8,0x6f,0x3b,0x21,
+    0x54,0xde,0x8b,0x02,0x7a,0x73,0x2d,0x1b,0xfa,0xc9,0x9b,0xbc,0xe3,0x5b,0xa6,0x28,
+    0x86,0x2a,0xad,0x02,0xf6,0x59,0x98,0x7f,0xcc,0xbe,0xe3,0xfd,0xa3,0xb4,0x4c,0xa1,
+    0x8c,0xdc,0xd0,0xa7,0x12,0x81,0x99,0x1f,0xa7,0xb6,0x73,0x7b,0x6b,0x94,0x6b,0xf7,
+    0x05,0x1c,0x68,0x23,0x3c,0xf0,0xaf,0xdc,0x06,0x03,0x68,0xad,0xae,0x72,0xd0,0x65,
+    0xfb,0xfb,0x79,0xc0,0xb6,0xb3,0xec,0xd2,0x0d,0x5b,0x67,0x67,0xf6,0x2a,0x5d,0x18,
+    0x8b,0xde,0x12,0xc3,0x85,0x3b,0xfc,0x79,0x17,0xe4,0x5b,0x8d,0x48,0x82,0x90,0xda,
+    0xc8,0x4f,0x59,0x11,0xe8,0x5c,0xc3,0xe0,0x31,0x37,0xc6,0x2c,0x2b,0x93,0x01,0x94,
+    0x49,0x1b,0x65,0xc6,0xaa,0x5c,0xed,0x3c,0xd9,0xaa,0x9f,0xb0,0xad,0x2a,0x47,0xf1,
+    0xc9,0x54,0x7d,0x5c,0x53,0xf5,0xc9,0x48,0x7a,0x32,0x92,0x66,0x30,0x92,0x34,0x1f,
+    0xd3,0x93,0x8d,0xf4,0x64,0x23,0x3d,0xd9,0x48,0x1f,0xb5,0x8d,0x24,0xe4,0xf3,0x37,
+    0x81,0x17,0xc6,0xe7,0x8d,0xa0,0x18,0x0f,0x32,0xbf,0xbd,0x24,0x60,0x3e,0xd9,0x4d,
+    0xf7,0xb7,0x9b,0xa8,0xef,0x16,0xcc,0x89,0x43,0x54,0x9e,0xae,0x3e,0x3c,0x3b,0xb6,
+    0xfa,0x6d,0x77,0x6d,0x29,0x76,0xef,0x65,0x6c,0xd9,0x4d,0xd9,0x58,0xd3,0xb6,0xc4,
+    0x40,0x7e,0x68,0xa3,0x4b,0xb4,0x7b,0x6f,0xc3,0x4b,0xce,0xd1,0x47,0xb4,0xbe,0x44,
+    0x1f,0x1e,0xcb,0x59,0x78,0xd0,0x9f,0xd5,0x51,0x38,0x85,0x86,0x01,0x00,0xfa,0xe0,
+    0x34,0xfc,0xe9,0xc7,0xdf,0xff,0x79,0x45,0xf8,0x03,0xe9,0x83,0xa2,0x20,0xee,0x1f,
+    0x19,0x02,0xeb,0x43,0x99,0xb5,0xdc,0x0b,0x69,0x2d,0x6c,0xde,0x4a,0xaa,0xa6,0x93,
+    0x33,0xa4,0xf8,0x87,0x30,0x71,0x6b,0xfb,0x66,0x7a,0x5e,0x99,0x93,0x98,0x39,0x5f,
+    0x4f,0xde,0xec,0x1e,0x1c,0xee,0xbf,0xb1,0xd6,0xac,0xdd,0xf0,0xd2,0xbb,0x4e,0x2d,
+    0x0c,0xc1,0x27,0x6c,0xbb,0x28,0x95,0x9e,0xd8,0x39,0xc0,0x93,0x34,0x85,0x12,0xa0,
+    0x72,0xd2,0x95,0xed,0xbf,0xfc,0xcf,0x7f,0x58,0xfb,0xc7,0xc7,0xfb,0xaf,0x4e,0x0e,
+    0x76,0x0f,0x8f,0xa1,0x8d,0xef,0x40,0x66,0xd3,0x16,0x2c,0x72,0x01,0xd6,0x89,0x95,
+    0xe9,0x1e,0xe2,0x39,0x1a,0x61,0x4f,0x5e,0x88,0x48,0xfc,0xfb,0xef,0xac,0xa3,0xd7,
+    0x27,0x07,0x47,0xaf,0x76,0x0f,0xa1,0x85,0xfd,0x2b,0xc0,0x6f,0x9e,0xde,0x9b,0x6b,
+    0x83,0xbb,0x8f,0x68,0x71,0x90,0xd3,0xb6,0x9f,0x8c,0x27,0x95,0x77,0xba,0x61,0x37,
+    0xf5,0x19,0xdc,0xb4,0x1f,0x73,0xcd,0xa0,0xd4,0xdd,0xa3,0xae,0x1b,0x8c,0x01,0x9d,
+    0x73,0xfd,0x50,0x72,0x44,0x49,0xa9,0xc0,0x72,0x53,0xb0,0xa2,0xe1,0x59,0x43,0xe5,
+    0xf3,0xe6,0xde,0x6c,0x51,0xed,0x26,0x1b,0x94,0xd8,0x9d,0xf5,0xa1,0x09,0x26,0x5a,
+    0xc5,0xf8,0x04,0x54,0x57,0x33,0xd4,0xc7,0x62,0x85,0xfa,0x85,0xc8,0x84,0x3d,0x5d,
+    0x89,0x4f,0x09,0xad,0x5e,0x46,0x90,0x0e,0x6d,0xde,0x46,0x8d,0xc5,0x63,0xa2,0xa1,
+    0x22,0x3f,0xaa,0xb1,0xbd,0xd5,0xa9,0x00,0x9c,0xc5,0xb1,0x15,0xc6,0xd1,0xb9,0xd5,
+    0x00,0xa3,0xd0,0xda,0xea,0x58,0xfd,0xa1,0x97,0xa4,0x8e,0xd1,0x00,0x82,0x16,0xa0,
+    0xd6,0x15,0x28,0x54,0xf4,0x06,0x84,0xf5,0x32,0x08,0xc2,0xa4,0x34,0xac,0xc9,0xbe,
+    0x6e,0x4d,0x12,0xcd,0x9a,0xc4,0xf2,0x93,0x24,0x74,0x8d,0xc8,0x09,0xb9,0x36,0xd9,
+    0x99,0x1e,0xd5,0x43,0x9b,0x63,0xb6,0x25,0x1e,0xf4,0xa2,0xa4,0x29,0x2b,0x4f,0x29,
+    0x57,0xaa,0xd8,0xb1,0x13,0xa0,0x2a,0x65,0xd0,0xc9,0xf4,0x81,0xe5,0x8a,0x55,0x85,
+    0x32,0x01,0x0e,0x30,0x6f,0x57,0x75,0x28,0x76,0x53,0x7b,0x42,0xfe,0xa4,0x21,0x22,
+    0x50,0xb0,0x32,0x86,0xad,0x64,0x7e,0x72,0xf2,0xff,0xe5,0xbf,0x7e,0x2d,0x25,0x88,
+    0xb5,0x62,0x37,0x11,0xf7,0xa6,0xbd,0x62,0xb1,0x25,0x84,0xbf,0x6c,0x7f,0x04,0x41,
+    0x6f,0x61,0xec,0xf9,0xf0,0x83,0xcb,0x26,0x15,0x2d,0x02,0xa8,0xd3,0x48,0x91,0xfc,
+    0xc1,0xa7,0x51,0x7a,0x0e,0xf8,0x4f,0x43,0xfb,0x4f,0xbf,0xb1,0x64,0x14,0x22,0xd4,
+    0xa0,0x8b,0xd2,0x92,0xe0,0x11,0x8c,0x4e,0x89,0x60,0x20,0xeb,0x1c,0x1d,0xd0,0x1f,
+    0xdd,0xc5,0x91,0xb5,0x02,0x90,0x95,0xb0,0x08,0x0b,0xbd,0x34,0xc5,0xd3,0x50,0xed,
+    0x2c,0x3e,0x3f,0x0f,0x61,0x01,0xce,0x89,0xd3,0x0a,0x60,0x99,0xee,0xf0,0xf9,0x3e,
+    0xf2,0x82,0x28,0x47,0x55,0x93,0x33,0x00,0x7a,0x47,0x38,0x07,0xfc,0x6b,0x18,0x9e,
+    0xa0,0x5f,0x58,0xef,0x15,0xb8,0x89,0x15,0xe0,0x52,0x2d,0xc2,0x53,0x6d,0x60,0x64,
+    0xb2,0x96,0xd8,0xca,0xaf,0xcd,0x95,0x3c,0xac,0x00,0xd1,0x58,0x84,0xf9,0x92,0x87,
+    0x6d,0x96,0x42,0x5d,0x65,0xcb,0x00,0xcd,0x0a,0x50,0xbc,0x50,0x3d,0xa4,0x8a,0xf6,
+    0x14,0xb5,0x60,0x92,0x36,0x00,0x14,0xee,0xf8,0x47,0x6c,0xd1,0x4d,0xc3,0xc1,0xe5,
+    0xe9,0xc0,0xe2,0xb9,0x3b,0x39,0xc1,0x77,0x80,0x58,0x18,0x27,0xac,0x1d,0xf7,0x11,
+    0xbc,0xc1,0xdf,0x0c,0xb3,0x51,0x88,0x9e,0x27,0xa3,0x75,0xb5,0xda,0xc4,0x02,0x85,
+    0x38,0xa5,0x9b,0xca,0xce,0x72,0x2d,0x51,0xe8,0xef,0x5d,0x0b,0x4f,0x37,0x72,0xea,
+    0x6f,0x39,0x09,0x19,0x24,0x24,0x1d,0x1e,0x0f,0xe3,0xf1,0x18,0xac,0x03,0xac,0xda,
+    0xe0,0x21,0xaf,0x1a,0xc3,0x15,0xf9,0xdc,0xb9,0xd1,0x42,0xa4,0x72,0xcc,0xc9,0x78,
+    0x0a,0xb8,0x1b,0x0f,0xb8,0xf2,0x58,0xef,0x70,0xca,0x91,0x5f,0x28,0xc9,0xf8,0x68,
+    0xe8,0x27,0x2e,0x09,0xdb,0xe3,0x84,0x5c,0x04,0xf1,0x24,0xe5,0x25,0x8f,0x83,0xb3,
+    0x10,0x3a,0xa7,0xe9,0x21,0x28,0x57,0x98,0xe5,0xe4,0x6a,0xec,0x45,0x3e,0x57,0x40,
+    0x14,0x43,0x12,0x6a,0x04,0xe1,0xe7,0x87,0xd3,0x86,0xcd,0x0a,0xd2,0x83,0x83,0x37,
+    0x4b,0xb9,0x32,0x82,0x68,0xaa,0x44,0x2f,0xf7,0x9d,0x72,0x00,0x98,0x41,0xa1,0x37,
+    0x4e,0xe9,0xd7,0x25,0xaa,0x3b,0x34,0x97,0xc0,0xbb,0xc9,0xc6,0xd6,0xd7,0x2f,0x6c,
+    0x21,0x00,0x4a,0xa1,0xeb,0x00,0x8a,0xe0,0xb5,0xb6,0xcb,0xa1,0xef,0xd9,0xb9,0x33,
+    0x54,0x02,0x1a,0x4e,0xf9,0x29,0xf2,0x80,0x5a,0xe8,0x6b,0xf2,0x20,0xb5,0x26,0x1b,
+    0x08,0xe5,0xbd,0x7b,0xd2,0xe2,0xe1,0x07,0x50,0x6a,0xfe,0x52,0x12,0xe7,0xd8,0x8e,
+    0x55,0xfe,0xb9,0x88,0x30,0xfb,0x90,0x7d,0x48,0x22,0xec,0x99,0x44,0x00,0xe9,0x70,
+    0x9c,0x79,0x19,0x18,0xa4,0xe2,0x9c,0x78,0x2b,0xa5,0xcf,0x40,0x13,0x71,0xfe,0xfa,
+    0xad,0xcd,0x5e,0xd9,0x2d,0xf3,0x48,0x39,0x2f,0x7b,0xda,0x9a,0xd0,0xe3,0xb5,0xc7,
+    0x93,0x11,0xac,0xd4,0xaf,0xa1,0x13,0xec,0xf9,0xfb,0x83,0x02,0x54,0xbd,0xed,0xca,
+    0x42,0xdc,0x9b,0x3e,0xd7,0xe9,0x7f,0x4a,0x22,0x1c,0xa8,0x59,0x8e,0xfd,0x03,0x95,
+    0xb0,0x28,0x3b,0xfd,0xdf,0x4e,0x8b,0xae,0x65,0x81,0xb0,0xe8,0x35,0x05,0x7f,0x96,
+    0x45,0x2c,0x8a,0x5f,0x54,0x2c,0x81,0xcf,0x2a,0xac,0x41,0x51,0x6c,0x05,0x6b,0x28,
+    0x6d,0x7a,0x46,0xb5,0xe9,0x59,0xbd,0x36,0xe5,0x2d,0x4a,0x1a,0x7e,0x4b,0x0f,0xb7,
+    0x13,0xff,0x24,0x00,0x11,0x89,0xae,0x7e,0x5c,0x3a,0xe0,0x29,0x8f,0x6b,0x68,0x90,
+    0x7d,0x34,0x16,0x13,0xac,0x9e,0xb2,0xdd,0xb0,0x26,0x3d,0x89,0x9e,0x1b,0x24,0xa8,
+    0x73,0xbf,0x06,0x24,0x9c,0xb2,0x13,0xad,0x88,0x45,0x6a,0xeb,0xaa,0x0b,0xcf,0x81,
+    0x4b,0xd5,0xe5,0x53,0xbd,0x55,0x33,0xe5,0x52,0x06,0x1c,0x2c,0xdc,0xc4,0xb7,0x98,
+    0xf9,0x68,0x3b,0x6f,0x3b,0xa7,0x39,0x07,0xbe,0xdf,0x1e,0xd0,0x63,0xef,0xf3,0x03,
+    0x5a,0x37,0x01,0x85,0xf1,0xe5,0x22,0x70,0x36,0x4c,0x38,0xa0,0x65,0x41,0x0f,0x9a,
+    0x33,0x6c,0x0f,0xf3,0x26,0x28,0x2e,0x47,0xa3,0xb8,0x75,0x81,0x07,0x9a,0xd5,0x14,
+    0x93,0x69,0x16,0xde,0xe2,0xd7,0xd3,0xe2,0x4c,0x83,0xf2,0x3b,0xeb,0xdd,0xce,0x69,
+    0x89,0xe6,0x94,0x8e,0xe7,0xf2,0x99,0x8c,0x27,0x83,0x5a,0x54,0x01,0x2f,0x30,0xad,
+    0x70,0x21,0xa0,0x65,0xd5,0x60,0x2b,0x98,0xb9,0x27,0x1b,0xae,0x26,0xd4,0xbc,0xc9,
+    0x81,0x81,0x29,0x52,0x3d,0xa7,0x72,0x13,0xaa,0x0d,0x6b,0x05,0x89,0x10,0x87,0x0a,
+    0xaf,0x6f,0x6f,0xf1,0x5b,0x99,0xd6,0x06,0x3b,0x0d,0xf9,0x1f,0xb5,0x76,0xae,0xe3,
+    0xe9,0x2e,0x9d,0x6e,0x6e,0x55,0xbd,0x7c,0xc0,0x78,0x44,0x2e,0xff,0x01,0xd6,0xdf,
+    0xcb,0xa2,0x1a,0x9d,0xd5,0x35,0x73,0x98,0x95,0x67,0xfd,0x53,0xfd,0xc5,0xd3,0xb9,
+    0xde,0x7b,0x10,0xe6,0xb6,0x18,0x06,0xe4,0x09,0xe2,0x7f,0x3d,0x3b,0xfa,0xbc,0x86,
+    0xda,0xa5,0x9b,0xb3,0x3e,0xab,0x20,0x0c,0x69,0xd6,0xcb,0x9b,0x25,0xd5,0x8f,0x12,
+    0x25,0xa6,0x28,0xd8,0x5b,0x92,0xed,0x4d,0x29,0xc7,0xed,0xea,0x52,0xb8,0x54,0xf7,
+    0xe9,0x85,0x6b,0x5b,0x57,0xe3,0x50,0xd6,0x76,0x01,0x56,0x5d,0x07,0x15,0xa8,0xe2,
+    0x74,0xec,0xb4,0x68,0x58,0x6c,0xe9,0xb7,0x75,0xf9,0xed,0xae,0xe4,0xeb,0x86,0x1a,
+    0x6c,0x8e,0x75,0xb1,0x4c,0x8e,0x05,0xc4,0x10,0xee,0x74,0xba,0xeb,0x5a,0x5d,0x2e,
+    0x99,0xe5,0x3c,0x66,0x12,0x9b,0x9a,0xc9,0x4b,0x05,0xb9,0x5b,0x2c,0xf5,0x6a,0x82,
+    0x59,0x5f,0x54,0x32,0x10,0xe3,0x38,0x02,0x7e,0xce,0xc1,0x61,0x1c,0x7b,0x42,0xd9,
+    0x51,0x75,0x94,0x09,0xa4,0x32,0x24,0x2f,0x04,0x3b,0x2f,0xd3,0x32,0x35,0x14,0xac,
+    0x21,0x60,0x05,0x92,0xcf,0x0d,0x3f,0x18,0xf1,0x50,0x76,0xec,0x4b,0xef,0x34,0xcf,
+    0xb4,0xb0,0x2c,0x53,0x2d,0xec,0x61,0x11,0xcb,0x0b,0x43,0x8b,0x21,0xd0,0xb2,0xf6,
+    0x18,0x51,0x5b,0x16,0x58,0x41,0xd6,0x6b,0xe6,0x17,0x07,0x9d,0x6b,0x29,0x20,0x3b,
+    0x9a,0x04,0x28,0xea,0x2a,0xda,0x28,0x00,0xdc,0xa1,0x3e,0x12,0xe5,0x18,0xb7,0x4b,
+    0x8f,0x9c,0x57,0x1c,0xfb,0xd8,0x2c,0x3b,0xae,0xc6,0xfa,0x9a,0xcf,0x65,0x50,0x44,
+    0xf6,0x88,0x7b,0xc9,0xef,0x81,0xaa,0x00,0xc1,0x84,0xf2,0x3c,0xe8,0x0a,0x17,0xfd,
+    0x5c,0xc8,0x3e,0x5f,0x1c,0x59,0xbe,0x6d,0x53,0x83,0x2b,0xc7,0xd1,0x44,0x51,0xec,
+    0xf7,0xcc,0x8d,0xa1,0x3a,0x50,0x37,0x3b,0x82,0x1b,0x8b,0x23,0xa8,0xec,0xae,0x54,
+    0x38,0x70,0x07,0xdc,0xc2,0xa2,0xd6,0x95,0x5b,0xbb,0xd2,0x88,0x2e,0xa4,0x53,0xcf,
+    0xa2,0xea,0xb3,0x1b,0xc5,0x59,0x43,0x66,0x30,0x11,0xdb,0x19,0x16,0xba,0x27,0x56,
+    0x4e,0x1d,0x40,0x8a,0x79,0x21,0xf9,0x36,0x75,0x9c,0xa1,0xdb,0x7b,0xfe,0x56,0x0c,
+    0x38,0xac,0xc3,0x34,0xda,0x24,0xdf,0x77,0xd7,0x55,0x4d,0xec,0xd8,0x38,0x5a,0xca,
+    0x67,0x99,0xda,0x5d,0xfb,0x22,0x48,0x03,0x3c,0xd2,0x22,0x6a,0xb1,0xd1,0xb2,0x1a,
+    0x76,0x33,0x07,0xa7,0x69,0x5b,0xf1,0x00,0x77,0xba,0x25,0xb0,0xa6,0xed,0xd8,0xbd,
+    0x3c,0x47,0x1c,0x43,0x47,0x44,0x3d,0xec,0x0a,0x54,0xca,0x62,0xeb,0xe8,0xfb,0x13,
+    0x8b,0x89,0x54,0xca,0x15,0x69,0x16,0xf7,0xdf,0x33,0xc5,0xba,0x63,0xa8,0x79,0xde,
+    0x97,0x03,0x6a,0xa6,0xbc,0x3d,0xad,0x37,0xef,0x16,0x20,0xbc,0x30,0xeb,0x69,0xd2,
+    0x2c,0x15,0x00,0xc4,0xbc,0x84,0xf8,0x52,0x0b,0x89,0xd1,0xc1,0x43,0xd5,0x19,0x62,
+    0x59,0x94,0x8d,0xa5,0x01,0x2c,0x4b,0x1d,0x06,0xef,0x55,0x9d,0x80,0xe6,0x01,0xa3,
+    0x35,0x78,0xfc,0xcc,0xea,0xaa,0x84,0x21,0x22,0x6a,0x74,0xc2,0xb0,0x4c,0x58,0x37,
+    0x81,0xdf,0xad,0x6c,0x00,0x78,0xbd,0x05,0x40,0xbb,0x02,0x30,0x95,0xeb,0x5d,0x09,
+    0xf5,0x8e,0xf9,0x7e,0xa0,0xe5,0x1c,0x5c,0x91,0x83,0xca,0x55,0xde,0xf1,0x57,0xb1,
+    0x18,0x13,0xce,0x16,0x30,0x9c,0x74,0xd6,0x14,0x0f,0x18,0x5e,0xa3,0xfb,0xc8,0x35,
+    0x72,0x24,0xdd,0xb0,0xb8,0x12,0xbd,0x19,0x6c,0x19,0x39,0x30,0x0e,0x49,0x1b,0x83,
+    0x67,0x80,0x69,0x68,0x1e,0x25,0x06,0x57,0x00,0xea,0xda,0x2d,0xfe,0xcb,0x99,0x2e,
+    0x2e,0x74,0x86,0xbe,0x77,0xc2,0x2b,0xde,0xac,0x7e,0x6c,0x3e,0xdf,0x5f,0x26,0x53,
+    0x12,0x92,0x8e,0xe1,0x2d,0x81,0x8e,0x26,0xdc,0x62,0x6b,0x51,0xf9,0xd4,0xcb,0xa7,
+    0x3a,0xf9,0xd4,0x8e,0x6b,0xd7,0x4b,0x4c,0x9a,0xca,0x47,0x8c,0x42,0xc5,0x32,0xd2,
+    0x43,0x34,0x4a,0x76,0x02,0x44,0xa6,0xae,0xb4,0x9f,0xc4,0xa0,0x54,0xe2,0xc6,0x0d,
+    0x0d,0x63,0x6a,0x9d,0x91,0xa1,0x77,0x11,0xc4,0x49,0xd7,0x4e,0x47,0x71,0x9c,0x0d,
+    0xed,0x3b,0xb9,0x90,0x56,0xeb,0xde,0x25,0xb9,0x5f,0xf0,0x7b,0xeb,0x18,0x5a,0xa0,
+    0x3b,0x03,0xb9,0x8e,0xe3,0xdb,0xea,0x7e,0x73,0x23,0xe7,0x1f,0x83,0x6c,0xc8,0xd2,
+    0x8a,0x15,0x97,0x76,0x2d,0x69,0x96,0xcd,0xbf,0xc2,0x63,0x29,0xc6,0xee,0xb7,0x58,
+    0x2f,0x38,0xff,0x71,0xba,0x30,0x2b,0x41,0x5b,0x1f,0xe2,0x06,0x49,0x4b,0xdf,0xe6,
+    0x69,0x89,0x01,0x67,0x3a,0x93,0xeb,0x2f,0x8f,0x82,0x71,0xc7,0xc0,0x39,0x63,0x1c,
+    0xd5,0x61,0x0c,0x72,0x8d,0xbf,0xa5,0x52,0x58,0xed,0xb5,0x74,0xdf,0x45,0xef,0xa2,
+    0x75,0xdc,0xe0,0xc7,0x7c,0x1f,0xd8,0xe8,0xbb,0x68,0x03,0x1e,0x59,0x5a,0xa7,0x77,
+    0xd1,0x26,0x46,0x17,0x80,0x45,0x8e,0x73,0xdf,0x0f,0x06,0x03,0x42,0x03,0x03,0x85,
+    0xf0,0xc3,0xca,0x2c,0x64,0x67,0xbd,0x65,0x6d,0xb4,0x2c,0x00,0xbd,0xd9,0xe5,0x72,
+    0x8d,0x77,0x02,0x8c,0xe8,0x75,0x5c,0x42,0x61,0xd2,0x04,0x04,0xaf,0x90,0xc9,0xe1,
+    0x41,0x31,0x33,0x90,0x41,0x1b,0x18,0x07,0xd9,0xca,0x41,0xdb,0xb0,0xcb,0x73,0x79,
+    0x29,0x9c,0x76,0x2a,0xb2,0x76,0xb1,0xbc,0x60,0x5a,0xd6,0x2e,0x39,0x94,0x95,0xb9,
+    0x8a,0x3e,0xb5,0x09,0x5c,0x91,0x8d,0xab,0x48,0xc5,0x4d,0xb9,0xac,0x65,0x43,0x19,
+    0x90,0xe9,0x3a,0xb7,0x34,0xa8,0x96,0xa8,0x88,0x5a,0x05,0x8a,0x69,0x29,0x78,0x0f,
+    0x36,0xc0,0x1a,0xa6,0xda,0x28,0x0b,0xae,0x65,0x7a,0x88,0xf7,0x01,0x17,0x7f,0xae,
+    0x06,0xe0,0x87,0x38,0x88,0x1a,0xf6,0xbb,0xc8,0xce,0xa5,0xfd,0x92,0x2c,0xcd,0x3a,
+    0x66,0xb1,0x70,0x00,0xc9,0x8e,0x94,0x99,0xa9,0x23,0x04,0xc1,0x35,0x6d,0xc5,0x9e,
+    0x2a,0xa2,0x6c,0x32,0x3a,0x23,0x49,0x57,0x2d,0xaa,0x01,0xea,0xea,0x2a,0xfb,0x17,
+    0xf4,0xed,0x31,0x55,0x5e,0xc8,0x18,0xe5,0x2c,0x64,0xa4,0x7d,0x93,0x0c,0x54,0xcc,
+    0x14,0xf3,0xd9,0xb0,0x14,0x9d,0xfd,0x26,0x43,0x19,0xc2,0x4a,0x6c,0x74,0xea,0x02,
+    0x8b,0x05,0x03,0xcc,0x26,0x8f,0xfa,0xc5,0x4d,0x60,0x29,0x98,0x78,0x0a,0x91,0x3d,
+    0x29,0x72,0x94,0x78,0xd2,0x5e,0x4a,0x39,0x84,0x32,0x68,0xa3,0x42,0x06,0x71,0x46,
+    0xc2,0x10,0x49,0xd9,0x19,0x56,0x4d,0x4f,0x1c,0x43,0xe3,0x0a,0x40,0xb3,0xf3,0x1c,
+    0x08,0x8c,0x4d,0xb0,0x0e,0xe5,0x13,0xfc,0x81,0x86,0x19,0xc3,0xae,0x2a,0xb3,0x0b,
+    0xc0,0xda,0xd1,0x13,0xb5,0xd6,0xec,0xf7,0x33,0x90,0x9f,0x8f,0x08,0x2a,0x4b,0xf9,
+    0x72,0x37,0x8f,0x20,0x2f,0x61,0x06,0xba,0xb6,0xdc,0x3d,0x3c,0x04,0x3b,0x34,0xe5,
+    0x0b,0x4a,0x1c,0xf2,0xd2,0x9c,0x8d,0xcb,0xb5,0xd2,0x3f,0x37,0x30,0x9f,0xbb,0xd8,
+    0x2f,0xc6,0xae,0xa3,0x06,0xe6,0x71,0xeb,0x5a,0x18,0x87,0x1e,0x3e,0x54,0x9c,0x17,
+    0xf2,0x2c,0x94,0x98,0x55,0x2c,0xce,0x47,0x5f,0xba,0x09,0x40,0x60,0x41,0x19,0x00,
+    0x0c,0xc1,0x6b,0x35,0x3a,0x6b,0xb6,0xd5,0xb4,0x1a,0xb5,0x7a,0x46,0xae,0x6e,0xd7,
+    0xd6,0x1d,0x28,0x6c,0x3b,0x5d,0xb5,0x56,0x92,0xed,0xf0,0xc5,0x91,0xde,0x0d,0x33,
+    0x13,0x0e,0x5b,0xa1,0xea,0xd1,0x2b,0x34,0x18,0xc1,0x28,0xa6,0xf8,0x2f,0x26,0xa9,
+    0x4a,0x09,0x4a,0xa1,0xe1,0xf1,0x79,0xe0,0x11,0x91,0x09,0x88,0x72,0xdd,0x3f,0xed,
+    0x1f,0x5b,0xae,0x75,0x9c,0x61,0x54,0x27,0x7e,0xe6,0x7e,0x8e,0x06,0xc6,0x7d,0x3a,
+    0xef,0xa2,0x57,0x47,0xf0,0x15,0xcf,0xea,0x13,0x3c,0xab,0x8f,0x91,0x98,0xf8,0xe9,
+    0x8f,0xbf,0x83,0x25,0xa8,0x91,0x68,0x8e,0xfa,0xf8,0xca,0x32,0xac,0xd0,0x8c,0xa4,
+    0x94,0x4b,0x01,0x7b,0x0d,0x67,0xa4,0x05,0x17,0x25,0xf0,0xb3,0x2a,0x78,0x88,0x96,
+    0xca,0x85,0xec,0xc0,0x1b,0xed,0x99,0x7e,0x37,0x49,0x05,0x2f,0xf3,0xaf,0x0a,0xc9,
+    0x5d,0x3e,0x9e,0x09,0x52,0x1d,0x92,0x33,0x35,0x77,0x0b,0xc6,0x2c,0xea,0xb9,0x88,
+    0xf9,0x52,0x41,0x28,0xa9,0x0b,0x6e,0xaf,0xcb,0x9c,0xe8,0xec,0xa5,0x74,0x81,0x96,
+    0x7e,0xe5,0x04,0xd3,0xbe,0xa9,0xb4,0xd2,0xf4,0x1d,0xdf,0xe5,0x91,0x7b,0xa5,0x5c,
+    0x0a,0xca,0xc6,0xc4,0x16,0xe2,0x8d,0xd9,0x05,0xf6,0x1e,0x7f,0xf1,0xd9,0xae,0x7f,
+    0x67,0x1f,0xa1,0xf3,0x73,0x7b,0x8e,0xca,0x1c,0x21,0xf8,0x9b,0xf5,0x53,0x25,0x27,
+    0xaa,0xf2,0x30,0xf0,0xbd,0x56,0x87,0xef,0xca,0x1a,0x41,0x36,0x1c,0x4f,0x17,0xba,
+    0x7d,0x7b,0xab,0x81,0x15,0x58,0xee,0xd8,0x18,0xbd,0x0b,0x93,0x80,0x45,0xec,0xdc,
+    0xd5,0x6f,0x9c,0xde,0x99,0xc4,0x14,0xfe,0x48,0x3e,0xed,0x8e,0x0b,0x44,0xcd,0x0f,
+    0x87,0x6b,0x94,0xab,0x18,0xb2,0x5c,0x29,0x93,0xe0,0xf9,0xd2,0xb9,0xa2,0x0f,0x49,
+    0x7e,0x31,0x17,0xa7,0xd2,0x5f,0x3a,0x48,0xb9,0x6d,0x0c,0xb2,0x7d,0x12,0xfa,0xc7,
+    0x20,0xe1,0x5d,0x94,0x2f,0x54,0xe8,0xe5,0x11,0x02,0x8c,0x9c,0x42,0x29,0xa1,0x91,
+    0x8d,0xa2,0xb9,0x92,0x0d,0xbd,0x63,0xf0,0xa9,0xb2,0x56,0xa7,0xba,0x56,0xa7,0x9c,
+    0x4f,0x54,0xf9,0x85,0x39,0xa2,0xba,0x14,0xa3,0x6a,0xfc,0x9e,0x79,0x41,0x3b,0xad,
+    0x10,0x6c,0x54,0xfe,0x13,0xf4,0x2a,0xff,0xd9,0xbb,0xff,0xd8,0x61,0xec,0x46,0x01,
+    0x35,0xbc,0x05,0x80,0xa2,0x22,0x82,0x30,0x17,0x98,0x57,0x62,0x2b,0xf2,0x25,0x90,
+    0x8f,0xa3,0xd1,0x6c,0x2a,0xea,0xa7,0x72,0xb0,0x04,0x66,0x65,0x5f,0x37,0x1c,0x81,
+    0x2c,0x7c,0xbd,0x53,0xab,0xad,0xc4,0x4f,0xdd,0xb9,0xf7,0xce,0xb9,0x02,0x86,0xba,
+    0x6f,0x3b,0xa7,0x8e,0xf8,0x91,0xdb,0x4e,0xe7,0x1d,0xd5,0x4a,0xae,0x8b,0x92,0xc6,
+    0x06,0xbe,0xe8,0xb5,0x56,0x74,0x43,0x14,0x35,0xf6,0xe8,0x05,0x0a,0x5c,0x4c,0x73,
+    0x45,0x20,0xf2,0xf9,0xf0,0x49,0x89,0xae,0x6d,0x3b,0x97,0x65,0x8c,0x31,0x66,0xfe,
+    0xb3,0x64,0x1c,0xea,0x80,0xc9,0x83,0x68,0x30,0xf1,0x82,0x1b,0xac,0xa5,0x2d,0xb0,
+    0xcf,0xb5,0x2c,0xf3,0x45,0x18,0xf7,0xd7,0xa0,0xa5,0x16,0xfd,0xc1,0x27,0x88,0x78,
+    0x08,0xc6,0x1a,0xfb,0xe0,0x1e,0xfa,0xf6,0x59,0xed,0xc6,0x67,0x5d,0x80,0x3a,0x42,
+    0x14,0x9e,0x76,0xc7,0xdc,0x61,0x55,0x3b,0xa7,0xb5,0x31,0x21,0xf4,0xa3,0x4e,0xa4,
+    0x02,0x01,0x72,0x14,0x9c,0x05,0x7d,0xbe,0x75,0x4d,0x29,0xc0,0x7f,0xc7,0xef,0xe5,
+    0x4f,0x18,0x72,0xf5,0x7a,0x92,0x3d,0x1c,0x35,0x38,0xcc,0x07,0x21,0x88,0xfe,0xf1,
+    0xe6,0x61,0x44,0x7b,0x99,0x74,0x2e,0x65,0x31,0x14,0x1b,0xc8,0xa7,0xce,0x3d,0x55,
+    0x42,0x15,0x7c,0x96,0x70,0x9c,0x95,0x63,0xbb,0x0c,0x1c,0xfc,0xb2,0x21,0xf4,0xf9,
+    0xa5,0x2f,0xf5,0x70,0x80,0x9f,0x4d,0x20,0x9d,0x22,0x90,0x3b,0x0d,0x8a,0xce,0x4f,
+    0x02,0xd7,0xd5,0x55,0x55,0xc5,0xb9,0x9f,0x25,0x52,0xda,0x0e,0xf6,0x35,0x7e,0xcf,
+    0x7b,0xca,0x3e,0x6c,0x77,0x6a,0x71,0x35,0x6b,0x03,0xdb,0xe6,0xaa,0x4f,0x25,0x56,
+    0xa1,0x79,0xe0,0x75,0x03,0xc0,0x46,0x29,0xa1,0x7e,0x16,0x15,0x29,0x76,0x39,0x35,
+    0xae,0xae,0x95,0xa0,0x35,0xd2,0xb3,0x6e,0x36,0xb0,0xa9,0xc7,0xa2,0xe8,0x1e,0x52,
+    0xca,0xd1,0xf9,0x50,0x3d,0xa1,0xa7,0xc9,0x84,0x29,0xd5,0x6b,0xe5,0x01,0x43,0x49,
+    0xa5,0x66,0xa0,0x3b,0x05,0xd4,0xd9,0x05,0xcb,0x2d,0x5c,0x6e,0xfb,0xba,0xd5,0x69,
+    0x2e,0x11,0x5c,0x2c,0x2e,0xcc,0xcd,0x92,0xf5,0x03,0xdd,0xba,0x32,0xec,0x4c,0xb3,
+    0x18,0x96,0x99,0x66,0x60,0x56,0x46,0xba,0xaa,0xa8,0x31,0xb6,0x85,0x35,0x2d,0xe8,
+    0x6b,0x66,0xd9,0x45,0x7b,0x8e,0x06,0xe5,0x8d,0xf9,0x55,0x39,0x79,0x58,0x99,0x4e,
+    0x79,0xe4,0xd4,0x1c,0x21,0x53,0x6c,0xa3,0x78,0x96,0x8a,0x22,0x56,0x8b,0x75,0x51,
+    0x54,0xcb,0xf7,0x51,0xbc,0xad,0x8d,0x21,0x5b,0x5d,0x5d,0x2e,0x8d,0x71,0x2a,0x89,
+    0x36,0xe3,0x01,0xe0,0x5a,0x13,0xb3,0x57,0x35,0x69,0xb5,0xee,0xdc,0x94,0x04,0x89,
+    0xcd,0x16,0x1d,0xf6,0x78,0x94,0x2a,0x8b,0xe0,0x9a,0x8d,0x50,0xb3,0xd6,0x34,0xe9,
+    0xb4,0x21,0xae,0xdc,0x58,0x00,0xdf,0x32,0x0c,0x77,0x66,0xc3,0xb5,0xbb,0xa0,0x94,
+    0xce,0xef,0xeb,0x25,0x04,0x23,0x97,0xc3,0xf0,0x73,0x8f,0x33,0x41,0x4f,0xad,0xda,
+    0x96,0x67,0x0e,0xdb,0x07,0x0e,0x36,0x79,0x83,0xa4,0x2c,0x09,0x37,0xf9,0x76,0x12,
+    0x86,0x35,0x97,0xf9,0x3c,0xc5,0x9b,0x7c,0x62,0xf1,0x26,0x74,0xca,0xfc,0x0c,0xf1,
+    0x26,0x14,0xee,0x8c,0xf1,0x26,0xb4,0x2c,0x9a,0x12,0x3f,0x7f,0x78,0x09,0x63,0xeb,
+    0xcf,0x35,0xbc,0x84,0x61,0x67,0x84,0x69,0x70,0x3b,0x83,0x9d,0x4d,0xab,0x5c,0xd5,
+    0x8b,0x12,0xd3,0x97,0xf5,0xc7,0xa5,0xb0,0xd4,0xea,0xb6,0xa2,0xad,0x19,0x16,0xb8,
+    0x6f,0x03,0xff,0x9f,0xdd,0x15,0x7a,0xa9,0x24,0xda,0xa6,0x78,0x1f,0xd9,0x83,0xad,
+    0x61,0x05,0xd0,0x39,0x56,0xb1,0x02,0xd1,0x9a,0xe5,0x7d,0x09,0xd1,0x8a,0x84,0x98,
+    0x77,0x9d,0xaf,0x91,0x81,0xab,0xd9,0x07,0xa7,0xc4,0xfc,0x4b,0xfa,0xe9,0xc4,0x28,
+    0x2b,0x34,0xe5,0x4c,0x8b,0xb8,0x3e,0xb4,0x42,0x98,0xf3,0xc5,0x34,0x0a,0x44,0x77,
+    0xea,0xc2,0xbc,0xa7,0xb9,0x02,0x6b,0x6b,0x88,0x35,0xad,0x21,0xb8,0x68,0x56,0x45,
+    0x1e,0x48,0xe9,0x41,0x95,0xae,0x38,0xeb,0x84,0xf5,0x5b,0x62,0x61,0x0f,0x6f,0xb5,
+    0x5e,0xf1,0x46,0x43,0xce,0xe9,0xdf,0x61,0xc0,0xb9,0x5b,0xc1,0xff,0x6c,0x32,0xdd,
+    0xde,0x36,0x2a,0xbf,0x2b,0xdf,0x81,0x8e,0x38,0xbf,0xc4,0xcc,0xa9,0xaf,0x49,0xbd,
+    0x05,0xf9,0x6a,0xf2,0xb2,0x25,0x45,0x97,0x7c,0x07,0xf3,0x0b,0x69,0xb3,0x7b,0xc6,
+    0x57,0xb6,0x4c,0xd7,0xc8,0x4b,0xb7,0xfc,0xab,0xcb,0xb3,0x55,0x79,0xae,0xfc,0x86,
+    0x5d,0xb1,0xa1,0x91,0xa3,0x9f,0xa8,0x44,0x1f,0xaa,0x37,0x33,0x04,0xab,0xd5,0xbb,
+    0xae,0xcb,0x4a,0xdd,0xe8,0xc6,0xc9,0x21,0xd8,0xaa,0x9d,0x16,0x7f,0x38,0x9a,0x4c,
+    0x75,0x5a,0xd7,0xb1,0x6c,0xa9,0xaf,0x5a,0xba,0xaa,0x75,0xcb,0xe8,0x3e,0x0e,0x6b,
+    0x5c,0xca,0xa8,0xce,0x97,0x7b,0xa5,0x15,0x3e,0xe8,0x97,0x36,0xb2,0xec,0xd5,0x4b,
+    0x86,0xd2,0x4c,0x7b,0xec,0x44,0x26,0x9e,0xae,0xe6,0x5b,0xbe,0xaa,0x81,0x6d,0x30,
+    0x2f,0xf0,0x0b,0xcd,0x25,0x34,0xf6,0x22,0x91,0x2a,0x85,0x27,0x3a,0x21,0x83,0xe7,
+    0xf0,0xdf,0xca,0xb6,0xdd,0xd4,0xfa,0x64,0x63,0xd0,0xf2,0xcb,0x67,0x58,0x9c,0x26,
+    0xae,0x51,0x00,0x01,0x23,0x04,0x08,0x2f,0x10,0xa6,0xc3,0x01,0xe3,0x86,0x6a,0xaf,
+    0xa6,0x91,0xc1,0xd6,0x57,0xa4,0x73,0xa6,0x35,0x82,0x84,0xb1,0xad,0xc3,0xa3,0x7f,
+    0x2c,0x6d,0x04,0x87,0xd9,0xed,0xac,0xae,0x6a,0x2c,0x00,0x46,0x12,0x43,0xaf,0xc3,
+    0x8d,0x69,0x14,0x0e,0x2c,0x8b,0xa0,0x71,0x7a,0xfc,0xae,0xe0,0xc1,0x90,0x3c,0xc6,
+    0x37,0xce,0x46,0xa0,0xda,0x1f,0x41,0xf0,0xa9,0xb5,0x17,0x76,0x40,0xcd,0x67,0xfe,
+    0x34,0x55,0xb8,0xc8,0x72,0x75,0xa2,0x64,0x5e,0x1f,0xda,0x4c,0x5a,0x0e,0x89,0xb7,
+    0xc6,0x1d,0x5c,0xe5,0x9a,0x8e,0xb5,0xa8,0x92,0xed,0xb8,0x36,0x4d,0xba,0xb7,0xb1,
+    0xb5,0xd5,0x12,0x7f,0x3a,0xed,0x75,0xc7,0x9e,0xa6,0xf7,0xf4,0x96,0xec,0x26,0x1d,
+    0xa8,0xd9,0x60,0x6f,0xe2,0xfa,0x68,0x36,0xc1,0xc3,0xd2,0x32,0x51,0xe3,0x58,0xb0,
+    0x82,0xf4,0xd1,0x9c,0xc5,0x57,0x64,0xca,0xce,0x10,0x9d,0x83,0xf4,0x56,0x69,0x27,
+    0xb7,0x8a,0x12,0xbb,0x6b,0x0c,0xbc,0x58,0x16,0x76,0xf8,0x81,0x31,0x0a,0x58,0xb9,
+    0xa6,0xce,0xf4,0x6d,0x4f,0xb7,0x7f,0xa6,0x2d,0x84,0x34,0xd6,0x53,0xc7,0x10,0xa5,
+    0x70,0xaa,0x17,0x61,0x37,0x08,0x89,0x39,0x60,0xb8,0x57,0x55,0xae,0x1a,0xf4,0x5e,
+    0xa2,0x4c,0x5a,0x50,0xca,0xcd,0xcd,0xfc,0xb7,0xb7,0x32,0xd6,0x83,0x9d,0x64,0x14,
+    0x1e,0xfd,0x46,0x19,0x9b,0x17,0xd6,0x2a,0x72,0xa8,0x30,0xa7,0x10,0x2c,0x07,0x28,
+    0x4f,0x34,0xed,0x16,0xef,0x7b,0x57,0x1c,0xb0,0xc4,0x57,0x14,0x73,0xcc,0xfe,0x04,
+    0xfa,0xfe,0x12,0x6f,0x37,0x54,0xf2,0x18,0x3f,0x83,0xc2,0xd3,0x5f,0x6e,0x18,0x9b,
+    0xc7,0xb4,0x29,0xcd,0x99,0xad,0x4d,0x52,0xe9,0x1a,0x62,0x65,0x0c,0x57,0x1f,0x2f,
+    0xc8,0x47,0xa0,0x04,0x5a,0xa1,0x28,0xdd,0xfc,0xc9,0x97,0xd4,0xba,0x55,0x2c,0x8f,
+    0xaa,0xbd,0xaa,0xfc,0x7a,0x49,0x79,0x49,0xfc,0x7c,0x1d,0x49,0xfb,0xb2,0x1a,0xb8,
+    0x3b,0x97,0x2f,0xbe,0xac,0x97,0xd7,0x18,0x4b,0x2f,0xc4,0xd4,0x9e,0xf6,0xc2,0xc9,
+    0xb1,0x3f,0x53,0x6e,0xda,0xdc,0x1b,0x79,0xc9,0x7b,0x58,0x03,0xe1,0x11,0x18,0xe2,
+    0x0b,0x4d,0x2f,0xaa,0x4c,0x75,0x41,0xa8,0xb9,0xd7,0x95,0x6e,0xd2,0xf9,0xe7,0x94,
+    0x68,0x6e,0x8e,0x85,0x7d,0x55,0x01,0x3c,0x75,0xec,0xa8,0xd5,0x7e,0x95,0xf7,0xc1,
+    0x76,0x94,0x0b,0x40,0xb6,0xae,0xae,0x3c,0x17,0x8b,0xc3,0xd7,0x21,0xf1,0x60,0x54,
+    0x44,0xc2,0x3f,0xcd,0x01,0x80,0xf4,0x32,0x13,0x46,0x49,0x47,0xd0,0x77,0x40,0x53,
+    0x0b,0xe6,0x41,0x1e,0x30,0xa8,0x57,0xf1,0x86,0x82,0x6a,0xa4,0x8e,0xe5,0xa5,0xcc,
+    0x3b,0x54,0x7b,0x14,0x4d,0x34,0xf7,0xd0,0x57,0xa7,0x8b,0xde,0x38,0x77,0x95,0x97,
+    0x53,0xa6,0xe7,0x53,0x92,0xa8,0x42,0x89,0xdc,0xce,0x38,0xcd,0x9f,0x54,0x86,0xba,
+    0xc0,0x38,0x11,0xbc,0xb6,0x6c,0xd3,0xca,0x4c,0x6c,0xf6,0xd3,0x94,0x7a,0xf0,0xca,
+    0xf2,0xca,0xd2,0xd4,0xab,0x09,0x4d,0xf2,0xc6,0xb2,0xb0,0x16,0x13,0xc8,0x31,0xa3,
+    0xe6,0x72,0x08,0x8d,0xc8,0x74,0x8b,0x98,0xa4,0x8f,0x26,0x45,0x35,0x52,0xca,0xe1,
+    0x1b,0x91,0x38,0xf6,0x2b,0xf8,0xaf,0x90,0x45,0xce,0xee,0xd5,0xe4,0x69,0xc3,0xcc,
+    0x48,0x86,0x97,0x01,0xb1,0x10,0xc9,0xd1,0x5a,0x9b,0x1d,0xf4,0x30,0x54,0xa4,0xb7,
+    0x31,0xfc,0x0e,0x48,0x87,0xea,0xa3,0x80,0xf1,0xf8,0x9a,0xd5,0xbb,0xd1,0x4e,0xca,
+    0xcf,0x34,0x1f,0x0d,0x2b,0x89,0xe5,0x17,0x11,0xc1,0x94,0x60,0xcd,0x92,0x42,0xc2,
+    0x68,0xcc,0x81,0xc7,0x93,0xe2,0xf2,0x1c,0x67,0x60,0xc2,0x06,0xca,0xd7,0x66,0xff,
+    0xe5,0x5f,0xff,0xdb,0x62,0x91,0xaf,0xf9,0x24,0xd1,0x72,0x12,0x05,0x39,0x07,0x5a,
+    0xce,0x7f,0xa6,0xce,0x69,0x01,0x4a,0x85,0x0c,0x66,0x30,0xe8,0xac,0xae,0x1e,0x5d,
+    0x4f,0x3b,0x71,0x11,0x9c,0x7b,0xd0,0x3b,0x10,0x1a,0xc1,0xf8,0x2c,0xf6,0x12,0x7f,
+    0x75,0xb5,0xe4,0x65,0xfb,0x32,0x81,0xfa,0xc8,0x3c,0x40,0xa8,0xda,0xef,0x0d,0x68,
+    0x4b,0x4b,0x96,0x74,0xa3,0x1d,0xe0,0xd9,0x8b,0xc7,0x01,0xbb,0x3e,0x4d,0xd6,0xa3,
+    0xc7,0x79,0xd8,0x29,0x9a,0x25,0x19,0x24,0x0e,0x08,0xb0,0x60,0xcc,0x10,0x46,0x06,
+    0xd7,0xb5,0x57,0x8c,0x02,0x6c,0x64,0xa7,0x14,0xd3,0x6f,0x83,0x8f,0x2f,0x23,0x74,
+    0xba,0x89,0x01,0xe6,0x07,0x91,0xc4,0xa2,0xae,0x3d,0x04,0x06,0xca,0x25,0x6a,0x13,
+    0x15,0x6c,0x93,0x45,0xc4,0x5e,0xeb,0x43,0xb2,0x0a,0x4b,0x61,0x34,0x7d,0x49,0xf6,
+    0x38,0xec,0x54,0x3c,0xfe,0xf7,0xb1,0xb3,0x15,0x3b,0x9b,0x91,0x2a,0x59,0x68,0x6c,
+    0x36,0xcc,0xce,0x76,0xb2,0xe2,0x8c,0xfc,0x57,0x5e,0xde,0xd0,0xfe,0x72,0xb3,0x99,
+    0xf8,0x05,0x43,0x60,0xae,0xfd,0x88,0xfb,0x2f,0xf4,0x17,0xf4,0xf2,0x3f,0xa0,0x31,
+    0x50,0xba,0x1f,0x30,0x75,0x3b,0xc0,0xb4,0x06,0x8c,0x7d,0xa9,0x5a,0xf7,0xd6,0x8e,
+    0x0d,0x1a,0x1b,0x37,0x9c,0xca,0x4b,0x71,0xd5,0x99,0xe2,0x6a,0x4a,0xdb,0x58,0xaa,
+    0xf3,0x48,0x15,0x20,0xea,0x65,0xd0,0x0a,0x61,0x71,0xa7,0xe6,0xf6,0x15,0xb5,0x5a,
+    0x70,0x9b,0x4c,0xfa,0x04,0x0e,0xf2,0x6c,0xab,0x63,0x0e,0xaa,0xdc,0xd8,0xe8,0x7a,
+    0x54,0x53,0x46,0xef,0xf0,0xcf,0x60,0xce,0x94,0xd3,0x23,0x37,0x8d,0x9f,0x6c,0x1b,
+    0x65,0xdb,0x7c,0x3d,0x09,0xdf,0x0b,0x62,0x54,0x1a,0x38,0x1e,0x3b,0xf9,0x41,0xcf,
+    0xb5,0x55,0x9e,0xf5,0x28,0x3f,0xe7,0x71,0x7b,0x4b,0xd3,0xb0,0xb2,0x23,0x7b,0xc0,
+    0xf4,0x76,0x0d,0xc7,0xe1,0xe5,0xb0,0x33,0x9e,0x7a,0x7a,0xd8,0x23,0x4f,0x8f,0x77,
+    0x51,0x6c,0xe5,0x9d,0xb0,0xc5,0x41,0x98,0x72,0x02,0x96,0x77,0xe1,0x55,0xc9,0x41,
+    0x58,0x76,0x7a,0x56,0xbb,0x82,0x1c,0x4f,0x4a,0xf6,0x96,0xf4,0x7b,0xc8,0xa9,0x06,
+    0x56,0xaf,0x34,0xc0,0xb9,0x9c,0xb5,0x4c,0xe1,0xe7,0xf3,0xc4,0xce,0x0a,0x7b,0x81,
+    0x9b,0x2d,0x88,0xb8,0xbe,0xfc,0xe9,0x4a,0x8b,0x47,0xb8,0x0a,0x4c,0x1e,0xe9,0xfe,
+    0x24,0x6f,0x00,0x43,0xde,0xf9,0x50,0x97,0x50,0x7c,0xf8,0x4b,0xbe,0x16,0xbe,0x8f,
+    0x96,0x92,0xe5,0x43,0x5e,0x48,0xfb,0xe9,0x5d,0x16,0x4b,0x49,0xf4,0x74,0x11,0x5a,
+    0x9c,0x92,0x7d,0x21,0x7f,0x3f,0xfa,0x4b,0x0e,0xd8,0xe9,0x5c,0x14,0x1c,0xdf,0x82,
+    0xde,0x9e,0xab,0xcf,0x6c,0x0f,0x6f,0xf1,0x6e,0xf3,0xc3,0xb3,0xb3,0x5f,0x7f,0x56,
+    0x76,0x41,0x03,0xd6,0x46,0x6a,0xcf,0xda,0xe9,0xe7,0xde,0xe0,0x01,0xaf,0x62,0xa0,
+    0xe9,0x4f,0xf6,0x86,0x5e,0x74,0x4e,0xd2,0xc7,0xbc,0x8a,0x41,0xe3,0xb7,0xd9,0xee,
+    0x60,0xd0,0x36,0x54,0xb8,0xdf,0xbd,0x72,0x83,0x4c,0x17,0x7c,0xa8,0x7e,0x73,0xd5,
+    0x72,0x4a,0x71,0x81,0x1b,0xb1,0xe7,0xbd,0x75,0xdb,0x36,0xdb,0x67,0x35,0xf3,0x76,
+    0x5b,0xe1,0xb8,0xaf,0x7e,0x54,0x7a,0x26,0x74,0x55,0x48,0x60,0x6f,0x29,0x5f,0x51,
+    0x47,0xd8,0x7e,0xba,0x0b,0xef,0xaf,0xf7,0x2e,0x3c,0xa0,0x32,0x4f,0x5a,0xc2,0x8b,
+    0x3b,0x32,0x8b,0x89,0x61,0xd8,0x3b,0x0e,0x87,0x23,0x77,0x9c,0x58,0x4c,0xbf,0xc1,
+    0x58,0x73,0x5f,0x9a,0x27,0x0d,0x35,0x71,0x6f,0x84,0xab,0x2d,0x65,0x66,0xac,0x27,
+    0xae,0x58,0x11,0x69,0x39,0xcb,0xd6,0x24,0xc5,0x25,0x49,0xd9,0x6a,0x87,0x6f,0x61,
+    0x3e,0x2d,0x56,0x9e,0x16,0x2b,0x9f,0xeb,0x62,0x65,0x76,0xc5,0xfe,0x64,0xa5,0x3f,
+    0x59,0xe9,0x4f,0x56,0xfa,0x93,0x95,0xfe,0x00,0x56,0xfa,0x93,0xdd,0xfa,0x64,0xb7,
+    0x3e,0xd9,0xad,0xd5,0x76,0x6b,0xf1,0xa2,0x3e,0x69,0x93,0x36,0x66,0xba,0x9e,0x4f,
+    0xbb,0x7b,0xba,0x78,0x33,0x9f,0xcc,0xe5,0x24,0xa3,0x15,0x67,0xbd,0x03,0x9b,0xc2,
+    0xca,0xaf,0xb4,0xeb,0xfb,0xa0,0xd2,0x6f,0xf3,0x4b,0xe0,0x0a,0x37,0xfb,0xbd,0x9a,
+    0x72,0xa1,0x1f,0x67,0x67,0x6f,0x94,0xba,0xb6,0xdc,0x0e,0xa2,0xfd,0x99,0xbe,0x27,
+    0xd4,0x2c,0xa6,0xa6,0x6a,0xf2,0x1e,0x55,0xed,0x38,0xd9,0x4d,0xd6,0x58,0x21,0x63,
+    0xd5,0x52,0xe1,0x1e,0x3a,0x21,0xf5,0x96,0x3e,0xb1,0x5d,0xa6,0xba,0x94,0x56,0xc5,
+    0xad,0xa7,0x5c,0x6a,0x2b,0x93,0x2d,0xd5,0x81,0xf6,0x8f,0x81,0x2b,0x3f,0x28,0x6f,
+    0x3d,0x31,0xd0,0xbd,0x18,0xa8,0xd4,0xf8,0x2b,0xcd,0xe0,0x28,0x73,0xe8,0xd5,0x9c,
+    0xc4,0x2d,0xcf,0x9d,0x69,0xe4,0x57,0x35,0x34,0x41,0x4b,0x77,0x01,0x94,0x6f,0x1f,
+    0x17,0x0c,0x9c,0xa5,0x4f,0x73,0x43,0xb9,0x22,0xa3,0x63,0x3e,0x17,0xb7,0xb4,0x66,
+    0x67,0x99,0xc9,0x05,0x75,0x97,0x9b,0xca,0x91,0xba,0x59,0x76,0x86,0xd9,0x6c,0x18,
+    0x79,0x8b,0x4f,0xe7,0x40,0x8e,0xf1,0x41,0xf1,0xf2,0xd2,0xa9,0xea,0x2a,0xef,0x12,
+    0xe6,0x4a,0x5c,0x44,0xd3,0x6b,0x09,0x7e,0x69,0x37,0xc1,0xb6,0x31,0x0d,0x0b,0x7e,
+    0x75,0x21,0xbc,0x7d,0xcd,0x44,0xca,0x4c,0x7c,0xb7,0x98,0x12,0x13,0x01,0xff,0x86,
+    0x53,0xb8,0x54,0x28,0x31,0xf2,0x6a,0x17,0xcd,0x36,0x55,0x1f,0x2b,0x83,0x26,0x70,
+    0xea,0xcc,0x89,0x86,0x91,0xb2,0x98,0x5d,0xe9,0xca,0xc6,0xc6,0x2a,0xcf,0x7d,0xcc,
+    0x62,0xb8,0x16,0x8a,0x28,0xba,0x5a,0xbb,0xbc,0xbc,0x5c,0x03,0x43,0x7e,0xb4,0x36,
+    0x49,0x42,0x46,0x3a,0x5f,0x84,0x18,0xa9,0xce,0xcb,0x08,0xbb,0x6c,0x98,0xc4,0x97,
+    0x34,0x01,0x29,0xbd,0x2b,0xb5,0x61,0x53,0x0f,0x91,0x9a,0x10,0x4b,0x77,0x95,0x37,
+    0xce,0xea,0xf3,0xff,0x53,0x3c,0x27,0x4d,0x11,0xc6,0x01,0xc5,0x93,0xea,0x34,0x2c,
+    0x07,0x84,0xb3,0x9e,0xa2,0x98,0x09,0x04,0x5c,0xb6,0x60,0x20,0xa9,0x0a,0x84,0x94,
+    0xb7,0xca,0x92,0xf6,0x88,0xa4,0xa9,0x77,0x4e,0xf8,0x45,0x9f,0xcc,0xab,0xaa,0x29,
+    0xcf,0x8f,0x96,0xd3,0xc7,0x26,0x97,0x7f,0x66,0x43,0x9b,0x67,0x62,0x3a,0x38,0x62,
+    0x78,0x1e,0x4d,0x5e,0xf5,0x2a,0xf3,0x58,0x57,0x89,0x9e,0xbf,0x2e,0xc9,0x53,0x92,
+    0xd2,0xfa,0x49,0xf4,0x3c,0xb6,0xe8,0xa9,0x65,0xda,0xcf,0x5c,0x8a,0x94,0xe5,0x58,
+    0x47,0x39,0xb2,0x94,0x4b,0x36,0x84,0xac,0x9d,0x0b,0x38,0x34,0xef,0xf0,0x9a,0xc3,
+    0x5c,0xaf,0x0b,0x33,0xae,0xba,0x14,0xe1,0xb3,0x8c,0xef,0x64,0xe8,0x56,0x84,0x78,
+    0x96,0xc6,0xeb,0x96,0xde,0x93,0xc3,0x4b,0xd4,0xdc,0xb8,0xea,0x65,0x9e,0x74,0x71,
+    0xce,0x74,0x03,0xe8,0x57,0x5f,0xc9,0xcb,0x89,0xa9,0x54,0x9c,0xe3,0x24,0x3d,0x36,
+    0xd6,0xee,0xb3,0x4c,0x4e,0x98,0xb5,0x8d,0x01,0xd0,0x7d,0xb5,0xfa,0xc1,0x73,0x91,
+    0x4b,0x4e,0xdf,0xdb,0xc3,0x0d,0x13,0x9a,0xa4,0xc3,0x5d,0xa1,0x46,0xfe,0xca,0xf6,
+    0xcb,0xe1,0xe6,0x36,0x1e,0xcc,0xd8,0x0d,0x43,0x8b,0x87,0x6a,0x5b,0x93,0xf1,0x32,
+    0xdd,0xde,0x7b,0x39,0xde,0x96,0x87,0x95,0x22,0x02,0x1f,0xc6,0x93,0xa4,0x3f,0xf4,
+    0x52,0xa0,0xc8,0xcb,0x67,0x63,0xb5,0x41,0xa3,0xda,0xaa,0xb9,0x8e,0x59,0x93,0x30,
+    0x14,0x05,0xe9,0x5c,0x16,0x88,0x89,0x0c,0xb2,0x78,0x74,0x5f,0x96,0x98,0x9a,0x10,
+    0x20,0x57,0xd5,0xc8,0x09,0x20,0x41,0x8b,0x3c,0xb6,0x00,0x5a,0x87,0x4c,0x33,0x02,
+    0xdc,0x4d,0x2b,0x55,0x9f,0x2b,0x20,0x57,0xd3,0x48,0x17,0x50,0x1c,0x20,0x09,0x57,
+    0xa5,0xcb,0xf9,0x05,0xcd,0x18,0x50,0xb3,0x5b,0x8a,0xfb,0x58,0x85,0xdd,0x2d,0xdc,
+    0x02,0xa1,0x9b,0x59,0x97,0x09,0x3c,0xe1,0x5f,0x74,0x4b,0x4b,0x00,0x2c,0xdd,0x59,
+    0xd1,0x8e,0x94,0xbf,0xc3,0x53,0x11,0xef,0xec,0xe2,0xfe,0xca,0x0b,0xdc,0x5f,0xd9,
+    0xc8,0xef,0xaf,0x94,0x9c,0x64,0xdf,0x70,0x6a,0x36,0x5c,0x5e,0xe4,0xb7,0x88,0xe8,
+    0x0e,0x4b,0x1a,0xfc,0x8a,0x74,0x29,0x60,0x73,0xc7,0x88,0xdf,0x11,0x03,0xfc,0xa7,
+    0x6f,0xb6,0xcc,0x8e,0x08,0x8c,0xfd,0x7c,0x88,0x6c,0x7e,0xd5,0x7a,0xf1,0x25,0xfe,
+    0x1f,0x0f,0xe4,0x3f,0x34,0x1a,0x47,0x13,0xf8,0x13,0x85,0xd7,0x8b,0xe1,0x02,0x7c,
+    0x34,0x1f,0x2e,0xcf,0xb7,0x5a,0xeb,0x5b,0x5f,0xb6,0xd6,0xd7,0x7f,0x16,0x64,0x0e,
+    0xc1,0xbe,0x5a,0x1c,0x19,0xec,0xc5,0x3d,0x58,0x6c,0xfd,0xe1,0xd0,0xf9,0x86,0xa4,
+    0x45,0x26,0x93,0xd2,0x8b,0xce,0x60,0x76,0x1c,0xad,0x34,0xb9,0x26,0x3d,0x1a,0xb4,
+    0x47,0x85,0x26,0x3f,0xaf,0xc5,0x0f,0xc1,0xef,0xd0,0x33,0xf2,0x5d,0x7a,0xf2,0x9d,
+    0x5f,0xba,0xec,0xf9,0xe7,0xa4,0x50,0x0a,0x44,0x12,0x94,0x02,0xc1,0x60,0x90,0x4f,
+    0x13,0xc6,0xf2,0x9c,0x98,0x25,0x72,0x05,0xd0,0x06,0xf1,0x4e,0x15,0xb1,0x9d,0xe3,
+    0xae,0x30,0xdd,0xdd,0xa6,0x87,0x36,0xf8,0x7b,0xda,0x51,0xf1,0x01,0xff,0x52,0x5f,
+    0x7c,0xf5,0xde,0x97,0x6f,0x79,0xaf,0xc4,0x17,0x91,0x96,0x80,0x7f,0x15,0x9e,0x1c,
+    0xf1,0x39,0xbf,0x66,0x84,0x62,0x26,0x03,0xe8,0x51,0x16,0x22,0x83,0xc4,0x4a,0x0e,
+    0x27,0xfa,0xd6,0x0c,0x1b,0xc0,0x50,0x01,0x11,0x86,0x83,0xbf,0xb9,0xc0,0x4b,0x78,
+    0x60,0x4e,0xc9,0x08,0x1a,0xed,0xea,0x12,0x39,0x57,0x19,0xa1,0x69,0xcc,0xc0,0xe2,
+    0x30,0x9a,0x8d,0x12,0x6c,0x76,0x6c,0x8c,0x35,0x84,0x71,0xc1,0xf0,0x41,0x1b,0x0c,
+    0x59,0x25,0xb5,0xcd,0x31,0xe2,0x0d,0xa1,0xb8,0xed,0xae,0x83,0xc6,0xd4,0xdf,0x19,
+    0xbb,0xc7,0x46,0xe8,0xc5,0x06,0x6b,0x9f,0x36,0xcf,0xee,0xc8,0x91,0x5c,0x57,0xd5,
+    0x88,0xea,0xfc,0x26,0xe0,0x12,0x8f,0xbd,0x7e,0x90,0x5d,0x77,0x3b,0xed,0x2f,0x25,
+    0x20,0xe5,0x49,0x67,0xc0,0x4a,0x41,0x52,0x0a,0xf1,0x81,0xa0,0x5c,0x59,0x60,0x2c,
+    0x00,0x47,0x3f,0x48,0xcc,0x05,0x1c,0x9e,0x8c,0xaf,0x60,0x3d,0x08,0xf0,0xbd,0x99,
+    0xd4,0xbd,0x66,0xbd,0x55,0x65,0x3c,0xe1,0x06,0x5c,0xf1,0x52,0x3d,0x34,0xf3,0x22,
+    0xe1,0x5d,0x44,0xe6,0xd2,0x8f,0xc2,0xec,0xd8,0xca,0x11,0x01,0xc3,0x47,0xc4,0x46,
+    0x09,0x9f,0x82,0x58,0xfe,0x10,0x23,0x5c,0x8c,0x4a,0x7b,0x7a,0xa5,0x7d,0xa3,0x52,
+    0xc9,0x31,0x2b,0xbb,0x29,0x21,0x81,0x56,0x37,0x2e,0x9d,0x9a,0xe9,0xe0,0x15,0x05,
+    0xaa,0x7d,0xe4,0xb9,0x45,0xfa,0xda,0x15,0x5b,0xac,0x29,0x30,0x55,0x7f,0x08,0xe8,
+    0x07,0xab,0x41,0xda,0xe7,0xed,0x96,0xf5,0xd3,0x8f,0xff,0xf6,0x27,0xbc,0x21,0xeb,
+    0xa7,0x1f,0x7f,0xfb,0x9f,0xff,0xf7,0xbf,0xbf,0x75,0xba,0x76,0x0b,0xf8,0xf4,0xf7,
+    0x7f,0x96,0xd9,0x56,0xa0,0xec,0xed,0x2d,0xfe,0xad,0x37,0x4c,0x41,0xb3,0x72,0x50,
+    0x0c,0x1f,0xb4,0x12,0xf2,0xdc,0x31,0x3f,0xac,0xb7,0xbd,0xa5,0x8e,0x70,0xee,0xe9,
+    0xd8,0x81,0xf5,0x1c,0x5b,0x61,0x0c,0xeb,0xca,0xc6,0xc8,0xbb,0xb2,0xb6,0x3a,0x16,
+    0x98,0x7c,0x49,0xea,0x18,0xfe,0x60,0x0a,0x9a,0x83,0x5a,0x57,0xa0,0x0e,0xfa,0xf4,
+    0x22,0x6c,0x1d,0xc2,0x7a,0x19,0x04,0x24,0x05,0xac,0xf2,0x5d,0x63,0x93,0x47,0x7a,
+    0xab,0x77,0xa6,0x7b,0xb4,0x28,0x67,0xb0,0x61,0x82,0x27,0x86,0x7c,0x59,0x79,0xfc,
+    0x22,0xe8,0x56,0xf4,0x5e,0xeb,0x37,0xf0,0x18,0x37,0x9f,0x69,0x9f,0xf8,0x35,0x67,
+    0xae,0x75,0xf2,0x66,0xf7,0xe0,0x70,0xff,0x8d,0xd5,0xf0,0xc2,0x4b,0xbc,0x59,0x88,
+    0x25,0xc8,0x75,0xf0,0xba,0x33,0xd7,0xda,0x3f,0x3e,0xde,0x7f,0x75,0x72,0xb0,0x7b,
+    0x78,0x0c,0x98,0x4f,0x52,0x96,0x26,0xd8,0x22,0x17,0xb0,0x64,0xa2,0x37,0x0c,0x39,
+    0x78,0x51,0xa3,0x6b,0x1d,0xbd,0x3e,0x39,0x38,0x7a,0xb5,0x7b,0x08,0xa3,0x7d,0x05,
+    0x22,0x97,0x1f,0x66,0xad,0xbb,0xa4,0x31,0x77,0x37,0x12,0x66,0x4c,0xcb,0xdd,0x1b,
+    0x24,0x5c,0xeb,0x5a,0x0e,0xaf,0x5c,0xf9,0x0d,0xa3,0xbc,0x76,0x15,0x77,0x55,0x95,
+    0x4d,0xa3,0x8a,0xbc,0xce,0x9a,0x55,0x90,0xa3,0x1d,0x5d,0x78,0x18,0xe6,0xc5,0xd4,
+    0x2b,0x6e,0xfe,0x5b,0x3c,0x3f,0x48,0x9f,0x91,0x50,0xa1,0xd2,0xd6,0x47,0x1f,0x46,
+    0x1e,0x84,0x54,0xfe,0xf6,0xa3,0xa6,0xf6,0xd4,0x13,0x37,0x2e,0x41,0xc1,0x32,0xef,
+    0x80,0x3c,0x50,0xfe,0x6b,0x79,0xb7,0x9c,0x7e,0x0d,0x19,0x8b,0xe0,0xa0,0x07,0xc7,
+    0x3f,0xe2,0x5b,0x90,0x18,0x25,0xc5,0x36,0x1f,0xc3,0x12,0x8f,0xe3,0x6e,0x0b,0xec,
+    0xfe,0xf4,0x1b,0x4b,0xba,0x6b,0xf0,0x24,0xaa,0x90,0x95,0x77,0x4b,0xff,0x0f,0xf4,
+    0xa2,0x40,0xba,0x35,0xc6,0x00,0x00,
+};
+#define ASSET_URL_INVENTORY_JS "/static/inventory.js?v=e41bdf44"
+
+// monitor.css: 2911 bytes, 1041 gzipped
+static const uint8_t ASSET_MONITOR_CSS[] PROGMEM = {
+    0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xa5,0x56,0x5d,0x8f,0xa3,0x36,
+    0x14,0x7d,0xcf,0xaf,0xa0,0x8a,0x56,0x3b,0xa9,0x20,0x32,0x1f,0x21,0x09,0xbc,0xb4,
+    0x7d,0xa8,0xd4,0x87,0x3e,0xad,0xf6,0x07,0x18,0x6c,0x88,0x35,0x06,0x23,0x63,0xf2,
+    0x51,0x94,0xff,0xde,0x6b,0x03,0x03,0x24,0x69,0x26,0xdd,0x55,0x26,0x99,0x04,0x5f,
+    0x9f,0x73,0xec,0x7b,0xee,0xb5,0x7f,0x6d,0x9d,0x13,0x4d,0xde,0x99,0x72,0x94,0x68,
+    0xd2,0x83,0x93,0x62,0xce,0x45,0xa3,0xa2,0x52,0x94,0x34,0x1e,0x86,0x9a,0x9a,0x4a,
+    0xa7,0xa6,0x9c,0xa6,0xfd,0xc0,0xed,0x83,0xeb,0x22,0x11,0xe4,0xd2,0x26,0x38,0x7d,
+    0xcf,0xa5,0x68,0x4a,0x12,0x2d,0x11,0x42,0x71,0x2a,0xb8,0x90,0xd1,0x32,0xcb,0xb2,
+    0x38,0x13,0xa5,0x72,0x32,0x5c,0x30,0x7e,0x89,0x1c,0x5c,0x55,0x9c,0x3a,0xf5,0xa5,
+    0x56,0xb4,0xb0,0xff,0xe0,0xac,0x7c,0xff,0x1b,0xa7,0xdf,0xcc,0xcf,0x3f,0x21,0xce,
+    0xfe,0xfa,0x8d,0xe6,0x82,0x5a,0xdf,0xff,0xfa,0x6a,0xff,0x2e,0x19,0xe6,0x76,0x8d,
+    0xcb,0x1a,0xf8,0x24,0xcb,0xe2,0x02,0xcb,0x9c,0x95,0x11,0x8a,0x2b,0x4c,0x08,0x2b,
+    0xf3,0x68,0x57,0x9d,0x63,0x80,0xa0,0xce,0x81,0xb2,0xfc,0xa0,0x22,0x77,0xed,0x77,
+    0x6c,0x35,0xfb,0x87,0x46,0xee,0xa6,0x3a,0x5f,0x17,0xeb,0x74,0xaa,0x4d,0x47,0x63,
+    0xe9,0xe4,0x12,0x13,0x46,0x4b,0xf5,0xe6,0xfa,0x1b,0x42,0x73,0x7b,0xe9,0x62,0xfd,
+    0xb2,0xd0,0x17,0xf8,0xea,0xba,0x96,0x8b,0xd0,0x97,0xd5,0xc0,0x07,0x2c,0xd6,0xc8,
+    0xe9,0x22,0x20,0x4d,0x84,0x24,0xb0,0x0d,0x1a,0xa5,0xa9,0x23,0xd7,0x1b,0x1f,0x71,
+    0x9a,0xa9,0xc8,0x87,0x19,0xb5,0xe0,0x8c,0x58,0x4b,0xdf,0xf7,0x61,0xe8,0xec,0xd4,
+    0x07,0x4c,0xc4,0x29,0x42,0x56,0x00,0x63,0x21,0xbc,0x65,0x9e,0xe0,0x37,0x64,0x9b,
+    0xd7,0xda,0x5f,0xc5,0x95,0xa8,0x99,0x62,0xa2,0x8c,0x24,0xe5,0x58,0xb1,0x23,0xd5,
+    0xd2,0xd7,0xa2,0xd4,0x8a,0xdb,0x09,0xb8,0xd3,0xef,0x6c,0x90,0x05,0x4f,0x80,0xb7,
+    0x7b,0xdb,0x0b,0x02,0x1b,0xfe,0xa1,0xb5,0xb7,0x32,0x50,0x27,0x2c,0xcb,0x47,0x40,
+    0xd9,0x0e,0x3d,0x01,0xf2,0x36,0x1b,0xdb,0xf5,0x43,0xa3,0xb2,0x07,0x4a,0x25,0x08,
+    0x05,0xb3,0x3c,0x04,0xf3,0xbc,0x4f,0xc0,0xfc,0x40,0xff,0x75,0x60,0x07,0xaf,0x1d,
+    0x72,0x6a,0x21,0x1d,0x36,0xcd,0xde,0x1a,0x6d,0x68,0x31,0xf8,0x88,0x10,0x12,0x13,
+    0x56,0x57,0x1c,0x5f,0xa2,0x8c,0xd3,0x73,0x8c,0x39,0xcb,0x4b,0x87,0x81,0x6d,0xea,
+    0x28,0x85,0x4c,0x52,0x19,0xe7,0xb8,0x32,0x8e,0x30,0x18,0xa7,0xce,0x11,0x21,0x42,
+    0xa0,0x99,0xa5,0xa2,0x6c,0xa7,0xd0,0x3e,0x20,0x67,0x8c,0xc3,0xac,0x88,0x48,0x51,
+    0xf5,0x72,0xdf,0x90,0x05,0x99,0x34,0x92,0x67,0xd9,0xd9,0xac,0xf4,0xc2,0x8f,0x33,
+    0x04,0xad,0x6d,0x4a,0x94,0x08,0x4e,0x06,0xc3,0x04,0xc6,0x30,0x33,0x63,0x7e,0xd8,
+    0x07,0x3c,0x69,0xed,0xee,0x1c,0xa4,0x9f,0x0c,0xcb,0x63,0x26,0xe5,0x4e,0xc2,0x45,
+    0xfa,0x1e,0xbf,0x60,0x5d,0x30,0x82,0xbd,0xf4,0x88,0xb7,0x1a,0xf6,0x4a,0x97,0xdf,
+    0x2c,0x07,0xb3,0x45,0x4d,0x9d,0xe1,0x9b,0x75,0xf5,0xce,0xf8,0x9c,0x09,0x9c,0x62,
+    0x2f,0x49,0x88,0x5e,0x64,0x9a,0x5a,0xa7,0x67,0x1a,0xad,0xf3,0x02,0x9b,0xe7,0x01,
+    0x1b,0x1a,0xd9,0x74,0x2f,0x79,0xce,0x36,0x78,0xcb,0xb0,0x41,0xce,0x15,0xe0,0xb5,
+    0x33,0xdb,0x68,0x8f,0xe8,0xbe,0xf0,0xc0,0x3f,0x30,0x25,0x97,0x8c,0x7c,0xc4,0xeb,
+    0x1f,0xb1,0xfe,0x70,0x20,0x08,0x9e,0x28,0xaa,0x4d,0xde,0x14,0x25,0x14,0x7c,0x26,
+    0x2d,0x78,0x1b,0x34,0x6d,0x6e,0xd3,0x00,0x46,0x77,0xa0,0xf5,0xde,0xd8,0x03,0x08,
+    0x23,0x57,0xdb,0x0f,0x00,0xe6,0x32,0xf4,0x87,0x43,0x98,0x84,0x26,0xaa,0x4b,0xbe,
+    0xc3,0x85,0x48,0x8e,0x13,0xca,0xdb,0x7e,0xbd,0xfb,0xfd,0x7e,0x06,0xba,0x03,0xcc,
+    0xce,0x61,0x4e,0x22,0x94,0x12,0x45,0xe4,0xdd,0xb8,0x7d,0x63,0xdc,0x7e,0xc4,0xbc,
+    0xa1,0xed,0x6d,0x03,0x9e,0x16,0xd5,0xfd,0x9c,0x03,0xab,0x55,0x5f,0x8b,0x70,0x1a,
+    0x4c,0xea,0xa8,0xe7,0xde,0x4e,0x6a,0x11,0x74,0xe9,0x19,0x52,0x9c,0xda,0x57,0x4a,
+    0x52,0x97,0x75,0x5f,0x18,0x3a,0x61,0x86,0x8d,0x27,0xbc,0x3d,0x31,0xa2,0x0e,0x51,
+    0x08,0x09,0x8c,0x15,0x3d,0x2b,0xc7,0x4c,0x8f,0xa4,0x16,0xa5,0x43,0x12,0x2c,0xdb,
+    0xbe,0x7a,0xb4,0x98,0x02,0x84,0x75,0x33,0x5c,0x5d,0x3d,0xff,0x6d,0x9f,0x3d,0xea,
+    0xab,0x02,0xa7,0x19,0xb5,0xc1,0xa2,0x99,0x97,0xd1,0xd5,0x4d,0xbd,0x05,0xe6,0x64,
+    0x28,0xf1,0xd1,0xd1,0x48,0xed,0xc3,0xd2,0x9b,0x6f,0xb5,0x69,0xfb,0x93,0x73,0xc7,
+    0x72,0xc3,0xe7,0x3a,0xc6,0xf2,0x7c,0x26,0x44,0x2f,0x6d,0x92,0x29,0xb3,0x11,0x84,
+    0xa6,0x42,0x62,0x63,0x0c,0x73,0xe2,0xce,0x8c,0x75,0x93,0xbd,0xae,0xbf,0x99,0x85,
+    0x34,0xa0,0xb3,0xac,0xa7,0x49,0x34,0x46,0xbf,0xb3,0x7f,0x38,0xae,0x5d,0x41,0x57,
+    0x34,0x26,0x7d,0x76,0xba,0xed,0xe6,0x09,0xea,0x33,0x7b,0x6b,0xaf,0x51,0x4f,0x9c,
+    0x36,0xb2,0x86,0xb1,0x4a,0x30,0x13,0x79,0x23,0x7f,0xe4,0x5e,0x67,0x50,0x5c,0x39,
+    0x7d,0xa5,0x17,0x84,0xe1,0x96,0x52,0x6c,0x2f,0xb7,0x61,0x90,0x60,0x73,0x0c,0x0d,
+    0x18,0x85,0x28,0x99,0x12,0xb2,0xfd,0xff,0x99,0x98,0x80,0xb0,0xf2,0x08,0x81,0x42,
+    0x5e,0x7e,0x4c,0x8b,0xa4,0x99,0xa4,0xf5,0xc1,0xec,0xe7,0xc7,0x31,0x9e,0xb1,0x33,
+    0x25,0xf1,0xe0,0x1e,0x9d,0x09,0xd9,0x1d,0x05,0xfa,0x6b,0xe7,0xe4,0x40,0x6f,0x76,
+    0xef,0xf1,0xe0,0x7e,0xe3,0x3d,0xf4,0x33,0x0e,0xeb,0xbc,0xf3,0xb8,0x0b,0xe8,0x5a,
+    0x9e,0x27,0xe9,0xee,0xcc,0xde,0xdd,0x5f,0x51,0xae,0x8b,0xdf,0x0a,0x4a,0x18,0x7e,
+    0x1b,0x6b,0x71,0x1b,0x42,0xdc,0xaa,0xed,0xae,0x80,0x53,0x0f,0x59,0x66,0x99,0x05,
+    0x3e,0x0f,0x45,0xeb,0x21,0x34,0xf6,0x01,0x64,0xe1,0x46,0x89,0xa9,0xa2,0xb0,0xbf,
+    0xaa,0x3d,0xbe,0x72,0x79,0x9f,0x5e,0xb9,0x7a,0x1a,0x53,0xd7,0x70,0xab,0x98,0x76,
+    0x3c,0x77,0x73,0xd7,0x37,0x3b,0xb6,0xe9,0x81,0xee,0x41,0xcc,0x40,0x37,0x74,0xf4,
+    0x49,0x95,0x7c,0x28,0x01,0x82,0x5f,0x58,0x51,0x09,0xa9,0x70,0xa9,0x66,0x8d,0x15,
+    0x36,0x75,0x1c,0xb9,0x2e,0xae,0x8b,0x7f,0x01,0x07,0xc7,0xfb,0x8e,0x5f,0x0b,0x00,
+    0x00,
+};
+#define ASSET_URL_MONITOR_CSS "/static/monitor.css?v=158535f4"
+
+static const StaticAsset STATIC_ASSETS[] = {
+    {"/static/dashboard.css", "text/css", ASSET_DASHBOARD_CSS, sizeof(ASSET_DASHBOARD_CSS), "928045e1"},
+    {"/static/dashboard.js", "application/javascript", ASSET_DASHBOARD_JS, sizeof(ASSET_DASHBOARD_JS), "49c416b4"},
+    {"/static/fridge.css", "text/css", ASSET_FRIDGE_CSS, sizeof(ASSET_FRIDGE_CSS), "bf683500"},
+    {"/static/fridge.js", "application/javascript", ASSET_FRIDGE_JS, sizeof(ASSET_FRIDGE_JS), "b01d36e0"},
+    {"/static/inventory.css", "text/css", ASSET_INVENTORY_CSS, sizeof(ASSET_INVENTORY_CSS), "77e531e2"},
+    {"/static/inventory.js", "application/javascript", ASSET_INVENTORY_JS, sizeof(ASSET_INVENTORY_JS), "e41bdf44"},
+    {"/static/monitor.css", "text/css", ASSET_MONITOR_CSS, sizeof(ASSET_MONITOR_CSS), "158535f4"},
+};
+static const size_t STATIC_ASSET_COUNT = sizeof(STATIC_ASSETS) / sizeof(STATIC_ASSETS[0]);
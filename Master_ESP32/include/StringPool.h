@@ -0,0 +1,54 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+/**
+ * Interned, arena-backed string storage.
+ *
+ * intern() returns a stable pointer to a NUL-terminated copy of the string.
+ * Equal strings share one copy, so pointers can be compared directly. Copies
+ * are packed into fixed-size blocks (bigger strings get a block of their
+ * own), so hundreds of names cost a handful of allocations instead of one
+ * each. Nothing is freed until clear(), which invalidates every pointer.
+ *
+ * Strings nobody points at any more are only reclaimed by compacting: intern
+ * the live ones into a fresh pool, repoint their holders, then swap() the
+ * fresh pool in and let the old one go (see compactInventoryNames()).
+ *
+ * Plain C++ (no Arduino types), so it also builds on the host.
+ */
+class StringPool {
+public:
+    static const size_t BLOCK_SIZE = 1024;
+
+    ~StringPool() { clear(); }
+
+    const char* intern(const char* s, size_t len);
+    const char* intern(const char* s);
+
+    // Drop every string and free all blocks
+    void clear();
+
+    // Exchange contents; pointers stay valid and now belong to `other`
+    void swap(StringPool& other);
+
+    size_t count() const { return _count; }
+    size_t bytesUsed() const { return _used; }          // String bytes incl. terminators
+    size_t bytesReserved() const;                       // Blocks + index, i.e. heap held
+
+private:
+    char* allocate(size_t len);
+    void grow();
+
+    std::vector<char*> _blocks;
+    size_t _blockFree = 0;          // Bytes left in the last full-size block
+    char* _blockNext = nullptr;
+    const char** _index = nullptr;  // Open-addressing hash set, capacity a power of two
+    size_t _capacity = 0;
+    size_t _count = 0;
+    size_t _used = 0;
+    size_t _oversized = 0;          // Bytes in dedicated blocks
+    size_t _sharedBlocks = 0;
+};
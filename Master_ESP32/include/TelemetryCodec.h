@@ -0,0 +1,131 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * Compact encoding for rows of fixed-point telemetry (one uint32 timestamp
+ * plus N int16 values, as stored by HistoryStore).
+ *
+ *   timestamp: delta-of-delta, zig-zag varint  (steady interval -> 1 byte)
+ *   values:    delta from the series' previous value, zig-zag varint + 1,
+ *              with 0 meaning "no reading"      (|delta| < 64 -> 1 byte)
+ *
+ * The scales in HISTORY_SERIES keep normal changes between rows small
+ * (0.01 V, 0.01 A, 0.1 %, 1 W), so most values take one byte.
+ * Rows must be decoded in the order they were encoded. Plain C++, no
+ * Arduino dependencies, so it can be built and benchmarked on the host.
+ */
+
+#define TELEMETRY_MAX_SERIES 16
+#define TELEMETRY_MISSING INT16_MIN
+
+inline uint32_t zigzagEncode(int32_t v) { return ((uint32_t)v << 1) ^ (uint32_t)(v >> 31); }
+inline int32_t zigzagDecode(uint32_t v) { return (int32_t)(v >> 1) ^ -(int32_t)(v & 1); }
+
+inline size_t writeVarint(uint8_t* out, uint32_t v) {
+    size_t n = 0;
+    while (v >= 0x80) {
+        out[n++] = (uint8_t)(v | 0x80);
+        v >>= 7;
+    }
+    out[n++] = (uint8_t)v;
+    return n;
+}
+
+// Returns bytes consumed, 0 if the input ends mid-varint
+inline size_t readVarint(const uint8_t* in, size_t len, uint32_t& v) {
+    v = 0;
+    for (size_t n = 0; n < len && n < 5; n++) {
+        v |= (uint32_t)(in[n] & 0x7F) << (7 * n);
+        if ((in[n] & 0x80) == 0) return n + 1;
+    }
+    return 0;
+}
+
+class TelemetryEncoder {
+public:
+    explicit TelemetryEncoder(uint8_t seriesCount) : _series(seriesCount) { reset(); }
+
+    // Worst-case bytes for one row
+    size_t maxRowBytes() const { return 5 + 3 * _series; }
+
+    void reset() {
+        _prevTime = 0;
+        _prevDelta = 0;
+        for (uint8_t s = 0; s < TELEMETRY_MAX_SERIES; s++) _prev[s] = 0;
+    }
+
+    // Encode one row into `out` (at least maxRowBytes() long); returns bytes written
+    size_t encode(uint32_t t, const int16_t* values, uint8_t* out) {
+        int32_t delta = (int32_t)(t - _prevTime);
+        size_t n = writeVarint(out, zigzagEncode(delta - _prevDelta));
+        _prevTime = t;
+        _prevDelta = delta;
+
+        for (uint8_t s = 0; s < _series; s++) {
+            if (values[s] == TELEMETRY_MISSING) {
+                out[n++] = 0;
+                continue;
+            }
+            n += writeVarint(out + n, zigzagEncode((int32_t)values[s] - _prev[s]) + 1);
+            _prev[s] = values[s];
+        }
+        return n;
+    }
+
+private:
+    uint8_t _series;
+    uint32_t _prevTime;
+    int32_t _prevDelta;
+    int16_t _prev[TELEMETRY_MAX_SERIES];
+};
+
+class TelemetryDecoder {
+public:
+    explicit TelemetryDecoder(uint8_t seriesCount) : _series(seriesCount) { reset(); }
+
+    void reset() {
+        _prevTime = 0;
+        _prevDelta = 0;
+        for (uint8_t s = 0; s < TELEMETRY_MAX_SERIES; s++) _prev[s] = 0;
+    }
+
+    // Decode one row; returns bytes consumed, 0 if `in` holds no complete row
+    size_t decode(const uint8_t* in, size_t len, uint32_t& t, int16_t* values) {
+        uint32_t raw;
+        size_t n = readVarint(in, len, raw);
+        if (n == 0) return 0;
+        int32_t delta = _prevDelta + zigzagDecode(raw);
+
+        int16_t row[TELEMETRY_MAX_SERIES];
+        int16_t prev[TELEMETRY_MAX_SERIES];
+        for (uint8_t s = 0; s < _series; s++) {
+            size_t used = readVarint(in + n, len - n, raw);
+            if (used == 0) return 0;
+            n += used;
+            if (raw == 0) {
+                row[s] = TELEMETRY_MISSING;
+                prev[s] = _prev[s];
+            } else {
+                row[s] = prev[s] = (int16_t)(_prev[s] + zigzagDecode(raw - 1));
+            }
+        }
+
+        // Only commit state once the whole row is known to be complete
+        _prevTime += (uint32_t)delta;
+        _prevDelta = delta;
+        t = _prevTime;
+        for (uint8_t s = 0; s < _series; s++) {
+            values[s] = row[s];
+            _prev[s] = prev[s];
+        }
+        return n;
+    }
+
+private:
+    uint8_t _series;
+    uint32_t _prevTime;
+    int32_t _prevDelta;
+    int16_t _prev[TELEMETRY_MAX_SERIES];
+};
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+#include "TelemetryCodec.h"
+
+/**
+ * Benchmark for TelemetryCodec, shared by the host tool
+ * (tools/codec_bench.cpp) and the ESP32 (GET /debug/codec).
+ *
+ * Generates a day of synthetic BMV/MPPT/IP22 rows in HistoryStore's series
+ * order and scales, encodes and decodes them, and checks the round trip.
+ * `nowNs` is the platform clock in nanoseconds.
+ */
+
+#define CODEC_BENCH_SERIES 5
+
+struct CodecBenchResult {
+    uint32_t rows;
+    uint32_t rawBytes;          // [uint32 t][int16 x series] per row, as in segment v1
+    uint32_t encodedBytes;
+    float bytesPerRow;
+    float bytesPerSample;       // Per stored value, timestamp cost included
+    float encodeNsPerRow;
+    float decodeNsPerRow;
+    bool roundTripOk;
+};
+
+// Deterministic noise in [-range, range]
+inline int16_t codecBenchNoise(uint32_t& seed, int16_t range) {
+    seed = seed * 1664525UL + 1013904223UL;
+    return (int16_t)((int32_t)(seed >> 16) % (2 * range + 1) - range);
+}
+
+// Fill `rows` (count x CODEC_BENCH_SERIES) and `times` with `interval` s samples
+inline void codecBenchRows(int16_t* rows, uint32_t* times, uint32_t count, uint32_t interval) {
+    uint32_t seed = 12345;
+    bool charging = false;
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t t = 1700000000UL + i * interval;
+        float dayPhase = (float)(t % 86400) / 86400.0f;
+        float sun = sinf((dayPhase - 0.25f) * 2.0f * (float)M_PI);
+        if (sun < 0) sun = 0;
+        if (codecBenchNoise(seed, 200) == 0) charging = !charging;
+
+        int16_t* row = rows + i * CODEC_BENCH_SERIES;
+        row[0] = 1300 + (int16_t)(sun * 80) + codecBenchNoise(seed, 2);                    // bmv.voltage, 0.01 V
+        row[1] = (int16_t)(sun * 1500) - 450 + codecBenchNoise(seed, 30);                  // bmv.current, 0.01 A
+        row[2] = 700 + (int16_t)(dayPhase * 200);                                          // bmv.soc, 0.1 %
+        row[3] = (int16_t)(sun * 320) + (sun > 0 ? codecBenchNoise(seed, 5) : 0);          // mppt.power, 1 W
+        row[4] = (i % 97 == 0) ? TELEMETRY_MISSING
+                               : (charging ? 1500 + codecBenchNoise(seed, 10) : 0);        // ip22.current, 0.01 A
+        times[i] = t + (i % 50 == 0 ? 1 : 0);                                              // Occasional jitter
+    }
+}
+
+template <typename NowNs>
+CodecBenchResult runCodecBench(int16_t* rows, uint32_t* times, uint32_t count, uint32_t interval,
+                               uint8_t* encoded, NowNs nowNs) {
+    CodecBenchResult r = {};
+    codecBenchRows(rows, times, count, interval);
+
+    TelemetryEncoder encoder(CODEC_BENCH_SERIES);
+    uint64_t start = nowNs();
+    size_t len = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        len += encoder.encode(times[i], rows + i * CODEC_BENCH_SERIES, encoded + len);
+    }
+    uint64_t encodeNs = nowNs() - start;
+
+    TelemetryDecoder decoder(CODEC_BENCH_SERIES);
+    int16_t row[CODEC_BENCH_SERIES];
+    uint32_t t;
+    size_t pos = 0;
+    uint32_t decoded = 0;
+    bool ok = true;
+    start = nowNs();
+    while (pos < len) {
+        size_t used = decoder.decode(encoded + pos, len - pos, t, row);
+        if (used == 0) break;
+        pos += used;
+        ok &= t == times[decoded] && memcmp(row, rows + decoded * CODEC_BENCH_SERIES, sizeof(row)) == 0;
+        decoded++;
+    }
+    uint64_t decodeNs = nowNs() - start;
+
+    r.rows = count;
+    r.rawBytes = count * (4 + 2 * CODEC_BENCH_SERIES);
+    r.encodedBytes = len;
+    r.bytesPerRow = (float)len / count;
+    r.bytesPerSample = (float)len / (count * CODEC_BENCH_SERIES);
+    r.encodeNsPerRow = (float)encodeNs / count;
+    r.decodeNsPerRow = (float)decodeNs / count;
+    r.roundTripOk = ok && decoded == count;
+    return r;
+}
@@ -79,6 +79,8 @@ struct FridgeData {
 };
 
 // Command packet (Master → Victron)
+// Unacknowledged commands are resent with the same commandId, so the
+// receiver should execute each id once and just ACK the repeats.
 struct ControlCommand {
     uint32_t commandId;         // Unique command ID for tracking
     uint8_t device;             // Target device (1=Fridge)
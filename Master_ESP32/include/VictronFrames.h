@@ -0,0 +1,265 @@
+#pragma once
+
+#include "EspNowProtocol.h"
+#include "VictronData.h"
+
+/**
+ * Maps the structs in VictronData.h to and from EspNowProtocol.h frames.
+ * Shared with the Victron relay the same way VictronData.h is: the relay
+ * encodes with encodeTelemetryFrame() / encodeAckFrame(), the Master decodes
+ * with a DeltaDecoder plus applyTelemetrySection() / decodeCommandAck() and
+ * sends commands with encodeCommandFrame().
+ *
+ * Only keyframes carry the whole packet; applyTelemetrySection() updates
+ * just the part a section describes, so the receiver keeps a running
+ * VictronPacket and merges each frame into it.
+ */
+
+inline uint8_t validFlag(bool valid) { return valid ? SECTION_VALID : 0; }
+
+// Quantise the part of `p` a field section describes (ESPNOW_SECTIONS layout)
+inline bool packetFields(uint8_t tag, const VictronPacket& p, int32_t* v) {
+    switch (tag) {
+        case TAG_READY:
+            v[0] = p.readyForCommand;
+            return true;
+        case TAG_BMV: {
+            const BMVData& b = p.bmv;
+            v[0] = espnowQuantize(b.voltage, 100, 0, UINT16_MAX);
+            v[1] = espnowQuantize(b.current, 1000, INT32_MIN + 1, INT32_MAX - 1);
+            v[2] = espnowQuantize(b.soc, 10, 0, 1000);
+            v[3] = espnowQuantize(b.consumedAh, 10, INT16_MIN, INT16_MAX);
+            v[4] = espnowQuantize(b.auxVoltage, 100, 0, UINT16_MAX);
+            v[5] = b.timeToGo;
+            v[6] = validFlag(b.valid) | (b.hasLowVoltageAlarm ? BMV_ALARM_LOW_VOLTAGE : 0) |
+                   (b.hasHighVoltageAlarm ? BMV_ALARM_HIGH_VOLTAGE : 0) | (b.hasLowSOCAlarm ? BMV_ALARM_LOW_SOC : 0);
+            return true;
+        }
+        case TAG_MPPT: {
+            const MPPTData& m = p.mppt;
+            v[0] = espnowQuantize(m.batteryVoltage, 100, 0, UINT16_MAX);
+            v[1] = espnowQuantize(m.batteryCurrent, 100, INT16_MIN, INT16_MAX);
+            v[2] = espnowQuantize(m.solarPower, 1, 0, UINT16_MAX);
+            v[3] = espnowQuantize(m.yieldToday, 100, 0, UINT16_MAX);
+            v[4] = m.state;
+            v[5] = m.error;
+            v[6] = validFlag(m.valid);
+            return true;
+        }
+        case TAG_IP22: {
+            const IP22Data& c = p.ip22;
+            v[0] = espnowQuantize(c.batteryVoltage, 100, 0, UINT16_MAX);
+            v[1] = espnowQuantize(c.batteryCurrent, 100, INT16_MIN, INT16_MAX);
+            v[2] = espnowQuantize(c.temperature, 10, INT16_MIN, INT16_MAX);
+            v[3] = espnowQuantize(c.loadCurrent, 100, INT16_MIN, INT16_MAX);
+            v[4] = espnowQuantize(c.power, 1, 0, UINT16_MAX);
+            v[5] = c.state;
+            v[6] = c.error;
+            v[7] = validFlag(c.valid);
+            return true;
+        }
+        case TAG_ECOFLOW: {
+            const EcoFlowData& e = p.ecoflow;
+            v[0] = e.batteryPercent;
+            v[1] = espnowQuantize(e.rssi, 1, INT8_MIN, INT8_MAX);
+            v[2] = validFlag(e.valid);
+            return true;
+        }
+        case TAG_FRIDGE: {
+            const FridgeData& f = p.fridge;
+            v[0] = f.left_actual;
+            v[1] = f.left_setpoint;
+            v[2] = f.right_actual;
+            v[3] = f.right_setpoint;
+            v[4] = f.battery_protection;
+            v[5] = espnowQuantize(f.rssi, 1, INT8_MIN, INT8_MAX);
+            v[6] = validFlag(f.valid) | (f.connected ? FRIDGE_CONNECTED : 0) | (f.eco_mode ? FRIDGE_ECO : 0) |
+                   (f.lock ? FRIDGE_LOCK : 0) | (f.celsius ? FRIDGE_CELSIUS : 0);
+            return true;
+        }
+        default:
+            return false;
+    }
+}
+
+// Encode one telemetry frame from `p`: a keyframe or a delta frame as the
+// encoder decides, or a plain full frame without an encoder
+inline size_t encodeTelemetryFrame(const VictronPacket& p, uint8_t* buf, uint16_t seq, DeltaEncoder* delta) {
+    FrameWriter w(buf, MSG_TELEMETRY, SRC_VICTRON);
+    uint32_t text = espnowCrc16((const uint8_t*)p.ecoflow.serialNumber, strnlen(p.ecoflow.serialNumber, sizeof(p.ecoflow.serialNumber)));
+    text = text << 16 | espnowCrc16((const uint8_t*)p.ecoflow.macAddress, strnlen(p.ecoflow.macAddress, sizeof(p.ecoflow.macAddress)));
+    bool key = delta ? delta->begin(w, seq, text) : true;
+    if (!delta) w.setFlags(ESPNOW_FLAG_KEYFRAME);
+
+    w.beginSection(TAG_SENDER_TIME).u32(p.senderTime).endSection();
+    int32_t values[ESPNOW_MAX_FIELDS];
+    for (const SectionLayout& layout : ESPNOW_SECTIONS) {
+        packetFields(layout.tag, p, values);
+        if (delta) {
+            delta->section(w, layout.tag, values);
+        } else {
+            w.beginSection(layout.tag);
+            for (uint8_t i = 0; i < layout.count; i++) w.field(layout.fields[i], values[i]);
+            w.endSection();
+        }
+    }
+    if (key) {
+        w.beginSection(TAG_ECOFLOW_SERIAL).str(p.ecoflow.serialNumber, sizeof(p.ecoflow.serialNumber)).endSection();
+        w.beginSection(TAG_ECOFLOW_ADDRESS).str(p.ecoflow.macAddress, sizeof(p.ecoflow.macAddress)).endSection();
+    }
+    return w.finish(seq);
+}
+
+// Merge one decoded section into `p` (the apply callback of DeltaDecoder).
+// `values` are the fields of a field section, nullptr for the others.
+inline void applyTelemetrySection(uint8_t tag, const int32_t* v, SectionReader& s, VictronPacket& p) {
+    switch (tag) {
+        case TAG_SENDER_TIME:
+            p.senderTime = s.u32();
+            break;
+        case TAG_READY:
+            if (v) p.readyForCommand = v[0] != 0;
+            break;
+        case TAG_BMV: {
+            if (!v) break;
+            BMVData& b = p.bmv;
+            b.voltage = v[0] / 100.0f;
+            b.current = v[1] / 1000.0f;
+            b.soc = v[2] / 10.0f;
+            b.consumedAh = v[3] / 10.0f;
+            b.auxVoltage = v[4] / 100.0f;
+            b.timeToGo = v[5];
+            b.valid = v[6] & SECTION_VALID;
+            b.hasLowVoltageAlarm = v[6] & BMV_ALARM_LOW_VOLTAGE;
+            b.hasHighVoltageAlarm = v[6] & BMV_ALARM_HIGH_VOLTAGE;
+            b.hasLowSOCAlarm = v[6] & BMV_ALARM_LOW_SOC;
+            b.timestamp = p.senderTime;
+            break;
+        }
+        case TAG_MPPT: {
+            if (!v) break;
+            MPPTData& m = p.mppt;
+            m.batteryVoltage = v[0] / 100.0f;
+            m.batteryCurrent = v[1] / 100.0f;
+            m.solarPower = v[2];
+            m.yieldToday = v[3] / 100.0f;
+            m.state = v[4];
+            m.error = v[5];
+            m.valid = v[6] & SECTION_VALID;
+            m.timestamp = p.senderTime;
+            break;
+        }
+        case TAG_IP22: {
+            if (!v) break;
+            IP22Data& c = p.ip22;
+            c.batteryVoltage = v[0] / 100.0f;
+            c.batteryCurrent = v[1] / 100.0f;
+            c.temperature = v[2] / 10.0f;
+            c.loadCurrent = v[3] / 100.0f;
+            c.power = v[4];
+            c.state = v[5];
+            c.error = v[6];
+            c.valid = v[7] & SECTION_VALID;
+            c.timestamp = p.senderTime;
+            break;
+        }
+        case TAG_ECOFLOW: {
+            if (!v) break;
+            EcoFlowData& e = p.ecoflow;
+            e.batteryPercent = v[0];
+            e.rssi = v[1];
+            e.valid = v[2] & SECTION_VALID;
+            e.timestamp = p.senderTime;
+            break;
+        }
+        case TAG_ECOFLOW_SERIAL:
+            s.str(p.ecoflow.serialNumber, sizeof(p.ecoflow.serialNumber));
+            break;
+        case TAG_ECOFLOW_ADDRESS:
+            s.str(p.ecoflow.macAddress, sizeof(p.ecoflow.macAddress));
+            break;
+        case TAG_FRIDGE: {
+            if (!v) break;
+            FridgeData& f = p.fridge;
+            f.left_actual = v[0];
+            f.left_setpoint = v[1];
+            f.right_actual = v[2];
+            f.right_setpoint = v[3];
+            f.battery_protection = v[4];
+            f.rssi = v[5];
+            f.valid = v[6] & SECTION_VALID;
+            f.connected = v[6] & FRIDGE_CONNECTED;
+            f.eco_mode = v[6] & FRIDGE_ECO;
+            f.lock = v[6] & FRIDGE_LOCK;
+            f.celsius = v[6] & FRIDGE_CELSIUS;
+            f.last_seen = p.senderTime;
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+inline size_t encodeCommandFrame(const ControlCommand& cmd, uint8_t* buf, uint16_t seq) {
+    FrameWriter w(buf, MSG_COMMAND, SRC_MASTER);
+    w.beginSection(TAG_SENDER_TIME).u32(cmd.timestamp).endSection();
+    w.beginSection(TAG_COMMAND)
+        .u32(cmd.commandId).u8(cmd.device).u8(cmd.command).s16(cmd.value1).s16(cmd.value2)
+        .endSection();
+    return w.finish(seq);
+}
+
+inline bool decodeCommand(FrameReader& frame, ControlCommand& cmd) {
+    uint8_t tag;
+    SectionReader s(nullptr, 0);
+    bool found = false;
+    while (frame.next(tag, s)) {
+        if (tag == TAG_SENDER_TIME) {
+            cmd.timestamp = s.u32();
+        } else if (tag == TAG_COMMAND) {
+            cmd.commandId = s.u32();
+            cmd.device = s.u8();
+            cmd.command = s.u8();
+            cmd.value1 = s.s16();
+            cmd.value2 = s.s16();
+            found = true;
+        }
+    }
+    return found;
+}
+
+inline size_t encodeAckFrame(const CommandAck& ack, uint8_t* buf, uint16_t seq) {
+    FrameWriter w(buf, MSG_COMMAND_ACK, SRC_VICTRON);
+    w.beginSection(TAG_SENDER_TIME).u32(ack.timestamp).endSection();
+    w.beginSection(TAG_ACK)
+        .u32(ack.commandId)
+        .u8((ack.received ? ACK_RECEIVED : 0) | (ack.executed ? ACK_EXECUTED : 0))
+        .u8(ack.errorCode)
+        .endSection();
+    return w.finish(seq);
+}
+
+inline bool decodeCommandAck(FrameReader& frame, CommandAck& ack) {
+    uint8_t tag;
+    SectionReader s(nullptr, 0);
+    bool found = false;
+    while (frame.next(tag, s)) {
+        if (tag == TAG_SENDER_TIME) {
+            ack.timestamp = s.u32();
+        } else if (tag == TAG_ACK) {
+            ack.commandId = s.u32();
+            uint8_t flags = s.u8();
+            ack.received = flags & ACK_RECEIVED;
+            ack.executed = flags & ACK_EXECUTED;
+            ack.errorCode = s.u8();
+            found = true;
+        }
+    }
+    return found;
+}
+
+inline size_t encodeStatusFrame(bool ready, uint8_t* buf, uint16_t seq) {
+    FrameWriter w(buf, MSG_STATUS, SRC_VICTRON);
+    w.beginSection(TAG_READY).u8(ready).endSection();
+    return w.finish(seq);
+}
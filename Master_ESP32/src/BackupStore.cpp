@@ -0,0 +1,282 @@
+#include "BackupStore.h"
+#include <SPIFFS.h>
+
+BackupStore backupStore;
+
+static const char INDEX_MAGIC[4] = {'B', 'K', 'S', '1'};
+
+static void blobPath(uint32_t hash, char* path, size_t len) {
+    snprintf(path, len, "/blob_%08lx.bin", (unsigned long)hash);
+}
+
+// Directory entries come back with or without the leading '/' depending on the core
+static const char* baseName(const char* name) {
+    return name[0] == '/' ? name + 1 : name;
+}
+
+// FNV-1a over the whole file, read in blocks
+static bool hashFile(const char* path, uint32_t& hash, uint32_t& size) {
+    File file = SPIFFS.open(path, "r");
+    if (!file) return false;
+    uint8_t buf[BACKUP_COPY_BLOCK];
+    hash = 2166136261UL;
+    size = 0;
+    size_t n;
+    while ((n = file.read(buf, sizeof(buf))) > 0) {
+        for (size_t i = 0; i < n; i++) {
+            hash ^= buf[i];
+            hash *= 16777619UL;
+        }
+        size += n;
+    }
+    file.close();
+    return true;
+}
+
+static bool copyFile(const char* from, const char* to) {
+    File source = SPIFFS.open(from, "r");
+    if (!source) return false;
+    File dest = SPIFFS.open(to, "w");
+    if (!dest) {
+        source.close();
+        return false;
+    }
+    uint8_t buf[BACKUP_COPY_BLOCK];
+    bool ok = true;
+    size_t n;
+    while (ok && (n = source.read(buf, sizeof(buf))) > 0) {
+        ok = dest.write(buf, n) == n;
+    }
+    source.close();
+    dest.close();
+    if (!ok) SPIFFS.remove(to);
+    return ok;
+}
+
+static bool sameContents(const char* a, const char* b) {
+    File fa = SPIFFS.open(a, "r");
+    File fb = SPIFFS.open(b, "r");
+    bool same = fa && fb && fa.size() == fb.size();
+    uint8_t bufA[BACKUP_COPY_BLOCK / 2], bufB[BACKUP_COPY_BLOCK / 2];
+    while (same) {
+        size_t n = fa.read(bufA, sizeof(bufA));
+        if (n == 0) break;
+        same = fb.read(bufB, n) == n && memcmp(bufA, bufB, n) == 0;
+    }
+    if (fa) fa.close();
+    if (fb) fb.close();
+    return same;
+}
+
+void BackupStore::begin() {
+    _refs.clear();
+
+    // A save interrupted between remove and rename leaves only the temp file
+    if (!SPIFFS.exists(BACKUP_INDEX_PATH) && SPIFFS.exists(BACKUP_INDEX_TMP)) {
+        SPIFFS.rename(BACKUP_INDEX_TMP, BACKUP_INDEX_PATH);
+    }
+
+    bool indexOk = false;
+    File index = SPIFFS.open(BACKUP_INDEX_PATH, "r");
+    if (index) {
+        char magic[4];
+        BackupRef ref;
+        if (index.read((uint8_t*)magic, sizeof(magic)) == sizeof(magic) && memcmp(magic, INDEX_MAGIC, 4) == 0) {
+            while (index.read((uint8_t*)&ref, sizeof(ref)) == sizeof(ref)) {
+                ref.name[BACKUP_NAME_MAX] = '\0';
+                _refs.push_back(ref);
+            }
+            indexOk = true;
+        } else {
+            Serial.println("[BACKUP] Ignoring unreadable backup index");
+        }
+        index.close();
+    }
+
+    // Without an index every blob would look unreferenced; keep them all
+    // under recovered_<hash> names instead of collecting them
+    if (!indexOk) recoverBlobs();
+
+    // Adopt whole-file backups written by older firmware
+    std::vector<String> legacy;
+    File root = SPIFFS.open("/");
+    for (File file = root.openNextFile(); file; file = root.openNextFile()) {
+        String fileName = baseName(file.name());
+        if (fileName.startsWith("backup_") && fileName.endsWith(".json")) legacy.push_back(fileName);
+    }
+    for (const String& fileName : legacy) {
+        String name = fileName.substring(7, fileName.length() - 5);
+        String path = "/" + fileName;
+        if (name.length() <= BACKUP_NAME_MAX && put(name.c_str(), path.c_str())) {
+            SPIFFS.remove(path);
+            Serial.printf("[BACKUP] Adopted legacy backup: %s\n", name.c_str());
+        }
+    }
+
+    // Only trust the index to say which blobs are unused if it was read
+    if (indexOk) collectGarbage();
+    else SPIFFS.remove(BACKUP_BLOB_TMP);
+    Serial.printf("[BACKUP] %u backups in %u bytes\n", (unsigned)_refs.size(), (unsigned)bytesStored());
+}
+
+int BackupStore::find(const char* name) const {
+    for (size_t i = 0; i < _refs.size(); i++) {
+        if (strcmp(_refs[i].name, name) == 0) return i;
+    }
+    return -1;
+}
+
+bool BackupStore::put(const char* name, const char* path) {
+    if (strlen(name) > BACKUP_NAME_MAX) return false;
+    uint32_t hash, size, stored;
+    if (!hashFile(path, hash, size) || !storeBlob(path, hash, size, stored)) return false;
+
+    BackupRef ref = {};
+    strncpy(ref.name, name, BACKUP_NAME_MAX);
+    ref.hash = stored;
+    ref.size = size;
+    int i = find(name);
+    if (i >= 0) _refs[i] = ref;
+    else _refs.push_back(ref);
+
+    bool ok = saveIndex();
+    collectGarbage();    // The name may have pointed at a blob nothing else uses
+    return ok;
+}
+
+// Find the blob holding these contents, or write one. Hash collisions with
+// different contents move on to the next hash value.
+bool BackupStore::storeBlob(const char* path, uint32_t hash, uint32_t size, uint32_t& stored) {
+    char blob[24];
+    for (uint32_t h = hash; h != hash + 4; h++) {
+        blobPath(h, blob, sizeof(blob));
+        if (SPIFFS.exists(blob)) {
+            if (sameContents(path, blob)) {
+                stored = h;
+                return true;    // Already stored: nothing to write
+            }
+            continue;
+        }
+        if (!copyFile(path, BACKUP_BLOB_TMP) || !SPIFFS.rename(BACKUP_BLOB_TMP, blob)) {
+            SPIFFS.remove(BACKUP_BLOB_TMP);
+            Serial.println("[BACKUP] Failed to write blob");
+            return false;
+        }
+        stored = h;
+        return true;
+    }
+    return false;
+}
+
+bool BackupStore::restore(const char* name, const char* path) {
+    int i = find(name);
+    if (i < 0) return false;
+    char blob[24];
+    blobPath(_refs[i].hash, blob, sizeof(blob));
+    return copyFile(blob, path);
+}
+
+bool BackupStore::remove(const char* name) {
+    int i = find(name);
+    if (i < 0) return false;
+    _refs.erase(_refs.begin() + i);
+    bool ok = saveIndex();
+    collectGarbage();
+    return ok;
+}
+
+bool BackupStore::rename(const char* from, const char* to) {
+    int i = find(from);
+    if (i < 0 || strlen(to) > BACKUP_NAME_MAX) return false;
+    int j = find(to);
+    if (j == i) return true;
+    if (j >= 0) {
+        _refs[j].hash = _refs[i].hash;
+        _refs[j].size = _refs[i].size;
+        _refs.erase(_refs.begin() + i);
+    } else {
+        memset(_refs[i].name, 0, sizeof(_refs[i].name));
+        strncpy(_refs[i].name, to, BACKUP_NAME_MAX);
+    }
+    bool ok = saveIndex();
+    collectGarbage();
+    return ok;
+}
+
+void BackupStore::clear() {
+    _refs.clear();
+    SPIFFS.remove(BACKUP_INDEX_PATH);
+    collectGarbage();
+}
+
+size_t BackupStore::shares(const BackupRef& ref) const {
+    size_t n = 0;
+    for (const BackupRef& other : _refs) {
+        if (other.hash == ref.hash) n++;
+    }
+    return n;
+}
+
+size_t BackupStore::bytesStored() const {
+    size_t total = 0;
+    for (size_t i = 0; i < _refs.size(); i++) {
+        bool first = true;
+        for (size_t j = 0; j < i && first; j++) first = _refs[j].hash != _refs[i].hash;
+        if (first) total += _refs[i].size;
+    }
+    return total;
+}
+
+// Written to a temp file and renamed, like the inventory snapshot
+bool BackupStore::saveIndex() {
+    File index = SPIFFS.open(BACKUP_INDEX_TMP, "w");
+    if (!index) return false;
+    bool ok = index.write((const uint8_t*)INDEX_MAGIC, sizeof(INDEX_MAGIC)) == sizeof(INDEX_MAGIC);
+    for (const BackupRef& ref : _refs) {
+        ok = ok && index.write((const uint8_t*)&ref, sizeof(ref)) == sizeof(ref);
+    }
+    index.close();
+    if (!ok) {
+        SPIFFS.remove(BACKUP_INDEX_TMP);
+        Serial.println("[BACKUP] Failed to write backup index");
+        return false;
+    }
+    SPIFFS.remove(BACKUP_INDEX_PATH);
+    return SPIFFS.rename(BACKUP_INDEX_TMP, BACKUP_INDEX_PATH);
+}
+
+// Reference every blob on disk as recovered_<hash> (the index is lost)
+void BackupStore::recoverBlobs() {
+    File root = SPIFFS.open("/");
+    for (File file = root.openNextFile(); file; file = root.openNextFile()) {
+        const char* name = baseName(file.name());
+        if (strncmp(name, "blob_", 5) != 0) continue;
+        BackupRef ref = {};
+        ref.hash = strtoul(name + 5, nullptr, 16);
+        ref.size = file.size();
+        snprintf(ref.name, sizeof(ref.name), "recovered_%08lx", (unsigned long)ref.hash);
+        _refs.push_back(ref);
+    }
+    if (_refs.empty()) return;
+    Serial.printf("[BACKUP] Index lost, kept %u blobs as recovered backups\n", (unsigned)_refs.size());
+    saveIndex();
+}
+
+// Delete blobs no backup refers to (and leftovers from an interrupted copy)
+void BackupStore::collectGarbage() {
+    SPIFFS.remove(BACKUP_BLOB_TMP);
+    std::vector<String> unused;
+    File root = SPIFFS.open("/");
+    for (File file = root.openNextFile(); file; file = root.openNextFile()) {
+        const char* name = baseName(file.name());
+        if (strncmp(name, "blob_", 5) != 0) continue;
+        uint32_t hash = strtoul(name + 5, nullptr, 16);
+        bool used = false;
+        for (const BackupRef& ref : _refs) used = used || ref.hash == hash;
+        if (!used) unused.push_back(String("/") + name);
+    }
+    for (const String& path : unused) {
+        SPIFFS.remove(path);
+        Serial.printf("[BACKUP] Removed unreferenced blob %s\n", path.c_str());
+    }
+}
@@ -0,0 +1,78 @@
+#pragma once
+#include <Arduino.h>
+#include <vector>
+
+/**
+ * Content-addressed inventory backups.
+ *
+ * Each distinct snapshot is stored once as /blob_<hash>.bin (FNV-1a of the
+ * contents). A backup ("current", "daily_12", "weekly_1", ...) is just a
+ * named reference to a blob, kept in the small index file /backups.idx. An
+ * unchanged inventory backed up daily, weekly and monthly on the same day
+ * costs one blob and three index entries, and taking a backup of a snapshot
+ * that is already stored writes nothing but the index.
+ *
+ * Blobs that no reference points to are deleted whenever references are
+ * removed or replaced. Copies are done in BACKUP_COPY_BLOCK-byte blocks.
+ * Old /backup_<name>.json files are adopted into the store by begin().
+ *
+ * The index is written to a temp file and renamed over the old one; begin()
+ * picks up the temp file if a power cut hit between the two. If the index
+ * is still missing or unreadable, every blob on disk is kept as a
+ * "recovered_<hash>" backup rather than collected as unreferenced.
+ */
+
+#define BACKUP_INDEX_PATH "/backups.idx"
+#define BACKUP_INDEX_TMP "/backups.tmp"
+#define BACKUP_BLOB_TMP "/blob.tmp"
+#define BACKUP_RESTORE_TMP "/restore.tmp"     // Where a restore is staged before replacing the snapshot
+#define BACKUP_COPY_BLOCK 512
+#define BACKUP_NAME_MAX 23
+
+struct BackupRef {
+    char name[BACKUP_NAME_MAX + 1];
+    uint32_t hash;          // Blob the backup points at
+    uint32_t size;          // Blob size in bytes
+};
+static_assert(sizeof(BackupRef) == 32, "index records are written raw");
+
+class BackupStore {
+public:
+    // Load the index and adopt legacy backup files. Call after SPIFFS.begin().
+    void begin();
+
+    // Point `name` at the contents of `path`, storing the contents only if
+    // no existing blob already holds them
+    bool put(const char* name, const char* path);
+
+    // Copy backup `name` to `path` (via a temp file, then rename)
+    bool restore(const char* name, const char* path);
+
+    bool exists(const char* name) const { return find(name) >= 0; }
+    bool remove(const char* name);
+
+    // Rename a reference, replacing any existing `to`; false if `from` doesn't exist
+    bool rename(const char* from, const char* to);
+
+    // Drop every backup and blob
+    void clear();
+
+    const std::vector<BackupRef>& list() const { return _refs; }
+
+    // How many backups share this backup's blob
+    size_t shares(const BackupRef& ref) const;
+
+    // Bytes of blob storage actually used (each blob counted once)
+    size_t bytesStored() const;
+
+private:
+    int find(const char* name) const;
+    bool saveIndex();
+    void recoverBlobs();
+    void collectGarbage();
+    bool storeBlob(const char* path, uint32_t hash, uint32_t size, uint32_t& stored);
+
+    std::vector<BackupRef> _refs;
+};
+
+extern BackupStore backupStore;
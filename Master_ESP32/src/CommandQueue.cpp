@@ -0,0 +1,116 @@
+#include "CommandQueue.h"
+
+CommandQueue commandQueue;
+
+CommandLane commandLane(uint8_t device, uint8_t command) {
+    // Battery protection stops the fridge flattening the house battery
+    if (device == 1 && command == CMD_FRIDGE_SET_BATTERY) return LANE_URGENT;
+    return LANE_NORMAL;
+}
+
+const char* commandLaneName(CommandLane lane) {
+    return lane == LANE_URGENT ? "urgent" : "normal";
+}
+
+QueueResult CommandQueue::push(uint8_t device, uint8_t command, int16_t value1, int16_t value2, unsigned long now) {
+    QueueResult result = QUEUE_FULL;
+    portENTER_CRITICAL(&_mux);
+    int free = -1;
+    for (int i = 0; i < COMMAND_QUEUE_SIZE; i++) {
+        if (!_used[i]) {
+            if (free < 0) free = i;
+            continue;
+        }
+        if (_slots[i].device == device && _slots[i].command == command) {
+            _slots[i].value1 = value1;
+            _slots[i].value2 = value2;
+            _coalesced++;
+            result = QUEUE_REPLACED;
+            break;
+        }
+    }
+    if (result != QUEUE_REPLACED && free >= 0) {
+        QueuedCommand& slot = _slots[free];
+        slot.device = device;
+        slot.command = command;
+        slot.value1 = value1;
+        slot.value2 = value2;
+        slot.queuedAt = now;
+        slot.lane = commandLane(device, command);
+        slot.seq = _nextSeq++;
+        _used[free] = true;
+        if (++_count > _maxDepth) _maxDepth = _count;
+        result = QUEUE_ADDED;
+    }
+    if (result == QUEUE_FULL) _dropped++;
+    portEXIT_CRITICAL(&_mux);
+    return result;
+}
+
+bool CommandQueue::pop(QueuedCommand& out, unsigned long now) {
+    portENTER_CRITICAL(&_mux);
+    int next = -1;
+    for (int i = 0; i < COMMAND_QUEUE_SIZE; i++) {
+        if (!_used[i]) continue;
+        if (next < 0 || _slots[i].lane < _slots[next].lane ||
+            (_slots[i].lane == _slots[next].lane && (int32_t)(_slots[i].seq - _slots[next].seq) < 0)) {
+            next = i;
+        }
+    }
+    if (next >= 0) {
+        out = _slots[next];
+        _used[next] = false;
+        _count--;
+    }
+    portEXIT_CRITICAL(&_mux);
+    if (next < 0) return false;
+
+    unsigned long waited = now - out.queuedAt;
+    CommandLaneStats& stats = _lanes[out.lane];
+    stats.dispatched++;
+    stats.waitTotalMs += waited;
+    if (waited > stats.waitMaxMs) stats.waitMaxMs = waited;
+    return true;
+}
+
+bool CommandQueue::waiting(uint8_t device, uint8_t command) {
+    bool found = false;
+    portENTER_CRITICAL(&_mux);
+    for (int i = 0; i < COMMAND_QUEUE_SIZE && !found; i++) {
+        found = _used[i] && _slots[i].device == device && _slots[i].command == command;
+    }
+    portEXIT_CRITICAL(&_mux);
+    return found;
+}
+
+uint8_t CommandQueue::depth(CommandLane lane) const {
+    uint8_t n = 0;
+    for (int i = 0; i < COMMAND_QUEUE_SIZE; i++) {
+        if (_used[i] && _slots[i].lane == lane) n++;
+    }
+    return n;
+}
+
+uint32_t CommandQueue::dispatched() const {
+    uint32_t n = 0;
+    for (const CommandLaneStats& lane : _lanes) n += lane.dispatched;
+    return n;
+}
+
+unsigned long CommandQueue::waitAvgMs() const {
+    uint32_t n = 0;
+    unsigned long total = 0;
+    for (const CommandLaneStats& lane : _lanes) {
+        n += lane.dispatched;
+        total += lane.waitTotalMs;
+    }
+    return n ? total / n : 0;
+}
+
+unsigned long CommandQueue::waitMaxMs() const {
+    unsigned long worst = 0;
+    for (const CommandLaneStats& lane : _lanes) {
+        if (lane.waitMaxMs > worst) worst = lane.waitMaxMs;
+    }
+    return worst;
+}
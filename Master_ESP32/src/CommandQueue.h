@@ -0,0 +1,91 @@
+#pragma once
+#include <Arduino.h>
+#include "VictronData.h"
+
+/**
+ * Pending commands waiting for the radio, keyed by (device, command).
+ *
+ * Only the newest value for a setting matters, so queueing a command whose
+ * key is already waiting replaces that entry's values in place instead of
+ * adding another: five taps on the temperature "+" button send one command.
+ * The replaced entry keeps its place in line and its original queue time.
+ *
+ * Commands are sent urgent lane first, then oldest first within a lane.
+ * Safety settings (fridge battery protection) go in the urgent lane so they
+ * never wait behind setpoint changes.
+ *
+ * push() is called from HTTP handlers and pop() from commandTask; both take
+ * the queue's spinlock. The statistics are plain counters, fine to read
+ * from any task.
+ */
+
+#define COMMAND_QUEUE_SIZE 10
+
+enum CommandLane : uint8_t {
+    LANE_URGENT = 0,
+    LANE_NORMAL,
+    COMMAND_LANES
+};
+
+struct QueuedCommand {
+    uint8_t device;
+    uint8_t command;
+    int16_t value1;
+    int16_t value2;
+    unsigned long queuedAt;     // millis() when first queued, for wait stats
+    CommandLane lane;
+    uint32_t seq;               // Queue order within a lane
+};
+
+enum QueueResult : uint8_t {
+    QUEUE_ADDED,
+    QUEUE_REPLACED,             // Superseded a waiting command with the same key
+    QUEUE_FULL
+};
+
+struct CommandLaneStats {
+    uint32_t dispatched;
+    unsigned long waitTotalMs;
+    unsigned long waitMaxMs;
+};
+
+class CommandQueue {
+public:
+    QueueResult push(uint8_t device, uint8_t command, int16_t value1, int16_t value2, unsigned long now);
+
+    // Take the next command to send and record how long it waited
+    bool pop(QueuedCommand& out, unsigned long now);
+
+    // A command with this key is waiting to be sent
+    bool waiting(uint8_t device, uint8_t command);
+
+    uint8_t depth() const { return _count; }
+    uint8_t depth(CommandLane lane) const;
+    uint8_t maxDepth() const { return _maxDepth; }
+
+    uint32_t coalesced() const { return _coalesced; }
+    uint32_t dropped() const { return _dropped; }
+    const CommandLaneStats& laneStats(CommandLane lane) const { return _lanes[lane]; }
+
+    // Totals across lanes
+    uint32_t dispatched() const;
+    unsigned long waitAvgMs() const;
+    unsigned long waitMaxMs() const;
+
+private:
+    QueuedCommand _slots[COMMAND_QUEUE_SIZE];
+    bool _used[COMMAND_QUEUE_SIZE] = {};
+    uint8_t _count = 0;
+    uint8_t _maxDepth = 0;
+    uint32_t _nextSeq = 0;
+    uint32_t _coalesced = 0;
+    uint32_t _dropped = 0;
+    CommandLaneStats _lanes[COMMAND_LANES] = {};
+    portMUX_TYPE _mux = portMUX_INITIALIZER_UNLOCKED;
+};
+
+// Which lane a command belongs in
+CommandLane commandLane(uint8_t device, uint8_t command);
+const char* commandLaneName(CommandLane lane);
+
+extern CommandQueue commandQueue;
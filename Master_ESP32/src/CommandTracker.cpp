@@ -0,0 +1,145 @@
+#include "CommandTracker.h"
+
+CommandTracker commandTracker;
+
+// Bucket i holds latencies up to BUCKET_LIMITS_MS[i]; the last one catches the rest
+const uint32_t CommandTracker::BUCKET_LIMITS_MS[COMMAND_LATENCY_BUCKETS] = {
+    10, 20, 35, 50, 75, 100, 150, 250, 500, 1000, 2500, COMMAND_EXPIRE_MS
+};
+
+const char* commandOutcomeName(CommandOutcome outcome) {
+    switch (outcome) {
+        case CMD_OUTCOME_OK: return "ok";
+        case CMD_OUTCOME_FAILED: return "failed";
+        case CMD_OUTCOME_TIMEOUT: return "timeout";
+        default: return "none";
+    }
+}
+
+unsigned long CommandTracker::backoff(uint8_t attempts) {
+    unsigned long wait = (unsigned long)COMMAND_ACK_TIMEOUT_MS << (attempts - 1);
+    return wait < COMMAND_BACKOFF_MAX_MS ? wait : COMMAND_BACKOFF_MAX_MS;
+}
+
+bool CommandTracker::track(const ControlCommand& cmd, unsigned long now) {
+    for (Entry& e : _entries) {
+        if (e.used && e.cmd.device == cmd.device && e.cmd.command == cmd.command) supersede(e);
+    }
+    for (Entry& e : _entries) {
+        if (e.used) continue;
+        e.cmd = cmd;
+        e.firstSent = now;
+        e.attempts = 1;
+        e.deadline = now + backoff(1);
+        e.used = true;
+        _count++;
+        return true;
+    }
+    return false;
+}
+
+bool CommandTracker::acknowledge(const CommandAck& ack, unsigned long now) {
+    for (Entry& e : _entries) {
+        if (!e.used || e.cmd.commandId != ack.commandId) continue;
+        bool ok = ack.executed && ack.errorCode == 0;
+        finish(e, ok ? CMD_OUTCOME_OK : CMD_OUTCOME_FAILED, ack.errorCode, now);
+        return true;
+    }
+    for (uint32_t id : _recentIds) {
+        if (id == ack.commandId) {
+            _duplicateAcks++;
+            return false;
+        }
+    }
+    Serial.printf("[CMD] ACK for unknown command #%u\n", (unsigned)ack.commandId);
+    return false;
+}
+
+void CommandTracker::expire(unsigned long now) {
+    for (Entry& e : _entries) {
+        if (!e.used) continue;
+        bool outOfAttempts = e.attempts >= COMMAND_MAX_ATTEMPTS && (long)(now - e.deadline) >= 0;
+        if (outOfAttempts || now - e.firstSent >= COMMAND_EXPIRE_MS) {
+            finish(e, CMD_OUTCOME_TIMEOUT, 0, now);
+        }
+    }
+}
+
+bool CommandTracker::nextRetransmit(unsigned long now, ControlCommand& out, CommandQueue& queue) {
+    for (Entry& e : _entries) {
+        if (!e.used || e.attempts >= COMMAND_MAX_ATTEMPTS || (long)(now - e.deadline) < 0) continue;
+        if (queue.waiting(e.cmd.device, e.cmd.command)) {
+            supersede(e);
+            continue;
+        }
+        e.attempts++;
+        e.deadline = now + backoff(e.attempts);
+        _retransmits++;
+        out = e.cmd;
+        return true;
+    }
+    return false;
+}
+
+void CommandTracker::finish(Entry& e, CommandOutcome outcome, uint8_t errorCode, unsigned long now) {
+    CommandResult result;
+    result.commandId = e.cmd.commandId;
+    result.device = e.cmd.device;
+    result.command = e.cmd.command;
+    result.value1 = e.cmd.value1;
+    result.value2 = e.cmd.value2;
+    result.outcome = outcome;
+    result.errorCode = errorCode;
+    result.attempts = e.attempts;
+    result.latencyMs = now - e.firstSent;
+    result.finishedAt = now;
+    _last.store(result);
+
+    if (outcome == CMD_OUTCOME_TIMEOUT) {
+        _timedOut++;
+    } else {
+        // Timeouts would only pile up in the last bucket, so only ACKs are timed
+        size_t b = 0;
+        while (b < COMMAND_LATENCY_BUCKETS - 1 && result.latencyMs > BUCKET_LIMITS_MS[b]) b++;
+        _buckets[b]++;
+        if (outcome == CMD_OUTCOME_OK) _acked++;
+        else _failed++;
+    }
+
+    Serial.printf("[CMD] #%u %s after %u send(s), %ums (err %d)\n",
+                  (unsigned)result.commandId, commandOutcomeName(outcome),
+                  result.attempts, (unsigned)result.latencyMs, errorCode);
+
+    release(e);
+}
+
+// A newer value for the same setting replaces this one; no result is
+// recorded, the newer command's outcome is the one that counts
+void CommandTracker::supersede(Entry& e) {
+    Serial.printf("[CMD] #%u superseded after %u send(s)\n", (unsigned)e.cmd.commandId, e.attempts);
+    _superseded++;
+    release(e);
+}
+
+// Free the slot, remembering the id so a late ACK counts as a duplicate
+void CommandTracker::release(Entry& e) {
+    _recentIds[_recentNext] = e.cmd.commandId;
+    _recentNext = (_recentNext + 1) % COMMAND_INFLIGHT_MAX;
+    e.used = false;
+    _count--;
+}
+
+uint32_t CommandTracker::latencyPercentile(uint8_t pct) const {
+    uint32_t total = 0;
+    for (size_t i = 0; i < COMMAND_LATENCY_BUCKETS; i++) total += _buckets[i];
+    if (total == 0) return 0;
+    // Rank of the sample at pct, rounded up so p100 is the largest sample
+    uint32_t rank = (total * pct + 99) / 100;
+    if (rank == 0) rank = 1;
+    uint32_t seen = 0;
+    for (size_t i = 0; i < COMMAND_LATENCY_BUCKETS; i++) {
+        seen += _buckets[i];
+        if (seen >= rank) return BUCKET_LIMITS_MS[i];
+    }
+    return BUCKET_LIMITS_MS[COMMAND_LATENCY_BUCKETS - 1];
+}
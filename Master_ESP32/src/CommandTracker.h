@@ -0,0 +1,129 @@
+#pragma once
+#include <Arduino.h>
+#include "VictronData.h"
+#include "SeqLock.h"
+#include "CommandQueue.h"
+
+/**
+ * In-flight table for commands sent to the Victron relay.
+ *
+ * Every ControlCommand stays in the table until its CommandAck arrives. If
+ * no ACK comes within the timeout the same command (same commandId, so the
+ * receiver can drop repeats) is sent again, waiting twice as long each time
+ * up to COMMAND_BACKOFF_MAX_MS. After COMMAND_MAX_ATTEMPTS sends, or
+ * COMMAND_EXPIRE_MS while the relay is busy scanning, the command is given up
+ * as timed out.
+ *
+ * A command is dropped from the table, without a result, as soon as a newer
+ * one with the same (device, command) key is queued or sent. Otherwise a
+ * late retransmit of the old value could reach the relay after the new one
+ * and undo it.
+ *
+ * Send-to-ACK latency (from the first send) goes into a fixed-bucket
+ * histogram for the p50/p95 figures on /monitor, and the outcome of the most
+ * recent command is kept for /fridge/status.
+ *
+ * The table itself belongs to commandTask. ACKs arrive in the WiFi task and
+ * are handed over by the caller; the counters and lastResult() are safe to
+ * read from any task.
+ */
+
+#define COMMAND_INFLIGHT_MAX 8
+#define COMMAND_ACK_TIMEOUT_MS 300      // First retransmit; doubles per attempt
+#define COMMAND_BACKOFF_MAX_MS 2400
+#define COMMAND_MAX_ATTEMPTS 4          // Sends before giving up (~4.5s worst case)
+#define COMMAND_EXPIRE_MS 30000         // Give up even without retries (relay stuck scanning)
+#define COMMAND_LATENCY_BUCKETS 12
+
+enum CommandOutcome : uint8_t {
+    CMD_OUTCOME_NONE = 0,       // No command finished yet
+    CMD_OUTCOME_OK,             // ACKed and executed
+    CMD_OUTCOME_FAILED,         // ACKed with an error / not executed
+    CMD_OUTCOME_TIMEOUT         // Never ACKed
+};
+
+struct CommandResult {
+    uint32_t commandId;
+    uint8_t device;
+    uint8_t command;
+    int16_t value1;
+    int16_t value2;
+    CommandOutcome outcome;
+    uint8_t errorCode;          // From the ACK
+    uint8_t attempts;           // Times sent
+    uint32_t latencyMs;         // First send to ACK (or to giving up)
+    unsigned long finishedAt;   // millis()
+};
+
+class CommandTracker {
+public:
+    bool full() const { return _count >= COMMAND_INFLIGHT_MAX; }
+    uint8_t inFlight() const { return _count; }
+
+    // Record a command that has just been sent for the first time, dropping
+    // any in-flight command it supersedes
+    bool track(const ControlCommand& cmd, unsigned long now);
+
+    // Match an ACK to its command. False for unknown ids and repeat ACKs
+    // (the receiver ACKs every copy of a retransmitted command).
+    bool acknowledge(const CommandAck& ack, unsigned long now);
+
+    // Give up on commands that are out of attempts or too old
+    void expire(unsigned long now);
+
+    // The overdue command to send again, if any. Counts the attempt and
+    // pushes its deadline back; the caller does the actual send. Commands
+    // with a newer value waiting in `queue` are dropped instead.
+    bool nextRetransmit(unsigned long now, ControlCommand& out, CommandQueue& queue);
+
+    CommandResult lastResult() const { return _last.load(); }
+
+    // Latency percentile (0-100) in ms: the upper bound of the bucket it
+    // falls in, 0 if nothing has been ACKed yet
+    uint32_t latencyPercentile(uint8_t pct) const;
+    static uint32_t bucketLimit(size_t i) { return BUCKET_LIMITS_MS[i]; }
+    uint32_t bucketCount(size_t i) const { return _buckets[i]; }
+
+    uint32_t acked() const { return _acked; }
+    uint32_t failed() const { return _failed; }
+    uint32_t timedOut() const { return _timedOut; }
+    uint32_t retransmits() const { return _retransmits; }
+    uint32_t duplicateAcks() const { return _duplicateAcks; }
+    uint32_t superseded() const { return _superseded; }
+
+private:
+    struct Entry {
+        ControlCommand cmd;
+        unsigned long firstSent;
+        unsigned long deadline;     // Next retransmit (or give up) due
+        uint8_t attempts;
+        bool used;
+    };
+
+    static const uint32_t BUCKET_LIMITS_MS[COMMAND_LATENCY_BUCKETS];
+
+    void finish(Entry& e, CommandOutcome outcome, uint8_t errorCode, unsigned long now);
+    void supersede(Entry& e);
+    void release(Entry& e);
+    static unsigned long backoff(uint8_t attempts);
+
+    Entry _entries[COMMAND_INFLIGHT_MAX] = {};
+    uint8_t _count = 0;
+
+    // Recently finished ids, to tell a late repeat ACK from an unknown one
+    uint32_t _recentIds[COMMAND_INFLIGHT_MAX] = {};
+    uint8_t _recentNext = 0;
+
+    SeqLock<CommandResult> _last;
+    volatile uint32_t _buckets[COMMAND_LATENCY_BUCKETS] = {};
+    volatile uint32_t _acked = 0;
+    volatile uint32_t _failed = 0;
+    volatile uint32_t _timedOut = 0;
+    volatile uint32_t _retransmits = 0;
+    volatile uint32_t _duplicateAcks = 0;
+    volatile uint32_t _superseded = 0;
+};
+
+extern CommandTracker commandTracker;
+
+const char* commandOutcomeName(CommandOutcome outcome);
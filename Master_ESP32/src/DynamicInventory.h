@@ -1,9 +1,12 @@
 #pragma once
 #include <Arduino.h>
 #include <vector>
+#include "StringPool.h"
+#include "InventoryIndex.h"
+#include "WallClock.h"
 
-// Status enumeration for consumable items
-enum ItemStatus {
+// Status enumeration for consumable items (one byte in ConsumableItem)
+enum ItemStatus : int8_t {
     STATUS_FULL = -1,
     STATUS_OK = 0,
     STATUS_LOW = 1,
@@ -17,34 +20,66 @@ enum Subcategory {
     SUBCATEGORY_OPTIONAL = 2
 };
 
+// Category/item names and icons live in one interned pool instead of a heap
+// String each. Names are immutable: assigning a new value interns it.
+extern StringPool inventoryNames;
+
+class InternedName {
+public:
+    InternedName() : _s("") {}
+    InternedName(const char* s) : _s(inventoryNames.intern(s)) {}
+    InternedName(const String& s) : _s(inventoryNames.intern(s.c_str(), s.length())) {}
+
+    InternedName& operator=(const char* s) { _s = inventoryNames.intern(s); return *this; }
+    InternedName& operator=(const String& s) { _s = inventoryNames.intern(s.c_str(), s.length()); return *this; }
+
+    operator const char*() const { return _s; }
+    const char* c_str() const { return _s; }
+    size_t length() const { return strlen(_s); }
+
+    bool operator==(const char* s) const { return strcmp(_s, s) == 0; }
+    bool operator==(const String& s) const { return s.equals(_s); }
+    bool operator!=(const char* s) const { return !(*this == s); }
+    bool operator!=(const String& s) const { return !(*this == s); }
+    bool equalsIgnoreCase(const String& s) const { return strcasecmp(_s, s.c_str()) == 0; }
+
+    // Point at this name's copy in `pool` (see compactInventoryNames())
+    void rebind(StringPool& pool) { _s = pool.intern(_s); }
+
+private:
+    const char* _s;     // Owned by inventoryNames
+};
+
 // Consumable item structure (with new livesInTrailer field)
 struct ConsumableItem {
-    String name;
+    InternedName name;
+    unsigned long lastUpdated;      // Unix seconds (see WallClock.h)
+    uint16_t id;              // Stable item ID (see InventoryIndex.h)
     ItemStatus status;
-    bool livesInTrailer;  // NEW FIELD - true if item stays in trailer, false if bought fresh each trip
-    unsigned long lastUpdated;
+    bool livesInTrailer : 1;  // true if item stays in trailer, false if bought fresh each trip
     
-    ConsumableItem() : status(STATUS_OK), livesInTrailer(true), lastUpdated(0) {}
-    ConsumableItem(String n, ItemStatus s = STATUS_OK, bool trailer = true) : name(n), status(s), livesInTrailer(trailer), lastUpdated(millis()) {}
+    ConsumableItem() : lastUpdated(0), id(INVENTORY_NO_ID), status(STATUS_OK), livesInTrailer(true) {}
+    ConsumableItem(const String& n, ItemStatus s = STATUS_OK, bool trailer = true) : name(n), lastUpdated(wallClock.now()), id(newItemId()), status(s), livesInTrailer(trailer) {}
 };
 
 // Equipment item structure (with new livesInTrailer field for consistency)
 struct EquipmentItem {
-    String name;
-    bool checked;
-    bool packed;
-    bool taking;
-    bool livesInTrailer;  // NEW FIELD - always true for equipment, but keeps data structure consistent
-    unsigned long lastUpdated;
+    InternedName name;
+    unsigned long lastUpdated;      // Unix seconds (see WallClock.h)
+    uint16_t id;
+    bool checked : 1;
+    bool packed : 1;
+    bool taking : 1;
+    bool livesInTrailer : 1;  // Always true for equipment, but keeps data structure consistent
     
-    EquipmentItem() : checked(false), packed(false), taking(false), livesInTrailer(true), lastUpdated(0) {}
-    EquipmentItem(String n, bool c = false, bool p = false, bool t = false) : name(n), checked(c), packed(p), taking(t), livesInTrailer(true), lastUpdated(millis()) {}
+    EquipmentItem() : lastUpdated(0), id(INVENTORY_NO_ID), checked(false), packed(false), taking(false), livesInTrailer(true) {}
+    EquipmentItem(const String& n, bool c = false, bool p = false, bool t = false) : name(n), lastUpdated(wallClock.now()), id(newItemId()), checked(c), packed(p), taking(t), livesInTrailer(true) {}
 };
 
 // Category structure
 struct DynamicCategory {
-    String name;
-    String icon;
+    InternedName name;
+    InternedName icon;
     bool isConsumable;
     Subcategory subcategory;
     std::vector<ConsumableItem> consumables;
@@ -57,6 +92,16 @@ struct DynamicCategory {
 // Global inventory
 extern std::vector<DynamicCategory> inventory;
 
+// Empty the inventory and release its interned names. Use this rather than
+// inventory.clear() whenever the whole inventory is replaced.
+void clearInventory();
+
+// Move the live names into a fresh pool and free the old one, dropping the
+// names renames, deletes and imports left behind. Unless `force`, only when
+// at least half the pool is garbage. Pointers into the old pool (staged
+// imports, undo copies) must be gone by then.
+void compactInventoryNames(bool force = false);
+
 // Helper function to get status name
 inline const char* getStatusName(ItemStatus status) {
     switch(status) {
@@ -0,0 +1,261 @@
+#include "HistoryStore.h"
+#include <SPIFFS.h>
+
+const HistorySeriesInfo HISTORY_SERIES[HIST_SERIES_COUNT] = {
+    {"bmv.voltage",  "V", 100},     // ±327.67 V
+    {"bmv.current",  "A", 100},     // ±327.67 A
+    {"bmv.soc",      "%", 10},
+    {"mppt.power",   "W", 1},
+    {"ip22.current", "A", 100},
+};
+
+const uint16_t HistoryStore::TIER_INTERVAL[HISTORY_TIER_COUNT] = {10, 60, 900};
+
+int16_t HistoryStore::_tier0Rows[HISTORY_TIER0_SLOTS * HIST_SERIES_COUNT];
+int16_t HistoryStore::_tier1Rows[HISTORY_TIER1_SLOTS * HIST_SERIES_COUNT];
+
+// Segment file: 4-byte header, then rows encoded with TelemetryCodec (the
+// codec chain starts fresh in each file). Version 1 files held raw rows.
+static const uint8_t SEGMENT_MAGIC[4] = {'H', 'S', 'G', 2};
+static const size_t SEGMENT_ROW_MAX = 5 + 3 * HIST_SERIES_COUNT;
+
+String HistoryStore::segmentPath(uint32_t day) {
+    return String(HISTORY_DIR "/") + String(day) + ".seg";
+}
+
+int HistoryStore::seriesIndex(const String& name) {
+    for (int i = 0; i < HIST_SERIES_COUNT; i++) {
+        if (name == HISTORY_SERIES[i].name) return i;
+    }
+    return -1;
+}
+
+void HistoryStore::begin() {
+    // Find the newest segment so the clock continues after it
+    uint32_t newestDay = 0;
+    bool found = false;
+    File root = SPIFFS.open("/");
+    File file = root.openNextFile();
+    while (file) {
+        String path = file.path();
+        file.close();
+        int slash = path.lastIndexOf('/');
+        if (path.startsWith(HISTORY_DIR "/") && path.endsWith(".seg")) {
+            uint32_t day = path.substring(slash + 1, path.length() - 4).toInt();
+            if (!found || day > newestDay) newestDay = day;
+            found = true;
+        }
+        file = root.openNextFile();
+    }
+
+    if (found) {
+        uint32_t lastTs = primeEncoder(newestDay);
+        _clockBase = lastTs ? lastTs + TIER_INTERVAL[HISTORY_TIER_PERSISTED] : (newestDay + 1) * 86400UL;
+        pruneSegments(now() / 86400);
+    }
+
+    Serial.printf("[HISTORY] %u bytes RAM (%u x 10s, %u x 1min), clock starts at %lu\n",
+                  (unsigned)ramBytes(), HISTORY_TIER0_SLOTS, (unsigned)HISTORY_TIER1_SLOTS, (unsigned long)now());
+}
+
+uint32_t HistoryStore::now() const {
+    if (_timeSource) return _timeSource();
+    return _clockBase + millis() / 1000;
+}
+
+void HistoryStore::addSample(const float* values, const bool* present) {
+    uint32_t t = now();
+
+    for (uint8_t tier = 0; tier < HISTORY_TIER_COUNT; tier++) {
+        Accumulator& acc = _acc[tier];
+        uint32_t slot = t - (t % TIER_INTERVAL[tier]);
+
+        if (acc.open && slot != acc.slotStart) closeSlot(tier);
+        if (!acc.open) {
+            memset(&acc, 0, sizeof(acc));
+            acc.slotStart = slot;
+            acc.open = true;
+        }
+
+        for (uint8_t s = 0; s < HIST_SERIES_COUNT; s++) {
+            if (!present[s]) continue;
+            acc.sum[s] += values[s];
+            acc.count[s]++;
+        }
+    }
+}
+
+// Average the open slot into one fixed-point row and store it
+void HistoryStore::closeSlot(uint8_t tier) {
+    Accumulator& acc = _acc[tier];
+    int16_t row[HIST_SERIES_COUNT];
+
+    for (uint8_t s = 0; s < HIST_SERIES_COUNT; s++) {
+        if (acc.count[s] == 0) {
+            row[s] = HISTORY_MISSING;
+            continue;
+        }
+        long v = lroundf(acc.sum[s] / acc.count[s] * HISTORY_SERIES[s].scale);
+        row[s] = (int16_t)constrain(v, INT16_MIN + 1, INT16_MAX);
+    }
+    acc.open = false;
+
+    if (tier == HISTORY_TIER_PERSISTED) {
+        appendSegment(acc.slotStart, row);
+    } else {
+        pushRing(_rings[tier], TIER_INTERVAL[tier], acc.slotStart, row);
+    }
+}
+
+void HistoryStore::pushRing(Ring& ring, uint16_t interval, uint32_t t, const int16_t* row) {
+    // Intervals with no packets at all become MISSING rows, so row index maps to time
+    if (ring.used > 0 && t > ring.newest + interval) {
+        uint32_t gaps = (t - ring.newest) / interval - 1;
+        if (gaps > ring.slots) gaps = ring.slots;
+        for (uint32_t i = 0; i < gaps; i++) {
+            int16_t* dst = ring.rows + ring.head * HIST_SERIES_COUNT;
+            for (uint8_t s = 0; s < HIST_SERIES_COUNT; s++) dst[s] = HISTORY_MISSING;
+            ring.head = (ring.head + 1) % ring.slots;
+            if (ring.used < ring.slots) ring.used++;
+        }
+    }
+
+    memcpy(ring.rows + ring.head * HIST_SERIES_COUNT, row, HISTORY_ROW_BYTES);
+    ring.head = (ring.head + 1) % ring.slots;
+    if (ring.used < ring.slots) ring.used++;
+    ring.newest = t;
+}
+
+void HistoryStore::appendSegment(uint32_t t, const int16_t* row) {
+    uint32_t day = t / 86400;
+    if (day != _encoderDay) primeEncoder(day);
+    String path = segmentPath(day);
+    bool isNew = !SPIFFS.exists(path);
+
+    File seg = SPIFFS.open(path, "a");
+    if (!seg) {
+        Serial.printf("[HISTORY] ✗ Cannot open %s\n", path.c_str());
+        return;
+    }
+    uint8_t buf[SEGMENT_ROW_MAX];
+    if (isNew) {
+        seg.write(SEGMENT_MAGIC, sizeof(SEGMENT_MAGIC));
+        _encoder.reset();
+    }
+    seg.write(buf, _encoder.encode(t, row, buf));
+    seg.close();
+
+    if (day != _lastPrunedDay) pruneSegments(day);
+}
+
+// Replay a day's segment through the encoder so new rows continue its delta
+// chain. Returns the newest timestamp in it, 0 if it has no rows.
+uint32_t HistoryStore::primeEncoder(uint32_t day) {
+    uint32_t lastTs = 0;
+    uint8_t scratch[SEGMENT_ROW_MAX];
+    _encoder.reset();
+    _encoderDay = day;
+    bool readable = readSegment(day, [this, &lastTs, &scratch](uint32_t t, const int16_t* row) {
+        _encoder.encode(t, row, scratch);
+        lastTs = t;
+    });
+    if (!readable) {
+        // Older format: start the day over rather than mix encodings in one file
+        SPIFFS.remove(segmentPath(day));
+        Serial.printf("[HISTORY] Replaced old-format segment for day %lu\n", (unsigned long)day);
+    }
+    return lastTs;
+}
+
+// Decode every row of one segment, oldest first; a torn last row is skipped.
+// Returns false if the file exists but has another format version.
+bool HistoryStore::readSegment(uint32_t day, const std::function<void(uint32_t, const int16_t*)>& visit) {
+    String path = segmentPath(day);
+    if (!SPIFFS.exists(path)) return true;
+    File seg = SPIFFS.open(path, "r");
+    if (!seg) return true;
+
+    uint8_t buf[128];
+    if (seg.read(buf, sizeof(SEGMENT_MAGIC)) != sizeof(SEGMENT_MAGIC) ||
+        memcmp(buf, SEGMENT_MAGIC, sizeof(SEGMENT_MAGIC)) != 0) {
+        seg.close();
+        return false;
+    }
+
+    TelemetryDecoder decoder(HIST_SERIES_COUNT);
+    int16_t row[HIST_SERIES_COUNT];
+    uint32_t t;
+    size_t len = 0;
+    for (;;) {
+        len += seg.read(buf + len, sizeof(buf) - len);
+        size_t pos = 0, used;
+        while ((used = decoder.decode(buf + pos, len - pos, t, row)) > 0) {
+            visit(t, row);
+            pos += used;
+        }
+        if (pos == 0) break;    // No progress: end of file (or a torn last row)
+        memmove(buf, buf + pos, len - pos);
+        len -= pos;
+    }
+    seg.close();
+    return true;
+}
+
+void HistoryStore::pruneSegments(uint32_t today) {
+    _lastPrunedDay = today;
+    if (today < HISTORY_DAYS) return;
+
+    File root = SPIFFS.open("/");
+    File file = root.openNextFile();
+    while (file) {
+        String path = file.path();
+        file.close();
+        if (path.startsWith(HISTORY_DIR "/") && path.endsWith(".seg")) {
+            uint32_t day = path.substring(path.lastIndexOf('/') + 1, path.length() - 4).toInt();
+            if (day + HISTORY_DAYS < today) {
+                SPIFFS.remove(path);
+                Serial.printf("[HISTORY] Removed old segment %s\n", path.c_str());
+            }
+        }
+        file = root.openNextFile();
+    }
+}
+
+uint8_t HistoryStore::tierFor(uint32_t from) const {
+    uint32_t t = now();
+    for (uint8_t tier = 0; tier < HISTORY_TIER_PERSISTED; tier++) {
+        uint32_t span = (uint32_t)_rings[tier].slots * TIER_INTERVAL[tier];
+        if (from + span >= t) return tier;
+    }
+    return HISTORY_TIER_PERSISTED;
+}
+
+void HistoryStore::query(uint8_t series, uint8_t tier, uint32_t from, uint32_t to, const Visitor& visit) const {
+    if (series >= HIST_SERIES_COUNT || tier >= HISTORY_TIER_COUNT) return;
+    if (tier == HISTORY_TIER_PERSISTED) {
+        querySegments(series, from, to, visit);
+        return;
+    }
+
+    const Ring& ring = _rings[tier];
+    uint16_t interval = TIER_INTERVAL[tier];
+    for (uint16_t i = 0; i < ring.used; i++) {
+        uint32_t t = ring.newest - (uint32_t)(ring.used - 1 - i) * interval;
+        if (t < from || t > to) continue;
+        uint16_t index = (ring.head + ring.slots - ring.used + i) % ring.slots;
+        visit(t, ring.rows[index * HIST_SERIES_COUNT + series]);
+    }
+}
+
+void HistoryStore::querySegments(uint8_t series, uint32_t from, uint32_t to, const Visitor& visit) const {
+    uint32_t today = now() / 86400;
+    uint32_t firstDay = from / 86400;
+    uint32_t lastDay = min(to / 86400, today);
+    if (today > HISTORY_DAYS && firstDay < today - HISTORY_DAYS) firstDay = today - HISTORY_DAYS;
+
+    for (uint32_t day = firstDay; day <= lastDay; day++) {
+        readSegment(day, [&](uint32_t t, const int16_t* row) {
+            if (t >= from && t <= to) visit(t, row[series]);
+        });
+    }
+}
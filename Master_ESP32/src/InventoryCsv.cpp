@@ -0,0 +1,248 @@
+#include "InventoryCsv.h"
+
+InventoryCsvImport csvImport;
+
+enum CsvColumn {
+    COL_TYPE, COL_CATEGORY, COL_ITEM, COL_STATUS, COL_TRAILER, COL_CHECKED, COL_PACKED, COL_TAKING,
+    CSV_REQUIRED_COLUMNS        // Last Updated is optional
+};
+
+static bool parseStatus(const char* s, ItemStatus& status) {
+    if (strcasecmp(s, "Full") == 0) status = STATUS_FULL;
+    else if (strcasecmp(s, "OK") == 0 || !*s) status = STATUS_OK;
+    else if (strcasecmp(s, "Low") == 0) status = STATUS_LOW;
+    else if (strcasecmp(s, "Out") == 0) status = STATUS_OUT;
+    else return false;
+    return true;
+}
+
+// Category Type column -> consumable flag and tab. Unknown types fall back to
+// guessing from the status and checked columns, as the old importer did.
+static void parseType(const CsvRecord& row, bool& consumable, Subcategory& sub) {
+    const char* type = row.field(COL_TYPE);
+    consumable = false;
+    if (strcmp(type, "CONSUMABLES") == 0) {
+        consumable = true;
+        sub = SUBCATEGORY_TRAILER;      // Consumables always use SUBCATEGORY_TRAILER
+    } else if (strcmp(type, "TRAILER") == 0) {
+        sub = SUBCATEGORY_TRAILER;
+    } else if (strcmp(type, "ESSENTIALS") == 0) {
+        sub = SUBCATEGORY_ESSENTIALS;
+    } else if (strcmp(type, "OPTIONAL") == 0) {
+        sub = SUBCATEGORY_OPTIONAL;
+    } else {
+        consumable = strcmp(row.field(COL_STATUS), "OK") != 0 || strcmp(row.field(COL_CHECKED), "N/A") == 0;
+        sub = consumable ? SUBCATEGORY_TRAILER : SUBCATEGORY_OPTIONAL;
+    }
+}
+
+static bool yes(const char* s) {
+    return strcmp(s, "Yes") == 0;
+}
+
+// Stock list heading rows (see InventoryCsv.h)
+static bool consumableHeading(const CsvRecord& row) {
+    return strcasecmp(row.field(1), "Full") == 0 && strcasecmp(row.field(2), "OK") == 0 &&
+           strcasecmp(row.field(3), "Low") == 0 &&
+           (strcasecmp(row.field(4), "Repl") == 0 || strcasecmp(row.field(4), "Out") == 0);
+}
+
+static bool equipmentHeading(const CsvRecord& row) {
+    return strcasecmp(row.field(1), "Checked") == 0 && strcasecmp(row.field(3), "Packed") == 0;
+}
+
+// A name ending in ':' and nothing else ("Essentials list:")
+static bool listHeading(const CsvRecord& row) {
+    for (size_t i = 1; i < row.count; i++) {
+        if (row.fields[i][0]) return false;
+    }
+    size_t len = strlen(row.field(0));
+    return len > 1 && row.field(0)[len - 1] == ':';
+}
+
+// Stock list tick box: TRUE, FALSE or empty
+static bool parseTick(const char* s, bool& ticked) {
+    ticked = strcasecmp(s, "TRUE") == 0;
+    return ticked || !*s || strcasecmp(s, "FALSE") == 0;
+}
+
+void InventoryCsvImport::begin() {
+    reset();
+    _active = true;
+}
+
+void InventoryCsvImport::reset() {
+    _reader.reset();
+    _categories.clear();
+    _categories.shrink_to_fit();
+    _errors.clear();
+    _errorCount = 0;
+    _imported = 0;
+    _layout = LAYOUT_UNKNOWN;
+    _section = -1;
+    _active = false;
+}
+
+void InventoryCsvImport::write(const char* data, size_t len) {
+    _reader.feed(data, len, [this](const CsvRecord& row) { record(row); });
+}
+
+bool InventoryCsvImport::finish() {
+    _reader.finish([this](const CsvRecord& row) { record(row); });
+    _active = false;
+    if (_imported == 0 && _errorCount == 0) error(0, "No items found");
+    return _errorCount == 0;
+}
+
+void InventoryCsvImport::error(uint32_t line, const String& message) {
+    _errorCount++;
+    if (_errors.size() < MAX_ERRORS) _errors.push_back(CsvImportError{line, message});
+}
+
+// Index of the staged category called `name`, added if new; -1 (after an
+// error) if it exists with the other kind of item
+int InventoryCsvImport::stagedCategory(const char* name, bool consumable, uint32_t line) {
+    for (size_t i = 0; i < _categories.size(); i++) {
+        if (_categories[i].name != name) continue;
+        if (_categories[i].isConsumable == consumable) return i;
+        error(line, "Category \"" + String(name) + "\" mixes consumables and equipment");
+        return -1;
+    }
+    _categories.push_back(DynamicCategory());
+    DynamicCategory& added = _categories.back();
+    added.name = name;
+    added.icon = "📦";   // Default icon
+    added.isConsumable = consumable;
+    return _categories.size() - 1;
+}
+
+void InventoryCsvImport::record(const CsvRecord& row) {
+    if (_layout == LAYOUT_UNKNOWN) {
+        const char* first = *row.field(0) ? row.field(0) : row.field(1);
+        if (strncasecmp(first, "Date:", 5) == 0) {
+            _layout = LAYOUT_CHECKLIST;     // The stock list's ";Date: ____" line
+            return;
+        }
+        if (!consumableHeading(row) && !equipmentHeading(row)) {
+            _layout = LAYOUT_EXPORT;
+            return;     // Column header
+        }
+        _layout = LAYOUT_CHECKLIST;
+    }
+    if (row.blank()) return;
+    if (row.malformed) {
+        error(row.line, "Row too long or unterminated quote");
+        return;
+    }
+    if (_layout == LAYOUT_CHECKLIST) {
+        recordChecklist(row);
+        return;
+    }
+    if (row.count < CSV_REQUIRED_COLUMNS) {
+        error(row.line, "Expected at least " + String((int)CSV_REQUIRED_COLUMNS) + " columns, found " + String(row.count));
+        return;
+    }
+
+    const char* categoryName = row.field(COL_CATEGORY);
+    const char* itemName = row.field(COL_ITEM);
+    if (!*categoryName) {
+        error(row.line, "Missing category");
+        return;
+    }
+    if (!*itemName) {
+        error(row.line, "Missing item name");
+        return;
+    }
+
+    bool consumable;
+    Subcategory sub;
+    parseType(row, consumable, sub);
+
+    ItemStatus status = STATUS_OK;
+    if (consumable && !parseStatus(row.field(COL_STATUS), status)) {
+        error(row.line, "Unknown status \"" + String(row.field(COL_STATUS)) + "\"");
+        return;
+    }
+
+    int index = stagedCategory(categoryName, consumable, row.line);
+    if (index < 0) return;
+    DynamicCategory* category = &_categories[index];
+    category->subcategory = sub;    // Last row wins, as before
+
+    if (consumable) {
+        ConsumableItem item;
+        item.name = itemName;
+        item.status = status;
+        item.livesInTrailer = yes(row.field(COL_TRAILER));
+        item.lastUpdated = wallClock.now();
+        category->consumables.push_back(item);
+    } else {
+        EquipmentItem item;
+        item.name = itemName;
+        item.livesInTrailer = yes(row.field(COL_TRAILER));
+        item.checked = yes(row.field(COL_CHECKED));
+        item.packed = yes(row.field(COL_PACKED));
+        item.taking = yes(row.field(COL_TAKING));
+        item.lastUpdated = wallClock.now();
+        category->equipment.push_back(item);
+    }
+    _imported++;
+}
+
+void InventoryCsvImport::recordChecklist(const CsvRecord& row) {
+    const char* name = row.field(0);
+    bool consumable = consumableHeading(row);
+    bool ticked = equipmentHeading(row);
+    if (consumable || ticked || listHeading(row)) {
+        if (!*name) {
+            error(row.line, "Missing category");
+            return;
+        }
+        String categoryName = name;
+        if (categoryName.endsWith(":")) categoryName = categoryName.substring(0, categoryName.length() - 1);
+        _section = stagedCategory(categoryName.c_str(), consumable, row.line);
+        if (_section < 0) return;
+        DynamicCategory& section = _categories[_section];
+        if (section.consumables.empty() && section.equipment.empty()) {
+            // Ticked equipment moves to the Trailer tab with its first 'y' under Trailer
+            section.subcategory = consumable ? SUBCATEGORY_TRAILER : ticked ? SUBCATEGORY_OPTIONAL : SUBCATEGORY_ESSENTIALS;
+        }
+        return;
+    }
+    if (!*name) return;     // Spare rows of tick boxes
+    if (_section < 0) {
+        error(row.line, "Item before any category heading");
+        return;
+    }
+
+    bool ticks[4];
+    for (int i = 0; i < 4; i++) {
+        if (!parseTick(row.field(i + 1), ticks[i])) {
+            error(row.line, "Expected TRUE or FALSE, found \"" + String(row.field(i + 1)) + "\"");
+            return;
+        }
+    }
+
+    DynamicCategory& section = _categories[_section];
+    if (section.isConsumable) {
+        static const ItemStatus columns[4] = {STATUS_FULL, STATUS_OK, STATUS_LOW, STATUS_OUT};
+        ConsumableItem item;
+        item.name = name;
+        for (int i = 3; i >= 0; i--) {
+            if (ticks[i]) item.status = columns[i];     // The first ticked column wins
+        }
+        item.livesInTrailer = true;     // It is the trailer's stock list
+        item.lastUpdated = wallClock.now();
+        section.consumables.push_back(item);
+    } else {
+        EquipmentItem item;
+        item.name = name;
+        item.checked = ticks[0];
+        item.packed = ticks[2];
+        item.livesInTrailer = strcasecmp(row.field(5), "y") == 0;
+        item.lastUpdated = wallClock.now();
+        if (item.livesInTrailer && section.subcategory == SUBCATEGORY_OPTIONAL) section.subcategory = SUBCATEGORY_TRAILER;
+        section.equipment.push_back(item);
+    }
+    _imported++;
+}
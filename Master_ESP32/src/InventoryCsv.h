@@ -0,0 +1,77 @@
+#pragma once
+#include <Arduino.h>
+#include <vector>
+#include "CsvReader.h"
+#include "DynamicInventory.h"
+
+/**
+ * Streaming import of the inventory CSV (the format written by
+ * /inventory/export-csv: Category Type, Category, Item Name, Status, Lives
+ * in Trailer, Checked, Packed, Taking, Last Updated).
+ *
+ * The printable stock list ("Check List/Camping Stock List.csv") imports
+ * too. It has no column header; each category starts with a heading row
+ * and its items follow:
+ *   Kitchen:;Full;OK;Low;Repl        consumables, the TRUE column is the
+ *                                    status (none ticked: OK)
+ *   Lighting;Checked;;Packed;;Trailer;Optional
+ *                                    equipment, TRUE marks checked/packed,
+ *                                    'y' under Trailer keeps it in the trailer
+ *   Essentials list:                 equipment on the Essentials tab, names only
+ * Equipment categories go on the Trailer tab if any item is marked 'y' under
+ * Trailer, else on the Optional tab. Rows without a name are skipped.
+ *
+ * The upload is fed in chunks as it arrives. Rows are parsed straight into
+ * a separate category list, so the live inventory is untouched until
+ * finish() reports success and the caller swaps the result in. Any bad row
+ * fails the whole import; the first MAX_ERRORS problems are kept with their
+ * line numbers so they can be shown to the user.
+ *
+ * Staged items have no IDs yet; call assignItemIds() after the swap.
+ */
+
+struct CsvImportError {
+    uint32_t line;
+    String message;
+};
+
+class InventoryCsvImport {
+public:
+    static const size_t MAX_ERRORS = 20;
+
+    // Start a new import, dropping any previous result
+    void begin();
+    void write(const char* data, size_t len);
+
+    // End of input. True if at least one item was read and no row failed.
+    bool finish();
+
+    // Discard the staged result (e.g. the upload was aborted)
+    void reset();
+
+    bool active() const { return _active; }
+    size_t imported() const { return _imported; }
+    size_t errorCount() const { return _errorCount; }
+    const std::vector<CsvImportError>& errors() const { return _errors; }
+
+    // The staged inventory; swap it into `inventory` after a successful finish()
+    std::vector<DynamicCategory>& categories() { return _categories; }
+
+private:
+    void record(const CsvRecord& row);
+    void recordChecklist(const CsvRecord& row);
+    int stagedCategory(const char* name, bool consumable, uint32_t line);
+    void error(uint32_t line, const String& message);
+
+    CsvReader _reader;
+    std::vector<DynamicCategory> _categories;
+    std::vector<CsvImportError> _errors;
+    size_t _errorCount = 0;
+    size_t _imported = 0;
+    enum Layout : uint8_t { LAYOUT_UNKNOWN, LAYOUT_EXPORT, LAYOUT_CHECKLIST };
+    Layout _layout = LAYOUT_UNKNOWN;    // Decided by the first row
+    int _section = -1;                  // Checklist: category the rows belong to
+    bool _active = false;
+};
+
+extern InventoryCsvImport csvImport;
@@ -0,0 +1,155 @@
+#include "InventoryIndex.h"
+#include "DynamicInventory.h"
+
+uint16_t nextItemId = 1;
+InventoryIndex inventoryIndex;
+
+// ID of the item at a position, or INVENTORY_NO_ID if the position is stale
+static uint16_t idAt(int cat, int item) {
+    if (cat < 0 || cat >= (int)inventory.size() || item < 0) return INVENTORY_NO_ID;
+    const DynamicCategory& category = inventory[cat];
+    if (category.isConsumable) {
+        return item < (int)category.consumables.size() ? category.consumables[item].id : INVENTORY_NO_ID;
+    }
+    return item < (int)category.equipment.size() ? category.equipment[item].id : INVENTORY_NO_ID;
+}
+
+static void renumberItems() {
+    uint16_t id = 1;
+    for (DynamicCategory& category : inventory) {
+        for (ConsumableItem& item : category.consumables) item.id = id++;
+        for (EquipmentItem& item : category.equipment) item.id = id++;
+    }
+    nextItemId = id;
+    inventoryIndex.invalidate();
+    Serial.printf("[INVENTORY] Item IDs exhausted, renumbered %u items\n", id - 1);
+}
+
+uint16_t newItemId() {
+    if (nextItemId == INVENTORY_NO_ID) renumberItems();
+    return nextItemId++;
+}
+
+void assignItemIds() {
+    uint16_t maxId = 0;
+    for (const DynamicCategory& category : inventory) {
+        for (const ConsumableItem& item : category.consumables) if (item.id > maxId) maxId = item.id;
+        for (const EquipmentItem& item : category.equipment) if (item.id > maxId) maxId = item.id;
+    }
+    if (maxId >= nextItemId) nextItemId = maxId + 1;     // Wraps to 0 -> renumber on next newItemId()
+
+    for (DynamicCategory& category : inventory) {
+        for (ConsumableItem& item : category.consumables) {
+            if (item.id == INVENTORY_NO_ID) item.id = newItemId();
+        }
+        for (EquipmentItem& item : category.equipment) {
+            if (item.id == INVENTORY_NO_ID) item.id = newItemId();
+        }
+    }
+    inventoryIndex.invalidate();
+}
+
+static size_t inventoryItemCount() {
+    size_t items = 0;
+    for (const DynamicCategory& category : inventory) {
+        items += category.consumables.size() + category.equipment.size();
+    }
+    return items;
+}
+
+bool InventoryIndex::find(uint16_t id, int& cat, int& item) {
+    if (id == INVENTORY_NO_ID) return false;
+    if (!_valid) rebuild();
+    if (probe(id, cat, item)) {
+        if (idAt(cat, item) == id) return true;
+    } else if (inventoryItemCount() == _items) {
+        return false;   // Unknown or deleted ID
+    }
+
+    // An edit moved or added an item without updating the index
+    rebuild();
+    return probe(id, cat, item) && idAt(cat, item) == id;
+}
+
+bool InventoryIndex::probe(uint16_t id, int& cat, int& item) const {
+    int slot = slotOf(id);
+    if (slot < 0) return false;
+    cat = _slots[slot].cat;
+    item = _slots[slot].item;
+    return true;
+}
+
+int InventoryIndex::slotOf(uint16_t id) const {
+    if (_slots.empty()) return -1;
+    size_t mask = _slots.size() - 1;
+    for (size_t slot = id & mask; _slots[slot].id != INVENTORY_NO_ID; slot = (slot + 1) & mask) {
+        if (_slots[slot].id == id) return slot;
+    }
+    return -1;
+}
+
+void InventoryIndex::placeCategory(int cat) {
+    if (!_valid) return;    // Rebuilt on the next lookup anyway
+    const DynamicCategory& category = inventory[cat];
+    size_t count = category.isConsumable ? category.consumables.size() : category.equipment.size();
+    size_t mask = _slots.size() - 1;
+    for (size_t i = 0; i < count; i++) {
+        uint16_t id = category.isConsumable ? category.consumables[i].id : category.equipment[i].id;
+        if (id == INVENTORY_NO_ID) continue;
+        int slot = slotOf(id);
+        if (slot < 0) {
+            if ((_items + 1) * 2 > _slots.size()) {
+                invalidate();   // Grow on the next lookup
+                return;
+            }
+            slot = id & mask;
+            while (_slots[slot].id != INVENTORY_NO_ID) slot = (slot + 1) & mask;
+            _slots[slot].id = id;
+            _items++;
+        }
+        _slots[slot].cat = (uint8_t)cat;
+        _slots[slot].item = (uint16_t)i;
+    }
+}
+
+void InventoryIndex::remove(uint16_t id) {
+    if (!_valid) return;
+    int hole = slotOf(id);
+    if (hole < 0) return;
+    _items--;
+
+    // Backward-shift deletion: pull later entries of the probe run into the
+    // hole unless that would put them before their home slot
+    size_t mask = _slots.size() - 1;
+    size_t i = hole;
+    for (size_t j = (i + 1) & mask; _slots[j].id != INVENTORY_NO_ID; j = (j + 1) & mask) {
+        size_t home = _slots[j].id & mask;
+        bool between = i <= j ? (i < home && home <= j) : (i < home || home <= j);
+        if (between) continue;
+        _slots[i] = _slots[j];
+        i = j;
+    }
+    _slots[i].id = INVENTORY_NO_ID;
+}
+
+void InventoryIndex::rebuild() {
+    size_t items = inventoryItemCount();
+    size_t capacity = 16;
+    while (capacity < items * 2) capacity *= 2;
+
+    _slots.assign(capacity, Slot{INVENTORY_NO_ID, 0, 0});
+    _items = 0;
+    size_t mask = capacity - 1;
+    auto insert = [&](uint16_t id, size_t cat, size_t item) {
+        if (id == INVENTORY_NO_ID) return;
+        size_t slot = id & mask;
+        while (_slots[slot].id != INVENTORY_NO_ID) slot = (slot + 1) & mask;
+        _slots[slot] = Slot{id, (uint16_t)item, (uint8_t)cat};
+        _items++;
+    };
+    for (size_t c = 0; c < inventory.size(); c++) {
+        for (size_t i = 0; i < inventory[c].consumables.size(); i++) insert(inventory[c].consumables[i].id, c, i);
+        for (size_t i = 0; i < inventory[c].equipment.size(); i++) insert(inventory[c].equipment[i].id, c, i);
+    }
+    _valid = true;
+}
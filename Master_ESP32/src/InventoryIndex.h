@@ -0,0 +1,67 @@
+#pragma once
+#include <Arduino.h>
+#include <vector>
+
+/**
+ * Stable item IDs and an ID -> position index for the inventory.
+ *
+ * Every item gets a 16-bit ID when it is created. IDs are persisted in the
+ * snapshot and survive sorting, moves between categories and deletes of
+ * other items, so the web UI addresses items by ID instead of by
+ * category/item position, and two phones editing at once cannot hit the
+ * wrong item.
+ *
+ * The index is an open-addressing table from ID to (category, item). Item
+ * edits keep it current through placeCategory() and remove(); changes to
+ * the category list itself (loads, imports, deleting a category) call
+ * invalidate() and the next lookup rebuilds it. find() still verifies the
+ * slot it lands on, so an edit that forgot to update the index costs one
+ * rebuild rather than a wrong item. A lookup of an unknown or deleted ID is
+ * a plain miss and never rebuilds.
+ */
+
+#define INVENTORY_NO_ID 0
+
+// Next ID to hand out; persisted in the snapshot header
+extern uint16_t nextItemId;
+
+// Allocate a fresh ID. When the 16-bit space runs out every item is renumbered.
+uint16_t newItemId();
+
+// Give every item still at INVENTORY_NO_ID an ID and move nextItemId past
+// the largest ID in use (after loading)
+void assignItemIds();
+
+class InventoryIndex {
+public:
+    // Position of the item with `id`; false if there is none
+    bool find(uint16_t id, int& cat, int& item);
+
+    // Force a rebuild on the next lookup
+    void invalidate() { _valid = false; }
+
+    // Re-index every item in category `cat` at its current position: call
+    // after items there were added, sorted or shifted by an erase
+    void placeCategory(int cat);
+
+    // Forget an item that was deleted (or moved: placeCategory() on the
+    // target is enough for that)
+    void remove(uint16_t id);
+
+private:
+    struct Slot {
+        uint16_t id;
+        uint16_t item;
+        uint8_t cat;
+    };
+
+    bool probe(uint16_t id, int& cat, int& item) const;
+    int slotOf(uint16_t id) const;
+    void rebuild();
+
+    std::vector<Slot> _slots;   // Power-of-two size, at most half full
+    size_t _items = 0;          // IDs in the table
+    bool _valid = false;
+};
+
+extern InventoryIndex inventoryIndex;
@@ -0,0 +1,110 @@
+#include "InventoryJournal.h"
+#include "DynamicInventory.h"
+#include <SPIFFS.h>
+#include <vector>
+
+InventoryJournal inventoryJournal;
+
+// 16-bit FNV-1a of the item name, to catch records that point at a different item
+static uint16_t nameHash(const char* name) {
+    uint32_t h = 2166136261UL;
+    for (; *name; name++) {
+        h ^= (uint8_t)*name;
+        h *= 16777619UL;
+    }
+    return (uint16_t)(h ^ (h >> 16));
+}
+
+// Look up the item a record refers to. Returns its name, or nullptr if the
+// ID is unknown or the item is the wrong kind for `op`.
+static const char* findItem(uint8_t op, uint16_t id, int& cat, int& item) {
+    if (!inventoryIndex.find(id, cat, item)) return nullptr;
+    DynamicCategory& category = inventory[cat];
+    if (op == JOURNAL_SET_STATUS) {
+        return category.isConsumable ? category.consumables[item].name.c_str() : nullptr;
+    }
+    return category.isConsumable ? nullptr : category.equipment[item].name.c_str();
+}
+
+bool InventoryJournal::append(InventoryJournalOp op, uint16_t id, int value) {
+    InventoryJournalChange change = {op, id, value};
+    return append(&change, 1);
+}
+
+bool InventoryJournal::append(const InventoryJournalChange* changes, size_t count) {
+    std::vector<InventoryJournalRecord> recs(count);
+    for (size_t i = 0; i < count; i++) {
+        int cat, item;
+        const char* name = findItem(changes[i].op, changes[i].id, cat, item);
+        if (!name) return false;
+        recs[i].op = changes[i].op;
+        recs[i].id = changes[i].id;
+        recs[i].value = changes[i].value;
+        recs[i].nameHash = nameHash(name);
+    }
+    if (count == 0) return true;
+
+    File file = SPIFFS.open(INVENTORY_JOURNAL_PATH, "a");
+    if (!file) {
+        Serial.println("[JOURNAL] ✗ Cannot open journal");
+        return false;
+    }
+    size_t bytes = count * sizeof(InventoryJournalRecord);
+    bool ok = file.write((const uint8_t*)recs.data(), bytes) == bytes;
+    file.close();
+    if (!ok) return false;
+
+    _records += count;
+    _lastAppend = millis();
+    return true;
+}
+
+uint16_t InventoryJournal::replay() {
+    _records = 0;
+    if (!SPIFFS.exists(INVENTORY_JOURNAL_PATH)) return 0;
+    File file = SPIFFS.open(INVENTORY_JOURNAL_PATH, "r");
+    if (!file) return 0;
+
+    uint16_t applied = 0, skipped = 0;
+    InventoryJournalRecord rec;
+    // A torn record from a crash mid-append is shorter than a record and is ignored
+    while (file.read((uint8_t*)&rec, sizeof(rec)) == sizeof(rec)) {
+        _records++;
+        int cat, item;
+        const char* name = findItem(rec.op, rec.id, cat, item);
+        if (!name || nameHash(name) != rec.nameHash) {
+            skipped++;
+            continue;
+        }
+
+        switch (rec.op) {
+            case JOURNAL_SET_STATUS:
+                inventory[cat].consumables[item].status = (ItemStatus)rec.value;
+                break;
+            case JOURNAL_SET_CHECKED:
+                inventory[cat].equipment[item].checked = rec.value != 0;
+                break;
+            case JOURNAL_SET_PACKED:
+                inventory[cat].equipment[item].packed = rec.value != 0;
+                break;
+            case JOURNAL_SET_TAKING:
+                inventory[cat].equipment[item].taking = rec.value != 0;
+                break;
+            default:
+                skipped++;
+                continue;
+        }
+        applied++;
+    }
+    file.close();
+
+    // Leave the file in place; it is compacted like any other pending journal
+    _lastAppend = millis();
+    Serial.printf("[JOURNAL] Replayed %u changes (%u skipped)\n", applied, skipped);
+    return applied;
+}
+
+void InventoryJournal::clear() {
+    if (SPIFFS.exists(INVENTORY_JOURNAL_PATH)) SPIFFS.remove(INVENTORY_JOURNAL_PATH);
+    _records = 0;
+}
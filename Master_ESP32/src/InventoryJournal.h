@@ -0,0 +1,73 @@
+#pragma once
+#include <Arduino.h>
+
+/**
+ * Write-behind journal for inventory taps.
+ *
+ * Status and checkbox changes are appended to /inventory.journal as small
+ * fixed-size records instead of rewriting /inventory.json on every tap.
+ * Once the journal has been idle for INVENTORY_COMPACT_IDLE_MS, or holds
+ * INVENTORY_COMPACT_RECORDS records, the owner writes a full snapshot and
+ * calls clear(). At boot, replay() applies whatever the last snapshot missed.
+ *
+ * Records address items by their stable ID (see InventoryIndex.h), so they
+ * stay valid across reorders. Each record also carries a hash of the item
+ * name, and replay skips records whose item no longer matches.
+ */
+
+#define INVENTORY_JOURNAL_PATH "/inventory.journal"
+#define INVENTORY_COMPACT_IDLE_MS 3000      // Snapshot after this long without taps
+#define INVENTORY_COMPACT_RECORDS 64        // ...or once this many records are pending
+
+enum InventoryJournalOp : uint8_t {
+    JOURNAL_SET_STATUS = 1,     // Consumable status
+    JOURNAL_SET_CHECKED,        // Equipment flags
+    JOURNAL_SET_PACKED,
+    JOURNAL_SET_TAKING
+};
+
+struct InventoryJournalRecord {
+    uint8_t op;
+    uint8_t reserved0;
+    uint16_t id;                // Item ID
+    int8_t value;
+    uint8_t reserved;
+    uint16_t nameHash;
+};
+static_assert(sizeof(InventoryJournalRecord) == 8, "journal records are written raw");
+
+struct InventoryJournalChange {
+    InventoryJournalOp op;
+    uint16_t id;
+    int value;
+};
+
+class InventoryJournal {
+public:
+    // Append one change; false if the record could not be written
+    bool append(InventoryJournalOp op, uint16_t id, int value);
+
+    // Append several changes with one file write; false if any could not be recorded
+    bool append(const InventoryJournalChange* changes, size_t count);
+
+    // Apply the journal to `inventory`; returns the number of records applied
+    uint16_t replay();
+
+    // Drop the journal (after a snapshot has been written)
+    void clear();
+
+    bool pending() const { return _records > 0; }
+    uint16_t records() const { return _records; }
+
+    // True when pending records should be compacted into a snapshot
+    bool compactDue() const {
+        return _records > 0 &&
+               (_records >= INVENTORY_COMPACT_RECORDS || millis() - _lastAppend >= INVENTORY_COMPACT_IDLE_MS);
+    }
+
+private:
+    uint16_t _records = 0;
+    unsigned long _lastAppend = 0;
+};
+
+extern InventoryJournal inventoryJournal;
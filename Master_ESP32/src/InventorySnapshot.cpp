@@ -0,0 +1,160 @@
+#include "InventorySnapshot.h"
+#include "DynamicInventory.h"
+#include <SPIFFS.h>
+
+static const uint8_t SNAPSHOT_MAGIC[3] = {'I', 'N', 'V'};
+
+static bool writeString(File& file, const char* s) {
+    size_t length = strlen(s);
+    uint8_t len = length > 255 ? 255 : length;
+    return file.write(&len, 1) == 1 && file.write((const uint8_t*)s, len) == len;
+}
+
+bool writeInventorySnapshot(const char* path) {
+    File file = SPIFFS.open(path, "w");
+    if (!file) return false;
+
+    // String table, in the order the records below use it
+    uint16_t strings = 0;
+    for (const DynamicCategory& category : inventory) {
+        strings += 2 + (category.isConsumable ? category.consumables.size() : category.equipment.size());
+    }
+
+    uint8_t header[4] = {SNAPSHOT_MAGIC[0], SNAPSHOT_MAGIC[1], SNAPSHOT_MAGIC[2], INVENTORY_SNAPSHOT_VERSION};
+    bool ok = file.write(header, sizeof(header)) == sizeof(header);
+    ok = ok && file.write((const uint8_t*)&nextItemId, sizeof(nextItemId)) == sizeof(nextItemId);
+    ok = ok && file.write((const uint8_t*)&strings, sizeof(strings)) == sizeof(strings);
+    for (const DynamicCategory& category : inventory) {
+        ok = ok && writeString(file, category.name) && writeString(file, category.icon);
+        if (category.isConsumable) {
+            for (const ConsumableItem& item : category.consumables) ok = ok && writeString(file, item.name);
+        } else {
+            for (const EquipmentItem& item : category.equipment) ok = ok && writeString(file, item.name);
+        }
+    }
+
+    // Packed records
+    uint16_t index = 0;
+    uint16_t categories = inventory.size();
+    ok = ok && file.write((const uint8_t*)&categories, sizeof(categories)) == sizeof(categories);
+    for (const DynamicCategory& category : inventory) {
+        InventoryCategoryRecord cat = {};
+        cat.name = index++;
+        cat.icon = index++;
+        cat.flags = category.isConsumable ? SNAPSHOT_CONSUMABLE : 0;
+        cat.subcategory = category.subcategory;
+        cat.itemCount = category.isConsumable ? category.consumables.size() : category.equipment.size();
+        ok = ok && file.write((const uint8_t*)&cat, sizeof(cat)) == sizeof(cat);
+
+        InventoryItemRecord rec = {};
+        if (category.isConsumable) {
+            for (const ConsumableItem& item : category.consumables) {
+                rec.name = index++;
+                rec.id = item.id;
+                rec.status = item.status;
+                rec.flags = item.livesInTrailer ? SNAPSHOT_TRAILER : 0;
+                rec.lastUpdated = item.lastUpdated;
+                ok = ok && file.write((const uint8_t*)&rec, sizeof(rec)) == sizeof(rec);
+            }
+        } else {
+            for (const EquipmentItem& item : category.equipment) {
+                rec.name = index++;
+                rec.id = item.id;
+                rec.flags = (item.livesInTrailer ? SNAPSHOT_TRAILER : 0) | (item.checked ? SNAPSHOT_CHECKED : 0) |
+                            (item.packed ? SNAPSHOT_PACKED : 0) | (item.taking ? SNAPSHOT_TAKING : 0);
+                rec.lastUpdated = item.lastUpdated;
+                ok = ok && file.write((const uint8_t*)&rec, sizeof(rec)) == sizeof(rec);
+            }
+        }
+    }
+    file.close();
+    return ok;
+}
+
+bool isInventorySnapshot(File& file) {
+    uint8_t magic[sizeof(SNAPSHOT_MAGIC)];
+    bool match = file.read(magic, sizeof(magic)) == sizeof(magic) && memcmp(magic, SNAPSHOT_MAGIC, sizeof(magic)) == 0;
+    file.seek(0);
+    return match;
+}
+
+bool readInventorySnapshot(File& file) {
+    clearInventory();
+
+    uint8_t header[4];
+    uint16_t count, storedNextId = 1;
+    if (file.read(header, sizeof(header)) != sizeof(header) || memcmp(header, SNAPSHOT_MAGIC, 3) != 0 ||
+        header[3] < 1 || header[3] > INVENTORY_SNAPSHOT_VERSION) {
+        Serial.println("[SNAPSHOT] ✗ Unknown header");
+        return false;
+    }
+    bool hasIds = header[3] >= 2;
+    size_t itemRecordSize = hasIds ? sizeof(InventoryItemRecord) : SNAPSHOT_V1_ITEM_RECORD;
+    if (hasIds && file.read((uint8_t*)&storedNextId, sizeof(storedNextId)) != sizeof(storedNextId)) return false;
+    if (file.read((uint8_t*)&count, sizeof(count)) != sizeof(count)) return false;
+
+    std::vector<InternedName> strings;
+    strings.reserve(count);
+    char buf[256];
+    for (uint16_t i = 0; i < count; i++) {
+        uint8_t len;
+        if (file.read(&len, 1) != 1 || file.read((uint8_t*)buf, len) != len) return false;
+        buf[len] = '\0';
+        strings.push_back(InternedName(buf));
+    }
+
+    uint16_t categories;
+    if (file.read((uint8_t*)&categories, sizeof(categories)) != sizeof(categories)) return false;
+    inventory.reserve(categories);
+
+    for (uint16_t c = 0; c < categories; c++) {
+        InventoryCategoryRecord cat;
+        if (file.read((uint8_t*)&cat, sizeof(cat)) != sizeof(cat) || cat.name >= count || cat.icon >= count) {
+            clearInventory();
+            return false;
+        }
+        inventory.emplace_back();
+        DynamicCategory& category = inventory.back();
+        category.name = strings[cat.name];
+        category.icon = strings[cat.icon];
+        category.isConsumable = cat.flags & SNAPSHOT_CONSUMABLE;
+        category.subcategory = (Subcategory)cat.subcategory;
+        if (category.isConsumable) {
+            category.consumables.reserve(cat.itemCount);
+        } else {
+            category.equipment.reserve(cat.itemCount);
+        }
+
+        for (uint16_t i = 0; i < cat.itemCount; i++) {
+            InventoryItemRecord rec = {};
+            if (file.read((uint8_t*)&rec, itemRecordSize) != itemRecordSize || rec.name >= count) {
+                clearInventory();
+                return false;
+            }
+            if (category.isConsumable) {
+                category.consumables.emplace_back();
+                ConsumableItem& item = category.consumables.back();
+                item.id = rec.id;
+                item.name = strings[rec.name];
+                item.status = (ItemStatus)rec.status;
+                item.livesInTrailer = rec.flags & SNAPSHOT_TRAILER;
+                item.lastUpdated = rec.lastUpdated;
+            } else {
+                category.equipment.emplace_back();
+                EquipmentItem& item = category.equipment.back();
+                item.id = rec.id;
+                item.name = strings[rec.name];
+                item.checked = rec.flags & SNAPSHOT_CHECKED;
+                item.packed = rec.flags & SNAPSHOT_PACKED;
+                item.taking = rec.flags & SNAPSHOT_TAKING;
+                item.livesInTrailer = rec.flags & SNAPSHOT_TRAILER;
+                item.lastUpdated = rec.lastUpdated;
+            }
+        }
+    }
+
+    // Never hand out an ID older than one a client may still hold
+    if (storedNextId > nextItemId) nextItemId = storedNextId;
+    assignItemIds();
+    return true;
+}
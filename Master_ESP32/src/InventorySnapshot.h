@@ -0,0 +1,62 @@
+#pragma once
+#include <Arduino.h>
+#include <FS.h>
+
+/**
+ * Binary inventory snapshot, loaded in one streaming pass with no JSON DOM.
+ *
+ *   header:   'I' 'N' 'V' <version>, uint16 nextItemId (v2+)
+ *   strings:  uint16 count, then per string: uint8 length + bytes
+ *   records:  uint16 category count, then per category one
+ *             InventoryCategoryRecord followed by its InventoryItemRecords
+ *
+ * Records refer to strings by index. The loader interns each string once
+ * into inventoryNames and hands out the pooled pointer.
+ * Names are capped at 255 bytes. Integers are little-endian, as on the ESP32.
+ * Version 1 had no item IDs (8-byte item records); it is still readable and
+ * its items get fresh IDs on load.
+ */
+
+#define INVENTORY_SNAPSHOT_PATH "/inventory.bin"
+#define INVENTORY_SNAPSHOT_TMP "/inventory.tmp"
+#define INVENTORY_LEGACY_PATH "/inventory.json"     // ArduinoJson format, read-only now
+#define INVENTORY_SNAPSHOT_VERSION 2
+
+struct InventoryCategoryRecord {
+    uint16_t name;          // String index
+    uint16_t icon;
+    uint8_t flags;          // SNAPSHOT_CONSUMABLE
+    uint8_t subcategory;
+    uint16_t itemCount;
+};
+
+struct InventoryItemRecord {
+    uint16_t name;
+    int8_t status;          // Consumables only
+    uint8_t flags;          // SNAPSHOT_* item bits
+    uint32_t lastUpdated;
+    uint16_t id;            // v2+
+    uint16_t reserved;
+};
+
+#define SNAPSHOT_V1_ITEM_RECORD 8   // InventoryItemRecord without id/reserved
+
+static_assert(sizeof(InventoryCategoryRecord) == 8 && sizeof(InventoryItemRecord) == 12,
+              "snapshot records are written raw");
+
+#define SNAPSHOT_CONSUMABLE 0x01    // Category flag
+
+#define SNAPSHOT_TRAILER 0x01       // Item flags
+#define SNAPSHOT_CHECKED 0x02
+#define SNAPSHOT_PACKED  0x04
+#define SNAPSHOT_TAKING  0x08
+
+// Write `inventory` to `path`; false on any write error
+bool writeInventorySnapshot(const char* path);
+
+// True if the file starts with a snapshot header (any version); rewinds the file
+bool isInventorySnapshot(File& file);
+
+// Replace `inventory` with the snapshot in `file`. On a format error or a
+// truncated file `inventory` is left empty and false is returned.
+bool readInventorySnapshot(File& file);
@@ -0,0 +1,101 @@
+#include "InventoryStats.h"
+#include <algorithm>
+
+InventoryStats inventoryStats;
+
+static void count(StockCounts& counts, ItemStatus status, int delta) {
+    switch (status) {
+        case STATUS_FULL: counts.full += delta; break;
+        case STATUS_OK: counts.ok += delta; break;
+        case STATUS_LOW: counts.low += delta; break;
+        case STATUS_OUT: counts.out += delta; break;
+    }
+}
+
+static void count(PackCounts& counts, const EquipmentItem& item, int delta) {
+    counts.total += delta;
+    if (item.checked) counts.checked += delta;
+    if (item.packed) counts.packed += delta;
+    if (item.taking) {
+        counts.taking += delta;
+        if (item.checked) counts.takingChecked += delta;
+        if (item.packed) counts.takingPacked += delta;
+    }
+}
+
+static bool needsBuying(ItemStatus status) {
+    return status == STATUS_LOW || status == STATUS_OUT;
+}
+
+void InventoryStats::apply(int cat, const ConsumableItem& item, int delta) {
+    if (!_valid) return;    // Rebuilt from scratch on the next query anyway
+    count(item.livesInTrailer ? _trailer : _trip, item.status, delta);
+
+    if (needsBuying(item.status)) {
+        if (delta > 0) {
+            _shopping.push_back(item.id);
+        } else {
+            auto it = std::find(_shopping.begin(), _shopping.end(), item.id);
+            if (it != _shopping.end()) _shopping.erase(it);
+        }
+    }
+}
+
+void InventoryStats::apply(int cat, const EquipmentItem& item, int delta) {
+    if (!_valid) return;
+    if (cat < 0 || cat >= (int)inventory.size() || inventory[cat].subcategory > SUBCATEGORY_OPTIONAL) {
+        _valid = false;
+        return;
+    }
+    count(_equipment[inventory[cat].subcategory], item, delta);
+}
+
+const StockCounts& InventoryStats::consumables(bool trailer) {
+    ensure();
+    return trailer ? _trailer : _trip;
+}
+
+StockCounts InventoryStats::consumables() {
+    ensure();
+    StockCounts total;
+    total.full = _trailer.full + _trip.full;
+    total.ok = _trailer.ok + _trip.ok;
+    total.low = _trailer.low + _trip.low;
+    total.out = _trailer.out + _trip.out;
+    return total;
+}
+
+const PackCounts& InventoryStats::equipment(Subcategory sub) {
+    ensure();
+    return _equipment[sub <= SUBCATEGORY_OPTIONAL ? sub : SUBCATEGORY_TRAILER];
+}
+
+std::vector<ShoppingEntry> InventoryStats::shopping() {
+    ensure();
+    std::vector<ShoppingEntry> entries;
+    entries.reserve(_shopping.size());
+    for (uint16_t id : _shopping) {
+        ShoppingEntry entry;
+        if (inventoryIndex.find(id, entry.cat, entry.item)) entries.push_back(entry);
+    }
+    std::sort(entries.begin(), entries.end(), [](const ShoppingEntry& a, const ShoppingEntry& b) {
+        return a.cat != b.cat ? a.cat < b.cat : a.item < b.item;
+    });
+    return entries;
+}
+
+void InventoryStats::rebuild() {
+    _trailer = StockCounts();
+    _trip = StockCounts();
+    for (PackCounts& counts : _equipment) counts = PackCounts();
+    _shopping.clear();
+    _valid = true;
+
+    for (size_t i = 0; i < inventory.size(); i++) {
+        if (inventory[i].isConsumable) {
+            for (const ConsumableItem& item : inventory[i].consumables) apply(i, item, 1);
+        } else {
+            for (const EquipmentItem& item : inventory[i].equipment) apply(i, item, 1);
+        }
+    }
+}
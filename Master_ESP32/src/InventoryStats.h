@@ -0,0 +1,76 @@
+#pragma once
+#include <Arduino.h>
+#include <vector>
+#include "DynamicInventory.h"
+
+/**
+ * Aggregate counts for the inventory pages (per subcategory tab and per
+ * trailer/trip consumable group), kept up to date instead of rescanning
+ * every item on each request.
+ *
+ * Single-item taps adjust the counters in place: call remove() with the item
+ * as it was, change it, then add() it back. Anything bigger (loads, imports,
+ * bulk resets, adds, moves, deletes) calls invalidate() in its handler; the
+ * next query rebuilds everything in one pass. clearInventory() invalidates
+ * too. Saving a snapshot does not: journal compaction rewrites the file
+ * without changing anything in memory.
+ *
+ * The shopping list is a materialised set of the IDs of all Low/Out
+ * consumables.
+ */
+
+struct StockCounts {
+    uint16_t full = 0;
+    uint16_t ok = 0;
+    uint16_t low = 0;
+    uint16_t out = 0;
+
+    uint16_t inStock() const { return full + ok; }      // What the pages show as "OK"
+};
+
+struct PackCounts {
+    uint16_t total = 0;
+    uint16_t checked = 0;
+    uint16_t packed = 0;
+    uint16_t taking = 0;
+    uint16_t takingChecked = 0;     // Checked/packed among items marked Taking
+    uint16_t takingPacked = 0;
+};
+
+// A Low/Out consumable, resolved to its current position
+struct ShoppingEntry {
+    int cat;
+    int item;
+};
+
+class InventoryStats {
+public:
+    void add(int cat, const ConsumableItem& item) { apply(cat, item, 1); }
+    void remove(int cat, const ConsumableItem& item) { apply(cat, item, -1); }
+    void add(int cat, const EquipmentItem& item) { apply(cat, item, 1); }
+    void remove(int cat, const EquipmentItem& item) { apply(cat, item, -1); }
+
+    // Recount everything on the next query
+    void invalidate() { _valid = false; }
+
+    // Consumables that live in the trailer, or those bought each trip
+    const StockCounts& consumables(bool trailer);
+    StockCounts consumables();                         // Trailer + trip
+    const PackCounts& equipment(Subcategory sub);
+
+    // Low/Out consumables in category/item order
+    std::vector<ShoppingEntry> shopping();
+
+private:
+    void apply(int cat, const ConsumableItem& item, int delta);
+    void apply(int cat, const EquipmentItem& item, int delta);
+    void ensure() { if (!_valid) rebuild(); }
+    void rebuild();
+
+    StockCounts _trailer, _trip;
+    PackCounts _equipment[3];       // Indexed by Subcategory
+    std::vector<uint16_t> _shopping;
+    bool _valid = false;
+};
+
+extern InventoryStats inventoryStats;
@@ -0,0 +1,121 @@
+#include "LinkStats.h"
+
+// Sequence numbers further behind the newest than this are a restarted
+// sender, not a late frame
+#define LINK_REBOOT_BACKSTEP LINK_WINDOW
+
+static uint8_t popcount64(uint64_t v) {
+    uint8_t n = 0;
+    for (; v; v &= v - 1) n++;
+    return n;
+}
+
+void LinkStats::restart() {
+    _window = 0;
+    _span = 0;
+    _started = false;
+    _timed = false;
+    _jitter16 = 0;
+    _offsetCount = 0;
+    _offsetNext = 0;
+    _latency8 = 0;
+}
+
+LinkArrival LinkStats::record(uint16_t seq, bool timed, uint32_t senderTime, unsigned long now) {
+    if (_started) {
+        int16_t ahead = (int16_t)(seq - _newest);
+        // A late frame's clock is behind too; only a frame that is otherwise
+        // new says the sender restarted when its clock goes back
+        bool clockBack = ahead > 0 && timed && _timed && (int32_t)(senderTime - _lastSenderTime) < 0;
+        if (ahead < -LINK_REBOOT_BACKSTEP || clockBack) {
+            _reboots++;
+            Serial.printf("[LINK] Sender restarted (seq %u -> %u%s)\n", _newest, seq, clockBack ? ", clock went back" : "");
+            restart();
+        } else if (ahead <= 0) {
+            // Older than the window can't be checked for repeats; count it late
+            uint16_t back = -ahead;
+            bool inWindow = back < _span;
+            if (inWindow && (_window & (1ULL << back))) {
+                _duplicates++;
+                return LINK_DUPLICATE;
+            }
+            if (inWindow) _window |= 1ULL << back;
+            _received++;
+            _late++;
+            return LINK_LATE;
+        } else {
+            // Slide the window; sequence numbers falling out unreceived are lost
+            if (ahead >= LINK_WINDOW) {
+                uint64_t covered = _span >= LINK_WINDOW ? ~0ULL : ((1ULL << _span) - 1);
+                _lost += _span - popcount64(_window & covered) + (ahead - LINK_WINDOW);
+                _window = 0;
+                _span = LINK_WINDOW;
+            } else {
+                for (int16_t i = 0; i < ahead; i++) {
+                    if (_span == LINK_WINDOW && !(_window & (1ULL << (LINK_WINDOW - 1)))) _lost++;
+                    _window <<= 1;
+                    if (_span < LINK_WINDOW) _span++;
+                }
+            }
+            _window |= 1;
+            _newest = seq;
+            _received++;
+            if (timed) sampleTime(senderTime, now);
+            return LINK_NEW;
+        }
+    }
+
+    _started = true;
+    _newest = seq;
+    _window = 1;
+    _span = 1;
+    _received++;
+    if (timed) sampleTime(senderTime, now);
+    return LINK_NEW;
+}
+
+void LinkStats::sampleTime(uint32_t senderTime, unsigned long now) {
+    if (_timed) {
+        // RFC 3550: J += (|D| - J) / 16, D = arrival gap - send gap
+        int32_t d = (int32_t)((uint32_t)(now - _lastArrival) - (senderTime - _lastSenderTime));
+        uint32_t absD = d < 0 ? -d : d;
+        _jitter16 += absD - ((_jitter16 + 8) >> 4);
+    }
+    _timed = true;
+    _lastSenderTime = senderTime;
+    _lastArrival = now;
+
+    uint32_t offset = (uint32_t)now - senderTime;
+    _offsets[_offsetNext] = offset;
+    _offsetNext = (_offsetNext + 1) % LINK_OFFSET_SAMPLES;
+    if (_offsetCount < LINK_OFFSET_SAMPLES) _offsetCount++;
+
+    uint32_t best = offset;
+    for (uint8_t i = 0; i < _offsetCount; i++) {
+        if ((int32_t)(_offsets[i] - best) < 0) best = _offsets[i];
+    }
+    uint32_t latency = offset - best;
+    _latency8 += latency - ((_latency8 + 4) >> 3);
+}
+
+void LinkStats::summary(LinkSummary& out) const {
+    out.received = _received;
+    out.lost = _lost;
+    out.duplicates = _duplicates;
+    out.late = _late;
+    out.reboots = _reboots;
+    out.windowSize = _span;
+    uint64_t covered = _span >= LINK_WINDOW ? ~0ULL : ((1ULL << _span) - 1);
+    out.windowLost = _span - popcount64(_window & covered);
+    out.jitterMs = _jitter16 >> 4;
+    out.latencyMs = _latency8 >> 3;
+    out.timed = _offsetCount > 0;
+
+    uint32_t best = 0, worst = 0;
+    for (uint8_t i = 0; i < _offsetCount; i++) {
+        if (i == 0 || (int32_t)(_offsets[i] - best) < 0) best = _offsets[i];
+        if (i == 0 || (int32_t)(_offsets[i] - worst) > 0) worst = _offsets[i];
+    }
+    out.clockOffsetMs = (int32_t)best;
+    out.latencyMaxMs = worst - best;
+}
@@ -0,0 +1,89 @@
+#pragma once
+#include <Arduino.h>
+
+/**
+ * Link quality of one ESP-NOW sender, from its frame sequence numbers and
+ * the senderTime (sender millis()) its telemetry carries.
+ *
+ * - Loss: a bitmap of the last LINK_WINDOW sequence numbers. The window
+ *   loss rate is the share of them that never arrived; `lost` counts every
+ *   sequence number that left the window unreceived.
+ * - Duplicates (already in the window) and late frames (older than the
+ *   newest, arriving out of order) are counted and reported back so the
+ *   caller can drop them instead of rolling state backwards.
+ * - Reboot: the sequence number jumping back further than the window, or
+ *   a frame ahead of the newest whose senderTime went backwards, means the
+ *   sender restarted. The window, clock offset and jitter start over instead
+ *   of counting ~65000 losses. A frame inside the window is late or a
+ *   duplicate whatever its clock says.
+ * - Jitter: RFC 3550 interarrival jitter, the smoothed variation of
+ *   (arrival gap - send gap), in ms.
+ * - Latency: the clocks aren't synchronised, so the offset
+ *   (arrival - senderTime) is only known up to the true one-way delay. The
+ *   smallest offset over the last LINK_OFFSET_SAMPLES frames is taken as
+ *   "no delay" (it also follows crystal drift), and latency is how far each
+ *   frame's offset sits above it: queueing and retries, not airtime.
+ *
+ * Owned by the WiFi task; summary() fills a plain copy for other tasks.
+ */
+
+#define LINK_WINDOW 64
+#define LINK_OFFSET_SAMPLES 32
+
+enum LinkArrival : uint8_t {
+    LINK_NEW,           // Newest frame so far
+    LINK_LATE,          // Older than the newest, first copy
+    LINK_DUPLICATE      // Seen before
+};
+
+struct LinkSummary {
+    uint32_t received;
+    uint32_t lost;              // Sequence numbers that never arrived
+    uint32_t duplicates;
+    uint32_t late;
+    uint16_t reboots;
+    uint16_t windowSize;        // Sequence numbers the loss rate covers
+    uint16_t windowLost;
+    uint32_t jitterMs;
+    uint32_t latencyMs;         // Smoothed, above the best-case offset
+    uint32_t latencyMaxMs;      // Worst over the offset window
+    int32_t clockOffsetMs;      // Receiver millis() - sender millis() at best-case delay
+    bool timed;                 // Has senderTime samples
+};
+
+class LinkStats {
+public:
+    // Record a frame. `timed` is false when the frame carries no senderTime.
+    LinkArrival record(uint16_t seq, bool timed, uint32_t senderTime, unsigned long now);
+
+    void summary(LinkSummary& out) const;
+
+    // Percentage of the window lost, in tenths (0..1000)
+    static uint16_t lossPermille(const LinkSummary& s) {
+        return s.windowSize ? (uint32_t)s.windowLost * 1000 / s.windowSize : 0;
+    }
+
+private:
+    void restart();
+    void sampleTime(uint32_t senderTime, unsigned long now);
+
+    uint64_t _window = 0;           // Bit i: sequence (_newest - i) arrived
+    uint16_t _newest = 0;
+    uint16_t _span = 0;             // Valid bits in _window
+    bool _started = false;
+
+    uint32_t _received = 0;
+    uint32_t _lost = 0;
+    uint32_t _duplicates = 0;
+    uint32_t _late = 0;
+    uint16_t _reboots = 0;
+
+    bool _timed = false;
+    uint32_t _lastSenderTime = 0;
+    unsigned long _lastArrival = 0;
+    uint32_t _jitter16 = 0;         // Jitter in ms * 16 (RFC 3550 fixed point)
+    uint32_t _offsets[LINK_OFFSET_SAMPLES] = {};
+    uint8_t _offsetCount = 0;
+    uint8_t _offsetNext = 0;
+    uint32_t _latency8 = 0;         // Smoothed latency in ms * 8
+};
@@ -0,0 +1,206 @@
+#include "PeerRegistry.h"
+
+PeerRegistry peerRegistry;
+
+const char* peerSourceName(uint8_t source) {
+    switch (source) {
+        case SRC_MASTER: return "master";
+        case SRC_VICTRON: return "victron";
+        case SRC_ECOFLOW: return "ecoflow";
+        case SRC_FRIDGE: return "fridge";
+        default: return "unknown";
+    }
+}
+
+const char* peerSectionName(uint8_t tag) {
+    switch (tag) {
+        case TAG_READY: return "ready";
+        case TAG_BMV: return "bmv";
+        case TAG_MPPT: return "mppt";
+        case TAG_IP22: return "ip22";
+        case TAG_ECOFLOW: return "ecoflow";
+        case TAG_FRIDGE: return "fridge";
+        default: return "unknown";
+    }
+}
+
+bool PeerRegistry::stale(const PeerInfo& info, unsigned long now) {
+    unsigned long limit = PEER_STALE_DEFAULT_MS;
+    if (info.received >= 2) {
+        limit = PEER_STALE_INTERVALS * info.intervalMs;
+        if (limit < PEER_STALE_MIN_MS) limit = PEER_STALE_MIN_MS;
+    }
+    return now - info.lastSeen > limit;
+}
+
+int PeerRegistry::observe(const uint8_t* mac, uint8_t source, bool framed, int8_t rssi, unsigned long now) {
+    int slot = -1, free = -1, oldest = -1;
+    for (int i = 0; i < PEER_MAX; i++) {
+        const Peer& p = _peers[i];
+        if (!p.used) {
+            if (free < 0) free = i;
+        } else if (memcmp(p.info.mac, mac, 6) == 0) {
+            slot = i;
+            break;
+        } else if (stale(p.info, now) && (oldest < 0 || (long)(p.info.lastSeen - _peers[oldest].info.lastSeen) < 0)) {
+            oldest = i;
+        }
+    }
+
+    if (slot < 0) {
+        slot = free >= 0 ? free : oldest;
+        if (slot < 0) {
+            _rejected++;
+            return -1;
+        }
+        if (_peers[slot].used) evict(slot);
+
+        Peer& p = _peers[slot];
+        p.decoder = DeltaDecoder();
+        p.link = LinkStats();
+        memset(&p.state, 0, sizeof(p.state));
+        p.seqValid = false;
+        portENTER_CRITICAL(&_mux);
+        memset(&p.info, 0, sizeof(p.info));
+        memcpy(p.info.mac, mac, 6);
+        p.info.firstSeen = now;
+        p.used = true;
+        portEXIT_CRITICAL(&_mux);
+        Serial.printf("[PEER] New %s peer %02X:%02X:%02X:%02X:%02X:%02X (%s)\n",
+                     peerSourceName(source), mac[0], mac[1], mac[2], mac[3], mac[4], mac[5],
+                     framed ? "framed" : "legacy");
+    }
+
+    portENTER_CRITICAL(&_mux);
+    PeerInfo& info = _peers[slot].info;
+    if (info.received > 0) {
+        unsigned long gap = now - info.lastSeen;
+        info.intervalMs = info.intervalMs ? (info.intervalMs * 7 + gap) / 8 : gap;
+    }
+    info.source = source;
+    info.framed = framed;
+    info.rssi = rssi;
+    info.lastSeen = now;
+    info.received++;
+    bool pinned = source == SRC_VICTRON && pinRelay(slot, now);
+    portEXIT_CRITICAL(&_mux);
+    if (pinned) {
+        Serial.printf("[PEER] Commands go to relay %02X:%02X:%02X:%02X:%02X:%02X\n",
+                     mac[0], mac[1], mac[2], mac[3], mac[4], mac[5]);
+    }
+    return slot;
+}
+
+// Make `peer` (a relay just heard from) the command target if there is none
+// yet, the current one has gone quiet, or it is framed and the current one
+// isn't. True if the target changed. Called under the spinlock.
+bool PeerRegistry::pinRelay(int peer, unsigned long now) {
+    if (_relay == peer) return false;
+    if (_relay >= 0) {
+        const PeerInfo& current = _peers[_relay].info;
+        bool replace = current.source != SRC_VICTRON || stale(current, now) ||
+                       (_peers[peer].info.framed && !current.framed);
+        if (!replace) return false;
+    }
+    _relay = peer;
+    return true;
+}
+
+LinkArrival PeerRegistry::arrive(int peer, uint16_t seq, bool timed, uint32_t senderTime, unsigned long now) {
+    Peer& p = _peers[peer];
+    uint16_t reboots = p.info.link.reboots;
+    LinkArrival arrival = p.link.record(seq, timed, senderTime, now);
+    LinkSummary link;
+    p.link.summary(link);
+    if (link.reboots != reboots) {
+        // Its first frame is a keyframe; don't wait for deltas against the old one
+        p.decoder.reset();
+        p.seqValid = false;
+    }
+
+    portENTER_CRITICAL(&_mux);
+    if (arrival == LINK_NEW) {
+        p.info.packetId += p.seqValid ? (uint16_t)(seq - p.info.lastSeq) : 1;
+        p.info.lastSeq = seq;
+    }
+    p.info.link = link;
+    portEXIT_CRITICAL(&_mux);
+    if (arrival == LINK_NEW) p.seqValid = true;
+    return arrival;
+}
+
+bool PeerRegistry::claimSection(int section, int peer, bool valid, unsigned long now) {
+    int owner = _owner[section];
+    bool take = owner == peer || owner < 0 || stale(_peers[owner].info, now) ||
+                (valid && !_ownerValid[section]);
+    if (take) {
+        portENTER_CRITICAL(&_mux);
+        _owner[section] = peer;
+        portEXIT_CRITICAL(&_mux);
+        _ownerValid[section] = valid;
+    }
+    return take;
+}
+
+uint32_t PeerRegistry::freshSections(unsigned long now, unsigned long* newest) {
+    uint32_t fresh = 0;
+    unsigned long latest = 0;
+    bool owned = false;
+    portENTER_CRITICAL(&_mux);
+    for (size_t s = 0; s < ESPNOW_FIELD_SECTIONS; s++) {
+        int owner = _owner[s];
+        if (owner < 0) continue;
+        const PeerInfo& info = _peers[owner].info;
+        if (!owned || (long)(info.lastSeen - latest) > 0) latest = info.lastSeen;
+        owned = true;
+        if (!stale(info, now)) fresh |= 1u << s;
+    }
+    portEXIT_CRITICAL(&_mux);
+    if (newest) *newest = latest;
+    return fresh;
+}
+
+bool PeerRegistry::sectionSeen(int section, unsigned long& lastSeen) {
+    portENTER_CRITICAL(&_mux);
+    int owner = _owner[section];
+    if (owner >= 0) lastSeen = _peers[owner].info.lastSeen;
+    portEXIT_CRITICAL(&_mux);
+    return owner >= 0;
+}
+
+bool PeerRegistry::snapshot(int peer, PeerInfo& out) {
+    portENTER_CRITICAL(&_mux);
+    bool used = _peers[peer].used;
+    if (used) out = _peers[peer].info;
+    portEXIT_CRITICAL(&_mux);
+    return used;
+}
+
+bool PeerRegistry::commandTarget(uint8_t device, PeerInfo& out, unsigned long now) {
+    int best = -1;
+    portENTER_CRITICAL(&_mux);
+    for (int i = 0; i < PEER_MAX && device == 1; i++) {
+        const PeerInfo& info = _peers[i].info;
+        if (_peers[i].used && info.source == SRC_FRIDGE && !stale(info, now)) {
+            best = i;
+            break;
+        }
+    }
+    if (best < 0 && _relay >= 0 && _peers[_relay].info.source == SRC_VICTRON) best = _relay;
+    if (best >= 0) out = _peers[best].info;
+    portEXIT_CRITICAL(&_mux);
+    return best >= 0;
+}
+
+void PeerRegistry::evict(int peer) {
+    const uint8_t* mac = _peers[peer].info.mac;
+    Serial.printf("[PEER] Dropping stale %s peer %02X:%02X:%02X:%02X:%02X:%02X\n",
+                 peerSourceName(_peers[peer].info.source), mac[0], mac[1], mac[2], mac[3], mac[4], mac[5]);
+    portENTER_CRITICAL(&_mux);
+    for (size_t s = 0; s < ESPNOW_FIELD_SECTIONS; s++) {
+        if (_owner[s] == peer) _owner[s] = -1;
+    }
+    if (_relay == peer) _relay = -1;
+    _peers[peer].used = false;
+    portEXIT_CRITICAL(&_mux);
+}
@@ -0,0 +1,120 @@
+#pragma once
+#include <Arduino.h>
+#include "EspNowProtocol.h"
+#include "VictronData.h"
+#include "LinkStats.h"
+
+/**
+ * Every ESP-NOW sender the Master has heard from, keyed by MAC address.
+ *
+ * Senders are discovered from their first packet; nothing is configured.
+ * Each peer keeps its own DeltaDecoder and VictronPacket (the state its
+ * frames describe), its sequence position, the RSSI of its last packet and
+ * when it was last heard. A peer is stale once it has been quiet for three
+ * of its usual send intervals, so a relay sending every second and an
+ * EcoFlow bridge sending every 30 s are both judged fairly.
+ *
+ * Several peers may report the same section (the relay forwards EcoFlow
+ * data that the EcoFlow bridge also sends directly). claimSection() decides
+ * whose copy goes into the combined view: a section stays with the peer
+ * that last reported it valid until that peer goes stale, so an "invalid"
+ * section from one sender never blanks good data from another. A section is
+ * only as fresh as its owner: once the owner is stale, freshSections() leaves
+ * it out and the combined view's copy should be shown as offline.
+ *
+ * Commands for the fridge go to one pinned relay: the first SRC_VICTRON peer
+ * heard, kept until it goes stale or is dropped. A framed relay takes the
+ * pin from a legacy one (frames are checked, a packet of the right size is
+ * not), but a packet from a new MAC never moves the pin off a live relay,
+ * so a stray sender can't capture command traffic.
+ *
+ * observe(), arrive(), claimSection() and the decoder()/state() accessors
+ * belong to the WiFi task. snapshot(), commandTarget(), freshSections() and
+ * sectionSeen() may be called from any task; they read under the registry's
+ * spinlock.
+ */
+
+#define PEER_MAX 6
+#define PEER_STALE_INTERVALS 3      // Missed send intervals before a peer is stale
+#define PEER_STALE_MIN_MS 5000
+#define PEER_STALE_DEFAULT_MS 60000 // Until a peer's send interval is known
+
+struct PeerInfo {
+    uint8_t mac[6];
+    uint8_t source;             // EspNowSource
+    bool framed;                // Sends EspNowProtocol frames, so it is sent framed commands
+    int8_t rssi;                // Of the last packet
+    uint16_t lastSeq;
+    uint32_t packetId;          // lastSeq widened to 32 bits, kept rising across sender reboots
+    uint32_t received;          // Every packet, telemetry or not
+    LinkSummary link;           // Telemetry loss, jitter and latency (LinkStats.h)
+    unsigned long intervalMs;   // Smoothed time between packets
+    unsigned long firstSeen;
+    unsigned long lastSeen;
+};
+
+class PeerRegistry {
+public:
+    PeerRegistry() { memset(_owner, -1, sizeof(_owner)); }
+
+    // Record a packet from `mac` and return its peer slot, adding the peer
+    // if it is new. -1 if the table is full of peers that are still live.
+    int observe(const uint8_t* mac, uint8_t source, bool framed, int8_t rssi, unsigned long now);
+
+    // Record a telemetry frame in the peer's LinkStats. For a new frame,
+    // also widen its sequence number into packetId. Anything but LINK_NEW
+    // should not be applied: it is a repeat or older than the peer's state.
+    LinkArrival arrive(int peer, uint16_t seq, bool timed, uint32_t senderTime, unsigned long now);
+
+    // Should `peer`'s copy of a section go into the combined view?
+    // `section` is an ESPNOW_SECTIONS index.
+    bool claimSection(int section, int peer, bool valid, unsigned long now);
+
+    DeltaDecoder& decoder(int peer) { return _peers[peer].decoder; }
+    VictronPacket& state(int peer) { return _peers[peer].state; }
+
+    size_t size() const { return PEER_MAX; }
+    bool snapshot(int peer, PeerInfo& out);
+    int sectionOwner(int section) const { return _owner[section]; }
+
+    // Sections (bits of ESPNOW_SECTIONS indices) whose owner is live. If
+    // `newest` is given it gets when any owner, live or not, was last heard
+    // (0 if no section has an owner).
+    uint32_t freshSections(unsigned long now, unsigned long* newest = nullptr);
+
+    // When the owner of `section` was last heard; false if it has none
+    bool sectionSeen(int section, unsigned long& lastSeen);
+
+    // Peer to send a command for `device` to: the device itself if it
+    // reports directly and is live, otherwise the pinned Victron relay
+    bool commandTarget(uint8_t device, PeerInfo& out, unsigned long now);
+
+    uint32_t rejected() const { return _rejected; }
+
+    static bool stale(const PeerInfo& info, unsigned long now);
+
+private:
+    struct Peer {
+        PeerInfo info;
+        DeltaDecoder decoder;
+        VictronPacket state;
+        LinkStats link;
+        bool seqValid;
+        bool used;
+    };
+
+    void evict(int peer);
+    bool pinRelay(int peer, unsigned long now);
+
+    Peer _peers[PEER_MAX] = {};
+    int8_t _owner[ESPNOW_FIELD_SECTIONS];          // Peer whose copy is in the combined view, -1 for none
+    bool _ownerValid[ESPNOW_FIELD_SECTIONS] = {};
+    int8_t _relay = -1;                             // Command target for the fridge, -1 until a relay is heard
+    uint32_t _rejected = 0;
+    portMUX_TYPE _mux = portMUX_INITIALIZER_UNLOCKED;
+};
+
+const char* peerSourceName(uint8_t source);
+const char* peerSectionName(uint8_t tag);     // Field section tag, for JSON
+
+extern PeerRegistry peerRegistry;
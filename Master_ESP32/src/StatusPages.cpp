@@ -0,0 +1,284 @@
+#include "StatusPages.h"
+#include "StaticAssets.h"
+
+void renderRootPage(Print& html, const RootPageView& view) {
+    html += "<!DOCTYPE html><html><head><meta charset='UTF-8'><meta name='viewport' content='width=device-width,initial-scale=1,viewport-fit=cover'>";
+    // PWA and iOS web app support
+    html += "<meta name='apple-mobile-web-app-capable' content='yes'>";
+    html += "<meta name='apple-mobile-web-app-status-bar-style' content='black-translucent'>";
+    html += "<meta name='apple-mobile-web-app-title' content='Trailer'>";
+    html += "<meta name='mobile-web-app-capable' content='yes'>";
+    html += "<link rel='manifest' href='/manifest.json'>";
+    html += "<link rel='apple-touch-icon' href='/icon-192.png'>";
+    html += "<title>Trailer Dashboard</title>";
+
+    // Styles and scripts are served gzipped from /static (see web/)
+    html += "<link rel='stylesheet' href='" ASSET_URL_DASHBOARD_CSS "'>";
+    
+    // Determine system status and show appropriate alert
+    uint32_t freeHeap = view.freeHeap;
+    bool batteryHealthy = true;
+    
+    // Check battery health
+    if (view.dataRecent && view.data.bmv.valid) {
+        float soc = view.data.bmv.soc;
+        int ttg = view.data.bmv.timeToGo;
+        batteryHealthy = !(soc <= 20 || (ttg > 0 && ttg <= 60));
+    }
+    
+    // Generate alert message and type - Only show alerts for problems or first navigation
+    String alertType = "";
+    String alertMessage = "";
+    
+    if (!view.dataRecent) {
+        alertType = "critical";
+        alertMessage = "⚠ Data Connection Lost - Click for Details";
+    }
+    else if (freeHeap < 20000) {
+        alertType = "critical";
+        alertMessage = "⚠ Critical: Low Memory (" + String(freeHeap/1024) + "KB) - Click for Details";
+    }
+    else if (freeHeap < 40000) {
+        alertType = "warning";
+        alertMessage = "⚠ Warning: Memory Low (" + String(freeHeap/1024) + "KB) - Click for Details";
+    }
+    else if (freeHeap < 60000) {
+        alertType = "caution";
+        alertMessage = "⚡ Caution: Monitor Memory (" + String(freeHeap/1024) + "KB) - Click for Details";
+    }
+    else if (!batteryHealthy) {
+        if (view.dataRecent && view.data.bmv.valid) {
+            float soc = view.data.bmv.soc;
+            if (soc <= 10) {
+                alertType = "critical";
+                alertMessage = "🔋 Critical: Battery " + String(soc,0) + "% - Immediate Attention Required";
+            }
+            else if (soc <= 20) {
+                alertType = "warning";
+                alertMessage = "🔋 Warning: Battery " + String(soc,0) + "% - Low Power";
+            }
+        }
+    }
+    else {
+        // Only show "All Systems Normal" on first navigation
+        alertType = "normal";
+        alertMessage = "✓ All Systems Normal";
+    }
+    
+    // Alert is shown by dashboard.js on first navigation
+    html += "<script>var alertType='" + alertType + "',alertMessage='" + alertMessage + "';</script>";
+    html += "<script src='" ASSET_URL_DASHBOARD_JS "'></script>";
+    if (!view.clockSynced) html += CLOCK_SYNC_SCRIPT;
+    html += "</head><body>";
+
+    // Card shells - dashboard.js fills them from /api/live every 2s
+    html += "<div class='c offline' id='bmv'><h2><span class='icon'>\U0001F50B</span>KARSTEN MAXI SHUNT<span class='badge'>BMV-712</span></h2>";
+    html += "<div class='body'><div class='v'>--</div><div style='font-size:0.9em;color:#888'>Offline</div></div></div>";
+
+    html += "<div class='c offline' id='mppt'><h2><span class='icon'>\u2600\uFE0F</span>KARSTEN MAXI SOLAR<span class='badge'>MPPT 100/20</span><span class='state'></span></h2>";
+    html += "<div class='body'><div class='v'>--</div><div style='font-size:0.9em;color:#888'>Offline</div></div></div>";
+
+    html += "<div class='c offline' id='ip22'><h2><span class='icon'>\U0001F50C</span>KARSTEN MAXI AC<span class='badge'>IP22 12|20</span><span class='state'></span></h2>";
+    html += "<div class='body'><div class='v'>--</div><div style='font-size:0.9em;color:#888'>Offline</div></div></div>";
+
+    html += "<div class='c offline' id='ecoflow'><h2><span class='icon'>\u26A1</span>EcoFlow<span class='badge'>DELTA Max 2</span></h2>";
+    html += "<div class='body'><div class='v'>--</div><div style='font-size:0.9em;color:#888'>Offline</div></div></div>";
+
+    html += "<div class='c offline' id='fridge' onclick=\"window.location.href='/fridge'\" style='cursor:pointer;transition:transform 0.2s'>";
+    html += "<h2><span class='icon'>\u2744\uFE0F</span>Fridge<span class='badge'>Flex Adventure 95L K.I.D</span> <span style='margin-left:auto;font-size:1.2em'>→</span></h2>";
+    html += "<div class='body'><div class='v'>--</div><div style='font-size:0.9em;color:#888'>Offline</div></div></div>";
+
+    // Navigation buttons
+    html += "<div style='margin-top:15px;display:flex;gap:6px'>";
+    html += "<div onclick=\"window.location.href='/fridge'\" style='flex:1;padding:10px;background:linear-gradient(135deg,#667eea,#764ba2);border-radius:8px;text-align:center;color:#fff;font-weight:600;cursor:pointer;font-size:0.9em'>\U0001F9CA Fridge</div>";
+    html += "<div onclick=\"window.location.href='/monitor'\" style='flex:1;padding:10px;background:linear-gradient(135deg,#4facfe,#00f2fe);border-radius:8px;text-align:center;color:#fff;font-weight:600;cursor:pointer;font-size:0.9em'>\U0001F4CA Monitor</div>";
+    html += "<div onclick=\"window.location.href='/inventory'\" style='flex:1;padding:10px;background:linear-gradient(135deg,#667eea,#764ba2);border-radius:8px;text-align:center;color:#fff;font-weight:600;cursor:pointer;font-size:0.9em'>\U0001F69A Inventory</div>";
+    html += "</div>";
+
+    // Footer
+    html += "<div id='footer' style='margin-top:10px;padding:6px;background:#111;border-radius:4px;font-size:0.7em;color:#666;text-align:center'>";
+    html += "Pkts: " + String(view.packetsReceived) + " | --";
+    html += "</div>";
+
+    html += "</body></html>";
+}
+
+void renderMonitorPage(Print& html, const MonitorPageView& view) {
+    const CommandTracker& commandTracker = *view.commands;
+    const CommandQueue& commandQueue = *view.queue;
+    PeerRegistry& peerRegistry = *view.peers;
+    uint32_t freeHeap = view.freeHeap;
+    uint32_t heapSize = view.heapSize;
+    unsigned long uptime = view.now / 1000;
+    
+    // Calculate memory usage percentage
+    float heapUsage = ((float)(heapSize - freeHeap) / heapSize) * 100;
+    
+    // Determine alert level and status
+    String alertLevel = "Normal";
+    String alertColor = "#4ade80";
+    String statusIndicator = "●";
+    if (freeHeap < 20000) { 
+        alertLevel = "Critical"; 
+        alertColor = "#ef4444"; 
+    }
+    else if (freeHeap < 40000) { 
+        alertLevel = "Warning"; 
+        alertColor = "#f97316"; 
+    }
+    else if (freeHeap < 60000) { 
+        alertLevel = "Caution"; 
+        alertColor = "#eab308"; 
+    }
+
+    html += "<!DOCTYPE html><html><head>";
+    html += "<meta charset='UTF-8'>";
+    html += "<meta name='viewport' content='width=device-width,initial-scale=1,viewport-fit=cover'>";
+    html += "<title>System Monitor - Trailer Dashboard</title>";
+    
+    // Use the same styling as main dashboard
+    html += "<link rel='stylesheet' href='" ASSET_URL_MONITOR_CSS "'>";
+    html += "<meta http-equiv='refresh' content='5'>";
+    html += "</head><body>";
+    
+    // Memory Status Card (same style as main dashboard cards)
+    String cardClass = "c";
+    if (freeHeap < 20000) cardClass += " critical";
+    else if (freeHeap < 60000) cardClass += " warn";
+    else cardClass += " online";
+    
+    html += "<div class='" + cardClass + "'>";
+    html += "<h2><span class='icon'>\U0001F4CA</span>SYSTEM MONITOR<span style='background:#444;padding:2px 6px;border-radius:6px;font-size:0.68em;color:#aaa;margin-left:5px'>ESP32</span></h2>";
+    
+    html += "<div class='content'>";
+    
+    // Main memory value (same style as dashboard)
+    String valueClass = "v";
+    if (freeHeap < 20000) valueClass += " critical";
+    else if (freeHeap < 60000) valueClass += " warn";
+    html += "<div class='" + valueClass + "'>" + String(freeHeap / 1024) + " KB</div>";
+    
+    // Grid with system metrics
+    html += "<div class='grid'>";
+    html += "<div class='item'><div class='label'>Memory Used</div><div class='value'>" + String(heapUsage, 1) + "%</div></div>";
+    
+    int hours = uptime / 3600;
+    int minutes = (uptime % 3600) / 60;
+    html += "<div class='item'><div class='label'>Uptime</div><div class='value'>" + String(hours) + "h " + String(minutes) + "m</div></div>";
+    
+    bool dataRecent = view.dataRecent;
+    html += "<div class='item'><div class='label'>Data Status</div><div class='value' style='color:" + String(dataRecent ? "#4f4" : "#f22") + "'>";
+    html += String(dataRecent ? "Active" : "Stale") + "</div></div>";
+    
+    html += "<div class='item'><div class='label'>ESP32 Packets</div><div class='value'>" + String(view.packetsReceived) + "</div></div>";
+    html += "<div class='item'><div class='label'>Ring Overruns</div><div class='value'>" + String(view.ringOverruns) + "</div></div>";
+    html += "<div class='item'><div class='label'>Ring Delay Avg / Max</div><div class='value'>" + String(view.ringDelayAvgMs) + " / " + String(view.ringDelayMaxMs) + " ms</div></div>";
+    PeerInfo relay;
+    String linkProtocol = !peerRegistry.commandTarget(1, relay, view.now) ? String("--")
+                        : relay.framed ? "Framed v" + String(ESPNOW_PROTOCOL_VERSION) : String("Legacy");
+    html += "<div class='item'><div class='label'>Link Protocol</div><div class='value'>" + linkProtocol + "</div></div>";
+    html += "<div class='item'><div class='label'>Frames / Rejected</div><div class='value'>" + String(view.framesReceived) + " / " + String(view.framesRejected) + "</div></div>";
+    html += "<div class='item'><div class='label'>Avg Frame / Full Packet</div><div class='value'>" + String(view.framesReceived ? view.frameBytes / view.framesReceived : 0) + " / " + String((unsigned)sizeof(VictronPacket)) + " B</div></div>";
+    html += "<div class='item'><div class='label'>Deltas w/o Keyframe</div><div class='value'>" + String(view.deltaFramesDropped) + "</div></div>";
+    html += "</div></div></div>";
+    
+    // System Details Card
+    html += "<div class='c'>";
+    html += "<h2><span class='icon'>\u2699\uFE0F</span>SYSTEM INFO</h2>";
+    html += "<div class='content'>";
+    html += "<div class='v' style='background:linear-gradient(135deg,#4facfe,#00f2fe);color:#000'>" + String(view.cpuFreq) + " MHz</div>";
+    
+    html += "<div class='grid'>";
+    html += "<div class='item'><div class='label'>Chip Rev</div><div class='value'>v" + String(view.chipRev) + "</div></div>";
+    html += "<div class='item'><div class='label'>Max Alloc</div><div class='value'>" + String(view.maxAllocHeap / 1024) + " KB</div></div>";
+    html += "<div class='item'><div class='label'>Alert Level</div><div class='value' style='color:" + alertColor + "'>" + alertLevel + "</div></div>";
+    html += "<div class='item'><div class='label'>Free Flash</div><div class='value'>" + String(view.freeSketchSpace / 1024) + " KB</div></div>";
+    html += "<div class='item'><div class='label'>Inventory Names</div><div class='value'>" + String(view.inventoryNameCount) + " / " + String(view.inventoryNameBytes / 1024.0, 1) + " KB</div></div>";
+    html += "</div></div></div>";
+
+    // Command Delivery Card: send-to-ACK latency and retry outcomes
+    uint32_t lost = commandTracker.failed() + commandTracker.timedOut();
+    html += "<div class='c" + String(lost ? " warn" : "") + "'>";
+    html += "<h2><span class='icon'>\U0001F4E1</span>COMMANDS</h2>";
+    html += "<div class='content'>";
+    html += "<div class='v'>" + String(commandTracker.latencyPercentile(50)) + " ms</div>";
+    html += "<div class='grid'>";
+    html += "<div class='item'><div class='label'>ACK p50 / p95</div><div class='value'>" + String(commandTracker.latencyPercentile(50)) + " / " + String(commandTracker.latencyPercentile(95)) + " ms</div></div>";
+    html += "<div class='item'><div class='label'>Acked</div><div class='value'>" + String(commandTracker.acked()) + "</div></div>";
+    html += "<div class='item'><div class='label'>Failed / Timed Out</div><div class='value'>" + String(commandTracker.failed()) + " / " + String(commandTracker.timedOut()) + "</div></div>";
+    html += "<div class='item'><div class='label'>Retransmits</div><div class='value'>" + String(commandTracker.retransmits()) + "</div></div>";
+    html += "<div class='item'><div class='label'>In Flight / Queued</div><div class='value'>" + String(commandTracker.inFlight()) + " / " + String(commandQueue.depth()) + "</div></div>";
+    html += "<div class='item'><div class='label'>Queue Wait Avg / Max</div><div class='value'>" + String(commandQueue.waitAvgMs()) + " / " + String(commandQueue.waitMaxMs()) + " ms</div></div>";
+    html += "<div class='item'><div class='label'>Coalesced / Dropped</div><div class='value'>" + String(commandQueue.coalesced()) + " / " + String(commandQueue.dropped()) + "</div></div>";
+    html += "<div class='item'><div class='label'>Peak Queue Depth</div><div class='value'>" + String(commandQueue.maxDepth()) + " / " + String(COMMAND_QUEUE_SIZE) + "</div></div>";
+    html += "<div class='item'><div class='label'>Duplicate ACKs</div><div class='value'>" + String(commandTracker.duplicateAcks()) + "</div></div>";
+    html += "<div class='item'><div class='label'>Superseded</div><div class='value'>" + String(commandTracker.superseded()) + "</div></div>";
+    html += "</div></div>";
+    // Latency histogram, bars scaled to the fullest bucket
+    uint32_t peak = 0;
+    for (size_t i = 0; i < COMMAND_LATENCY_BUCKETS; i++) peak = max(peak, commandTracker.bucketCount(i));
+    if (peak > 0) {
+        html += "<div class='hist'>";
+        for (size_t i = 0; i < COMMAND_LATENCY_BUCKETS; i++) {
+            uint32_t n = commandTracker.bucketCount(i);
+            String limit = i < COMMAND_LATENCY_BUCKETS - 1 ? "\u2264" + String(CommandTracker::bucketLimit(i)) + "ms" : ">" + String(CommandTracker::bucketLimit(i - 1)) + "ms";
+            html += "<div class='hrow'><span class='hlbl'>" + limit + "</span>";
+            html += "<div class='hbar' style='width:" + String(n * 70 / peak) + "%'></div><span>" + String(n) + "</span></div>";
+        }
+        html += "</div>";
+    }
+    html += "</div>";
+
+    // ESP-NOW Peers Card: every sender heard from, live or stale
+    html += "<div class='c'>";
+    html += "<h2><span class='icon'>\U0001F4F6</span>PEERS</h2>";
+    html += "<div class='content'><div class='grid'>";
+    unsigned long now = view.now;
+    for (size_t i = 0; i < peerRegistry.size(); i++) {
+        PeerInfo peer;
+        if (!peerRegistry.snapshot(i, peer)) continue;
+        bool live = !PeerRegistry::stale(peer, now);
+        char label[32];
+        snprintf(label, sizeof(label), "%s %02X:%02X:%02X", peerSourceName(peer.source), peer.mac[3], peer.mac[4], peer.mac[5]);
+        html += "<div class='item'><div class='label'>" + String(label) + "</div><div class='value' style='color:" + String(live ? "#4f4" : "#f22") + "'>";
+        html += String(peer.rssi) + " dBm | " + String((now - peer.lastSeen) / 1000) + "s ago | " + String(peer.received) + " pkts</div></div>";
+
+        // Link quality: loss over the last LINK_WINDOW frames, then timing
+        const LinkSummary& link = peer.link;
+        uint16_t loss = LinkStats::lossPermille(link);
+        html += "<div class='item'><div class='label'>Loss / Jitter / Latency</div><div class='value' style='color:" + String(loss > 100 ? "#f22" : loss > 20 ? "#fa0" : "#4f4") + "'>";
+        html += String(loss / 10.0, 1) + "% | ";
+        html += link.timed ? String(link.jitterMs) + " | " + String(link.latencyMs) + " ms" : String("-- | --");
+        if (link.reboots || link.duplicates || link.late) {
+            html += "<br>" + String(link.reboots) + " reboots, " + String(link.duplicates) + " dup, " + String(link.late) + " late";
+        }
+        html += "</div></div>";
+    }
+    if (peerRegistry.rejected()) {
+        html += "<div class='item'><div class='label'>Table Full Drops</div><div class='value'>" + String(peerRegistry.rejected()) + "</div></div>";
+    }
+    html += "</div></div></div>";
+    
+    // Navigation buttons - change to Dashboard, Fridge, Inventory
+    html += "<div class='nav-buttons'>";
+    html += "<div class='nav-btn fridge' onclick=\"window.location.href='/'\">\U0001F3E0 Dashboard</div>";
+    html += "<div class='nav-btn fridge' onclick=\"window.location.href='/fridge'\">\U0001F9CA Fridge</div>";
+    html += "<div class='nav-btn inventory' onclick=\"window.location.href='/inventory'\">\U0001F69A Inventory</div>";
+    html += "</div>";
+
+    // Footer (same as main dashboard)
+    html += "<div style='margin-top:10px;padding:6px;background:#111;border-radius:4px;font-size:0.7em;color:#666;text-align:center'>";
+    unsigned long secondsAgo = (view.now - view.lastUpdate) / 1000;
+    html += "Memory: " + String(freeHeap / 1024) + "KB free | ";
+    if (secondsAgo < 60) {
+        html += "Updated " + String(secondsAgo) + "s ago";
+    } else {
+        html += "Updated " + String(secondsAgo / 60) + "m ago";
+    }
+    html += "</div>";
+    
+    // Refresh button (smaller, in corner)
+    html += "<button class='refresh-btn' onclick='location.reload()'>↻</button>";
+    
+    html += "</body></html>";
+}
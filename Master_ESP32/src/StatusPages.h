@@ -0,0 +1,71 @@
+#pragma once
+#include <Arduino.h>
+#include "VictronData.h"
+#include "CommandQueue.h"
+#include "CommandTracker.h"
+#include "PeerRegistry.h"
+
+/**
+ * The dashboard (/) and system monitor (/monitor) pages, rendered into any
+ * Print. The handlers stream them through ChunkedResponse; host tests render
+ * them into a String as well and compare the bytes.
+ *
+ * The views carry everything a page shows, read once by the handler, so
+ * rendering needs no globals and no ESP APIs.
+ */
+
+// Pages post the browser's clock once after each boot (see WallClock.h)
+#define CLOCK_SYNC_SCRIPT "<script>fetch('/api/time?epoch='+Math.floor(Date.now()/1000),{method:'POST'}).catch(function(){});</script>"
+
+// Page builders use the same `+=` on a Print as on a String
+inline Print& operator+=(Print& out, const char* s) {
+    out.write((const uint8_t*)s, strlen(s));
+    return out;
+}
+inline Print& operator+=(Print& out, const String& s) {
+    out.write((const uint8_t*)s.c_str(), s.length());
+    return out;
+}
+inline Print& operator+=(Print& out, char c) {
+    out.write((uint8_t)c);
+    return out;
+}
+
+struct RootPageView {
+    bool dataRecent = false;            // Some peer that owns a section is live
+    uint32_t freeHeap = 0;
+    VictronPacket data = {};            // Latest combined readings
+    bool clockSynced = false;           // Else the page posts the browser's clock
+    uint32_t packetsReceived = 0;
+};
+
+struct MonitorPageView {
+    unsigned long now = 0;              // millis()
+    uint32_t freeHeap = 0;
+    uint32_t heapSize = 1;
+    uint32_t maxAllocHeap = 0;
+    uint32_t freeSketchSpace = 0;
+    uint32_t chipRev = 0;
+    uint32_t cpuFreq = 0;
+
+    bool dataRecent = false;            // Some peer that owns a section is live
+    unsigned long lastUpdate = 0;       // When a section's owner was last heard
+    uint32_t packetsReceived = 0;
+    uint32_t ringOverruns = 0;
+    unsigned long ringDelayAvgMs = 0;
+    unsigned long ringDelayMaxMs = 0;
+    uint32_t framesReceived = 0;
+    uint32_t frameBytes = 0;
+    uint32_t framesRejected = 0;
+    uint32_t deltaFramesDropped = 0;
+
+    size_t inventoryNameCount = 0;
+    size_t inventoryNameBytes = 0;
+
+    const CommandTracker* commands = nullptr;
+    const CommandQueue* queue = nullptr;
+    PeerRegistry* peers = nullptr;
+};
+
+void renderRootPage(Print& html, const RootPageView& view);
+void renderMonitorPage(Print& html, const MonitorPageView& view);
@@ -0,0 +1,111 @@
+#include "StringPool.h"
+#include <stdlib.h>
+#include <string.h>
+#include <utility>
+
+// FNV-1a
+static uint32_t hashString(const char* s, size_t len) {
+    uint32_t h = 2166136261UL;
+    for (size_t i = 0; i < len; i++) {
+        h ^= (uint8_t)s[i];
+        h *= 16777619UL;
+    }
+    return h;
+}
+
+const char* StringPool::intern(const char* s) {
+    return intern(s, strlen(s));
+}
+
+const char* StringPool::intern(const char* s, size_t len) {
+    if (_count + 1 > _capacity * 3 / 4) grow();
+    if (_count + 1 >= _capacity) return "";    // Out of memory for the index
+
+    size_t mask = _capacity - 1;
+    size_t slot = hashString(s, len) & mask;
+    while (_index[slot]) {
+        const char* existing = _index[slot];
+        if (strncmp(existing, s, len) == 0 && existing[len] == '\0') return existing;
+        slot = (slot + 1) & mask;
+    }
+
+    char* copy = allocate(len + 1);
+    if (!copy) return "";
+    memcpy(copy, s, len);
+    copy[len] = '\0';
+    _index[slot] = copy;
+    _count++;
+    _used += len + 1;
+    return copy;
+}
+
+char* StringPool::allocate(size_t len) {
+    if (len > BLOCK_SIZE / 4) {
+        // Big strings get their own block rather than wasting the tail of a shared one
+        char* block = (char*)malloc(len);
+        if (!block) return nullptr;
+        _blocks.push_back(block);
+        _oversized += len;
+        return block;
+    }
+    if (len > _blockFree) {
+        char* block = (char*)malloc(BLOCK_SIZE);
+        if (!block) return nullptr;
+        _blocks.push_back(block);
+        _sharedBlocks++;
+        _blockNext = block;
+        _blockFree = BLOCK_SIZE;
+    }
+    char* p = _blockNext;
+    _blockNext += len;
+    _blockFree -= len;
+    return p;
+}
+
+void StringPool::grow() {
+    size_t capacity = _capacity ? _capacity * 2 : 64;
+    const char** index = (const char**)calloc(capacity, sizeof(const char*));
+    if (!index) return;     // Keep probing the old table; it still has free slots
+
+    for (size_t i = 0; i < _capacity; i++) {
+        const char* s = _index[i];
+        if (!s) continue;
+        size_t slot = hashString(s, strlen(s)) & (capacity - 1);
+        while (index[slot]) slot = (slot + 1) & (capacity - 1);
+        index[slot] = s;
+    }
+    free(_index);
+    _index = index;
+    _capacity = capacity;
+}
+
+void StringPool::clear() {
+    for (char* block : _blocks) free(block);
+    _blocks.clear();
+    _blocks.shrink_to_fit();
+    free(_index);
+    _index = nullptr;
+    _capacity = 0;
+    _count = 0;
+    _used = 0;
+    _oversized = 0;
+    _sharedBlocks = 0;
+    _blockFree = 0;
+    _blockNext = nullptr;
+}
+
+void StringPool::swap(StringPool& other) {
+    std::swap(_blocks, other._blocks);
+    std::swap(_blockFree, other._blockFree);
+    std::swap(_blockNext, other._blockNext);
+    std::swap(_index, other._index);
+    std::swap(_capacity, other._capacity);
+    std::swap(_count, other._count);
+    std::swap(_used, other._used);
+    std::swap(_oversized, other._oversized);
+    std::swap(_sharedBlocks, other._sharedBlocks);
+}
+
+size_t StringPool::bytesReserved() const {
+    return _sharedBlocks * BLOCK_SIZE + _oversized + _capacity * sizeof(const char*);
+}
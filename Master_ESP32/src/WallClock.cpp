@@ -0,0 +1,51 @@
+#include "WallClock.h"
+#include <Preferences.h>
+
+WallClock wallClock;
+
+void WallClock::begin() {
+    Preferences prefs;
+    prefs.begin("clock", true);
+    uint32_t saved = prefs.getULong("epoch", 0);
+    prefs.end();
+
+    // Resume exactly at the last save; the browser sync fills in the time off
+    if (saved > WALLCLOCK_MAX_EPOCH) saved = 0;
+    _base = saved - uptimeSeconds();
+    _lastSaved = now();
+    Serial.printf("[CLOCK] Resumed at %lu (%s)\n", (unsigned long)now(), valid() ? "restored" : "not set yet");
+}
+
+void WallClock::setFloor(uint32_t floor) {
+    _floor = floor;
+    uint32_t current = now();
+    if (current < floor) _base += floor - current;
+}
+
+bool WallClock::set(uint32_t epoch) {
+    if (epoch < WALLCLOCK_MIN_EPOCH || epoch > WALLCLOCK_MAX_EPOCH) return false;
+    uint32_t current = now();
+    if (!_synced) {
+        uint32_t target = epoch > _floor ? epoch : _floor;
+        _base += target - current;      // May step back; unsigned wrap does the subtraction
+        Serial.printf("[CLOCK] Set from browser, %+lds\n", (long)(int32_t)(target - current));
+    } else if (epoch > current) {
+        _base += epoch - current;
+        Serial.printf("[CLOCK] Set from browser, +%lus\n", (unsigned long)(epoch - current));
+    }
+    _synced = true;
+    save();
+    return true;
+}
+
+void WallClock::service() {
+    if (now() - _lastSaved >= WALLCLOCK_SAVE_INTERVAL_S) save();
+}
+
+void WallClock::save() {
+    Preferences prefs;
+    prefs.begin("clock", false);
+    prefs.putULong("epoch", now());
+    prefs.end();
+    _lastSaved = now();
+}
@@ -0,0 +1,57 @@
+#pragma once
+#include <Arduino.h>
+
+/**
+ * Monotonic wall clock in Unix seconds that survives reboots.
+ *
+ * The device has no RTC or NTP. The clock is set from the browser (the
+ * pages post Date.now() on the first load after each boot), saved to NVS
+ * every WALLCLOCK_SAVE_INTERVAL_S seconds, and resumed from the saved value
+ * at boot. Time spent powered off is lost until the next browser sync.
+ *
+ * The first browser time after boot is taken as is, so it can step the
+ * clock back (e.g. to undo a bad earlier sync), but never behind the floor
+ * given to setFloor(), the newest stored history row. Later syncs in the
+ * same boot only move the clock forward.
+ */
+
+#define WALLCLOCK_SAVE_INTERVAL_S 600
+#define WALLCLOCK_MIN_EPOCH 1700000000UL    // Browser times before Nov 2023 are rejected
+#define WALLCLOCK_MAX_EPOCH 4102444800UL    // ...and so are times after 2099
+
+class WallClock {
+public:
+    // Resume from NVS (needs no filesystem)
+    void begin();
+
+    // Earliest acceptable time (the newest stored history row); moves the
+    // clock up to it if behind, and bounds the first browser sync
+    void setFloor(uint32_t floor);
+
+    uint32_t now() const { return _base + uptimeSeconds(); }
+
+    // Browser-provided time: authoritative the first time after boot (down
+    // to the floor), forward-only after that. False if the value is implausible.
+    bool set(uint32_t epoch);
+
+    // Time has come from a browser since boot
+    bool synced() const { return _synced; }
+
+    // Real calendar time (set from a browser at some point), possibly behind
+    // by however long the device was off
+    bool valid() const { return now() >= WALLCLOCK_MIN_EPOCH; }
+
+    // Persist the clock when the save interval has passed (call from the main loop)
+    void service();
+
+private:
+    static uint32_t uptimeSeconds() { return (uint32_t)(esp_timer_get_time() / 1000000); }
+    void save();
+
+    uint32_t _base = 0;
+    uint32_t _lastSaved = 0;
+    uint32_t _floor = 0;
+    bool _synced = false;
+};
+
+extern WallClock wallClock;
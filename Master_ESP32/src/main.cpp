@@ -6,12 +6,75 @@
 #include <SPIFFS.h>
 #include <ArduinoJson.h>
 #include <algorithm>
+#include <lwip/sockets.h>
 #include "VictronData.h"
+#include "VictronFrames.h"
 #include "DynamicInventory.h"
+#include "InventoryJournal.h"
+#include "InventorySnapshot.h"
+#include "InventoryStats.h"
+#include "InventoryCsv.h"
+#include "BackupStore.h"
+#include "WallClock.h"
+#include "CommandQueue.h"
+#include "CommandTracker.h"
+#include "PeerRegistry.h"
+#include "StatusPages.h"
+#include "ChunkedResponse.h"
+#include "JsonWriter.h"
+#include "StaticAssets.h"
+#include "SpscRing.h"
+#include "SeqLock.h"
+#include "HistoryStore.h"
+#include "TelemetryCodecBench.h"
 
 // ============ GLOBAL INVENTORY ============
+StringPool inventoryNames;      // Declared before inventory so it outlives it
 std::vector<DynamicCategory> inventory;
 
+void clearInventory() {
+    inventory.clear();
+    inventory.shrink_to_fit();
+    inventoryNames.clear();
+    inventoryIndex.invalidate();
+    inventoryStats.invalidate();
+}
+
+template <typename F>
+static void forEachInventoryName(F f) {
+    for (DynamicCategory& category : inventory) {
+        f(category.name);
+        f(category.icon);
+        for (ConsumableItem& item : category.consumables) f(item.name);
+        for (EquipmentItem& item : category.equipment) f(item.name);
+    }
+}
+
+void compactInventoryNames(bool force) {
+    size_t live = 0;    // Upper bound: a shared name is counted once per use
+    forEachInventoryName([&](InternedName& name) { live += name.length() + 1; });
+    size_t before = inventoryNames.bytesUsed();
+    if (!force && before <= 2 * live + StringPool::BLOCK_SIZE) return;
+
+    // Copy everything first, so running out of memory part-way leaves the
+    // inventory pointing at the old pool
+    StringPool fresh;
+    bool complete = true;
+    forEachInventoryName([&](InternedName& name) {
+        if (*name.c_str() && !*fresh.intern(name.c_str())) complete = false;
+    });
+    if (!complete) {
+        Serial.println("[INVENTORY] Name pool compaction skipped: out of memory");
+        return;
+    }
+    forEachInventoryName([&](InternedName& name) { name.rebind(fresh); });
+    size_t reservedBefore = inventoryNames.bytesReserved();
+    inventoryNames.swap(fresh);     // The old blocks go with `fresh`
+    Serial.printf("[INVENTORY] Name pool compacted: %u -> %u bytes used, %u -> %u reserved\n",
+                  (unsigned)before, (unsigned)inventoryNames.bytesUsed(),
+                  (unsigned)reservedBefore, (unsigned)inventoryNames.bytesReserved());
+}
+
 // ============ SMART DEFAULTS FOR TRAILER STATUS ============
 bool shouldLiveInTrailer(const String& itemName, const String& categoryName) {
     String item = itemName;
@@ -64,11 +127,13 @@ void handleInventoryDeleteItem();
 void handleCategoryRename();
 void handleCategoryDelete();
 void handleMonitor();
+void httpTask(void* param);
 String createStyledConfirmationPage(String title, String icon, String message, String buttonText, String buttonUrl, String buttonColor = "primary");
 
 // ============ CONFIGURATION ============
-// Victron ESP32 MAC address (use STA MAC from Victron serial output)
-uint8_t victronMAC[] = {0x78, 0x21, 0x84, 0x9C, 0x9B, 0x88};
+// ESP-NOW senders (Victron relay, EcoFlow bridge, ...) need no configuring
+// here: they are discovered from their first packet, see PeerRegistry.h
+#define ESPNOW_CHANNEL 1            // Default AP channel
 
 // WiFi AP credentials
 const char* AP_SSID = "PowerMonitor";
@@ -78,33 +143,68 @@ const char* AP_PASSWORD = "12345678";
 WebServer server(80);
 
 // ============ DATA STORAGE ============
+// Packets go onDataReceive (WiFi task) -> packetRing -> drainPacketRing() (httpTask).
+// latestData and the counters below are only written by httpTask between
+// requests, so handlers can read them directly. Each section of latestData is
+// only as fresh as the peer that owns it (sectionFresh()).
+struct ReceivedPacket {
+    VictronPacket packet;
+    unsigned long receivedAt;   // millis() at reception
+    bool sequenced;             // From the relay: packetId is its sequence, and it is recorded in history
+};
+#define PACKET_RING_SIZE 8
+SpscRing<ReceivedPacket, PACKET_RING_SIZE> packetRing;
+SeqLock<ReceivedPacket> latestPacket;   // Consistent latest snapshot, safe from any task
+
 VictronPacket latestData;
-unsigned long lastReceived = 0;
-uint32_t packetsReceived = 0;
-uint32_t packetsMissed = 0;
+uint32_t packetsReceived = 0;           // From every peer
+// Time packets wait in packetRing: the Master being busy, as opposed to
+// the radio losing them (per-peer LinkStats)
+unsigned long ringDelayTotalMs = 0;
+unsigned long ringDelayMaxMs = 0;
+uint32_t ringDelayCount = 0;
+bool liveDataDirty = false;             // Set by drainPacketRing(), consumed by serviceSseClients()
+
+// Each peer's frames rebuild that peer's own state (peerRegistry); the
+// sections it owns are copied into assembledPacket, the combined view
+// handed on to httpTask. Only the WiFi task touches these.
+VictronPacket assembledPacket;
+uint32_t framesReceived = 0;
+uint32_t frameBytes = 0;                // For the average frame size on /monitor
+uint32_t framesRejected = 0;            // Framed but wrong version, truncated or bad CRC
+uint32_t deltaFramesDropped = 0;        // Delta frames whose keyframe never arrived
+
+// ============ HISTORY ============
+HistoryStore history;                   // 10s / 1min / 15min tiers, see HistoryStore.h
 
 // ============ STATUS TRACKING ============
 bool victronReady = false;  // True when Victron is ready to receive commands
 unsigned long lastStatusUpdate = 0;
 
 // ============ COMMAND QUEUE ============
-#define MASTER_QUEUE_SIZE 10
-struct QueuedCommand {
-    uint8_t device;
-    uint8_t command;
-    int16_t value1;
-    int16_t value2;
-};
-QueuedCommand masterQueue[MASTER_QUEUE_SIZE];
-uint8_t masterQueueHead = 0;
-uint8_t masterQueueTail = 0;
-uint8_t masterQueueCount = 0;
-uint32_t nextCommandId = 1;
+// Pending commands live in commandQueue (CommandQueue.h), sent ones in
+// commandTracker (CommandTracker.h) until they are ACKed
+uint32_t nextCommandId = 1;          // Randomised at boot so the relay never mistakes a new command for a repeat
 unsigned long lastSendAttempt = 0;
 
+// ACKs go onDataReceive (WiFi task) -> ackRing -> commandTracker (commandTask)
+#define ACK_RING_SIZE 8
+SpscRing<CommandAck, ACK_RING_SIZE> ackRing;
+
+// ============ TASKS ============
+// HTTP and command dispatch run in their own tasks so a slow handler
+// (SPIFFS writes, big pages) can't hold up commands to the fridge
+#define COMMAND_SEND_INTERVAL_MS 100    // Min gap between ESP-NOW commands
+#define COMMAND_TASK_PRIORITY 5         // Above HTTP so a queued command always gets the CPU
+#define HTTP_TASK_PRIORITY 2
+#define HTTP_TASK_STACK 16384           // Inventory/backup handlers build large JSON documents
+TaskHandle_t commandTaskHandle = NULL;
+TaskHandle_t httpTaskHandle = NULL;
+
 // ============ FUNCTION DECLARATIONS ============
 bool saveInventoryToSPIFFS();
 void loadInventoryFromSPIFFS();
+void journalInventoryChange(InventoryJournalOp op, uint16_t id, int value);
 void initializeDefaultInventory();
 void sortCategoryItems(DynamicCategory& category);
 void sortAllInventory();
@@ -116,518 +216,393 @@ void onDataSent(const uint8_t *mac_addr, esp_now_send_status_t status) {
     Serial.printf("[ESP-NOW] Send status: %s\n", status == ESP_NOW_SEND_SUCCESS ? "✓ Success" : "✗ Failed");
 }
 
-// Receive callback for VictronPacket data
-void onDataReceive(const esp_now_recv_info *recv_info, const uint8_t *data, int len) {
-    if (len == sizeof(VictronPacket)) {
-        VictronPacket* packet = (VictronPacket*)data;
-
-        // Check for missed packets
-        if (packetsReceived > 0) {
-            uint32_t expected = latestData.packetId + 1;
-            if (packet->packetId != expected) {
-                packetsMissed += (packet->packetId - expected);
-                Serial.printf("[ESP-NOW] ⚠️  Missed %d packets\n", packet->packetId - expected);
-            }
-        }
+// Hand a packet to httpTask - never touch latestData from the WiFi task
+void pushReceivedPacket(const VictronPacket& packet, bool sequenced) {
+    ReceivedPacket rx;
+    rx.packet = packet;
+    rx.receivedAt = millis();
+    rx.sequenced = sequenced;
+    if (!packetRing.push(rx)) {
+        Serial.println("[ESP-NOW] ⚠️  Packet ring full, dropped packet");
+    }
+}
 
-        // Store data
-        memcpy(&latestData, data, sizeof(VictronPacket));
-        lastReceived = millis();
-        packetsReceived++;
+void setVictronReady(bool ready) {
+    victronReady = ready;
+    lastStatusUpdate = millis();
+    if (victronReady && commandTaskHandle) xTaskNotifyGive(commandTaskHandle);
+    Serial.printf("[STATUS] Victron is now: %s\n",
+                 victronReady ? "READY ✓" : "SCANNING");
+}
 
-        Serial.printf("[ESP-NOW] ✓ Packet #%d\n", latestData.packetId);
-    } else if (len == sizeof(StatusMessage)) {
-        StatusMessage* status = (StatusMessage*)data;
-        victronReady = (status->type == STATUS_READY);
-        lastStatusUpdate = millis();
-        Serial.printf("[STATUS] Victron is now: %s\n",
-                     victronReady ? "READY ✓" : "SCANNING");
-    } else if (len == sizeof(CommandAck)) {
-        CommandAck* ack = (CommandAck*)data;
-        Serial.printf("[ACK] Command #%d | RX:%s | EXEC:%s | Err:%d\n",
-                     ack->commandId,
-                     ack->received ? "✓" : "✗",
-                     ack->executed ? "✓" : "✗",
-                     ack->errorCode);
-    } else {
-        Serial.printf("[ESP-NOW] ✗ Unknown packet size: %d bytes\n", len);
+void receiveAck(const CommandAck& ack) {
+    Serial.printf("[ACK] Command #%d | RX:%s | EXEC:%s | Err:%d\n",
+                 ack.commandId,
+                 ack.received ? "✓" : "✗",
+                 ack.executed ? "✓" : "✗",
+                 ack.errorCode);
+    if (!ackRing.push(ack)) {
+        Serial.println("[ACK] ⚠️  ACK ring full, dropped ACK");
     }
+    if (commandTaskHandle) xTaskNotifyGive(commandTaskHandle);
 }
 
-// Queue a command for sending
-bool queueCommand(uint8_t device, uint8_t command, int16_t value1, int16_t value2) {
-    if (masterQueueCount >= MASTER_QUEUE_SIZE) {
-        Serial.println("[QUEUE] ✗ Queue full! Cannot add command");
-        return false;
+// Mark the sections of `p` that aren't in `fresh` (bits of ESPNOW_SECTIONS
+// indices) invalid. True if any of them was valid.
+bool expireSections(VictronPacket& p, uint32_t fresh) {
+    bool expired = false;
+    for (size_t s = 0; s < ESPNOW_FIELD_SECTIONS; s++) {
+        if (fresh & (1u << s)) continue;
+        bool* valid = nullptr;
+        switch (ESPNOW_SECTIONS[s].tag) {
+            case TAG_BMV: valid = &p.bmv.valid; break;
+            case TAG_MPPT: valid = &p.mppt.valid; break;
+            case TAG_IP22: valid = &p.ip22.valid; break;
+            case TAG_ECOFLOW: valid = &p.ecoflow.valid; break;
+            case TAG_FRIDGE: valid = &p.fridge.valid; break;
+        }
+        if (valid && *valid) {
+            *valid = false;
+            expired = true;
+        }
     }
+    return expired;
+}
 
-    masterQueue[masterQueueTail].device = device;
-    masterQueue[masterQueueTail].command = command;
-    masterQueue[masterQueueTail].value1 = value1;
-    masterQueue[masterQueueTail].value2 = value2;
+// Is latestData's copy of section `tag` from a peer that is still live?
+bool sectionFresh(uint8_t tag, unsigned long now) {
+    int s = espnowSectionIndex(tag);
+    return s >= 0 && (peerRegistry.freshSections(now) & (1u << s));
+}
 
-    masterQueueTail = (masterQueueTail + 1) % MASTER_QUEUE_SIZE;
-    masterQueueCount++;
+// Copy the sections in `mask` (bits of ESPNOW_SECTIONS indices) from a
+// peer's own state into the combined view, where the peer owns them
+void mergePeerSections(int peer, uint32_t mask) {
+    const VictronPacket& from = peerRegistry.state(peer);
+    VictronPacket& to = assembledPacket;
+    unsigned long now = millis();
+    for (size_t s = 0; s < ESPNOW_FIELD_SECTIONS; s++) {
+        if (!(mask & (1u << s))) continue;
+        switch (ESPNOW_SECTIONS[s].tag) {
+            case TAG_READY:
+                if (peerRegistry.claimSection(s, peer, true, now) && to.readyForCommand != from.readyForCommand) {
+                    to.readyForCommand = from.readyForCommand;
+                    setVictronReady(to.readyForCommand);
+                }
+                break;
+            case TAG_BMV:
+                if (peerRegistry.claimSection(s, peer, from.bmv.valid, now)) to.bmv = from.bmv;
+                break;
+            case TAG_MPPT:
+                if (peerRegistry.claimSection(s, peer, from.mppt.valid, now)) to.mppt = from.mppt;
+                break;
+            case TAG_IP22:
+                if (peerRegistry.claimSection(s, peer, from.ip22.valid, now)) to.ip22 = from.ip22;
+                break;
+            case TAG_ECOFLOW:
+                if (peerRegistry.claimSection(s, peer, from.ecoflow.valid, now)) to.ecoflow = from.ecoflow;
+                break;
+            case TAG_FRIDGE:
+                if (peerRegistry.claimSection(s, peer, from.fridge.valid, now)) to.fridge = from.fridge;
+                break;
+        }
+    }
+    // Sections whose owner has gone quiet stay offline until a live peer reports them
+    expireSections(to, peerRegistry.freshSections(now));
+}
 
-    Serial.printf("[QUEUE] ✓ Command queued (count: %d)\n", masterQueueCount);
-    return true;
+// Hand on the combined view after `peer` reported. Only the relay's packets
+// carry packetId and are recorded in history.
+void publishPeerPacket(int peer, const PeerInfo& info) {
+    bool sequenced = info.source == SRC_VICTRON;
+    if (sequenced) {
+        assembledPacket.packetId = info.packetId;
+        assembledPacket.senderTime = peerRegistry.state(peer).senderTime;
+    }
+    pushReceivedPacket(assembledPacket, sequenced);
 }
 
-// Process queued commands (called from loop)
-void processMasterQueue() {
-    if (masterQueueCount == 0) return;
-    if (!victronReady) return;
+// A frame that passed the header and CRC checks
+void receiveFrame(FrameReader& frame, int len, const uint8_t* mac, int8_t rssi, unsigned long now) {
+    const EspNowHeader& header = frame.header();
+    framesReceived++;
+    frameBytes += len;
+    int peer = peerRegistry.observe(mac, header.source, true, rssi, now);
+    if (peer < 0) {
+        Serial.println("[ESP-NOW] ⚠️  Peer table full, ignored frame");
+        return;
+    }
 
-    // Throttle sends to once per 100ms
-    if (millis() - lastSendAttempt < 100) return;
-    lastSendAttempt = millis();
+    switch (header.type) {
+        case MSG_TELEMETRY: {
+            // Repeats and out-of-order frames would roll the peer's state back
+            uint32_t senderTime = 0;
+            bool timed = espnowSenderTime(frame, senderTime);
+            LinkArrival arrival = peerRegistry.arrive(peer, header.seq, timed, senderTime, now);
+            if (arrival != LINK_NEW) {
+                Serial.printf("[ESP-NOW] Dropped %s frame #%u from %s\n",
+                             arrival == LINK_DUPLICATE ? "duplicate" : "late", header.seq, peerSourceName(header.source));
+                break;
+            }
 
-    // Send next command from queue
-    QueuedCommand cmd = masterQueue[masterQueueHead];
-    masterQueueHead = (masterQueueHead + 1) % MASTER_QUEUE_SIZE;
-    masterQueueCount--;
+            VictronPacket& state = peerRegistry.state(peer);
+            uint32_t touched = 0;
+            bool applied = peerRegistry.decoder(peer).decode(frame,
+                [&](uint8_t tag, const int32_t* values, SectionReader& section) {
+                    applyTelemetrySection(tag, values, section, state);
+                    int s = espnowSectionIndex(tag);
+                    if (s >= 0) touched |= 1u << s;
+                });
+
+            // A delta frame without its keyframe arrived but is unusable
+            if (!applied) {
+                deltaFramesDropped++;
+                Serial.printf("[ESP-NOW] ⚠️  Delta frame #%u from %s without its keyframe\n",
+                             header.seq, peerSourceName(header.source));
+                break;
+            }
+            mergePeerSections(peer, touched);
+            PeerInfo info;
+            if (peerRegistry.snapshot(peer, info)) publishPeerPacket(peer, info);
+            break;
+        }
+        case MSG_STATUS: {
+            uint8_t tag;
+            SectionReader section(nullptr, 0);
+            while (frame.next(tag, section)) {
+                if (tag == TAG_READY) setVictronReady(section.u8() != 0);
+            }
+            break;
+        }
+        case MSG_COMMAND_ACK: {
+            CommandAck ack = {};
+            if (decodeCommandAck(frame, ack)) receiveAck(ack);
+            break;
+        }
+        default:
+            Serial.printf("[ESP-NOW] ✗ Unexpected frame type %d from source %d\n", header.type, header.source);
+            break;
+    }
+}
 
-    ControlCommand espCmd;
-    espCmd.commandId = nextCommandId++;
-    espCmd.device = cmd.device;
-    espCmd.command = cmd.command;
-    espCmd.value1 = cmd.value1;
-    espCmd.value2 = cmd.value2;
-    espCmd.timestamp = millis();
+// Receive callback: framed messages first, then the fixed-size structs older
+// relay firmware sends (told apart only by their length). Only data with no
+// frame magic at all can be a legacy struct; a damaged frame is rejected even
+// if its length happens to match one.
+void onDataReceive(const esp_now_recv_info *recv_info, const uint8_t *data, int len) {
+    unsigned long now = millis();
+    const uint8_t* mac = recv_info->src_addr;
+    int8_t rssi = recv_info->rx_ctrl ? recv_info->rx_ctrl->rssi : 0;
+    FrameReader frame(data, len);
+    if (frame.valid()) {
+        receiveFrame(frame, len, mac, rssi, now);
+        return;
+    }
+    if (frame.error() != FrameReader::NOT_FRAMED) {
+        framesRejected++;
+        Serial.printf("[ESP-NOW] ✗ Rejected frame (error %d, %d bytes)\n", frame.error(), len);
+        return;
+    }
+    bool legacy = len == sizeof(VictronPacket) || len == sizeof(StatusMessage) || len == sizeof(CommandAck);
+    if (!legacy) {
+        Serial.printf("[ESP-NOW] ✗ Unknown packet size: %d bytes\n", len);
+        return;
+    }
 
-    Serial.printf("[SEND] Sending command #%d (device=%d, cmd=%d) | Queue remaining: %d\n",
-                 espCmd.commandId, cmd.device, cmd.command, masterQueueCount);
+    int peer = peerRegistry.observe(mac, SRC_VICTRON, false, rssi, now);
+    if (peer < 0) {
+        Serial.println("[ESP-NOW] ⚠️  Peer table full, ignored packet");
+        return;
+    }
 
-    esp_now_send(victronMAC, (uint8_t*)&espCmd, sizeof(espCmd));
+    if (len == sizeof(VictronPacket)) {
+        // Legacy packets carry everything, their own packetId and senderTime
+        VictronPacket packet;
+        memcpy(&packet, data, sizeof(VictronPacket));
+        if (peerRegistry.arrive(peer, (uint16_t)packet.packetId, true, packet.senderTime, now) != LINK_NEW) return;
+        VictronPacket& state = peerRegistry.state(peer);
+        state = packet;
+        mergePeerSections(peer, (1u << ESPNOW_FIELD_SECTIONS) - 1);
+        PeerInfo info;
+        if (peerRegistry.snapshot(peer, info)) publishPeerPacket(peer, info);
+    } else if (len == sizeof(StatusMessage)) {
+        StatusMessage* status = (StatusMessage*)data;
+        setVictronReady(status->type == STATUS_READY);
+    } else {
+        CommandAck ack;
+        memcpy(&ack, data, sizeof(ack));
+        receiveAck(ack);
+    }
 }
 
-// ============ WEB SERVER HANDLERS ============
+// Feed one packet into the history tiers; offline devices leave gaps
+void recordHistory(const VictronPacket& p) {
+    float values[HIST_SERIES_COUNT];
+    bool present[HIST_SERIES_COUNT];
 
-void handleRoot() {
-    bool dataRecent = (millis() - lastReceived) < 60000;
-    unsigned long now = millis();
+    values[HIST_BMV_VOLTAGE] = p.bmv.voltage;
+    values[HIST_BMV_CURRENT] = p.bmv.current;
+    values[HIST_BMV_SOC] = p.bmv.soc;
+    present[HIST_BMV_VOLTAGE] = present[HIST_BMV_CURRENT] = present[HIST_BMV_SOC] = p.bmv.valid;
 
-    // Pre-allocate string for better performance
-    String html;
-    html.reserve(4096);  // Reserve ~4KB to reduce reallocations
+    values[HIST_MPPT_POWER] = p.mppt.solarPower;
+    present[HIST_MPPT_POWER] = p.mppt.valid;
 
-    html = "<!DOCTYPE html><html><head><meta charset='UTF-8'><meta name='viewport' content='width=device-width,initial-scale=1,viewport-fit=cover'>";
-    // PWA and iOS web app support
-    html += "<meta name='apple-mobile-web-app-capable' content='yes'>";
-    html += "<meta name='apple-mobile-web-app-status-bar-style' content='black-translucent'>";
-    html += "<meta name='apple-mobile-web-app-title' content='Trailer'>";
-    html += "<meta name='mobile-web-app-capable' content='yes'>";
-    html += "<link rel='manifest' href='/manifest.json'>";
-    html += "<link rel='apple-touch-icon' href='/icon-192.png'>";
-    html += "<title>Trailer Dashboard</title>";
+    values[HIST_IP22_CURRENT] = p.ip22.batteryCurrent;
+    present[HIST_IP22_CURRENT] = p.ip22.valid;
 
-    // Beautiful gradient-enhanced layout (matching fridge page style)
-    html += "<style>";
-    html += "*{-webkit-touch-callout:none;-webkit-user-select:none;user-select:none}";
-    html += "body{background:#000;color:#fff;font-family:-apple-system,BlinkMacSystemFont,'Segoe UI',Arial,sans-serif;margin:0;padding:8px;line-height:1.3;font-size:15px}";
-
-    // Cards with gradients and depth
-    html += ".c{background:linear-gradient(135deg,#1a1a1a 0%,#111 100%);margin:8px 0;padding:10px;border-radius:12px;border-left:3px solid #333;box-shadow:0 4px 6px rgba(0,0,0,0.3);position:relative}";
-    html += ".c.online{border-left-color:#4f4;box-shadow:0 4px 6px rgba(79,244,79,0.2)}";
-    html += ".c.warn{border-left-color:#f80;box-shadow:0 4px 6px rgba(255,136,0,0.2)}";
-    html += ".c.critical{border-left-color:#f22;box-shadow:0 4px 6px rgba(255,34,34,0.2)}";
-    html += ".c.emergency{border-left-color:#a0f;box-shadow:0 4px 6px rgba(170,0,255,0.2)}";
-    html += ".c.offline{border-left-color:#666;opacity:0.5}";
-
-    // Headers with icons - slightly larger and better contrast
-    html += "h2{margin:0 0 6px;font-size:1.05em;color:#ddd;display:flex;align-items:center;gap:8px;font-weight:600}";
-    html += ".icon{font-size:1.3em;filter:drop-shadow(0 2px 4px rgba(0,0,0,0.5))}";
-
-    // Main values with gradient backgrounds (compact size)
-    html += ".v{font-size:1.5em;font-weight:bold;margin:4px 0;line-height:1;padding:5px 8px;border-radius:8px;display:inline-block;background:linear-gradient(135deg,#4f4,#2d2);color:#000;box-shadow:0 2px 4px rgba(79,244,79,0.3)}";
-    html += ".v.warn{background:linear-gradient(135deg,#f80,#d60);color:#000;box-shadow:0 2px 4px rgba(255,136,0,0.3)}";
-    html += ".v.critical{background:linear-gradient(135deg,#f22,#d00);color:#fff;box-shadow:0 2px 4px rgba(255,34,34,0.3)}";
-    html += ".v.emergency{background:linear-gradient(135deg,#a0f,#80d);color:#fff;box-shadow:0 2px 4px rgba(170,0,255,0.3)}";
-
-    // Side-by-side layout: big value left, grid right (larger text)
-    html += ".content{display:flex;gap:15px;align-items:center}";
-    html += ".grid{display:grid;grid-template-columns:1fr 1fr;gap:6px 12px;font-size:0.95em;flex:1}";
-    html += ".item{display:flex;flex-direction:column}";
-    html += ".label{color:#999;font-size:0.8em;margin-bottom:2px;font-weight:500}";
-    html += ".value{color:#fff;font-size:1.05em;font-weight:500}";
-
-    // Value color coding
-    html += ".value.voltage{color:#4af}";
-    html += ".value.current{color:#fff}";
-    html += ".value.power{color:#fa0}";
-    html += ".value.temp{color:#0ff}";
-
-    // Badges with animations
-    html += ".badge{background:#444;padding:2px 6px;border-radius:6px;font-size:0.68em;color:#aaa;margin-left:5px}";
-    html += ".badge.on{background:linear-gradient(135deg,#282,#161);color:#4f4;animation:pulse 2s infinite}";
-    html += ".badge.charging{background:linear-gradient(135deg,#248,#136);color:#4af;animation:pulse 2s infinite}";
-    html += "@keyframes pulse{0%,100%{opacity:1}50%{opacity:0.7}}";
-
-    // Tablet/iPad optimization (768px and wider)
-    html += "@media(min-width:768px){";
-    html += "body{padding:10px 15px;max-width:1200px;margin:0 auto;font-size:16px}";
-    html += ".c{margin:8px 0;padding:12px;border-radius:12px;border-left-width:4px}";
-    html += "h2{font-size:1.15em;margin-bottom:6px}";
-    html += ".icon{font-size:1.3em}";
-    html += ".v{font-size:2em;padding:6px 12px}";
-    html += ".content{gap:10px}";
-    html += ".grid{gap:6px 12px;font-size:1em}";
-    html += ".label{font-size:0.8em}";
-    html += ".value{font-size:1.1em}";
-    html += ".badge{font-size:0.7em;padding:3px 8px}";
-    html += "a{padding:14px!important;font-size:1.1em!important}";
-    html += "}";
-    html += "@media(min-width:768px) and (orientation:landscape){";
-    html += "body{padding:8px 12px}";
-    html += ".c{margin:6px 0;padding:10px}";
-    html += "}";
+    history.addSample(values, present);
+}
 
-    // Alert notification bar styles
-    html += ".alert-bar{position:fixed;top:0;left:0;right:0;z-index:1000;padding:8px 15px;text-align:center;";
-    html += "font-size:0.9em;font-weight:600;transform:translateY(-100%);transition:transform 0.5s ease;cursor:pointer}";
-    html += ".alert-bar.show{transform:translateY(0)}";
-    html += ".alert-bar.normal{background:linear-gradient(135deg,#22c55e,#16a34a);color:#fff}";
-    html += ".alert-bar.caution{background:linear-gradient(135deg,#eab308,#ca8a04);color:#000}";
-    html += ".alert-bar.warning{background:linear-gradient(135deg,#f97316,#ea580c);color:#fff}";
-    html += ".alert-bar.critical{background:linear-gradient(135deg,#ef4444,#dc2626);color:#fff;animation:pulse-alert 2s infinite}";
-    html += "@keyframes pulse-alert{0%,100%{opacity:1}50%{opacity:0.8}}";
-    html += "body.alert-active{padding-top:40px}";  // Add padding when alert is shown
-    
-    html += "</style>";
-    html += "<script>";
-    html += "if('serviceWorker' in navigator){";
-    html += "navigator.serviceWorker.register('/sw.js').catch(e=>console.log('SW registration failed'));";
-    html += "}";
-    
-    // Alert notification JavaScript
-    html += "function showAlert(type,message,duration=3000){";
-    html += "let bar=document.getElementById('alertBar');";
-    html += "if(!bar){bar=document.createElement('div');bar.id='alertBar';bar.className='alert-bar';document.body.appendChild(bar);}";
-    html += "bar.className='alert-bar '+type;bar.innerHTML=message;";
-    html += "document.body.classList.add('alert-active');";
-    html += "setTimeout(()=>bar.classList.add('show'),100);";
-    html += "if(type==='normal'){setTimeout(()=>{bar.classList.remove('show');";
-    html += "setTimeout(()=>document.body.classList.remove('alert-active'),500);},duration);}";
-    html += "bar.onclick=()=>{if(type!=='normal')window.location.href='/monitor';};";
-    html += "}";
-    
-    html += "window.onload=function(){";
-    html += "let isNavigation=!document.referrer||document.referrer.indexOf(window.location.origin)==-1||";
-    html += "document.referrer.indexOf('/monitor')>-1||document.referrer.indexOf('/fridge')>-1||document.referrer.indexOf('/inventory')>-1;";
-    html += "if(!isNavigation)return;";  // Skip alert on refresh
-    
-    // Determine system status and show appropriate alert
-    uint32_t freeHeap = ESP.getFreeHeap();
-    bool batteryHealthy = true;
-    
-    // Check battery health
-    if (dataRecent && latestData.bmv.valid) {
-        float soc = latestData.bmv.soc;
-        int ttg = latestData.bmv.timeToGo;
-        batteryHealthy = !(soc <= 20 || (ttg > 0 && ttg <= 60));
-    }
-    
-    // Generate alert message and type - Only show alerts for problems or first navigation
-    String alertType = "";
-    String alertMessage = "";
-    
-    if (!dataRecent) {
-        alertType = "critical";
-        alertMessage = "⚠ Data Connection Lost - Click for Details";
-    }
-    else if (freeHeap < 20000) {
-        alertType = "critical";
-        alertMessage = "⚠ Critical: Low Memory (" + String(freeHeap/1024) + "KB) - Click for Details";
-    }
-    else if (freeHeap < 40000) {
-        alertType = "warning";
-        alertMessage = "⚠ Warning: Memory Low (" + String(freeHeap/1024) + "KB) - Click for Details";
-    }
-    else if (freeHeap < 60000) {
-        alertType = "caution";
-        alertMessage = "⚡ Caution: Monitor Memory (" + String(freeHeap/1024) + "KB) - Click for Details";
-    }
-    else if (!batteryHealthy) {
-        if (dataRecent && latestData.bmv.valid) {
-            float soc = latestData.bmv.soc;
-            if (soc <= 10) {
-                alertType = "critical";
-                alertMessage = "🔋 Critical: Battery " + String(soc,0) + "% - Immediate Attention Required";
-            }
-            else if (soc <= 20) {
-                alertType = "warning";
-                alertMessage = "🔋 Warning: Battery " + String(soc,0) + "% - Low Power";
-            }
-        }
-    }
-    else {
-        // Only show "All Systems Normal" on first navigation
-        alertType = "normal";
-        alertMessage = "✓ All Systems Normal";
+// Apply packets queued by onDataReceive (called from httpTask). Loss is
+// counted per peer as packets arrive (PeerRegistry / LinkStats); here only
+// the time spent waiting in the ring.
+void drainPacketRing() {
+    ReceivedPacket rx;
+    while (packetRing.pop(rx)) {
+        unsigned long waited = millis() - rx.receivedAt;
+        ringDelayTotalMs += waited;
+        ringDelayCount++;
+        if (waited > ringDelayMaxMs) ringDelayMaxMs = waited;
+
+        latestData = rx.packet;
+        packetsReceived++;
+        latestPacket.store(rx);
+        liveDataDirty = true;
+        // A sensor reporting directly only updates its part of the display
+        if (!rx.sequenced) continue;
+
+        recordHistory(rx.packet);
+        Serial.printf("[ESP-NOW] ✓ Packet #%d\n", latestData.packetId);
     }
-    
-    html += "if('" + alertType + "')showAlert('" + alertType + "','" + alertMessage + "');";
-    html += "};";
-    
-    html += "</script>";
-    html += "<meta http-equiv='refresh' content='5'>";  // Auto-refresh every 5 seconds
-    html += "</head><body>";
+}
 
-    // Battery with warning levels
-    html += "<div class='c ";
-    if (dataRecent && latestData.bmv.valid) {
-        float soc = latestData.bmv.soc;
-        int ttg = latestData.bmv.timeToGo;
-        if (soc <= 10 || (ttg > 0 && ttg <= 30)) html += "emergency";
-        else if (soc <= 20 || (ttg > 0 && ttg <= 60)) html += "critical";
-        else if (soc <= 50 || (ttg > 0 && ttg <= 120)) html += "warn";
-        else html += "online";
-    } else {
-        html += "offline";
-    }
-    html += "'><h2><span class='icon'>\u{1F50B}</span>KARSTEN MAXI SHUNT<span class='badge'>BMV-712</span></h2>";
-    if (dataRecent && latestData.bmv.valid) {
-        html += "<div class='content'>";
-
-        // Main value with warning color
-        float soc = latestData.bmv.soc;
-        int ttg = latestData.bmv.timeToGo;
-        html += "<div class='v";
-        if (soc <= 10 || (ttg > 0 && ttg <= 30)) html += " emergency";
-        else if (soc <= 20 || (ttg > 0 && ttg <= 60)) html += " critical";
-        else if (soc <= 50 || (ttg > 0 && ttg <= 120)) html += " warn";
-        html += "'>" + String(latestData.bmv.soc, 0) + "%</div>";
-
-        // 2-column grid with color-coded values
-        html += "<div class='grid'>";
-        html += "<div class='item'><div class='label'>Voltage</div><div class='value voltage'>" + String(latestData.bmv.voltage, 2) + "V</div></div>";
-        html += "<div class='item'><div class='label'>Current</div><div class='value current'>" + String(latestData.bmv.current, 2) + "A</div></div>";
-
-        if (latestData.bmv.timeToGo > 0 && latestData.bmv.timeToGo < 1440) {
-            int hours = latestData.bmv.timeToGo / 60;
-            int mins = latestData.bmv.timeToGo % 60;
-            html += "<div class='item'><div class='label'>Time remaining</div><div class='value'>" + String(hours) + "h " + String(mins) + "m</div></div>";
-        } else {
-            html += "<div class='item'><div class='label'>Time remaining</div><div class='value'>--</div></div>";
-        }
+// A peer that goes quiet sends nothing to say so: take its sections out of
+// latestData once it is stale, and push that to /events listeners
+void expireStaleSections() {
+    if (expireSections(latestData, peerRegistry.freshSections(millis()))) liveDataDirty = true;
+}
 
-        html += "<div class='item'><div class='label'>Consumed</div><div class='value'>" + String(latestData.bmv.consumedAh, 1) + "Ah</div></div>";
-        html += "</div></div>";
-    } else {
-        html += "<div class='v'>--</div>";
-        html += "<div style='font-size:0.9em;color:#888'>Offline</div>";
-    }
-    html += "</div>";
+// Queue a command for sending; replaces a waiting command for the same setting
+bool queueCommand(uint8_t device, uint8_t command, int16_t value1, int16_t value2) {
+    QueueResult result = commandQueue.push(device, command, value1, value2, millis());
 
-    // Solar
-    html += "<div class='c ";
-    html += (dataRecent && latestData.mppt.valid) ? "online" : "offline";
-    html += "'><h2><span class='icon'>\u{2600}\u{FE0F}</span>KARSTEN MAXI SOLAR<span class='badge'>MPPT 100/20</span>";
-    if (dataRecent && latestData.mppt.valid) {
-        // Add charging state badge in header
-        if (latestData.mppt.state == 3) html += "<span class='badge charging'>Bulk</span>";
-        else if (latestData.mppt.state == 4) html += "<span class='badge charging'>Absorption</span>";
-        else if (latestData.mppt.state == 5) html += "<span class='badge on'>Float</span>";
-        else if (latestData.mppt.state == 0) html += "<span class='badge'>Off</span>";
-    }
-    html += "</h2>";
-    if (dataRecent && latestData.mppt.valid) {
-        html += "<div class='content'>";
-        html += "<div class='v'>" + String((int)latestData.mppt.solarPower) + "W</div>";
-
-        // 2-column grid
-        html += "<div class='grid'>";
-        html += "<div class='item'><div class='label'>Voltage</div><div class='value voltage'>" + String(latestData.mppt.batteryVoltage, 2) + "V</div></div>";
-        html += "<div class='item'><div class='label'>Current</div><div class='value current'>" + String(latestData.mppt.batteryCurrent, 2) + "A</div></div>";
-        html += "<div class='item'><div class='label'>Yield today</div><div class='value power'>" + String(latestData.mppt.yieldToday, 2) + "kWh</div></div>";
-        html += "</div></div>";
-    } else {
-        html += "<div class='v'>--</div>";
-        html += "<div style='font-size:0.9em;color:#888'>Offline</div>";
+    if (result == QUEUE_FULL) {
+        Serial.println("[QUEUE] ✗ Queue full! Cannot add command");
+        return false;
     }
-    html += "</div>";
 
-    // AC Charger
-    html += "<div class='c ";
-    html += (dataRecent && latestData.ip22.valid) ? "online" : "offline";
-    html += "'><h2><span class='icon'>\u{1F50C}</span>KARSTEN MAXI AC<span class='badge'>IP22 12|20</span>";
-    if (dataRecent && latestData.ip22.valid) {
-        // Add charging state badge in header
-        if (latestData.ip22.state == 3) html += "<span class='badge charging'>Bulk</span>";
-        else if (latestData.ip22.state == 4) html += "<span class='badge charging'>Absorption</span>";
-        else if (latestData.ip22.state == 5) html += "<span class='badge on'>Float</span>";
-        else if (latestData.ip22.state == 2) html += "<span class='badge on'>Storage</span>";
-        else if (latestData.ip22.state == 0) html += "<span class='badge'>Off</span>";
-    }
-    html += "</h2>";
-    if (dataRecent && latestData.ip22.valid) {
-        html += "<div class='content'>";
-        html += "<div class='v'>" + String(latestData.ip22.power, 0) + "W</div>";
-
-        // 2-column grid
-        html += "<div class='grid'>";
-        html += "<div class='item'><div class='label'>Voltage</div><div class='value voltage'>" + String(latestData.ip22.batteryVoltage, 2) + "V</div></div>";
-        html += "<div class='item'><div class='label'>Current</div><div class='value current'>" + String(latestData.ip22.batteryCurrent, 2) + "A</div></div>";
-        if (latestData.ip22.temperature > 0) {
-            html += "<div class='item'><div class='label'>Temp</div><div class='value temp'>" + String(latestData.ip22.temperature, 0) + "°C</div></div>";
-        }
-        html += "</div></div>";
-    } else {
-        html += "<div class='v'>--</div>";
-        html += "<div style='font-size:0.9em;color:#888'>Offline</div>";
-    }
-    html += "</div>";
+    Serial.printf("[QUEUE] ✓ Command %s (count: %d, %s)\n",
+                 result == QUEUE_REPLACED ? "replaced waiting one" : "queued",
+                 commandQueue.depth(), commandLaneName(commandLane(device, command)));
+    if (commandTaskHandle) xTaskNotifyGive(commandTaskHandle);  // Wake dispatcher now
+    return true;
+}
 
-    // EcoFlow with warning levels
-    html += "<div class='c ";
-    if (dataRecent && latestData.ecoflow.valid) {
-        int pct = latestData.ecoflow.batteryPercent;
-        if (pct <= 10) html += "emergency";
-        else if (pct <= 20) html += "critical";
-        else if (pct <= 50) html += "warn";
-        else html += "online";
-    } else {
-        html += "offline";
-    }
-    html += "'><h2><span class='icon'>\u{26A1}</span>EcoFlow<span class='badge'>DELTA Max 2</span></h2>";
-    if (dataRecent && latestData.ecoflow.valid) {
-        html += "<div class='content'>";
-
-        // Main value with warning color
-        int pct = latestData.ecoflow.batteryPercent;
-        html += "<div class='v";
-        if (pct <= 10) html += " emergency";
-        else if (pct <= 20) html += " critical";
-        else if (pct <= 50) html += " warn";
-        html += "'>" + String(pct) + "%</div>";
-
-        // 2-column grid
-        html += "<div class='grid'>";
-        html += "<div class='item'><div class='label'>RSSI</div><div class='value current'>" + String(latestData.ecoflow.rssi) + " dBm</div></div>";
-
-        // Show serial number if available
-        if (latestData.ecoflow.serialNumber[0] != 0) {
-            html += "<div class='item'><div class='label'>Serial</div><div class='value' style='font-size:0.8em'>";
-            for (int i = 0; i < 16 && latestData.ecoflow.serialNumber[i] != 0; i++) {
-                html += (char)latestData.ecoflow.serialNumber[i];
-            }
-            html += "</div></div>";
+// Send to the peer that handles the device (PeerRegistry::commandTarget()),
+// framed if that peer sends frames, raw struct otherwise. Peers are added
+// to ESP-NOW on first use, from commandTask rather than the WiFi callback.
+void sendCommand(const ControlCommand& cmd) {
+    static uint16_t seq = 0;
+    PeerInfo target;
+    if (!peerRegistry.commandTarget(cmd.device, target, millis())) {
+        Serial.printf("[SEND] ✗ No peer for device %d yet\n", cmd.device);
+        return;
+    }
+    if (!esp_now_is_peer_exist(target.mac)) {
+        esp_now_peer_info_t peerInfo = {};
+        memcpy(peerInfo.peer_addr, target.mac, 6);
+        peerInfo.channel = ESPNOW_CHANNEL;
+        peerInfo.encrypt = false;
+        if (esp_now_add_peer(&peerInfo) != ESP_OK) {
+            Serial.println("[SEND] ✗ Failed to add ESP-NOW peer");
+            return;
         }
-        html += "</div></div>";
-    } else {
-        html += "<div class='v'>--</div>";
-        html += "<div style='font-size:0.9em;color:#888'>Offline</div>";
     }
-    html += "</div>";
-
-    // Fridge with temperature spike warnings
-    bool hasFridgeData = dataRecent && latestData.fridge.valid && latestData.fridge.connected;
-    html += "<div class='c ";
-    if (hasFridgeData) {
-        // Check for temperature spikes (door open, sun, etc)
-        int leftDiff = abs(latestData.fridge.left_actual - latestData.fridge.left_setpoint);
-        int rightDiff = abs(latestData.fridge.right_actual - latestData.fridge.right_setpoint);
-        int maxDiff = max(leftDiff, rightDiff);
-
-        if (maxDiff >= 10) html += "critical";  // >10°C = critical
-        else if (maxDiff >= 5) html += "warn";   // >5°C = warning
-        else html += "online";
+    if (target.framed) {
+        uint8_t frame[ESPNOW_MAX_FRAME];
+        size_t len = encodeCommandFrame(cmd, frame, seq++);
+        esp_now_send(target.mac, frame, len);
     } else {
-        html += "offline";
+        esp_now_send(target.mac, (const uint8_t*)&cmd, sizeof(cmd));
     }
-    html += "' onclick=\"window.location.href='/fridge'\" style='cursor:pointer;transition:transform 0.2s'>";
-    html += "<h2><span class='icon'>\u{2744}\u{FE0F}</span>Fridge<span class='badge'>Flex Adventure 95L K.I.D</span> <span style='margin-left:auto;font-size:1.2em'>→</span></h2>";
-    if (hasFridgeData) {
-        // 4 blocks in a row: LEFT | RIGHT | ECO | BATTERY
-        html += "<div class='fridge-blocks' style='display:flex;gap:8px;justify-content:space-between'>";
-
-        // LEFT temp block
-        int leftDiff = abs(latestData.fridge.left_actual - latestData.fridge.left_setpoint);
-        html += "<div style='flex:1;text-align:center;background:rgba(79,244,79,0.05);padding:8px;border-radius:8px'>";
-        html += "<div class='label' style='font-size:0.75em;margin-bottom:4px'>LEFT</div>";
-        html += "<div class='temp-value' style='font-size:1.4em;font-weight:bold;margin:2px 0;padding:4px 8px;border-radius:6px;display:inline-block;";
-        if (leftDiff >= 10) html += "background:linear-gradient(135deg,#f22,#d00);color:#fff";
-        else if (leftDiff >= 5) html += "background:linear-gradient(135deg,#f80,#d60);color:#000";
-        else html += "background:linear-gradient(135deg,#4af,#28d);color:#000";
-        html += "'>" + String(latestData.fridge.left_actual) + "°C</div>";
-        html += "<div class='temp-setpoint' style='font-size:0.75em;color:#aaa;margin-top:4px'>→ " + String(latestData.fridge.left_setpoint) + "°C</div>";
-        html += "</div>";
+}
 
-        // RIGHT temp block
-        int rightDiff = abs(latestData.fridge.right_actual - latestData.fridge.right_setpoint);
-        html += "<div style='flex:1;text-align:center;background:rgba(68,170,255,0.05);padding:8px;border-radius:8px'>";
-        html += "<div class='label' style='font-size:0.75em;margin-bottom:4px'>RIGHT</div>";
-        html += "<div class='temp-value' style='font-size:1.4em;font-weight:bold;margin:2px 0;padding:4px 8px;border-radius:6px;display:inline-block;";
-        if (rightDiff >= 10) html += "background:linear-gradient(135deg,#f22,#d00);color:#fff";
-        else if (rightDiff >= 5) html += "background:linear-gradient(135deg,#f80,#d60);color:#000";
-        else html += "background:linear-gradient(135deg,#0ff,#0dd);color:#000";
-        html += "'>" + String(latestData.fridge.right_actual) + "°C</div>";
-        html += "<div class='temp-setpoint' style='font-size:0.75em;color:#aaa;margin-top:4px'>→ " + String(latestData.fridge.right_setpoint) + "°C</div>";
-        html += "</div>";
+// Process queued commands and retransmits (called from commandTask).
+// Urgent commands go first, then retransmits, then normal commands; all
+// share the send throttle.
+void processMasterQueue() {
+    CommandAck ack;
+    while (ackRing.pop(ack)) commandTracker.acknowledge(ack, millis());
+    commandTracker.expire(millis());
 
-        // ECO block
-        html += "<div style='flex:1;text-align:center;padding:8px;border-radius:8px;";
-        html += latestData.fridge.eco_mode ? "background:linear-gradient(135deg,#282,#161)" : "background:#f8f8f8";
-        html += "'>";
-        html += "<div class='icon-block' style='font-size:1.8em;margin-bottom:2px'>\u{1F343}</div>";
-        html += "<div class='icon-label' style='font-size:0.85em;font-weight:600;";
-        html += latestData.fridge.eco_mode ? "color:#4f4" : "color:#333";
-        html += "'>ECO</div>";
-        html += "<div class='icon-status' style='font-size:0.7em;";
-        html += latestData.fridge.eco_mode ? "color:#4f4" : "color:#666";
-        html += "'>" + String(latestData.fridge.eco_mode ? "ON" : "OFF") + "</div>";
-        html += "</div>";
+    if (!victronReady) return;
 
-        // BATTERY block
-        html += "<div style='flex:1;text-align:center;background:#222;padding:8px;border-radius:8px'>";
-        html += "<div class='icon-block' style='font-size:1.8em;margin-bottom:2px'>\u{1F50B}</div>";
-        html += "<div class='icon-label' style='font-size:0.85em;font-weight:600;color:#4af'>BAT</div>";
-        html += "<div class='icon-status' style='font-size:0.7em;color:#aaa'>";
-        if (latestData.fridge.battery_protection == 0) html += "L";
-        else if (latestData.fridge.battery_protection == 1) html += "M";
-        else html += "H";
-        html += "</div>";
-        html += "</div>";
+    // Throttle sends to once per 100ms
+    if (millis() - lastSendAttempt < COMMAND_SEND_INTERVAL_MS) return;
 
-        html += "</div>";
-    } else {
-        html += "<div class='v'>--</div>";
-        html += "<div style='font-size:0.9em;color:#888'>Offline</div>";
+    ControlCommand espCmd;
+    bool urgentWaiting = commandQueue.depth(LANE_URGENT) > 0 && !commandTracker.full();
+    if (!urgentWaiting && commandTracker.nextRetransmit(millis(), espCmd, commandQueue)) {
+        lastSendAttempt = millis();
+        Serial.printf("[SEND] Retransmitting command #%d (device=%d, cmd=%d)\n",
+                     espCmd.commandId, espCmd.device, espCmd.command);
+        sendCommand(espCmd);
+        return;
     }
-    html += "</div>";
 
-    // Navigation buttons
-    html += "<div style='margin-top:15px;display:flex;gap:6px'>";
-    html += "<div onclick=\"window.location.href='/fridge'\" style='flex:1;padding:10px;background:linear-gradient(135deg,#667eea,#764ba2);border-radius:8px;text-align:center;color:#fff;font-weight:600;cursor:pointer;font-size:0.9em'>\u{1F9CA} Fridge</div>";
-    html += "<div onclick=\"window.location.href='/monitor'\" style='flex:1;padding:10px;background:linear-gradient(135deg,#4facfe,#00f2fe);border-radius:8px;text-align:center;color:#fff;font-weight:600;cursor:pointer;font-size:0.9em'>\u{1F4CA} Monitor</div>";
-    html += "<div onclick=\"window.location.href='/inventory'\" style='flex:1;padding:10px;background:linear-gradient(135deg,#667eea,#764ba2);border-radius:8px;text-align:center;color:#fff;font-weight:600;cursor:pointer;font-size:0.9em'>\u{1F69A} Inventory</div>";
-    html += "</div>";
+    if (commandTracker.full()) return;    // Wait for ACKs (or timeouts) to free a slot
 
-    // Footer
-    html += "<div style='margin-top:10px;padding:6px;background:#111;border-radius:4px;font-size:0.7em;color:#666;text-align:center'>";
-    unsigned long secondsAgo = (millis() - lastReceived) / 1000;
-    html += "Pkts: " + String(packetsReceived) + " | ";
-    if (secondsAgo < 60) {
-        html += String(secondsAgo) + "s";
-    } else {
-        html += String(secondsAgo / 60) + "m";
-    }
-    html += " | Up: ";
-    unsigned long uptimeSeconds = millis() / 1000;
-    unsigned long days = uptimeSeconds / 86400;
-    unsigned long hours = (uptimeSeconds % 86400) / 3600;
-    if (days > 0) html += String(days) + "d ";
-    html += String(hours) + "h";
-    html += "</div>";
+    // Send next command from queue
+    QueuedCommand cmd;
+    if (!commandQueue.pop(cmd, millis())) return;
+    lastSendAttempt = millis();
+    unsigned long waited = millis() - cmd.queuedAt;
 
-    html += "</body></html>";
+    espCmd.commandId = nextCommandId++;
+    espCmd.device = cmd.device;
+    espCmd.command = cmd.command;
+    espCmd.value1 = cmd.value1;
+    espCmd.value2 = cmd.value2;
+    espCmd.timestamp = millis();
 
-    server.send(200, "text/html", html);
+    Serial.printf("[SEND] Sending command #%d (device=%d, cmd=%d) | Waited %lums | Queue remaining: %d\n",
+                 espCmd.commandId, cmd.device, cmd.command, waited, commandQueue.depth());
+
+    commandTracker.track(espCmd, millis());
+    sendCommand(espCmd);
+}
+
+// Sends queued commands. Sleeps until queueCommand() or a READY status
+// wakes it, and otherwise polls every COMMAND_SEND_INTERVAL_MS so throttled
+// commands still go out on time.
+void commandTask(void* param) {
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(COMMAND_SEND_INTERVAL_MS));
+        processMasterQueue();
+    }
+}
+
+// ============ WEB SERVER HANDLERS ============
+
+void handleRoot() {
+    RootPageView view;
+    view.dataRecent = peerRegistry.freshSections(millis()) != 0;
+    view.freeHeap = ESP.getFreeHeap();
+    view.data = latestData;
+    view.clockSynced = wallClock.synced();
+    view.packetsReceived = packetsReceived;
+
+    // Stream the page in chunks instead of building it in one String
+    ChunkedResponse html(server);
+    html.begin(200, "text/html");
+    renderRootPage(html, view);
+    html.end();
 }
 
 void handleFridge() {
-    bool dataRecent = (millis() - lastReceived) < 60000;
-    bool hasFridgeData = dataRecent && latestData.fridge.valid && latestData.fridge.connected;
+    unsigned long now = millis();
+    bool hasFridgeData = sectionFresh(TAG_FRIDGE, now) && latestData.fridge.valid && latestData.fridge.connected;
 
     // Get current state
     int leftActual = hasFridgeData ? latestData.fridge.left_actual : 0;
@@ -645,117 +620,20 @@ void handleFridge() {
     html += "<link rel='manifest' href='/manifest.json'>";
     html += "<link rel='apple-touch-icon' href='/icon-192.png'>";
     html += "<title>Fridge Control</title>";
-    html += "<style>";
-    html += "*{-webkit-touch-callout:none;-webkit-user-select:none;user-select:none}";
-    html += "body{background:#000;color:#fff;font-family:-apple-system,BlinkMacSystemFont,'Segoe UI',Arial,sans-serif;margin:0;padding:10px}";
-    html += "a{color:#4af;text-decoration:none;padding:8px 16px;background:#222;border-radius:4px;display:inline-block;margin:5px}";
-
-    // Zone selector cards - more compact
-    html += ".zone{display:flex;gap:10px;margin:15px 0}";
-    html += ".zcard{flex:1;padding:15px;border-radius:10px;text-align:center;cursor:pointer;border:2px solid #444}";
-    html += ".zcard.sel{background:#1a1a1a;color:#fff;border-color:#4af}";
-    html += ".zcard.unsel{background:#f8f8f8;color:#333;border-color:#ddd}";
-    html += ".ztemp{font-size:2em;font-weight:bold;margin:4px 0}";
-    html += ".zlabel{font-size:0.85em;color:#888;margin-bottom:6px}";
-
-    // Slider - thinner and longer
-    html += ".slider-container{margin:20px 0}";
-    html += ".slider-wrapper{position:relative;margin:15px 30px}";
-    html += ".slider{width:100%;height:12px;border-radius:6px;background:linear-gradient(to right,#00bfff,#00ff7f,#ffff00,#ffa500,#ff4500);-webkit-appearance:none;outline:none}";
-    html += ".slider::-webkit-slider-thumb{-webkit-appearance:none;width:40px;height:40px;border-radius:6px;background:#1a1a1a;border:3px solid #4af;cursor:pointer;position:relative}";
-    html += ".slider::-moz-range-thumb{width:40px;height:40px;border-radius:6px;background:#1a1a1a;border:3px solid #4af;cursor:pointer}";
-    html += ".temp-display{text-align:center;font-size:1.8em;margin:10px 0;font-weight:bold}";
-    html += ".temp-labels{display:flex;justify-content:space-between;font-size:0.85em;color:#888;margin-top:5px}";
-
-    // Toggle buttons
-    html += ".toggle-row{display:flex;gap:10px;margin:25px 0;justify-content:center}";
-    html += ".tbtn{padding:15px 25px;border-radius:12px;border:2px solid #444;cursor:pointer;text-align:center;min-width:80px}";
-    html += ".tbtn.on{background:#1a1a1a;color:#fff;border-color:#4af}";
-    html += ".tbtn.off{background:#f8f8f8;color:#333;border-color:#ddd}";
-    html += ".icon{font-size:1.5em;margin-bottom:5px}";
-    html += ".tlabel{font-size:0.8em}";
-
-    // Tablet/iPad optimization (768px and wider)
-    html += "@media(min-width:768px){";
-    html += "body{padding:15px 20px;max-width:900px;margin:0 auto}";
-    html += "a{padding:10px 18px;font-size:1em}";
-    html += ".zcard{padding:18px}";
-    html += ".ztemp{font-size:2.8em}";
-    html += ".zlabel{font-size:1em}";
-    html += ".slider{height:45px}";
-    html += ".slider::-webkit-slider-thumb{width:70px;height:70px}";
-    html += ".slider::-moz-range-thumb{width:70px;height:70px}";
-    html += ".temp-display{font-size:2.2em;margin:15px 0}";
-    html += ".temp-labels{font-size:1em}";
-    html += ".tbtn{padding:16px 28px;font-size:1em}";
-    html += ".icon{font-size:1.6em}";
-    html += "}";
-
-    html += "</style>";
+    html += "<link rel='stylesheet' href='" ASSET_URL_FRIDGE_CSS "'>";
     html += "<script>";
     html += "var currentZone='left';";
     html += "var leftTemp=" + String(leftSet) + ";";
     html += "var rightTemp=" + String(rightSet) + ";";
     html += "var ecoState=" + String(ecoMode ? "1" : "0") + ";";
     html += "var batLevel=" + String(batProt) + ";";
-
-    // Zone selection
-    html += "function selectZone(zone){currentZone=zone;updateDisplay();}";
-
-    // Temperature slider
-    html += "function updateTemp(val){if(currentZone=='left'){leftTemp=parseInt(val);}else{rightTemp=parseInt(val);}updateDisplay();}";
-    html += "function adjustTemp(delta){var newTemp;if(currentZone=='left'){newTemp=Math.max(-20,Math.min(20,leftTemp+delta));leftTemp=newTemp;}else{newTemp=Math.max(-20,Math.min(20,rightTemp+delta));rightTemp=newTemp;}updateDisplay();}";
-    html += "function updateDisplay(){document.getElementById('leftCard').className=currentZone=='left'?'zcard sel':'zcard unsel';";
-    html += "document.getElementById('rightCard').className=currentZone=='right'?'zcard sel':'zcard unsel';";
-    html += "var temp=currentZone=='left'?leftTemp:rightTemp;document.getElementById('slider').value=temp;document.getElementById('tempDisp').innerText=temp+'°C';}";
-    html += "function setTemp(){var zone=currentZone=='left'?0:1;var temp=currentZone=='left'?leftTemp:rightTemp;";
-    html += "showStatus('Setting temperature...');setTimeout(function(){window.location.href='/fridge/cmd?zone='+zone+'&temp='+temp;},100);}";
-
-    // ECO toggle (visual only, needs SET)
-    html += "function toggleEco(){ecoState=ecoState=='1'?'0':'1';document.getElementById('ecoBtn').className='tbtn '+(ecoState=='1'?'on':'off');}";
-    html += "function setEco(){showStatus('Setting ECO mode...');setTimeout(function(){window.location.href='/fridge/eco?state='+ecoState;},100);}";
-
-    // Battery protection (visual only, needs SET)
-    html += "function selectBat(level){batLevel=level;document.getElementById('batL').className='tbtn '+(level==0?'on':'off');";
-    html += "document.getElementById('batM').className='tbtn '+(level==1?'on':'off');";
-    html += "document.getElementById('batH').className='tbtn '+(level==2?'on':'off');}";
-    html += "function setBat(){showStatus('Setting battery protection...');setTimeout(function(){window.location.href='/fridge/battery?level='+batLevel;},100);}";
-
-    // Status message
-    html += "function showStatus(msg,color){var s=document.getElementById('status');if(s){s.innerText=msg;s.style.backgroundColor=color||'#248';s.style.display='block';}}";
-    html += "function refresh(){location.reload();}";
-
-    // Smart polling after command sent
-    html += "var checkCount=0;";
     html += "var expectedTemp=" + String(leftSet) + ";";
     html += "var expectedEco=" + String(ecoMode ? "1" : "0") + ";";
     html += "var expectedBat=" + String(batProt) + ";";
-    html += "var checkType='';";
-
-    html += "function checkUpdate(){";
-    html += "checkCount++;";
-    html += "if(checkCount>12){showStatus('Update timeout - please refresh manually','#f44');return;}";
-    html += "fetch('/fridge/status').then(r=>r.json()).then(data=>{";
-    html += "var updated=false;";
-    html += "if(checkType=='temp'){";
-    html += "var currentTemp=currentZone=='left'?data.leftSet:data.rightSet;";
-    html += "if(currentTemp==expectedTemp){updated=true;showStatus('Temperature updated!','#4a4');}";
-    html += "}else if(checkType=='eco'){";
-    html += "if((data.eco?'1':'0')==expectedEco){updated=true;showStatus('ECO mode updated!','#4a4');}";
-    html += "}else if(checkType=='bat'){";
-    html += "if(data.bat==expectedBat){updated=true;showStatus('Battery protection updated!','#4a4');}";
-    html += "}";
-    html += "if(updated){setTimeout(function(){window.location.href='/fridge';},1500);}";
-    html += "else{showStatus('Waiting for update... ('+checkCount+'/12)','#248');setTimeout(checkUpdate,2000);}";
-    html += "}).catch(e=>{setTimeout(checkUpdate,2000);});";
-    html += "}";
-
-    // Check if we just sent a command
-    html += "var params=new URLSearchParams(window.location.search);";
-    html += "if(params.has('zone')){checkType='temp';expectedTemp=parseInt(params.get('temp'));showStatus('Setting temperature...');setTimeout(checkUpdate,3000);}";
-    html += "else if(params.has('state')){checkType='eco';expectedEco=params.get('state');showStatus('Setting ECO mode...');setTimeout(checkUpdate,3000);}";
-    html += "else if(params.has('level')){checkType='bat';expectedBat=parseInt(params.get('level'));showStatus('Setting battery protection...');setTimeout(checkUpdate,3000);}";
-    html += "</script></head><body>";
+    html += "</script>";
+    html += "<script src='" ASSET_URL_FRIDGE_JS "'></script>";
+    if (!wallClock.synced()) html += CLOCK_SYNC_SCRIPT;
+    html += "</head><body>";
 
     html += "<button style='padding:8px 16px;background:#4af;color:#000;border:none;border-radius:8px;cursor:pointer;font-weight:bold;margin-bottom:10px' onclick='refresh()'>🔄 Refresh</button><hr>";
 
@@ -766,11 +644,11 @@ void handleFridge() {
     html += "<div class='zone'>";
     html += "<div id='leftCard' class='zcard sel' onclick='selectZone(\"left\")'>";
     html += "<div class='zlabel'>Current temp</div>";
-    html += "<div style='font-size:1.2em'>Left " + String(leftActual) + "°C</div>";
+    html += "<div id='leftNow' style='font-size:1.2em'>Left " + String(leftActual) + "°C</div>";
     html += "</div>";
     html += "<div id='rightCard' class='zcard unsel' onclick='selectZone(\"right\")'>";
     html += "<div class='zlabel'>Current temp</div>";
-    html += "<div style='font-size:1.2em'>Right " + String(rightActual) + "°C</div>";
+    html += "<div id='rightNow' style='font-size:1.2em'>Right " + String(rightActual) + "°C</div>";
     html += "</div>";
     html += "</div>";
 
@@ -805,13 +683,12 @@ void handleFridge() {
     html += "<button style='padding:12px 40px;font-size:1.1em;background:#4af;color:#000;border:none;border-radius:12px;cursor:pointer;font-weight:bold' onclick='setEco()'>SET ECO</button>";
     html += "</div>";
 
-    // Status
-    if (hasFridgeData) {
-        html += "<div style='margin:20px 0;padding:15px;background:#111;border-radius:8px;font-size:0.9em;text-align:center;color:#888'>";
-        html += "Last update: " + String((millis() - lastReceived) / 1000) + "s ago";
-        html += "</div>";
+    // Status (kept current by fridge.js from /api/live)
+    unsigned long fridgeSeen = now;
+    if (hasFridgeData && peerRegistry.sectionSeen(espnowSectionIndex(TAG_FRIDGE), fridgeSeen)) {
+        html += "<div id='fridgeInfo' class='finfo'>Last update: " + String((now - fridgeSeen) / 1000) + "s ago</div>";
     } else {
-        html += "<p style='color:#f66;font-size:1.1em;text-align:center'>⚠ Fridge offline</p>";
+        html += "<div id='fridgeInfo' class='foff'>⚠ Fridge offline</div>";
     }
 
     // Navigation buttons
@@ -825,6 +702,24 @@ void handleFridge() {
     server.send(200, "text/html; charset=UTF-8", html);
 }
 
+// ============ STATIC ASSETS ============
+// CSS/JS live in web/ and are embedded gzipped by tools/embed_assets.py.
+// Pages reference them as /static/<file>?v=<etag>, so they can be cached hard.
+
+void handleStaticAsset(const StaticAsset& asset) {
+    String etag = String("\"") + asset.etag + "\"";
+    server.sendHeader("ETag", etag);
+    server.sendHeader("Cache-Control", "public, max-age=604800");
+
+    if (server.header("If-None-Match") == etag) {
+        server.send(304);
+        return;
+    }
+
+    server.sendHeader("Content-Encoding", "gzip");
+    server.send_P(200, asset.contentType, (PGM_P)asset.data, asset.length);
+}
+
 // ============ PWA SUPPORT HANDLERS ============
 
 void handleManifest() {
@@ -923,72 +818,602 @@ void handleFridgeCommand() {
         return;
     }
 
-    int8_t zone = server.arg("zone").toInt();
-    int8_t temp = server.arg("temp").toInt();
+    int8_t zone = server.arg("zone").toInt();
+    int8_t temp = server.arg("temp").toInt();
+
+    Serial.printf("[WEB] Fridge command: Zone %d to %d°C - queueing\n", zone, temp);
+
+    // Use correct command based on zone: 0=LEFT, 1=RIGHT
+    uint8_t cmd = (zone == 0) ? CMD_FRIDGE_SET_LEFT_TEMP : CMD_FRIDGE_SET_RIGHT_TEMP;
+
+    // value1 = zone (0 or 1), value2 = temperature
+    bool success = queueCommand(1, cmd, zone, temp);
+
+    server.sendHeader("Location", "/fridge?zone=" + String(zone) + "&temp=" + String(temp));
+    server.send(303);
+}
+
+void handleFridgeEco() {
+    // Accept both "eco" and "state" parameters for compatibility
+    if (!server.hasArg("eco") && !server.hasArg("state")) {
+        server.send(400, "text/plain", "Missing parameter");
+        return;
+    }
+
+    int8_t eco = server.hasArg("state") ? server.arg("state").toInt() : server.arg("eco").toInt();
+    Serial.printf("[WEB] Fridge ECO mode: %s - queueing\n", eco ? "ON" : "OFF");
+
+    queueCommand(1, CMD_FRIDGE_SET_ECO, eco, 0);
+
+    server.sendHeader("Location", "/fridge?state=" + String(eco));
+    server.send(303);
+}
+
+void handleFridgeBattery() {
+    if (!server.hasArg("level")) {
+        server.send(400, "text/plain", "Missing parameter");
+        return;
+    }
+
+    int8_t level = server.arg("level").toInt();
+    Serial.printf("[WEB] Fridge battery protection: %d - queueing\n", level);
+
+    queueCommand(1, CMD_FRIDGE_SET_BATTERY, level, 0);
+
+    server.sendHeader("Location", "/fridge?level=" + String(level));
+    server.send(303);
+}
+
+void handleFridgeStatus() {
+    bool hasFridgeData = sectionFresh(TAG_FRIDGE, millis()) && latestData.fridge.valid && latestData.fridge.connected;
+    CommandResult last = commandTracker.lastResult();
+
+    ChunkedResponse out(server);
+    out.begin(200, "application/json");
+    JsonWriter<ChunkedResponse> json(out);
+    json.beginObject();
+    if (hasFridgeData) {
+        json.member("leftActual", latestData.fridge.left_actual)
+            .member("rightActual", latestData.fridge.right_actual)
+            .member("leftSet", latestData.fridge.left_setpoint)
+            .member("rightSet", latestData.fridge.right_setpoint)
+            .member("eco", latestData.fridge.eco_mode)
+            .member("bat", latestData.fridge.battery_protection);
+    }
+    json.member("connected", hasFridgeData)
+        .member("pending", commandTracker.inFlight() + commandQueue.depth());
+    // Outcome of the most recent command, so the page can report a lost or rejected one
+    if (last.outcome != CMD_OUTCOME_NONE) {
+        json.key("lastCommand").beginObject()
+            .member("id", last.commandId)
+            .member("cmd", last.command)
+            .member("value1", last.value1)
+            .member("value2", last.value2)
+            .member("result", commandOutcomeName(last.outcome))
+            .member("error", last.errorCode)
+            .member("attempts", last.attempts)
+            .member("latencyMs", last.latencyMs)
+            .member("ageMs", millis() - last.finishedAt)
+            .endObject();
+    }
+    json.endObject();
+    out.end();
+}
+
+// Command queue state and queue-to-radio latency (used by tools/bench_fridge_cmd.py)
+void handleApiCommands() {
+    server.sendHeader("Cache-Control", "no-store");
+    ChunkedResponse out(server);
+    out.begin(200, "application/json");
+    JsonWriter<ChunkedResponse> json(out);
+    json.beginObject()
+        .member("ready", (bool)victronReady)
+        .member("queued", commandQueue.depth())
+        .member("queuedMax", commandQueue.maxDepth())
+        .member("coalesced", commandQueue.coalesced())
+        .member("dropped", commandQueue.dropped())
+        .member("dispatched", commandQueue.dispatched())
+        .member("waitAvgMs", commandQueue.waitAvgMs())
+        .member("waitMaxMs", commandQueue.waitMaxMs())
+        .member("inFlight", commandTracker.inFlight())
+        .member("acked", commandTracker.acked())
+        .member("failed", commandTracker.failed())
+        .member("timedOut", commandTracker.timedOut())
+        .member("retransmits", commandTracker.retransmits())
+        .member("duplicateAcks", commandTracker.duplicateAcks())
+        .member("superseded", commandTracker.superseded())
+        .member("ackP50Ms", commandTracker.latencyPercentile(50))
+        .member("ackP95Ms", commandTracker.latencyPercentile(95));
+    json.key("lanes").beginArray();
+    for (uint8_t l = 0; l < COMMAND_LANES; l++) {
+        CommandLane lane = (CommandLane)l;
+        const CommandLaneStats& stats = commandQueue.laneStats(lane);
+        json.beginObject()
+            .member("lane", commandLaneName(lane))
+            .member("queued", commandQueue.depth(lane))
+            .member("dispatched", stats.dispatched)
+            .member("waitAvgMs", stats.dispatched ? stats.waitTotalMs / stats.dispatched : 0UL)
+            .member("waitMaxMs", stats.waitMaxMs)
+            .endObject();
+    }
+    json.endArray().endObject();
+    out.end();
+}
+
+// GET /api/peers -> every ESP-NOW sender heard from, its link quality and
+// which sections it supplies to the combined view. Radio trouble shows as
+// per-peer loss and jitter; a busy Master as ring overruns and ring delay.
+void handleApiPeers() {
+    server.sendHeader("Cache-Control", "no-store");
+    ChunkedResponse out(server);
+    out.begin(200, "application/json");
+    JsonWriter<ChunkedResponse> json(out);
+    unsigned long now = millis();
+    json.beginObject()
+        .member("framesReceived", framesReceived)
+        .member("framesRejected", framesRejected)
+        .member("deltaFramesDropped", deltaFramesDropped)
+        .member("tableFullDrops", peerRegistry.rejected())
+        .member("ringOverruns", packetRing.overruns())
+        .member("ringDelayAvgMs", ringDelayCount ? ringDelayTotalMs / ringDelayCount : 0UL)
+        .member("ringDelayMaxMs", ringDelayMaxMs);
+    json.key("peers").beginArray();
+    for (size_t i = 0; i < peerRegistry.size(); i++) {
+        PeerInfo peer;
+        if (!peerRegistry.snapshot(i, peer)) continue;
+        char mac[18];
+        snprintf(mac, sizeof(mac), "%02X:%02X:%02X:%02X:%02X:%02X",
+                 peer.mac[0], peer.mac[1], peer.mac[2], peer.mac[3], peer.mac[4], peer.mac[5]);
+        json.beginObject()
+            .member("mac", mac)
+            .member("source", peerSourceName(peer.source))
+            .member("framed", peer.framed)
+            .member("stale", PeerRegistry::stale(peer, now))
+            .member("rssi", (int)peer.rssi)
+            .member("seq", (unsigned)peer.lastSeq)
+            .member("received", peer.received)
+            .member("intervalMs", peer.intervalMs)
+            .member("ageMs", now - peer.lastSeen);
+        const LinkSummary& link = peer.link;
+        json.key("link").beginObject()
+            .member("received", link.received)
+            .member("lost", link.lost)
+            .member("window", link.windowSize)
+            .member("windowLost", link.windowLost)
+            .member("lossPct", LinkStats::lossPermille(link) / 10.0, 1)
+            .member("duplicates", link.duplicates)
+            .member("late", link.late)
+            .member("reboots", link.reboots);
+        if (link.timed) {
+            json.member("jitterMs", link.jitterMs)
+                .member("latencyMs", link.latencyMs)
+                .member("latencyMaxMs", link.latencyMaxMs)
+                .member("clockOffsetMs", link.clockOffsetMs);
+        }
+        json.endObject();
+        json.key("sections").beginArray();
+        for (size_t s = 0; s < ESPNOW_FIELD_SECTIONS; s++) {
+            if (peerRegistry.sectionOwner(s) == (int)i) json.value(peerSectionName(ESPNOW_SECTIONS[s].tag));
+        }
+        json.endArray().endObject();
+    }
+    json.endArray().endObject();
+    out.end();
+}
+
+// GET /api/time -> wall clock state; POST /api/time?epoch=<unix seconds> sets it
+void handleApiTime() {
+    if (server.method() == HTTP_POST) {
+        if (!wallClock.set(strtoul(server.arg("epoch").c_str(), nullptr, 10))) {
+            server.send(400, "text/plain", "Bad epoch");
+            return;
+        }
+    }
+    ChunkedResponse out(server);
+    out.begin(200, "application/json");
+    JsonWriter<ChunkedResponse>(out).beginObject()
+        .member("now", wallClock.now())
+        .member("synced", wallClock.synced())
+        .member("valid", wallClock.valid())
+        .endObject();
+    out.end();
+}
+
+// ============ HISTORY API ============
+// GET /api/history                       -> series list and current history time
+// GET /api/history?series=bmv.voltage&from=-86400[&to=..][&tier=0|1|2][&format=csv|bin]
+// from/to are history-clock seconds; negative values are relative to now.
+// Without tier, the finest tier that still covers `from` is used.
+// bin: "HST1", uint16 scale, uint16 interval, then (uint32 time, int16 value) rows,
+// little-endian; value -32768 means no reading.
+
+uint32_t historyTimeArg(const char* name, long fallback) {
+    long v = server.hasArg(name) ? server.arg(name).toInt() : fallback;
+    long now = history.now();
+    if (v < 0) v = now + v;
+    return v < 0 ? 0 : (uint32_t)v;
+}
+
+void handleApiHistory() {
+    if (!server.hasArg("series")) {
+        ChunkedResponse out(server);
+        out.begin(200, "application/json");
+        JsonWriter<ChunkedResponse> json(out);
+        json.beginObject().member("now", history.now()).key("tiers").beginArray();
+        for (uint8_t tier = 0; tier < HISTORY_TIER_COUNT; tier++) json.value(HistoryStore::TIER_INTERVAL[tier]);
+        json.endArray().key("series").beginArray();
+        for (int i = 0; i < HIST_SERIES_COUNT; i++) {
+            json.beginObject()
+                .member("name", HISTORY_SERIES[i].name)
+                .member("unit", HISTORY_SERIES[i].unit)
+                .member("scale", HISTORY_SERIES[i].scale)
+                .endObject();
+        }
+        json.endArray().endObject();
+        out.end();
+        return;
+    }
+
+    int series = HistoryStore::seriesIndex(server.arg("series"));
+    if (series < 0) {
+        server.send(400, "text/plain", "Unknown series");
+        return;
+    }
+
+    uint32_t from = historyTimeArg("from", -3600);
+    uint32_t to = historyTimeArg("to", history.now());
+    uint8_t tier = server.hasArg("tier") ? server.arg("tier").toInt() : history.tierFor(from);
+    if (tier >= HISTORY_TIER_COUNT) {
+        server.send(400, "text/plain", "Invalid tier");
+        return;
+    }
+
+    const HistorySeriesInfo& info = HISTORY_SERIES[series];
+    bool binary = server.arg("format") == "bin";
+
+    server.sendHeader("X-History-Now", String(history.now()));
+    server.sendHeader("X-History-Interval", String(HistoryStore::TIER_INTERVAL[tier]));
+    ChunkedResponse out(server);
+
+    if (binary) {
+        out.begin(200, "application/octet-stream");
+        uint8_t header[8] = {'H', 'S', 'T', '1'};
+        memcpy(header + 4, &info.scale, 2);
+        memcpy(header + 6, &HistoryStore::TIER_INTERVAL[tier], 2);
+        out.write(header, sizeof(header));
+        history.query(series, tier, from, to, [&out](uint32_t t, int16_t value) {
+            out.write((const uint8_t*)&t, sizeof(t));
+            out.write((const uint8_t*)&value, sizeof(value));
+        });
+    } else {
+        out.begin(200, "text/csv");
+        int decimals = info.scale >= 100 ? 2 : (info.scale >= 10 ? 1 : 0);
+        out += "time," + String(info.name) + " (" + info.unit + ")\n";
+        history.query(series, tier, from, to, [&out, &info, decimals](uint32_t t, int16_t value) {
+            out += String(t) + ",";
+            if (value != HISTORY_MISSING) out += String((float)value / info.scale, decimals);
+            out += "\n";
+        });
+    }
+    out.end();
+}
+
+// ============ LIVE DATA API ============
+// Compact snapshot of latestData that the dashboard and fridge pages poll
+// instead of reloading. A device block is null when it is offline.
+// The same field table feeds the /events delta stream below.
+
+enum LiveBlock { LIVE_TOP = 0, LIVE_BMV, LIVE_MPPT, LIVE_IP22, LIVE_ECOFLOW, LIVE_FRIDGE, LIVE_BLOCK_COUNT };
+const char* LIVE_BLOCK_NAMES[LIVE_BLOCK_COUNT] = {"", "bmv", "mppt", "ip22", "ecoflow", "fridge"};
+
+#define LIVE_MAX_FIELDS 32
+
+struct LiveField {
+    uint8_t block;
+    const char* key;
+    char value[24];         // Already formatted as JSON
+};
+
+// Every field is always present in the same slot, online or not, so
+// per-client change tracking can index by position
+struct LiveSnapshot {
+    bool online[LIVE_BLOCK_COUNT];
+    LiveField fields[LIVE_MAX_FIELDS];
+    uint8_t count = 0;
+
+    void add(uint8_t block, const char* key, const char* fmt, ...) {
+        if (count >= LIVE_MAX_FIELDS) return;
+        LiveField& f = fields[count++];
+        f.block = block;
+        f.key = key;
+        va_list args;
+        va_start(args, fmt);
+        vsnprintf(f.value, sizeof(f.value), fmt, args);
+        va_end(args);
+    }
+};
+
+// A block is online while the peer that owns its section is live and
+// reports it valid; "age" is since the newest section owner was heard
+void collectLiveFields(LiveSnapshot& snap) {
+    ReceivedPacket rx = latestPacket.load();
+    const VictronPacket& d = rx.packet;
+    unsigned long now = millis();
+    unsigned long newest = 0;
+    uint32_t fresh = peerRegistry.freshSections(now, &newest);
+    auto live = [fresh](uint8_t tag) { return (fresh & (1u << espnowSectionIndex(tag))) != 0; };
+
+    snap.count = 0;
+    snap.online[LIVE_TOP] = true;
+    snap.online[LIVE_BMV] = live(TAG_BMV) && d.bmv.valid;
+    snap.online[LIVE_MPPT] = live(TAG_MPPT) && d.mppt.valid;
+    snap.online[LIVE_IP22] = live(TAG_IP22) && d.ip22.valid;
+    snap.online[LIVE_ECOFLOW] = live(TAG_ECOFLOW) && d.ecoflow.valid;
+    snap.online[LIVE_FRIDGE] = live(TAG_FRIDGE) && d.fridge.valid && d.fridge.connected;
+
+    snap.add(LIVE_TOP, "age", "%lu", (now - newest) / 1000);
+    snap.add(LIVE_TOP, "pkts", "%lu", (unsigned long)packetsReceived);
+    snap.add(LIVE_TOP, "up", "%lu", millis() / 1000);
+
+    snap.add(LIVE_BMV, "soc", "%.1f", d.bmv.soc);
+    snap.add(LIVE_BMV, "v", "%.2f", d.bmv.voltage);
+    snap.add(LIVE_BMV, "a", "%.2f", d.bmv.current);
+    snap.add(LIVE_BMV, "ttg", "%u", d.bmv.timeToGo);
+    snap.add(LIVE_BMV, "ah", "%.1f", d.bmv.consumedAh);
+
+    snap.add(LIVE_MPPT, "state", "%u", d.mppt.state);
+    snap.add(LIVE_MPPT, "w", "%d", (int)d.mppt.solarPower);
+    snap.add(LIVE_MPPT, "v", "%.2f", d.mppt.batteryVoltage);
+    snap.add(LIVE_MPPT, "a", "%.2f", d.mppt.batteryCurrent);
+    snap.add(LIVE_MPPT, "kwh", "%.2f", d.mppt.yieldToday);
+
+    snap.add(LIVE_IP22, "state", "%u", d.ip22.state);
+    snap.add(LIVE_IP22, "w", "%.0f", d.ip22.power);
+    snap.add(LIVE_IP22, "v", "%.2f", d.ip22.batteryVoltage);
+    snap.add(LIVE_IP22, "a", "%.2f", d.ip22.batteryCurrent);
+    snap.add(LIVE_IP22, "temp", "%.0f", d.ip22.temperature);
+
+    // Same 16-char cut as the old page; drop anything that would need escaping
+    char serial[17];
+    int n = 0;
+    for (int i = 0; i < 16 && d.ecoflow.serialNumber[i] != 0; i++) {
+        char c = d.ecoflow.serialNumber[i];
+        if (isalnum(c) || c == '-' || c == '_') serial[n++] = c;
+    }
+    serial[n] = 0;
+    snap.add(LIVE_ECOFLOW, "pct", "%u", d.ecoflow.batteryPercent);
+    snap.add(LIVE_ECOFLOW, "rssi", "%d", d.ecoflow.rssi);
+    snap.add(LIVE_ECOFLOW, "serial", "\"%s\"", serial);
+
+    snap.add(LIVE_FRIDGE, "leftActual", "%d", d.fridge.left_actual);
+    snap.add(LIVE_FRIDGE, "leftSet", "%d", d.fridge.left_setpoint);
+    snap.add(LIVE_FRIDGE, "rightActual", "%d", d.fridge.right_actual);
+    snap.add(LIVE_FRIDGE, "rightSet", "%d", d.fridge.right_setpoint);
+    snap.add(LIVE_FRIDGE, "eco", "%s", d.fridge.eco_mode ? "true" : "false");
+    snap.add(LIVE_FRIDGE, "bat", "%u", d.fridge.battery_protection);
+}
+
+uint32_t liveValueHash(const char* s) {
+    uint32_t h = 2166136261u;   // FNV-1a
+    while (*s) h = (h ^ (uint8_t)*s++) * 16777619u;
+    return h;
+}
+
+/**
+ * Append the snapshot to `out` as nested JSON.
+ * With no tracking arrays everything is written. Otherwise only fields whose
+ * value changed since the last call (plus blocks that went on/offline) are
+ * written, and the arrays are updated. Top-level fields (age, packet count,
+ * uptime) are always included. Returns the number of entries written.
+ */
+size_t appendLiveJson(String& out, const LiveSnapshot& snap, uint32_t* sentHashes = nullptr, bool* sentOnline = nullptr) {
+    size_t written = 0;
+    out += '{';
+
+    for (uint8_t b = 1; b < LIVE_BLOCK_COUNT; b++) {
+        if (snap.online[b]) continue;
+        if (sentOnline) {
+            if (!sentOnline[b]) continue;   // Client already shows it offline
+            sentOnline[b] = false;
+        }
+        if (written++) out += ',';
+        out += '"';
+        out += LIVE_BLOCK_NAMES[b];
+        out += "\":null";
+    }
+
+    int openBlock = -1;
+    bool first = true;
+    for (uint8_t i = 0; i < snap.count; i++) {
+        const LiveField& f = snap.fields[i];
+        if (!snap.online[f.block]) {
+            if (sentHashes) sentHashes[i] = 0;  // Resend everything when it comes back
+            continue;
+        }
+        if (sentHashes && f.block != LIVE_TOP) {
+            uint32_t h = liveValueHash(f.value);
+            if (sentHashes[i] == h) continue;
+            sentHashes[i] = h;
+        }
+
+        if (f.block != openBlock) {
+            if (openBlock > 0) out += '}';
+            first = (written == 0);
+            openBlock = f.block;
+            if (openBlock > 0) {
+                if (!first) out += ',';
+                out += '"';
+                out += LIVE_BLOCK_NAMES[openBlock];
+                out += "\":{";
+                first = true;
+            }
+        }
+        if (!first) out += ',';
+        first = false;
+        out += '"';
+        out += f.key;
+        out += "\":";
+        out += f.value;
+        written++;
+    }
+    if (openBlock > 0) out += '}';
+    out += '}';
+
+    if (sentOnline) {
+        for (uint8_t b = 1; b < LIVE_BLOCK_COUNT; b++) {
+            if (snap.online[b]) sentOnline[b] = true;
+        }
+    }
+    return written;
+}
+
+void handleApiLive() {
+    LiveSnapshot snap;
+    collectLiveFields(snap);
+
+    String json;
+    json.reserve(400);
+    appendLiveJson(json, snap);
 
-    Serial.printf("[WEB] Fridge command: Zone %d to %d°C - queueing\n", zone, temp);
+    server.sendHeader("Cache-Control", "no-store");
+    server.send(200, "application/json", json);
+}
 
-    // Use correct command based on zone: 0=LEFT, 1=RIGHT
-    uint8_t cmd = (zone == 0) ? CMD_FRIDGE_SET_LEFT_TEMP : CMD_FRIDGE_SET_RIGHT_TEMP;
+// ============ SERVER-SENT EVENTS ============
+// /events holds the connection open and pushes a delta (only the fields that
+// changed for that client) whenever a VictronPacket arrives. Sockets are
+// written non-blocking: a client that can't keep up just gets a bigger delta
+// once its buffer drains, and one that stays stuck is dropped, so a sleeping
+// phone can never hold up loop() and processMasterQueue().
+
+#define MAX_SSE_CLIENTS 4           // Matches the softAP connection limit
+#define SSE_PENDING_SIZE 768        // Largest event: full snapshot is ~400 bytes
+#define SSE_KEEPALIVE_MS 15000
+#define SSE_STALL_TIMEOUT_MS 10000
+
+struct SseClient {
+    WiFiClient client;
+    bool active = false;
+    bool dirty = false;                     // New data not yet queued for this client
+    bool sentOnline[LIVE_BLOCK_COUNT];
+    uint32_t sentHashes[LIVE_MAX_FIELDS];
+    char pending[SSE_PENDING_SIZE];
+    size_t pendingLen = 0;
+    size_t pendingSent = 0;
+    unsigned long lastWrite = 0;            // Last time bytes left the buffer
+};
 
-    // value1 = zone (0 or 1), value2 = temperature
-    bool success = queueCommand(1, cmd, zone, temp);
+SseClient sseClients[MAX_SSE_CLIENTS];
 
-    server.sendHeader("Location", "/fridge?zone=" + String(zone) + "&temp=" + String(temp));
-    server.send(303);
+void sseDrop(SseClient& c, const char* reason) {
+    Serial.printf("[SSE] Dropping client %d (%s)\n", (int)(&c - sseClients), reason);
+    c.client.stop();
+    c.client = WiFiClient();
+    c.active = false;
+    c.pendingLen = c.pendingSent = 0;
 }
 
-void handleFridgeEco() {
-    // Accept both "eco" and "state" parameters for compatibility
-    if (!server.hasArg("eco") && !server.hasArg("state")) {
-        server.send(400, "text/plain", "Missing parameter");
-        return;
+bool sseQueue(SseClient& c, const char* data, size_t len) {
+    if (len > SSE_PENDING_SIZE) {
+        sseDrop(c, "event too large");
+        return false;
     }
+    memcpy(c.pending, data, len);
+    c.pendingLen = len;
+    c.pendingSent = 0;
+    return true;
+}
 
-    int8_t eco = server.hasArg("state") ? server.arg("state").toInt() : server.arg("eco").toInt();
-    Serial.printf("[WEB] Fridge ECO mode: %s - queueing\n", eco ? "ON" : "OFF");
-
-    queueCommand(1, CMD_FRIDGE_SET_ECO, eco, 0);
+void sseQueueDelta(SseClient& c, const LiveSnapshot& snap) {
+    String event;
+    event.reserve(450);
+    event += "data: ";
+    if (appendLiveJson(event, snap, c.sentHashes, c.sentOnline) == 0) return;
+    event += "\n\n";
+    sseQueue(c, event.c_str(), event.length());
+}
 
-    server.sendHeader("Location", "/fridge?state=" + String(eco));
-    server.send(303);
+// Push as much of the pending event as the socket takes without blocking
+void sseFlush(SseClient& c) {
+    while (c.pendingSent < c.pendingLen) {
+        int n = send(c.client.fd(), c.pending + c.pendingSent, c.pendingLen - c.pendingSent, MSG_DONTWAIT);
+        if (n > 0) {
+            c.pendingSent += n;
+            c.lastWrite = millis();
+        } else if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            return;     // Socket buffer full - retry next loop
+        } else {
+            sseDrop(c, "disconnected");
+            return;
+        }
+    }
+    c.pendingLen = c.pendingSent = 0;
 }
 
-void handleFridgeBattery() {
-    if (!server.hasArg("level")) {
-        server.send(400, "text/plain", "Missing parameter");
+void handleEvents() {
+    int slot = -1;
+    for (int i = 0; i < MAX_SSE_CLIENTS; i++) {
+        if (!sseClients[i].active) { slot = i; break; }
+    }
+    if (slot < 0) {
+        server.send(503, "text/plain", "Too many event streams");
         return;
     }
 
-    int8_t level = server.arg("level").toInt();
-    Serial.printf("[WEB] Fridge battery protection: %d - queueing\n", level);
+    WiFiClient client = server.client();
+    client.setNoDelay(true);
+    client.print("HTTP/1.1 200 OK\r\n"
+                 "Content-Type: text/event-stream\r\n"
+                 "Cache-Control: no-cache\r\n"
+                 "Connection: keep-alive\r\n\r\n"
+                 "retry: 2000\n\n");
+
+    SseClient& c = sseClients[slot];
+    c.client = client;
+    c.active = true;
+    c.dirty = true;     // Send the full snapshot straight away
+    c.pendingLen = c.pendingSent = 0;
+    c.lastWrite = millis();
+    memset(c.sentHashes, 0, sizeof(c.sentHashes));
+    for (uint8_t b = 0; b < LIVE_BLOCK_COUNT; b++) c.sentOnline[b] = true;
+
+    Serial.printf("[SSE] Client %d connected from %s\n", slot, client.remoteIP().toString().c_str());
+}
 
-    queueCommand(1, CMD_FRIDGE_SET_BATTERY, level, 0);
+// Called every loop(): queue deltas, flush sockets, keep-alive and reap stuck clients
+void serviceSseClients() {
+    bool dirty = liveDataDirty;
+    if (dirty) liveDataDirty = false;
 
-    server.sendHeader("Location", "/fridge?level=" + String(level));
-    server.send(303);
-}
+    LiveSnapshot snap;
+    bool haveSnap = false;
+    unsigned long now = millis();
 
-void handleFridgeStatus() {
-    bool dataRecent = (millis() - lastReceived) < 60000;
-    bool hasFridgeData = dataRecent && latestData.fridge.valid && latestData.fridge.connected;
+    for (int i = 0; i < MAX_SSE_CLIENTS; i++) {
+        SseClient& c = sseClients[i];
+        if (!c.active) continue;
+        if (dirty) c.dirty = true;
 
-    String json = "{";
-    if (hasFridgeData) {
-        json += "\"leftActual\":" + String(latestData.fridge.left_actual) + ",";
-        json += "\"rightActual\":" + String(latestData.fridge.right_actual) + ",";
-        json += "\"leftSet\":" + String(latestData.fridge.left_setpoint) + ",";
-        json += "\"rightSet\":" + String(latestData.fridge.right_setpoint) + ",";
-        json += "\"eco\":" + String(latestData.fridge.eco_mode ? "true" : "false") + ",";
-        json += "\"bat\":" + String(latestData.fridge.battery_protection) + ",";
-        json += "\"connected\":true";
-    } else {
-        json += "\"connected\":false";
-    }
-    json += "}";
+        if (c.pendingLen == 0) {
+            if (c.dirty) {
+                if (!haveSnap) {
+                    collectLiveFields(snap);
+                    haveSnap = true;
+                }
+                c.dirty = false;
+                sseQueueDelta(c, snap);
+            } else if (now - c.lastWrite > SSE_KEEPALIVE_MS) {
+                sseQueue(c, ": keep-alive\n\n", 14);
+            }
+        }
 
-    server.sendHeader("Content-Type", "application/json");
-    server.send(200, "application/json", json);
+        if (c.active && c.pendingLen > 0) {
+            sseFlush(c);
+            if (c.active && c.pendingLen > 0 && now - c.lastWrite > SSE_STALL_TIMEOUT_MS) {
+                sseDrop(c, "stalled");
+            }
+        }
+    }
 }
 
 // ============ INVENTORY HANDLERS ============
@@ -1007,18 +1432,8 @@ void handleTabContent() {
         html += "</div></div>";
         
         // Summary tiles
-        int okCount = 0, lowCount = 0, outCount = 0;
-        for (size_t i = 0; i < inventory.size(); i++) {
-            if (!inventory[i].isConsumable) continue;
-            for (size_t j = 0; j < inventory[i].consumables.size(); j++) {
-                switch (inventory[i].consumables[j].status) {
-                    case STATUS_FULL:
-                    case STATUS_OK: okCount++; break;
-                    case STATUS_LOW: lowCount++; break;
-                    case STATUS_OUT: outCount++; break;
-                }
-            }
-        }
+        StockCounts stock = inventoryStats.consumables();
+        int okCount = stock.inStock(), lowCount = stock.low, outCount = stock.out;
         
         html += "<div class='summary-grid' style='grid-template-columns:repeat(3,1fr)'>";
         html += "<div class='summary-card' onclick='filterStatus(0)' style='cursor:pointer'><div class='label'>OK Stock</div><div class='value' style='color:#22c55e'>" + String(okCount) + "</div></div>";
@@ -1065,7 +1480,7 @@ void handleTabContent() {
             html += "<div id='cat" + String(i) + "' class='items-container expanded'>";
             for (size_t j = 0; j < inventory[i].consumables.size(); j++) {
                 String trailerIcon = inventory[i].consumables[j].livesInTrailer ? "🚚" : "🛒";
-                html += "<div class='item consumable-item' data-status='" + String(inventory[i].consumables[j].status) + "' data-trailer='" + String(inventory[i].consumables[j].livesInTrailer ? "1" : "0") + "' data-item-index='" + String(j) + "'>";
+                html += "<div class='item consumable-item' data-status='" + String(inventory[i].consumables[j].status) + "' data-trailer='" + String(inventory[i].consumables[j].livesInTrailer ? "1" : "0") + "' data-item-index='" + String(j) + "' data-id='" + String(inventory[i].consumables[j].id) + "'>";
                 html += "<span class='item-name'>" + trailerIcon + " " + inventory[i].consumables[j].name + "</span>";
                 html += "<div class='status-btns'>";
                 html += String("<button class='status-btn ok") + (inventory[i].consumables[j].status <= STATUS_OK ? " active" : "") + "' onclick='setStatus(" + String(i) + "," + String(j) + "," + String(STATUS_OK) + ")'>OK</button>";
@@ -1095,15 +1510,8 @@ void handleTabContent() {
         html += "</div></div>";
         
         // Summary tiles for Trailer equipment
-        int totalItems = 0, checkedItems = 0, packedItems = 0;
-        for (size_t i = 0; i < inventory.size(); i++) {
-            if (inventory[i].isConsumable || inventory[i].subcategory != SUBCATEGORY_TRAILER) continue;
-            totalItems += inventory[i].equipment.size();
-            for (size_t j = 0; j < inventory[i].equipment.size(); j++) {
-                if (inventory[i].equipment[j].checked) checkedItems++;
-                if (inventory[i].equipment[j].packed) packedItems++;
-            }
-        }
+        const PackCounts& pack = inventoryStats.equipment(SUBCATEGORY_TRAILER);
+        int totalItems = pack.total, checkedItems = pack.checked, packedItems = pack.packed;
         
         html += "<div class='summary-grid' style='grid-template-columns:repeat(3,1fr)'>";
         html += "<div class='summary-card' style='cursor:pointer'><div class='label'>Total Items</div><div class='value' style='color:#3b82f6'>" + String(totalItems) + "</div></div>";
@@ -1124,7 +1532,9 @@ void handleTabContent() {
             
             html += "<div id='cat" + String(i) + "' class='items-container expanded'>";
             for (size_t j = 0; j < inventory[i].equipment.size(); j++) {
-                html += "<div class='item'><span class='item-name'>" + inventory[i].equipment[j].name + "</span>";
+                html += "<div class='item' data-id='" + String(inventory[i].equipment[j].id) + "'><span class='item-name'>";
+                html += inventory[i].equipment[j].name;
+                html += "</span>";
                 html += "<div class='status-btns'>";
                 html += String("<button class='status-btn checked") + (inventory[i].equipment[j].checked ? " active" : "") + "' onclick='toggleEquipmentStatus(" + String(i) + "," + String(j) + ",\"checked\",2)'>Checked</button>";
                 html += String("<button class='status-btn packed") + (inventory[i].equipment[j].packed ? " active" : "") + "' onclick='toggleEquipmentStatus(" + String(i) + "," + String(j) + ",\"packed\",2)'>Packed</button>";
@@ -1152,15 +1562,8 @@ void handleTabContent() {
         html += "</div></div>";
         
         // Summary tiles for Essentials equipment
-        int totalItems = 0, checkedItems = 0, packedItems = 0;
-        for (size_t i = 0; i < inventory.size(); i++) {
-            if (inventory[i].isConsumable || inventory[i].subcategory != SUBCATEGORY_ESSENTIALS) continue;
-            totalItems += inventory[i].equipment.size();
-            for (size_t j = 0; j < inventory[i].equipment.size(); j++) {
-                if (inventory[i].equipment[j].checked) checkedItems++;
-                if (inventory[i].equipment[j].packed) packedItems++;
-            }
-        }
+        const PackCounts& pack = inventoryStats.equipment(SUBCATEGORY_ESSENTIALS);
+        int totalItems = pack.total, checkedItems = pack.checked, packedItems = pack.packed;
         
         html += "<div class='summary-grid' style='grid-template-columns:repeat(3,1fr)'>";
         html += "<div class='summary-card' style='cursor:pointer'><div class='label'>Total Items</div><div class='value' style='color:#3b82f6'>" + String(totalItems) + "</div></div>";
@@ -1181,7 +1584,9 @@ void handleTabContent() {
             
             html += "<div id='cat" + String(i) + "' class='items-container expanded'>";
             for (size_t j = 0; j < inventory[i].equipment.size(); j++) {
-                html += "<div class='item'><span class='item-name'>" + inventory[i].equipment[j].name + "</span>";
+                html += "<div class='item' data-id='" + String(inventory[i].equipment[j].id) + "'><span class='item-name'>";
+                html += inventory[i].equipment[j].name;
+                html += "</span>";
                 html += "<div class='status-btns'>";
                 html += String("<button class='status-btn checked") + (inventory[i].equipment[j].checked ? " active" : "") + "' onclick='toggleEquipmentStatus(" + String(i) + "," + String(j) + ",\"checked\",3)'>Checked</button>";
                 html += String("<button class='status-btn packed") + (inventory[i].equipment[j].packed ? " active" : "") + "' onclick='toggleEquipmentStatus(" + String(i) + "," + String(j) + ",\"packed\",3)'>Packed</button>";
@@ -1209,16 +1614,8 @@ void handleTabContent() {
         html += "</div></div>";
         
         // Summary tiles for Optional equipment
-        int totalItems = 0, checkedItems = 0, packedItems = 0, takingItems = 0;
-        for (size_t i = 0; i < inventory.size(); i++) {
-            if (inventory[i].isConsumable || inventory[i].subcategory != SUBCATEGORY_OPTIONAL) continue;
-            totalItems += inventory[i].equipment.size();
-            for (size_t j = 0; j < inventory[i].equipment.size(); j++) {
-                if (inventory[i].equipment[j].checked) checkedItems++;
-                if (inventory[i].equipment[j].packed) packedItems++;
-                if (inventory[i].equipment[j].taking) takingItems++;
-            }
-        }
+        const PackCounts& pack = inventoryStats.equipment(SUBCATEGORY_OPTIONAL);
+        int totalItems = pack.total, checkedItems = pack.checked, packedItems = pack.packed, takingItems = pack.taking;
         
         html += "<div class='summary-grid'>";
         html += "<div class='summary-card' style='cursor:pointer'><div class='label'>Total Items</div><div class='value' style='color:#3b82f6'>" + String(totalItems) + "</div></div>";
@@ -1240,7 +1637,9 @@ void handleTabContent() {
             
             html += "<div id='cat" + String(i) + "' class='items-container expanded'>";
             for (size_t j = 0; j < inventory[i].equipment.size(); j++) {
-                html += "<div class='item'><span class='item-name'>" + inventory[i].equipment[j].name + "</span>";
+                html += "<div class='item' data-id='" + String(inventory[i].equipment[j].id) + "'><span class='item-name'>";
+                html += inventory[i].equipment[j].name;
+                html += "</span>";
                 html += "<div class='status-btns'>";
                 html += String("<button class='status-btn taking") + (inventory[i].equipment[j].taking ? " active" : "") + "' onclick='toggleEquipmentStatus(" + String(i) + "," + String(j) + ",\"taking\",4)'>Taking</button>";
                 String disabledClass = inventory[i].equipment[j].taking ? "" : " disabled";
@@ -1265,35 +1664,29 @@ void handleTabContent() {
         String shoppingItems = "";
         int shoppingCount = 0;
         
-        for (size_t i = 0; i < inventory.size(); i++) {
-            if (!inventory[i].isConsumable) continue;
-            for (size_t j = 0; j < inventory[i].consumables.size(); j++) {
-                if (inventory[i].consumables[j].status == STATUS_LOW || inventory[i].consumables[j].status == STATUS_OUT) {
-                    String statusClass = (inventory[i].consumables[j].status == STATUS_LOW) ? "low" : "out";
-                    String badgeText = (inventory[i].consumables[j].status == STATUS_LOW) ? "LOW" : "OUT";
-                    String trailerAttribute = inventory[i].consumables[j].livesInTrailer ? "true" : "false";
-                    shoppingItems += "<div class='shop-item " + statusClass + "' data-cat='" + String(i) + "' data-item='" + String(j) + "' data-status='" + String(inventory[i].consumables[j].status) + "' data-trailer='" + trailerAttribute + "'>";
-                    shoppingItems += "<input type='checkbox' class='shop-check' style='width:18px;height:18px;margin-right:10px;cursor:pointer'>";
-                    String trailerIcon = inventory[i].consumables[j].livesInTrailer ? "\u{1F69A}" : "\u{1F6D2}";
-                    shoppingItems += "<span style='margin-right:8px;font-size:14px'>" + trailerIcon + "</span>";
-                    shoppingItems += "<div style='flex:1'>";
-                    shoppingItems += "<div style='font-weight:bold;margin-bottom:2px'>" + inventory[i].consumables[j].name + "</div>";
-                    shoppingItems += "<div style='font-size:13px;opacity:0.8'>" + inventory[i].name + "</div></div>";
-                    shoppingItems += "<span class='badge " + statusClass + "'>" + badgeText + "</span></div>";
-                    shoppingCount++;
-                }
-            }
+        for (const ShoppingEntry& entry : inventoryStats.shopping()) {
+            size_t i = entry.cat, j = entry.item;
+            String statusClass = (inventory[i].consumables[j].status == STATUS_LOW) ? "low" : "out";
+            String badgeText = (inventory[i].consumables[j].status == STATUS_LOW) ? "LOW" : "OUT";
+            String trailerAttribute = inventory[i].consumables[j].livesInTrailer ? "true" : "false";
+            shoppingItems += "<div class='shop-item " + statusClass + "' data-cat='" + String(i) + "' data-item='" + String(j) + "' data-id='" + String(inventory[i].consumables[j].id) + "' data-status='" + String(inventory[i].consumables[j].status) + "' data-trailer='" + trailerAttribute + "'>";
+            shoppingItems += "<input type='checkbox' class='shop-check' style='width:18px;height:18px;margin-right:10px;cursor:pointer'>";
+            String trailerIcon = inventory[i].consumables[j].livesInTrailer ? "\u{1F69A}" : "\u{1F6D2}";
+            shoppingItems += "<span style='margin-right:8px;font-size:14px'>" + trailerIcon + "</span>";
+            shoppingItems += "<div style='flex:1'>";
+            shoppingItems += "<div style='font-weight:bold;margin-bottom:2px'>";
+            shoppingItems += inventory[i].consumables[j].name;
+            shoppingItems += "</div>";
+            shoppingItems += "<div style='font-size:13px;opacity:0.8'>";
+            shoppingItems += inventory[i].name;
+            shoppingItems += "</div></div>";
+            shoppingItems += "<span class='badge " + statusClass + "'>" + badgeText + "</span></div>";
+            shoppingCount++;
         }
 
         // Count LOW and OUT separately  
-        int lowShopCount = 0, outShopCount = 0;
-        for (size_t i = 0; i < inventory.size(); i++) {
-            if (!inventory[i].isConsumable) continue;
-            for (size_t j = 0; j < inventory[i].consumables.size(); j++) {
-                if (inventory[i].consumables[j].status == STATUS_LOW) lowShopCount++;
-                else if (inventory[i].consumables[j].status == STATUS_OUT) outShopCount++;
-            }
-        }
+        StockCounts stock = inventoryStats.consumables();
+        int lowShopCount = stock.low, outShopCount = stock.out;
         
         html += "<div class='c'>";
         
@@ -1376,111 +1769,8 @@ void handleInventory() {
     html += "<meta name='apple-mobile-web-app-status-bar-style' content='black-translucent'>";
     html += "<meta name='mobile-web-app-capable' content='yes'>";
     html += "<title>Inventory</title>";
-    html += "<style>";
-    html += "*{margin:0;padding:0;box-sizing:border-box;-webkit-touch-callout:none;-webkit-user-select:none;user-select:none}";
-    html += "body{background:#000;color:#fff;font-family:-apple-system,BlinkMacSystemFont,'Segoe UI',Arial,sans-serif;padding:8px;line-height:1.3;font-size:15px}";
-    html += ".header{text-align:center;padding:10px;background:linear-gradient(135deg,#1a1a1a,#111);border-radius:8px;margin-bottom:12px}";
-    html += ".header h1{font-size:1.3em;margin:0}";
-    html += ".tabs{display:grid;grid-template-columns:repeat(3,1fr);gap:8px;margin-bottom:15px}";
-    html += ".tab{padding:12px 8px;background:rgba(255,255,255,0.1);border:none;border-radius:8px;color:#fff;font-size:15px;cursor:pointer;text-align:center;transition:all 0.2s;font-weight:500;line-height:1.3;display:flex;flex-direction:column;align-items:center;gap:4px}";
-    html += ".tab.active{background:linear-gradient(135deg,#667eea,#764ba2);box-shadow:0 4px 15px rgba(102,126,234,0.4)}";
-    html += ".content{display:none}";
-    html += ".content.active{display:block}";
-    html += ".c{background:linear-gradient(135deg,#1a1a1a,#111);margin:8px 0;padding:12px;border-radius:12px;border-left:3px solid #333;box-shadow:0 4px 6px rgba(0,0,0,0.3)}";
-    html += ".cat-header{display:flex;align-items:center;padding:12px;background:rgba(255,255,255,0.08);border-radius:10px;margin-bottom:10px;border-left:3px solid rgba(255,255,255,0.2)}";
-    html += ".cat-title{font-size:1.1em;font-weight:bold;display:flex;align-items:center;gap:10px;cursor:pointer;flex:1}";
-    html += ".cat-count{background:rgba(255,255,255,0.15);padding:4px 12px;border-radius:15px;font-size:0.85em;margin-left:10px;color:#fff}";
-    html += ".cat-controls{display:flex;align-items:center;gap:10px;margin-left:auto}";
-    html += ".expand-icon{font-size:14px;color:rgba(255,255,255,0.7);cursor:pointer}";
-    html += ".item{display:flex;justify-content:space-between;align-items:center;padding:10px;background:rgba(255,255,255,0.05);border-radius:8px;margin-bottom:6px}";
-    html += ".item-name{flex:1;font-size:14px}";
-    html += ".status-btns{display:flex;gap:4px}";
-    html += ".status-btn{padding:5px 12px;border:none;border-radius:6px;font-size:12px;font-weight:600;cursor:pointer;opacity:0.5}";
-    html += ".status-btn.active{opacity:1;box-shadow:0 0 8px rgba(255,255,255,0.3)}";
-    html += ".status-btn.ok{background:#22c55e;color:#fff}";
-    html += ".status-btn.low{background:#f59e0b;color:#fff}";
-    html += ".status-btn.out{background:#ef4444;color:#fff}";
-    html += ".status-btn.checked{background:#3b82f6;color:#fff}";
-    html += ".status-btn.packed{background:#22c55e;color:#fff}";
-    html += ".status-btn.taking{background:#8b5cf6;color:#fff}";
-    html += ".status-btn.disabled{background:#6b7280;opacity:0.4;cursor:not-allowed}";
-    html += ".filter-btn{opacity:0.7;transition:all 0.2s}";
-    html += ".filter-btn.active{opacity:1;transform:scale(0.95);box-shadow:inset 0 2px 4px rgba(0,0,0,0.3)}";
-    html += ".checkbox-group{display:flex;gap:12px}";
-    html += ".checkbox-label{display:flex;align-items:center;gap:6px;font-size:13px;padding:6px 10px;border-radius:6px;background:rgba(255,255,255,0.05);transition:all 0.2s;cursor:pointer;opacity:0.6}";
-    html += ".checkbox-label:has(input:checked){opacity:1;background:rgba(255,255,255,0.15);box-shadow:0 0 8px rgba(255,255,255,0.2)}";
-    html += ".checkbox-label input{width:16px;height:16px;cursor:pointer;accent-color:#667eea}";
-    html += ".items-container{max-height:0;overflow:hidden;transition:max-height 0.3s}";
-    html += ".items-container.expanded{max-height:3000px}";
-    html += ".expand-icon{transition:transform 0.3s}";
-    html += ".expanded .expand-icon{transform:rotate(180deg)}";
-    html += "@media (max-width: 1024px){.items-container,.expand-icon{transition:none}}";
-    html += ".no-transition,.no-transition *{transition:none !important}";
-    html += ".action-btns{display:flex;gap:8px;margin-top:15px;flex-wrap:wrap}";
-    html += ".action-btn{flex:1;padding:12px;border:none;border-radius:10px;font-size:14px;font-weight:600;cursor:pointer;min-width:120px}";
-    html += ".action-btn.primary{background:linear-gradient(135deg,#667eea,#764ba2);color:#fff}";
-    html += ".action-btn.secondary{background:rgba(255,255,255,0.2);color:#fff}";
-    html += ".summary{display:grid;grid-template-columns:repeat(3,1fr);gap:10px;margin-bottom:15px}";
-    html += ".summary-grid{display:grid;grid-template-columns:repeat(4,1fr);gap:10px;margin:15px 0}";
-    html += ".summary-card{background:rgba(255,255,255,0.1);padding:15px;border-radius:10px;text-align:center}";
-    html += ".summary-card .value{font-size:2em;font-weight:bold;margin:5px 0}";
-    html += ".summary-card .label{font-size:0.85em;opacity:0.8}";
-    
-    // Main dashboard card styles
-    html += ".main-cards{display:flex;flex-direction:column;gap:16px;margin-bottom:20px}";
-    html += ".main-card{background:rgba(255,255,255,0.1);border-radius:12px;padding:16px;cursor:pointer;transition:all 0.2s;display:flex;align-items:center;gap:16px}";
-    html += ".main-card:hover{background:rgba(255,255,255,0.15);transform:translateY(-2px);box-shadow:0 8px 25px rgba(0,0,0,0.3)}";
-    html += ".main-card-left{flex-shrink:0;display:flex;flex-direction:column;align-items:center;gap:8px;min-width:80px}";
-    html += ".main-card-icon{font-size:32px;line-height:1}";
-    html += ".main-card-title{font-size:14px;font-weight:600;text-align:center;color:rgba(255,255,255,0.9)}";
-    html += ".main-card-right{flex:1;display:grid;grid-template-columns:repeat(3,1fr);gap:12px}";
-    html += ".main-card-tile{background:rgba(255,255,255,0.1);border-radius:8px;padding:12px;text-align:center;min-height:50px;display:flex;flex-direction:column;justify-content:center}";
-    html += ".main-card-tile.ok .tile-value{color:#22c55e}";
-    html += ".main-card-tile.low .tile-value{color:#f59e0b}";
-    html += ".main-card-tile.out .tile-value{color:#ef4444}";
-    html += ".main-card-tile.total .tile-value{color:#3b82f6}";
-    html += ".main-card-tile.check .tile-value{color:#f59e0b}";
-    html += ".main-card-tile.pack .tile-value{color:#ef4444}";
-    html += ".main-card-tile.taking .tile-value{color:#8b5cf6}";
-    html += ".tile-label{font-size:11px;color:rgba(255,255,255,0.7);margin-bottom:4px;font-weight:500}";
-    html += ".tile-value{font-size:18px;font-weight:bold;line-height:1}";
-    html += ".shop-item{display:flex;justify-content:space-between;align-items:center;padding:12px;background:rgba(255,255,255,0.05);border-radius:8px;margin-bottom:8px;border-left:4px solid}";
-    html += ".shop-item.low{border-left-color:#f59e0b}";
-    html += ".shop-item.out{border-left-color:#ef4444}";
-    html += ".badge{padding:4px 10px;border-radius:10px;font-size:11px;font-weight:600}";
-    html += ".badge.low{background:#f59e0b;color:#000}";
-    html += ".badge.out{background:#ef4444;color:#fff}";
-    html += ".empty{text-align:center;padding:30px;opacity:0.6}";
-
-    // Tablet/iPad optimization (768px and wider)
-    html += "@media(min-width:768px){";
-    html += "body{padding:12px 15px;max-width:1000px;margin:0 auto;font-size:16px}";
-    html += ".header{padding:15px}";
-    html += ".header h1{font-size:1.6em}";
-    html += ".tabs{grid-template-columns:repeat(6,1fr);gap:10px;margin-bottom:12px}";
-    html += ".tab{padding:14px 12px;font-size:1em;gap:5px}";
-    html += ".c{margin:10px 0;padding:12px}";
-    html += ".cat-header{padding:14px}";
-    html += ".cat-title{font-size:1.15em;gap:12px}";
-    html += ".cat-count{padding:5px 14px;font-size:0.9em;margin-left:18px}";
-    html += ".expand-icon{font-size:16px}";
-    html += ".item{padding:10px;margin-bottom:6px}";
-    html += ".item-name{font-size:1em}";
-    html += ".status-btn{padding:6px 12px;font-size:0.85em}";
-    html += ".checkbox-label{font-size:0.95em;padding:8px 12px}";
-    html += ".checkbox-label input{width:18px;height:18px}";
-    html += ".action-btn{padding:12px;font-size:1em;min-width:140px}";
-    html += ".summary-card{padding:12px}";
-    html += ".summary-card .value{font-size:2.2em}";
-    html += ".summary-card .label{font-size:0.9em}";
-    html += ".shop-item{padding:12px;margin-bottom:8px}";
-    html += ".badge{padding:4px 10px;font-size:0.75em}";
-    html += ".main-card-right{grid-template-columns:1fr;gap:8px}";
-    html += ".main-card-tile{padding:8px}";
-    html += ".tile-value{font-size:16px}";
-    html += "}";
-
-    html += "</style></head><body>";
+    html += "<link rel='stylesheet' href='" ASSET_URL_INVENTORY_CSS "'>";
+    html += "</head><body>";
 
     // Header
     html += "<div class='header'>";
@@ -1499,64 +1789,21 @@ void handleInventory() {
     // Main Dashboard Tab
     html += "<div class='content active' id='tab0'>";
     
-    // Calculate summary data for each tab
+    // Summary data for each tab (see InventoryStats.h)
     // Consumables Summary
-    int okCount = 0, lowCount = 0, outCount = 0;
-    int trailerOk = 0, trailerLow = 0, trailerOut = 0;
-    int tripOk = 0, tripLow = 0, tripOut = 0;
-    
-    for (size_t i = 0; i < inventory.size(); i++) {
-        if (!inventory[i].isConsumable) continue;
-        for (size_t j = 0; j < inventory[i].consumables.size(); j++) {
-            switch (inventory[i].consumables[j].status) {
-                case STATUS_OK: 
-                    okCount++; 
-                    if (inventory[i].consumables[j].livesInTrailer) trailerOk++; else tripOk++;
-                    break;
-                case STATUS_LOW: 
-                    lowCount++; 
-                    if (inventory[i].consumables[j].livesInTrailer) trailerLow++; else tripLow++;
-                    break;
-                case STATUS_OUT: 
-                    outCount++; 
-                    if (inventory[i].consumables[j].livesInTrailer) trailerOut++; else tripOut++;
-                    break;
-            }
-        }
-    }
+    const StockCounts& trailerStock = inventoryStats.consumables(true);
+    const StockCounts& tripStock = inventoryStats.consumables(false);
+    int trailerOk = trailerStock.ok, trailerLow = trailerStock.low, trailerOut = trailerStock.out;
+    int tripOk = tripStock.ok, tripLow = tripStock.low, tripOut = tripStock.out;
     
     // Equipment Summary by Category
-    int trailerTotal = 0, trailerChecked = 0, trailerPacked = 0;
-    int essentialsTotal = 0, essentialsChecked = 0, essentialsPacked = 0;
-    int optionalTotal = 0, optionalChecked = 0, optionalPacked = 0;
-    int optionalTaking = 0, optionalTakingChecked = 0, optionalTakingPacked = 0;
-    
-    for (size_t i = 0; i < inventory.size(); i++) {
-        if (inventory[i].isConsumable) continue;
-        
-        for (size_t j = 0; j < inventory[i].equipment.size(); j++) {
-            if (inventory[i].subcategory == SUBCATEGORY_TRAILER) {
-                trailerTotal++;
-                if (inventory[i].equipment[j].checked) trailerChecked++;
-                if (inventory[i].equipment[j].packed) trailerPacked++;
-            } else if (inventory[i].subcategory == SUBCATEGORY_ESSENTIALS) {
-                essentialsTotal++;
-                if (inventory[i].equipment[j].checked) essentialsChecked++;
-                if (inventory[i].equipment[j].packed) essentialsPacked++;
-            } else if (inventory[i].subcategory == SUBCATEGORY_OPTIONAL) {
-                optionalTotal++;
-                if (inventory[i].equipment[j].checked) optionalChecked++;
-                if (inventory[i].equipment[j].packed) optionalPacked++;
-                
-                // Count taking items only for optional category
-                if (inventory[i].equipment[j].taking) {
-                    optionalTaking++;
-                    if (inventory[i].equipment[j].checked) optionalTakingChecked++;
-                    if (inventory[i].equipment[j].packed) optionalTakingPacked++;
-                }
-            }
-        }
-    }
+    const PackCounts& trailerPack = inventoryStats.equipment(SUBCATEGORY_TRAILER);
+    const PackCounts& essentialsPack = inventoryStats.equipment(SUBCATEGORY_ESSENTIALS);
+    const PackCounts& optionalPack = inventoryStats.equipment(SUBCATEGORY_OPTIONAL);
+    int trailerTotal = trailerPack.total, trailerChecked = trailerPack.checked, trailerPacked = trailerPack.packed;
+    int essentialsTotal = essentialsPack.total, essentialsChecked = essentialsPack.checked, essentialsPacked = essentialsPack.packed;
+    int optionalTotal = optionalPack.total, optionalChecked = optionalPack.checked, optionalPacked = optionalPack.packed;
+    int optionalTaking = optionalPack.taking, optionalTakingChecked = optionalPack.takingChecked, optionalTakingPacked = optionalPack.takingPacked;
     
     // Main Dashboard Cards
     html += "<div class='main-cards'>";
@@ -1638,844 +1885,85 @@ void handleInventory() {
     html += "<div id='content' style='display:none'></div>";
 
     // JavaScript
-    html += "<script>";
-    html += "let editingCategory=-1;";
-    html += "let editingIndex=-1;";
-    html += "let editingIsConsumable=false;";
-    html += "function closeEditModal(){";
-    html += "let modal=document.getElementById('editModal');";
-    html += "if(modal){modal.remove();return;}";
-    html += "modal=document.querySelector('[style*=\"position:fixed\"]');";
-    html += "if(modal)modal.remove();}";
-    
-    html += "function closeAddModal(){";
-    html += "let modal=document.getElementById('addModal');";
-    html += "if(modal){modal.remove();return;}";
-    html += "modal=document.querySelector('[style*=\"position:fixed\"]');";
-    html += "if(modal)modal.remove();}";
-    
-    html += "function deleteItemFromModal(){";
-    html += "if(confirm('Delete this item? This cannot be undone.')){";
-    html += "fetch('/inventory/remove?cat='+editingCategory+'&item='+editingIndex).then(r=>{";
-    html += "if(r.ok){closeEditModal();";
-    html += "let currentTab=document.querySelector('.tab.active');";
-    html += "let tabIndex=Array.from(currentTab.parentNode.children).indexOf(currentTab);";
-    html += "setTimeout(()=>showTab(tabIndex),100);}else{alert('Delete failed');}});}}";
-    
-    html += "function saveItemEdit(){";
-    html += "let name=document.getElementById('edit-name').value.trim();";
-    html += "let newCategory=parseInt(document.getElementById('edit-category').value);";
-    html += "if(!name){alert('Name cannot be empty');return;}";
-    html += "if(editingIsConsumable){";
-    html += "let trailer=document.getElementById('edit-trailer').value==='true';";
-    html += "if(newCategory!==editingCategory){";
-    html += "let editParams='cat='+editingCategory+'&item='+editingIndex+'&name='+encodeURIComponent(name)+'&livesInTrailer='+(trailer?'true':'false');";
-    html += "fetch('/inventory/edit-consumable?'+editParams).then(r=>{";
-    html += "if(r.ok){let moveParams='cat='+editingCategory+'&item='+editingIndex+'&target='+newCategory;return fetch('/inventory/move-item',{method:'POST',headers:{'Content-Type':'application/x-www-form-urlencoded'},body:moveParams});}else{throw new Error('Edit failed');}";
-    html += "}).then(r=>{if(r.ok){closeEditModal();let currentTab=document.querySelector('.tab.active');let tabIndex=Array.from(currentTab.parentNode.children).indexOf(currentTab);setTimeout(()=>showTab(tabIndex),100);}else{alert('Error moving item to new category');}}).catch(e=>{alert('Error: '+e.message);});";
-    html += "}else{";
-    html += "let params='cat='+editingCategory+'&item='+editingIndex+'&name='+encodeURIComponent(name)+'&livesInTrailer='+(trailer?'true':'false');";
-    html += "fetch('/inventory/edit-consumable?'+params).then(r=>{if(r.ok){closeEditModal();let currentTab=document.querySelector('.tab.active');let tabIndex=Array.from(currentTab.parentNode.children).indexOf(currentTab);setTimeout(()=>showTab(tabIndex),100);}else{alert('Edit failed');}});";
-    html += "}";
-    html += "}else{";
-    html += "if(newCategory!==editingCategory){";
-    html += "let editParams='cat='+editingCategory+'&item='+editingIndex+'&name='+encodeURIComponent(name);";
-    html += "fetch('/inventory/rename?'+editParams).then(r=>{if(r.ok){let moveParams='cat='+editingCategory+'&item='+editingIndex+'&target='+newCategory;return fetch('/inventory/move-item',{method:'POST',headers:{'Content-Type':'application/x-www-form-urlencoded'},body:moveParams});}else{throw new Error('Rename failed');}}).then(r=>{if(r.ok){closeEditModal();let currentTab=document.querySelector('.tab.active');let tabIndex=Array.from(currentTab.parentNode.children).indexOf(currentTab);setTimeout(()=>showTab(tabIndex),100);}else{alert('Error moving item to new category');}}).catch(e=>{alert('Error: '+e.message);});";
-    html += "}else{";
-    html += "let params='cat='+editingCategory+'&item='+editingIndex+'&name='+encodeURIComponent(name);";
-    html += "fetch('/inventory/rename?'+params).then(r=>{if(r.ok){closeEditModal();let currentTab=document.querySelector('.tab.active');let tabIndex=Array.from(currentTab.parentNode.children).indexOf(currentTab);setTimeout(()=>showTab(tabIndex),100);}else{alert('Rename failed');}});";
-    html += "}";
-    html += "}";
-    html += "}";
-    
-    html += "function saveNewConsumable(){";
-    html += "let name=document.getElementById('add-name').value.trim();";
-    html += "let category=parseInt(document.getElementById('add-category').value);";
-    html += "let trailer=document.getElementById('add-trailer').value;";
-    html += "if(!name){alert('Name cannot be empty');return;}";
-    html += "let params='cat='+category+'&name='+encodeURIComponent(name)+'&livesInTrailer='+trailer;";
-    html += "fetch('/inventory/add?'+params).then(async r=>{";
-    html += "if(r.ok){closeAddModal();";
-    html += "let currentTab=document.querySelector('.tab.active');";
-    html += "let tabIndex=Array.from(currentTab.parentNode.children).indexOf(currentTab);";
-    html += "setTimeout(()=>showTab(tabIndex),100);}else{let t=await r.text();alert('Failed to add item: '+t);}});}";
-    
-    html += "function saveNewEquipment(){";
-    html += "let name=document.getElementById('add-name').value.trim();";
-    html += "let category=parseInt(document.getElementById('add-category').value);";
-    html += "if(!name){alert('Name cannot be empty');return;}";
-    html += "let params='cat='+category+'&name='+encodeURIComponent(name);";
-    html += "fetch('/inventory/add?'+params).then(async r=>{";
-    html += "if(r.ok){closeAddModal();";
-    html += "let currentTab=document.querySelector('.tab.active');";
-    html += "let tabIndex=Array.from(currentTab.parentNode.children).indexOf(currentTab);";
-    html += "setTimeout(()=>showTab(tabIndex),100);}else{let t=await r.text();alert('Failed to add item: '+t);}});}";
-    
-    html += "function showAddConsumableModal(){";
-    html += "let modal=document.createElement('div');";
-    html += "modal.id='addModal';";
-    html += "modal.style='position:fixed;top:0;left:0;width:100%;height:100%;background:rgba(0,0,0,0.8);display:flex;align-items:center;justify-content:center;z-index:1000';";
-    html += "let modalContent=document.createElement('div');";
-    html += "modalContent.style='background:#222;padding:20px;border-radius:10px;width:90%;max-width:400px;color:#fff';";
-    html += "modalContent.innerHTML='<h3 style=\"margin:0 0 15px 0\">Add Consumable Item</h3>';";
-    html += "modalContent.innerHTML+='<div style=\"margin-bottom:15px\"><label style=\"display:block;margin-bottom:5px\">Item Name:</label>';";
-    html += "modalContent.innerHTML+='<input type=\"text\" id=\"add-name\" style=\"width:100%;padding:8px;border:1px solid #444;background:#333;color:#fff;border-radius:4px\" placeholder=\"Enter item name\"></div>';";
-    html += "modalContent.innerHTML+='<div style=\"margin-bottom:15px\"><label style=\"display:block;margin-bottom:5px\">Location:</label>';";
-    html += "modalContent.innerHTML+='<select id=\"add-trailer\" style=\"width:100%;padding:8px;border:1px solid #444;background:#333;color:#fff;border-radius:4px\"><option value=\"false\">🛒 Buy Each Trip</option><option value=\"true\">🚚 Lives in Trailer</option></select></div>';";
-    html += "modalContent.innerHTML+='<div style=\"margin-bottom:20px\"><label style=\"display:block;margin-bottom:5px\">Category:</label>';";
-    html += "modalContent.innerHTML+='<select id=\"add-category\" style=\"width:100%;padding:8px;border:1px solid #444;background:#333;color:#fff;border-radius:4px\"></select></div>';";
-    html += "modalContent.innerHTML+='<div style=\"display:flex;gap:10px;justify-content:flex-end\">';";
-    html += "modalContent.innerHTML+='<button onclick=\"closeAddModal()\" style=\"padding:8px 16px;background:#666;border:none;border-radius:4px;color:#fff;cursor:pointer\">Cancel</button>';";
-    html += "modalContent.innerHTML+='<button onclick=\"saveNewConsumable()\" style=\"padding:8px 16px;background:#22c55e;border:none;border-radius:4px;color:#000;cursor:pointer;font-weight:bold\">Add Item</button>';";
-    html += "modalContent.innerHTML+='</div>';";
-    html += "modal.appendChild(modalContent);";
-    html += "modal.onclick=(e)=>{if(e.target===modal)closeAddModal();};";
-    html += "document.body.appendChild(modal);";
-    html += "document.querySelectorAll('.cat-title').forEach((catEl,idx)=>{";
-    html += "let catText=catEl.textContent.trim();";
-    html += "let countEl=catEl.querySelector('.cat-count');";
-    html += "if(countEl){catText=catText.replace(countEl.textContent,'').trim();}";
-    html += "let option=document.createElement('option');";
-    html += "let parent=catEl.closest('[data-category-index]')||catEl.closest('.c');";
-    html += "let realIdx=(parent && parent.getAttribute('data-category-index')!==null)?parent.getAttribute('data-category-index'):idx;";
-    html += "option.value=realIdx;";
-    html += "option.textContent=catText;";
-    html += "document.getElementById('add-category').appendChild(option);});";
-    html += "document.getElementById('add-name').focus();}";
-    html += "function showAddEquipmentModal(){";
-    html += "let modal=document.createElement('div');";
-    html += "modal.id='addModal';";
-    html += "modal.style='position:fixed;top:0;left:0;width:100%;height:100%;background:rgba(0,0,0,0.8);display:flex;align-items:center;justify-content:center;z-index:1000';";
-    html += "let modalContent=document.createElement('div');";
-    html += "modalContent.style='background:#222;padding:20px;border-radius:10px;width:90%;max-width:400px;color:#fff';";
-    html += "modalContent.innerHTML='<h3 style=\"margin:0 0 15px 0\">Add Equipment Item</h3>';";
-    html += "modalContent.innerHTML+='<div style=\"margin-bottom:15px\"><label style=\"display:block;margin-bottom:5px\">Item Name:</label>';";
-    html += "modalContent.innerHTML+='<input type=\"text\" id=\"add-name\" style=\"width:100%;padding:8px;border:1px solid #444;background:#333;color:#fff;border-radius:4px\" placeholder=\"Enter item name\"></div>';";
-    html += "modalContent.innerHTML+='<div style=\"margin-bottom:20px\"><label style=\"display:block;margin-bottom:5px\">Category:</label>';";
-    html += "modalContent.innerHTML+='<select id=\"add-category\" style=\"width:100%;padding:8px;border:1px solid #444;background:#333;color:#fff;border-radius:4px\"></select></div>';";
-    html += "modalContent.innerHTML+='<div style=\"display:flex;gap:10px;justify-content:flex-end\">';";
-    html += "modalContent.innerHTML+='<button onclick=\"closeAddModal()\" style=\"padding:8px 16px;background:#666;border:none;border-radius:4px;color:#fff;cursor:pointer\">Cancel</button>';";
-    html += "modalContent.innerHTML+='<button onclick=\"saveNewEquipment()\" style=\"padding:8px 16px;background:#22c55e;border:none;border-radius:4px;color:#000;cursor:pointer;font-weight:bold\">Add Item</button>';";
-    html += "modalContent.innerHTML+='</div>';";
-    html += "modal.appendChild(modalContent);";
-    html += "modal.onclick=(e)=>{if(e.target===modal)closeAddModal();};";
-    html += "document.body.appendChild(modal);";
-    html += "document.querySelectorAll('.cat-title').forEach((catEl,idx)=>{";
-    html += "let catText=catEl.textContent.trim();";
-    html += "let countEl=catEl.querySelector('.cat-count');";
-    html += "if(countEl){catText=catText.replace(countEl.textContent,'').trim();}";
-    html += "let option=document.createElement('option');";
-    html += "let parent=catEl.closest('[data-category-index]')||catEl.closest('.c');";
-    html += "let realIdx=(parent && parent.getAttribute('data-category-index')!==null)?parent.getAttribute('data-category-index'):idx;";
-    html += "option.value=realIdx;";
-    html += "option.textContent=catText;";
-    html += "document.getElementById('add-category').appendChild(option);});";
-    html += "document.getElementById('add-name').focus();}";
-    html += "function showAddCategoryDialog(isConsumable){";
-    html += "let modal=document.createElement('div');";
-    html += "modal.id='addCategoryModal';";
-    html += "modal.style='position:fixed;top:0;left:0;width:100%;height:100%;background:rgba(0,0,0,0.8);display:flex;align-items:center;justify-content:center;z-index:1000';";
-    html += "let modalContent=document.createElement('div');";
-    html += "modalContent.style='background:#222;padding:20px;border-radius:10px;width:90%;max-width:400px;color:#fff';";
-    html += "let typeLabel=isConsumable?'Consumable':'Equipment';";
-    html += "modalContent.innerHTML='<h3 style=\"margin:0 0 15px 0\">Add '+typeLabel+' Category</h3>';";
-    html += "modalContent.innerHTML+='<div style=\"margin-bottom:15px\"><label style=\"display:block;margin-bottom:5px\">Category Name:</label>';";
-    html += "modalContent.innerHTML+='<input type=\"text\" id=\"category-name\" style=\"width:100%;padding:8px;border:1px solid #444;background:#333;color:#fff;border-radius:4px\" placeholder=\"Enter category name\"></div>';";
-    html += "modalContent.innerHTML+='<div style=\"margin-bottom:15px\"><label style=\"display:block;margin-bottom:5px\">Icon:</label>';";
-    html += "modalContent.innerHTML+='<input type=\"text\" id=\"category-icon\" style=\"width:100%;padding:8px;border:1px solid #444;background:#333;color:#fff;border-radius:4px\" placeholder=\"📦\" value=\"📦\"></div>';";
-    html += "if(!isConsumable){";
-    html += "modalContent.innerHTML+='<div style=\"margin-bottom:20px\"><label style=\"display:block;margin-bottom:5px\">Trailer Category:</label>';";
-    html += "modalContent.innerHTML+='<select id=\"category-subtype\" style=\"width:100%;padding:8px;border:1px solid #444;background:#333;color:#fff;border-radius:4px\">';";
-    html += "modalContent.innerHTML+='<option value=\"trailer\">🚚 TRAILER - Always packed items</option>';";
-    html += "modalContent.innerHTML+='<option value=\"essentials\">⭐ ESSENTIALS - Must pack every trip</option>';";
-    html += "modalContent.innerHTML+='<option value=\"optional\">🎒 OPTIONAL - Extra items</option>';";
-    html += "modalContent.innerHTML+='</select></div>';}";
-    html += "modalContent.innerHTML+='<div style=\"display:flex;gap:10px;justify-content:flex-end\">';";
-    html += "modalContent.innerHTML+='<button onclick=\"closeAddCategoryModal()\" style=\"padding:8px 16px;background:#666;border:none;border-radius:4px;color:#fff;cursor:pointer\">Cancel</button>';";
-    html += "modalContent.innerHTML+='<button onclick=\"saveNewCategory('+isConsumable+')\" style=\"padding:8px 16px;background:#22c55e;border:none;border-radius:4px;color:#000;cursor:pointer;font-weight:bold\">Add Category</button>';";
-    html += "modalContent.innerHTML+='</div>';";
-    html += "modal.appendChild(modalContent);";
-    html += "modal.onclick=(e)=>{if(e.target===modal)closeAddCategoryModal();};";
-    html += "document.body.appendChild(modal);";
-    html += "document.getElementById('category-name').focus();}";
-
-    html += "function closeAddCategoryModal(){";
-    html += "let modal=document.getElementById('addCategoryModal');";
-    html += "if(modal)modal.remove();}";
-
-    html += "function saveNewCategory(isConsumable){";
-    html += "let name=document.getElementById('category-name').value.trim();";
-    html += "let icon=document.getElementById('category-icon').value.trim();";
-    html += "if(!name){alert('Category name cannot be empty');return;}";
-    html += "if(!icon)icon='📦';";
-    html += "if(name.length>50){alert('Category name too long (max 50 chars)');return;}";
-    html += "if(icon.length>10){alert('Icon too long (max 10 chars)');return;}";
-    html += "let type=isConsumable?'consumable':'equipment';";
-    html += "let url='/inventory/add-category?name='+encodeURIComponent(name)+'&type='+type+'&icon='+encodeURIComponent(icon);";
-    html += "if(!isConsumable){";
-    html += "let subcategory=document.getElementById('category-subtype').value;";
-    html += "url+='&subcategory='+subcategory;}";
-    html += "fetch(url).then(r=>{if(r.ok){closeAddCategoryModal();alert('✅ Category \"'+name+'\" created!');let currentTab=document.querySelector('.tab.active');let tabIndex=Array.from(currentTab.parentNode.children).indexOf(currentTab);loadTabContent(tabIndex);}";
-    html += "else{r.text().then(msg=>{closeAddCategoryModal();alert('❌ Error: '+msg);});}});}"; 
-    html += "function showTab(n){";
-    html += "document.querySelectorAll('.tab').forEach((t,i)=>t.classList.toggle('active',i==n));";
-    html += "let mainTab=document.getElementById('tab0');";
-    html += "let dynamicContent=document.getElementById('content');";
-    html += "if(n==0){";
-    html += "mainTab.style.display='block';";
-    html += "dynamicContent.style.display='none';";
-    html += "}else{";
-    html += "mainTab.style.display='none';";
-    html += "dynamicContent.style.display='block';";
-    html += "dynamicContent.classList.add('no-transition');";
-    html += "fetch('/inventory?tab='+n).then(r=>r.text()).then(html=>{";
-    html += "dynamicContent.innerHTML=html;";
-    html += "setTimeout(()=>{dynamicContent.classList.remove('no-transition');},50);";
-    html += "if(n==5)refreshShoppingList();});";
-    html += "}}";
-    html += "function loadTabContent(tab){showTab(tab);}";
-    html += "function toggleCat(id){";
-    html += "let el=document.getElementById('cat'+id);";
-    html += "let hdr=el.previousElementSibling;";
-    html += "let icon=hdr.querySelector('.expand-icon');";
-    html += "if(el.classList.contains('expanded')){";
-    html += "el.classList.remove('expanded');el.classList.add('collapsed');";
-    html += "icon.innerHTML='\\u25B6';}";
-    html += "else{el.classList.remove('collapsed');el.classList.add('expanded');";
-    html += "icon.innerHTML='\\u25BC';}}";
-
-    html += "function collapseAll(){";
-    html += "document.querySelectorAll('.items-container').forEach(el=>{";
-    html += "el.classList.remove('expanded');el.classList.add('collapsed');";
-    html += "let hdr=el.previousElementSibling;";
-    html += "let icon=hdr.querySelector('.expand-icon');";
-    html += "if(icon)icon.innerHTML='\\u25B6';});}";
-
-    html += "function expandAll(){";
-    html += "document.querySelectorAll('.items-container').forEach(el=>{";
-    html += "el.classList.remove('collapsed');el.classList.add('expanded');";
-    html += "let hdr=el.previousElementSibling;";
-    html += "let icon=hdr.querySelector('.expand-icon');";
-    html += "if(icon)icon.innerHTML='\\u25BC';});}";
-
-    html += "function setStatus(cat,item,status){";
-    html += "fetch('/inventory/set?cat='+cat+'&item='+item+'&status='+status).then(r=>r.ok?updateUI(cat,item,status):alert('Failed'));}";
-
-    html += "function updateUI(cat,item,status){";
-    html += "let container=document.getElementById('cat'+cat);";
-    html += "let items=container.querySelectorAll('.item');";
-    html += "items[item].setAttribute('data-status',status);";
-    html += "let btns=items[item].querySelectorAll('.status-btn');";
-    html += "btns.forEach((b,i)=>b.classList.toggle('active',i==status));";
-    html += "updateConsumableTiles();}";
-
-    html += "function updateConsumableTiles(){";
-    html += "updateSummary();updateFilteredTileCounts();applyAllFilters();}";
-
-    html += "function updateSummary(){";
-    html += "fetch('/inventory/stats').then(r=>r.json()).then(d=>{";
-    html += "document.querySelectorAll('.summary-card .value')[0].textContent=d.full;";
-    html += "document.querySelectorAll('.summary-card .value')[1].textContent=d.low;";
-    html += "document.querySelectorAll('.summary-card .value')[2].textContent=d.out;";
-    html += "});}";
-
-    html += "function setCheck(cat,item,type,val){";
-    html += "fetch('/inventory/check?cat='+cat+'&item='+item+'&type='+type+'&val='+(val?1:0));}";
-
-    html += "function toggleEquipmentStatus(cat,item,statusType,tab){";
-    html += "let container=document.getElementById('cat'+cat);";
-    html += "if(!container)return;";
-    html += "let items=container.querySelectorAll('.item');";
-    html += "if(!items[item])return;";
-    html += "let btn=items[item].querySelector('.status-btn.'+statusType);";
-    html += "if(!btn||btn.classList.contains('disabled'))return;";
-    html += "let isActive=btn.classList.contains('active');";
-    html += "let newVal=!isActive;";
-    html += "btn.classList.toggle('active',newVal);";
-    html += "if(statusType=='taking'){";
-    html += "let checkedBtn=items[item].querySelector('.status-btn.checked');";
-    html += "let packedBtn=items[item].querySelector('.status-btn.packed');";
-    html += "if(newVal){";
-    html += "checkedBtn.classList.remove('disabled');";
-    html += "packedBtn.classList.remove('disabled');";
-    html += "}else{";
-    html += "checkedBtn.classList.add('disabled');";
-    html += "checkedBtn.classList.remove('active');";
-    html += "packedBtn.classList.add('disabled');";
-    html += "packedBtn.classList.remove('active');";
-    html += "fetch('/inventory/check?cat='+cat+'&item='+item+'&type=0&val=0');";
-    html += "fetch('/inventory/check?cat='+cat+'&item='+item+'&type=1&val=0');";
-    html += "}";
-    html += "fetch('/inventory/check?cat='+cat+'&item='+item+'&type=2&val='+(newVal?1:0));";
-    html += "}else{";
-    html += "let typeNum=(statusType=='checked')?0:1;";
-    html += "fetch('/inventory/check?cat='+cat+'&item='+item+'&type='+typeNum+'&val='+(newVal?1:0));";
-    html += "}";
-    html += "updateEquipmentTiles(tab);";
-    html += "}";
-
-    html += "function updateEquipmentTiles(tabNum){";
-    html += "setTimeout(()=>showTab(tabNum),100);";
-    html += "}";
-
-    html += "function toggleTaking(cat,item,val){";
-    html += "fetch('/inventory/check?cat='+cat+'&item='+item+'&type=2&val='+(val?1:0)).then(()=>{";
-    html += "if(!val){";
-    html += "fetch('/inventory/check?cat='+cat+'&item='+item+'&type=0&val=0');";
-    html += "fetch('/inventory/check?cat='+cat+'&item='+item+'&type=1&val=0');}";
-    html += "setTimeout(()=>showTab(4),200);});}";
-
-    html += "function clearAllEssentials(){";
-    html += "if(!confirm('Clear all Taking, Checked, and Packed for Essentials?'))return;";
-    html += "fetch('/inventory/clearall?type=essentials').then(r=>{";
-    html += "if(r.ok){setTimeout(()=>showTab(3),100);}else{alert('Clear failed');}});}";
-
-    html += "function clearAllOptional(){";
-    html += "if(!confirm('Clear all Taking, Checked, and Packed for Optional items?'))return;";
-    html += "fetch('/inventory/clearall?type=optional').then(r=>{";
-    html += "if(r.ok){setTimeout(()=>showTab(4),100);}else{alert('Clear failed');}});}";
-
-    html += "function clearAllTrailer(){";
-    html += "if(!confirm('Clear all Checked and Packed for Trailer items?'))return;";
-    html += "fetch('/inventory/clearall?type=trailer').then(r=>{";
-    html += "if(r.ok){setTimeout(()=>showTab(2),100);}else{alert('Clear failed');}});}";
-
-    html += "function clearAllConsumables(){";
-    html += "let filteredCount=document.querySelectorAll('.inv-category .item:not([style*=\"display: none\"])').length;";
-    html += "let totalCount=document.querySelectorAll('.inv-category .item').length;";
-    html += "let filterText=filteredCount===totalCount?'all consumables':'visible filtered items ('+filteredCount+' of '+totalCount+')';";
-    html += "if(!confirm('Set '+filterText+' to OUT status for stocktaking?'))return;";
-    html += "let visibleItems=[];";
-    html += "document.querySelectorAll('.inv-category .item:not([style*=\"display: none\"])').forEach(item=>{";
-    html += "let catIndex=item.closest('.inv-category').getAttribute('data-category-index');";
-    html += "let itemIndex=item.getAttribute('data-item-index');";
-    html += "if(catIndex!==null&&itemIndex!==null)visibleItems.push({cat:catIndex,item:itemIndex});});";
-    html += "if(visibleItems.length===0){alert('No visible items to clear');return;}";
-    html += "let payload=JSON.stringify({items:visibleItems});";
-    html += "console.log('Sending clear payload:',payload);";
-    html += "fetch('/inventory/clearall?type=consumables',{method:'POST',headers:{'Content-Type':'application/json'},body:payload}).then(r=>{";
-    html += "console.log('Clear response:',r.status,r.ok);";
-    html += "if(r.ok){let currentTab=document.querySelector('.tab.active');let tabIndex=Array.from(currentTab.parentNode.children).indexOf(currentTab);setTimeout(()=>showTab(tabIndex),100);}else{alert('Clear failed');}});}";
-
-    html += "function saveInventory(){";
-    html += "fetch('/inventory/save').then(r=>{if(r.ok){";
-    html += "window.scrollTo({top:0,behavior:'smooth'});";
-    html += "updateSummary();";
-    html += "alert('\u{2713} Saved!');}else{alert('Save failed');}});}";
-
-    html += "function setCheckWithUpdate(cat,item,type,val,tabNum){";
-    html += "fetch('/inventory/check?cat='+cat+'&item='+item+'&type='+type+'&val='+(val?1:0)).then(()=>{";
-    html += "setTimeout(()=>{updateSummary();updateFilteredTileCounts();applyAllFilters();},100);});}";
-
-    html += "function showItemOptions(cat,item,name,isConsumable,currentTrailer){";
-    html += "let action=prompt('Choose action for \"'+name+'\":\\n\\n1 - Edit Item\\n2 - Delete\\n3 - Move to different category\\n\\nEnter 1, 2, or 3:');";
-    html += "if(action==='1'){";
-    html += "editItem(cat,item,isConsumable,name,currentTrailer);";
-    html += "}";
-    html += "else if(action==='2'){";
-    html += "if(confirm('Delete \"'+name+'\"?')){";
-    html += "fetch('/inventory/delete?cat='+cat+'&item='+item).then(r=>{";
-    html += "if(r.ok){let currentTab=document.querySelector('.tab.active');let tabIndex=Array.from(currentTab.parentNode.children).indexOf(currentTab);setTimeout(()=>showTab(tabIndex),100);}else{alert('Delete failed');}});}}";
-    html += "else if(action==='3'){";
-    html += "let categories=[];";
-    html += "document.querySelectorAll('.cat-title').forEach((el,idx)=>{";
-    html += "categories.push(idx+' - '+el.textContent.trim());});";
-    html += "let catList=categories.join('\\n');";
-    html += "let newCat=prompt('Select target category:\\n\\n'+catList+'\\n\\nEnter category number:');";
-    html += "if(newCat&&newCat!==String(cat)){";
-    html += "fetch('/inventory/move?cat='+cat+'&item='+item+'&target='+newCat).then(r=>{";
-    html += "if(r.ok){let currentTab=document.querySelector('.tab.active');let tabIndex=Array.from(currentTab.parentNode.children).indexOf(currentTab);setTimeout(()=>showTab(tabIndex),100);}else{alert('Move failed');}});}}";
-    html += "}";
+    html += "<script src='" ASSET_URL_INVENTORY_JS "'></script>";
+    if (!wallClock.synced()) html += CLOCK_SYNC_SCRIPT;
+    html += "</body></html>";
+    server.send(200, "text/html", html);
+}
 
-    html += "function showCategoryOptions(cat,name){";
-    html += "let action=prompt('Choose action for category \"'+name+'\":\\n\\n1 - Rename Category\\n2 - Delete Category\\n\\nEnter 1 or 2:');";
-    html += "if(action==='1'){";
-    html += "let newName=prompt('Enter new category name:',name);";
-    html += "if(newName&&newName!==name){";
-    html += "fetch('/inventory/renamecat?cat='+cat+'&name='+encodeURIComponent(newName)).then(r=>{";
-    html += "if(r.ok){let currentTab=document.querySelector('.tab.active');let tabIndex=Array.from(currentTab.parentNode.children).indexOf(currentTab);setTimeout(()=>showTab(tabIndex),100);}else{alert('Rename failed');}});}}";
-    html += "else if(action==='2'){";
-    html += "if(confirm('Delete category \"'+name+'\" and ALL its items?\\n\\nThis cannot be undone!')){";
-    html += "fetch('/inventory/deletecat?cat='+cat).then(r=>{";
-    html += "if(r.ok){let currentTab=document.querySelector('.tab.active');let tabIndex=Array.from(currentTab.parentNode.children).indexOf(currentTab);setTimeout(()=>showTab(tabIndex),100);}else{alert('Delete failed');}});}}";
-    html += "}";
+// Item an inventory request refers to: `id=` (stable item ID) or the older
+// positional `cat=`&`item=`. False if neither is given; an unknown ID yields
+// cat = item = -1 so the caller's range checks reject it.
+bool inventoryItemArg(int& cat, int& item) {
+    if (server.hasArg("id")) {
+        if (!inventoryIndex.find(server.arg("id").toInt(), cat, item)) cat = item = -1;
+        return true;
+    }
+    if (!server.hasArg("cat") || !server.hasArg("item")) return false;
+    cat = server.arg("cat").toInt();
+    item = server.arg("item").toInt();
+    return true;
+}
 
-    html += "function showAddItemDialog(subcategory){";
-    html += "let name=prompt('Enter new item name:');";
-    html += "if(!name)return;";
-    html += "let categoryNum=prompt('Enter category number (0-' + (document.querySelectorAll('.c').length-1) + '):');";
-    html += "if(categoryNum===null)return;";
-    html += "let livesInTrailer='';";
-    html += "if(subcategory==0){";
-    html += "livesInTrailer=confirm('Does this item live in the trailer?\\n\\nYES = Stays in trailer (🚚)\\nNO = Buy each trip (🛒)')?'true':'false';";
-    html += "}";
-    html += "fetch('/inventory/additem?cat=' + categoryNum + '&name=' + encodeURIComponent(name) + '&subcategory=' + subcategory + '&livesInTrailer=' + livesInTrailer)";
-    html += ".then(async r=>{if(r.ok){let currentTab=document.querySelector('.tab.active');let tabIndex=Array.from(currentTab.parentNode.children).indexOf(currentTab);loadTabContent(tabIndex);}else{let t=await r.text();alert('Add failed: '+t);}});}";
-
-    html += "let activeFilter=-1;";
-    html += "let activeEquipmentFilter=-1;";
-    html += "let activeTrailerFilter=-1;";
-    html += "function filterStatus(status){";
-    html += "if(activeFilter==status){activeFilter=-1;status=-1;}else{activeFilter=status;}";
-    html += "document.querySelectorAll('.inv-category .item').forEach(item=>{";
-    html += "let itemStatus=parseInt(item.getAttribute('data-status'));";
-    html += "item.style.display=(status==-1||itemStatus==status)?'flex':'none';});";
-    html += "updateFilteredTileCounts();}";
-
-    html += "function filterTrailer(trailerStatus){";
-    html += "if(activeTrailerFilter==trailerStatus){activeTrailerFilter=-1;trailerStatus=-1;}else{activeTrailerFilter=trailerStatus;}";
-    html += "document.querySelectorAll('.inv-category .item').forEach(item=>{";
-    html += "let itemTrailer=parseInt(item.getAttribute('data-trailer'));";
-    html += "let shouldShow=true;";
-    html += "if(trailerStatus==-1)shouldShow=true;";
-    html += "else if(trailerStatus==1)shouldShow=(itemTrailer==1);";
-    html += "else if(trailerStatus==0)shouldShow=(itemTrailer==0);";
-    html += "item.style.display=shouldShow?'flex':'none';});";
-    html += "updateFilteredTileCounts();}";
-
-    html += "function updateFilteredTileCounts(){";
-    html += "let okCount=0,lowCount=0,outCount=0;";
-    html += "document.querySelectorAll('.inv-category .item').forEach(item=>{";
-    html += "if(item.style.display!=='none'){";
-    html += "let status=parseInt(item.getAttribute('data-status'));";
-    html += "if(status<=0)okCount++;";
-    html += "else if(status==1)lowCount++;";
-    html += "else if(status==2)outCount++;}});";
-    html += "let cards=document.querySelectorAll('.summary-card .value');";
-    html += "if(cards[0])cards[0].textContent=okCount;";
-    html += "if(cards[1])cards[1].textContent=lowCount;";
-    html += "if(cards[2])cards[2].textContent=outCount;}";
-
-    html += "let currentLocationFilter='all';";
-    html += "let currentStatusFilter='all';";
-
-    html += "function applyLocationFilter(filter){";
-    html += "currentLocationFilter=filter;";
-    html += "document.querySelectorAll('#loc-all,#loc-trailer,#loc-trip').forEach(btn=>btn.classList.remove('active'));";
-    html += "document.getElementById('loc-'+filter).classList.add('active');";
-    html += "applyAllFilters();}";
-
-    html += "function applyStatusFilter(filter){";
-    html += "currentStatusFilter=filter;";
-    html += "document.querySelectorAll('#status-all,#status-ok,#status-low,#status-out').forEach(btn=>btn.classList.remove('active'));";
-    html += "document.getElementById('status-'+filter).classList.add('active');";
-    html += "applyAllFilters();}";
-
-    html += "function applyAllFilters(){";
-    html += "document.querySelectorAll('.inv-category .item').forEach(item=>{";
-    html += "let shouldShow=true;";
-    html += "if(currentLocationFilter!=='all'){";
-    html += "let itemTrailer=parseInt(item.getAttribute('data-trailer'));";
-    html += "if(currentLocationFilter==='trailer'&&itemTrailer!==1)shouldShow=false;";
-    html += "if(currentLocationFilter==='trip'&&itemTrailer!==0)shouldShow=false;}";
-    html += "if(currentStatusFilter!=='all'&&shouldShow){";
-    html += "let itemStatus=parseInt(item.getAttribute('data-status'));";
-    html += "if(currentStatusFilter==='ok'&&itemStatus>0)shouldShow=false;";
-    html += "if(currentStatusFilter==='low'&&itemStatus!==1)shouldShow=false;";
-    html += "if(currentStatusFilter==='out'&&itemStatus!==2)shouldShow=false;}";
-    html += "item.style.display=shouldShow?'flex':'none';});";
-    html += "updateFilteredTileCounts();}";
-
-    html += "function clearAllFilters(){";
-    html += "currentLocationFilter='all';";
-    html += "currentStatusFilter='all';";
-    html += "document.querySelectorAll('.filter-btn').forEach(btn=>btn.classList.remove('active'));";
-    html += "document.getElementById('loc-all').classList.add('active');";
-    html += "document.getElementById('status-all').classList.add('active');";
-    html += "applyAllFilters();}";
-
-    html += "function filterEquipment(type,showCompleted){";
-    html += "if(activeEquipmentFilter==type){activeEquipmentFilter=-1;type=-1;}else{activeEquipmentFilter=type;}";
-    html += "document.querySelectorAll('.items-container').forEach(container=>{";
-    html += "container.querySelectorAll('.item').forEach(item=>{";
-    html += "let shouldShow=true;";
-    html += "if(type==-1){shouldShow=true;}";
-    html += "else if(type==0){";
-    html += "let checkedBtn=item.querySelector('.status-btn.checked');";
-    html += "let takingBtn=item.querySelector('.status-btn.taking');";
-    html += "if(takingBtn){shouldShow=takingBtn.classList.contains('active')&&!checkedBtn.classList.contains('active');}";
-    html += "else{shouldShow=!checkedBtn.classList.contains('active');}}";
-    html += "else if(type==1){";
-    html += "let packedBtn=item.querySelector('.status-btn.packed');";
-    html += "let takingBtn=item.querySelector('.status-btn.taking');";
-    html += "if(takingBtn){shouldShow=takingBtn.classList.contains('active')&&!packedBtn.classList.contains('active');}";
-    html += "else{shouldShow=!packedBtn.classList.contains('active');}}";
-    html += "else if(type==2){";
-    html += "let takingBtn=item.querySelector('.status-btn.taking');";
-    html += "shouldShow=takingBtn?takingBtn.classList.contains('active'):false;}";
-    html += "item.style.display=shouldShow?'flex':'none';});});}";
-
-    html += "function resetAll(){";
-    html += "let filteredCount=document.querySelectorAll('.inv-category .item:not([style*=\"display: none\"])').length;";
-    html += "let totalCount=document.querySelectorAll('.inv-category .item').length;";
-    html += "let filterText=filteredCount===totalCount?'ALL consumable items':'visible filtered items ('+filteredCount+' of '+totalCount+')';";
-    html += "if(!confirm('Reset '+filterText+' to Full? This cannot be undone.'))return;";
-    html += "let visibleItems=[];";
-    html += "document.querySelectorAll('.inv-category .item:not([style*=\"display: none\"])').forEach(item=>{";
-    html += "let catIndex=item.closest('.inv-category').getAttribute('data-category-index');";
-    html += "let itemIndex=item.getAttribute('data-item-index');";
-    html += "if(catIndex!==null&&itemIndex!==null)visibleItems.push({cat:catIndex,item:itemIndex});});";
-    html += "if(visibleItems.length===0){alert('No visible items to reset');return;}";
-    html += "let payload=JSON.stringify({items:visibleItems});";
-    html += "console.log('Sending reset payload:',payload);";
-    html += "fetch('/inventory/resetall',{method:'POST',headers:{'Content-Type':'application/json'},body:payload}).then(r=>{";
-    html += "console.log('Reset response:',r.status,r.ok);";
-    html += "if(r.ok){let currentTab=document.querySelector('.tab.active');let tabIndex=Array.from(currentTab.parentNode.children).indexOf(currentTab);setTimeout(()=>showTab(tabIndex),100);}else{alert('Reset failed');}});}";
-
-    html += "let shoppingLocationFilter='all';";
-    html += "let shoppingStatusFilter='all';";
-    
-    html += "function applyShoppingLocationFilter(filter){";
-    html += "shoppingLocationFilter=filter;";
-    html += "document.querySelectorAll('[id^=\"shop-loc-\"]').forEach(btn=>btn.classList.remove('active'));";
-    html += "document.getElementById('shop-loc-'+filter).classList.add('active');";
-    html += "applyAllShoppingFilters();}";
-    
-    html += "function applyShoppingStatusFilter(filter){";
-    html += "shoppingStatusFilter=filter;";
-    html += "document.querySelectorAll('[id^=\"shop-status-\"]').forEach(btn=>btn.classList.remove('active'));";
-    html += "document.getElementById('shop-status-'+filter).classList.add('active');";
-    html += "applyAllShoppingFilters();}";
-    
-    html += "function applyAllShoppingFilters(){";
-    html += "document.querySelectorAll('.shop-item').forEach(item=>{";
-    html += "let trailerAttr=item.getAttribute('data-trailer');";
-    html += "let statusAttr=item.getAttribute('data-status');";
-    html += "console.log('Item status attr:',statusAttr,'trailer:',trailerAttr);";
-    html += "let locationMatch=shoppingLocationFilter=='all'||(shoppingLocationFilter=='trailer'&&trailerAttr=='true')||(shoppingLocationFilter=='trip'&&trailerAttr=='false');";
-    html += "let statusMatch=shoppingStatusFilter=='all'||(shoppingStatusFilter=='low'&&statusAttr=='1')||(shoppingStatusFilter=='out'&&statusAttr=='2');";
-    html += "item.style.display=(locationMatch&&statusMatch)?'flex':'none';});";
-    html += "updateShoppingTileCounts();}";
-    
-    html += "function updateShoppingTileCounts(){";
-    html += "let visibleLow=0,visibleOut=0;";
-    html += "document.querySelectorAll('.shop-item').forEach(item=>{";
-    html += "if(item.style.display=='none')return;";
-    html += "let status=parseInt(item.getAttribute('data-status'));";
-    html += "if(status==1)visibleLow++;";
-    html += "else if(status==2)visibleOut++;});";
-    html += "let countEl=document.getElementById('shop-count');";
-    html += "if(countEl){";
-    html += "let html='';";
-    html += "if(visibleOut>0){html+='<span style=\"color:#ef4444\">'+visibleOut+' OUT</span>';}";
-    html += "if(visibleLow>0){if(html)html+=' + ';html+='<span style=\"color:#f59e0b\">'+visibleLow+' LOW</span>';}";
-    html += "if(visibleOut==0&&visibleLow==0)html='0 items';";
-    html += "countEl.innerHTML=html;}}";
-
-    html += "function filterShoppingTrailer(mode){";
-    html += "document.querySelectorAll('.shop-item').forEach(item=>{";
-    html += "let trailerAttr=item.getAttribute('data-trailer');";
-    html += "let shouldShow=mode=='all'||(mode=='trailer'&&trailerAttr=='true')||(mode=='trip'&&trailerAttr=='false');";
-    html += "item.style.display=shouldShow?'flex':'none';});";
-    html += "document.querySelectorAll('[id^=\"shopping-filter-\"]').forEach(btn=>btn.style.background='rgba(255,255,255,0.1)');";
-    html += "document.getElementById('shopping-filter-'+mode).style.background='rgba(255,255,255,0.3)';";
-    html += "updateShoppingTileCounts();}";
-
-    html += "function selectItems(mode){";
-    html += "let checkboxes=document.querySelectorAll('.shop-check');";
-    html += "let visibleCount=0,selectedCount=0;";
-    html += "checkboxes.forEach(cb=>{";
-    html += "let item=cb.closest('.shop-item');";
-    html += "if(!item)return;";
-    html += "if(item.style.display=='none'){cb.checked=false;return;}";
-    html += "visibleCount++;";
-    html += "let status=parseInt(item.getAttribute('data-status'));";
-    html += "let trailerAttr=item.getAttribute('data-trailer')||'false';";
-    html += "let isTrailer=(trailerAttr=='true');";
-    html += "console.log('SelectItems mode:'+mode+', status:'+status+', checking: low='+(status==1)+', out='+(status==2));";
-    html += "let shouldSelect=false;";
-    html += "if(mode=='all'){shouldSelect=true;}";
-    html += "else if(mode=='none'){shouldSelect=false;}";
-    html += "else if(mode=='out'){shouldSelect=(status==2);}";
-    html += "else if(mode=='low'){shouldSelect=(status==1);}";
-    html += "else if(mode=='trailer'){shouldSelect=isTrailer;}";
-    html += "else if(mode=='trip'){shouldSelect=!isTrailer;}";
-    html += "cb.checked=shouldSelect;";
-    html += "if(shouldSelect)selectedCount++;});}";
-
-    html += "function markRestocked(){";
-    html += "let selected=[];";
-    html += "document.querySelectorAll('.shop-check:checked').forEach(cb=>{";
-    html += "let item=cb.closest('.shop-item');";
-    html += "selected.push({cat:item.getAttribute('data-cat'),item:item.getAttribute('data-item')});});";
-    html += "if(selected.length==0){alert('Please select items to restock');return;}";
-    html += "if(!confirm('Mark '+selected.length+' selected item(s) as Full?'))return;";
-    html += "fetch('/inventory/restock',{method:'POST',headers:{'Content-Type':'application/json'},body:JSON.stringify(selected)})";
-    html += ".then(r=>{if(r.ok){let msg=document.createElement('div');msg.textContent='✅ '+selected.length+' item(s) restocked!';msg.style.cssText='position:fixed;top:20px;right:20px;background:#22c55e;color:white;padding:10px 15px;border-radius:5px;z-index:9999;font-weight:bold';document.body.appendChild(msg);setTimeout(()=>msg.remove(),3000);refreshShoppingList();}else{alert('Restock failed');}});}";
-
-    html += "function copyList(){";
-    html += "let items=[];";
-    html += "document.querySelectorAll('.shop-item').forEach(el=>{";
-    html += "let nameEl=el.querySelector('div>div');";
-    html += "if(nameEl)items.push('\u{2022} '+nameEl.textContent);});";
-    html += "if(items.length==0){alert('No items to copy');return;}";
-    html += "let txt=items.join('\\n');";
-    html += "if(navigator.clipboard&&navigator.clipboard.writeText){";
-    html += "navigator.clipboard.writeText(txt).then(()=>{alert('\u{2713} Copied to clipboard!');},()=>{";
-    html += "prompt('Copy this list:',txt);});}else{prompt('Copy this list:',txt);}}";
-
-    html += "function downloadList(){";
-    html += "window.location.href='/inventory/download';}";
-
-    html += "function copyFilteredList(){";
-    html += "let items=[];";
-    html += "document.querySelectorAll('.shop-item').forEach(el=>{";
-    html += "if(el.style.display=='none')return;";
-    html += "let nameEl=el.querySelector('div>div');";
-    html += "if(nameEl)items.push('\u{2022} '+nameEl.textContent);});";
-    html += "if(items.length==0){alert('No visible items to copy');return;}";
-    html += "let txt=items.join('\\n');";
-    html += "if(navigator.clipboard&&navigator.clipboard.writeText){";
-    html += "navigator.clipboard.writeText(txt).then(()=>{alert('\u{2713} Copied '+items.length+' filtered items to clipboard!');},()=>{";
-    html += "prompt('Copy this filtered list:',txt);});}else{prompt('Copy this filtered list:',txt);}}";
-
-    html += "function markAllFilteredRestocked(){";
-    html += "let visibleItems=[];";
-    html += "document.querySelectorAll('.shop-item').forEach(item=>{";
-    html += "if(item.style.display=='none')return;";
-    html += "visibleItems.push({cat:item.getAttribute('data-cat'),item:item.getAttribute('data-item')});});";
-    html += "if(visibleItems.length==0){alert('No visible items to restock');return;}";
-    html += "let filterText=shoppingLocationFilter=='all'?'':' ('+shoppingLocationFilter+' items)';";
-    html += "filterText+=shoppingStatusFilter=='all'?'':' ('+shoppingStatusFilter+' status)';";
-    html += "if(!confirm('Mark ALL '+visibleItems.length+' visible item(s)'+filterText+' as Full?'))return;";
-    html += "fetch('/inventory/restock',{method:'POST',headers:{'Content-Type':'application/json'},body:JSON.stringify(visibleItems)})";
-    html += ".then(r=>{if(r.ok){let msg=document.createElement('div');msg.textContent='✅ '+visibleItems.length+' filtered item(s) restocked!';msg.style.cssText='position:fixed;top:20px;right:20px;background:#22c55e;color:white;padding:10px 15px;border-radius:5px;z-index:9999;font-weight:bold';document.body.appendChild(msg);setTimeout(()=>msg.remove(),3000);refreshShoppingList();}else{alert('Bulk restock failed');}});}";
-
-    html += "function addItem(cat){";
-    html += "let name=prompt('Enter item name:');";
-    html += "if(!name||name.trim()=='')return;";
-    html += "fetch('/inventory/add?cat='+cat+'&name='+encodeURIComponent(name)).then(r=>{";
-    html += "if(r.ok){let currentTab=document.querySelector('.tab.active');";
-    html += "let tabIndex=Array.from(currentTab.parentNode.children).indexOf(currentTab);";
-    html += "setTimeout(()=>showTab(tabIndex),100);}else{alert('Failed to add item');}});}";
-
-    html += "function editItem(cat,item,isConsumable,currentName,currentTrailer){";
-    html += "editingCategory=cat;";
-    html += "editingIndex=item;";
-    html += "editingIsConsumable=isConsumable;";
-    html += "if(isConsumable){";
-    html += "editingCategory=cat;";
-    html += "editingIndex=item;";
-    html += "let modal=document.createElement('div');";
-    html += "modal.id='editModal';";
-    html += "modal.style='position:fixed;top:0;left:0;width:100%;height:100%;background:rgba(0,0,0,0.8);display:flex;align-items:center;justify-content:center;z-index:1000';";
-    html += "let modalContent=document.createElement('div');";
-    html += "modalContent.style='background:#222;padding:20px;border-radius:10px;width:90%;max-width:400px;color:#fff';";
-    html += "modalContent.innerHTML='<h3 style=\"margin:0 0 15px 0\">Edit Item</h3>';";
-    html += "modalContent.innerHTML+='<div style=\"margin-bottom:15px\"><label style=\"display:block;margin-bottom:5px\">Item Name:</label>';";
-    html += "modalContent.innerHTML+='<input type=\"text\" id=\"edit-name\" style=\"width:100%;padding:8px;border:1px solid #444;background:#333;color:#fff;border-radius:4px\"></div>';";
-    html += "modalContent.innerHTML+='<div style=\"margin-bottom:20px\"><label style=\"display:block;margin-bottom:5px\">Location:</label>';";
-    html += "modalContent.innerHTML+='<select id=\"edit-trailer\" style=\"width:100%;padding:8px;border:1px solid #444;background:#333;color:#fff;border-radius:4px\"></select></div>';";
-    html += "modalContent.innerHTML+='<div style=\"margin-bottom:20px\"><label style=\"display:block;margin-bottom:5px\">Category:</label>';";
-    html += "modalContent.innerHTML+='<select id=\"edit-category\" style=\"width:100%;padding:8px;border:1px solid #444;background:#333;color:#fff;border-radius:4px\"></select></div>';";
-    html += "modalContent.innerHTML+='<div style=\"display:flex;gap:10px;justify-content:flex-end\">';";
-    html += "modalContent.innerHTML+='<button onclick=\"closeEditModal()\" style=\"padding:8px 16px;background:#666;border:none;border-radius:4px;color:#fff;cursor:pointer\">Cancel</button>';";
-    html += "modalContent.innerHTML+='<button onclick=\"deleteItemFromModal()\" style=\"padding:8px 16px;background:#ef4444;border:none;border-radius:4px;color:#fff;cursor:pointer\">Delete Item</button>';";
-    html += "modalContent.innerHTML+='<button onclick=\"saveItemEdit()\" style=\"padding:8px 16px;background:#4af;border:none;border-radius:4px;color:#000;cursor:pointer;font-weight:bold\">Save Changes</button>';";
-    html += "modalContent.innerHTML+='</div>';";
-    html += "modal.appendChild(modalContent);";
-    html += "modal.onclick=(e)=>{if(e.target===modal)closeEditModal();};";
-    html += "document.body.appendChild(modal);";
-    html += "let trailerSelect=document.getElementById('edit-trailer');";
-    html += "trailerSelect.innerHTML='<option value=\"true\">🚚 Lives in Trailer</option><option value=\"false\">🛒 Buy Each Trip</option>';";
-    html += "trailerSelect.value=currentTrailer?'true':'false';";
-    html += "let categorySelect=document.getElementById('edit-category');";
-    html += "categorySelect.innerHTML='';";
-    html += "document.querySelectorAll('.cat-title').forEach((catEl,idx)=>{";
-    html += "let catText=catEl.textContent.trim();";
-    html += "let countEl=catEl.querySelector('.cat-count');";
-    html += "if(countEl){catText=catText.replace(countEl.textContent,'').trim();}";
-    html += "let option=document.createElement('option');";
-    html += "let parent=catEl.closest('[data-category-index]')||catEl.closest('.c');";
-    html += "let realIdx=(parent && parent.getAttribute('data-category-index')!==null)?parent.getAttribute('data-category-index'):idx;";
-    html += "option.value=realIdx;";
-    html += "option.textContent=catText;";
-    // Fixing the undefined 'cat' variable by replacing it with 'editingCategory', which is defined earlier in the code.
-    html += "if(String(realIdx)==String(editingCategory))option.selected=true;";
-    html += "categorySelect.appendChild(option);});";
-    html += "document.getElementById('edit-name').value=currentName;";
-    html += "document.getElementById('edit-name').focus();";
-    html += "}else{";
-    html += "editingCategory=cat;editingIndex=item;editingIsConsumable=false;";
-    html += "let modal=document.createElement('div');";
-    html += "modal.id='editModal';";
-    html += "modal.style='position:fixed;top:0;left:0;width:100%;height:100%;background:rgba(0,0,0,0.8);display:flex;align-items:center;justify-content:center;z-index:1000';";
-    html += "let modalContent=document.createElement('div');";
-    html += "modalContent.style='background:#222;padding:20px;border-radius:10px;width:90%;max-width:400px;color:#fff';";
-    html += "modalContent.innerHTML='<h3 style=\"margin:0 0 15px 0\">Edit Item</h3>';";
-    html += "modalContent.innerHTML+='<div style=\"margin-bottom:15px\"><label style=\"display:block;margin-bottom:5px\">Item Name:</label>';";
-    html += "modalContent.innerHTML+='<input type=\"text\" id=\"edit-name\" style=\"width:100%;padding:8px;border:1px solid #444;background:#333;color:#fff;border-radius:4px\">';";
-    html += "modalContent.innerHTML+='</div>';";
-    html += "modalContent.innerHTML+='<div style=\"margin-bottom:20px\"><label style=\"display:block;margin-bottom:5px\">Category:</label>';";
-    html += "modalContent.innerHTML+='<select id=\"edit-category\" style=\"width:100%;padding:8px;border:1px solid #444;background:#333;color:#fff;border-radius:4px\"></select></div>';";
-    html += "modalContent.innerHTML+='<div style=\"display:flex;gap:10px;justify-content:flex-end\">';";
-    html += "modalContent.innerHTML+='<button onclick=\"closeEditModal()\" style=\"padding:8px 16px;background:#666;border:none;border-radius:4px;color:#fff;cursor:pointer\">Cancel</button>';";
-    html += "modalContent.innerHTML+='<button onclick=\"deleteItemFromModal()\" style=\"padding:8px 16px;background:#ef4444;border:none;border-radius:4px;color:#fff;cursor:pointer\">Delete Item</button>';";
-    html += "modalContent.innerHTML+='<button onclick=\"saveItemEdit()\" style=\"padding:8px 16px;background:#4af;border:none;border-radius:4px;color:#000;cursor:pointer;font-weight:bold\">Save Changes</button>';";
-    html += "modalContent.innerHTML+='</div>';";
-    html += "modal.appendChild(modalContent);";
-    html += "modal.onclick=(e)=>{if(e.target===modal)closeEditModal();};";
-    html += "document.body.appendChild(modal);";
-    html += "let categorySelect=document.getElementById('edit-category');";
-    html += "categorySelect.innerHTML='';";
-    html += "document.querySelectorAll('.cat-title').forEach((catEl,idx)=>{";
-    html += "let catText=catEl.textContent.trim();";
-    html += "let countEl=catEl.querySelector('.cat-count');";
-    html += "if(countEl){catText=catText.replace(countEl.textContent,'').trim();}";
-    html += "let option=document.createElement('option');";
-    html += "let parent=catEl.closest('[data-category-index]')||catEl.closest('.c');";
-    html += "let realIdx=(parent && parent.getAttribute('data-category-index')!==null)?parent.getAttribute('data-category-index'):idx;";
-    html += "option.value=realIdx;";
-    html += "option.textContent=catText;";
-    html += "if(String(realIdx)==String(editingCategory))option.selected=true;";
-    html += "categorySelect.appendChild(option);});";
-    html += "document.getElementById('edit-name').value=currentName;";
-    html += "document.getElementById('edit-name').focus();";
-    html += "}";
+// Same for one entry of a posted item list: {"id":N} or {"cat":C,"item":I}.
+// Values may be numbers or numeric strings (the UI reads them from attributes).
+static int jsonInt(JsonVariant value) {
+    return value.is<const char*>() ? atoi(value.as<const char*>()) : value.as<int>();
+}
 
-    html += "function saveNewConsumable(){";
-    html += "let name=document.getElementById('add-name').value.trim();";
-    html += "let category=parseInt(document.getElementById('add-category').value);";
-    html += "let trailer=document.getElementById('add-trailer').value;";
-    html += "if(!name){alert('Name cannot be empty');return;}";
-    html += "let params='cat='+category+'&name='+encodeURIComponent(name)+'&livesInTrailer='+trailer;";
-    html += "fetch('/inventory/add?'+params).then(async r=>{";
-    html += "if(r.ok){closeAddModal();";
-    html += "let currentTab=document.querySelector('.tab.active');";
-    html += "let tabIndex=Array.from(currentTab.parentNode.children).indexOf(currentTab);";
-    html += "setTimeout(()=>showTab(tabIndex),100);}else{let t=await r.text();alert('Failed to add item: '+t);}});}";
-    
-    html += "function saveNewEquipment(){";
-    html += "let name=document.getElementById('add-name').value.trim();";
-    html += "let category=parseInt(document.getElementById('add-category').value);";
-    html += "if(!name){alert('Name cannot be empty');return;}";
-    html += "let params='cat='+category+'&name='+encodeURIComponent(name);";
-    html += "fetch('/inventory/add?'+params).then(async r=>{";
-    html += "if(r.ok){closeAddModal();";
-    html += "let currentTab=document.querySelector('.tab.active');";
-    html += "let tabIndex=Array.from(currentTab.parentNode.children).indexOf(currentTab);";
-    html += "setTimeout(()=>showTab(tabIndex),100);}else{let t=await r.text();alert('Failed to add item: '+t);}});}";
-
-    html += "function deleteItemFromModal(){";
-    html += "if(confirm('Delete this item? This cannot be undone.')){";
-    html += "fetch('/inventory/remove?cat='+editingCategory+'&item='+editingIndex).then(r=>{";
-    html += "if(r.ok){closeEditModal();";
-    html += "let currentTab=document.querySelector('.tab.active');";
-    html += "let tabIndex=Array.from(currentTab.parentNode.children).indexOf(currentTab);";
-    html += "setTimeout(()=>showTab(tabIndex),100);}else{alert('Delete failed');}});}}";
-    
-    html += "function saveItemEdit(){";
-    html += "let name=document.getElementById('edit-name').value.trim();";
-    html += "let newCategory=parseInt(document.getElementById('edit-category').value);";
-    html += "if(!name){alert('Name cannot be empty');return;}";
-    html += "if(editingIsConsumable){";
-    html += "let trailer=document.getElementById('edit-trailer').value==='true';";
-    html += "if(newCategory!==editingCategory){";
-    html += "let editParams='cat='+editingCategory+'&item='+editingIndex+'&name='+encodeURIComponent(name)+'&livesInTrailer='+(trailer?'true':'false');";
-    html += "fetch('/inventory/edit-consumable?'+editParams).then(r=>{";
-    html += "if(r.ok){let moveParams='cat='+editingCategory+'&item='+editingIndex+'&target='+newCategory;return fetch('/inventory/move-item',{method:'POST',headers:{'Content-Type':'application/x-www-form-urlencoded'},body:moveParams});}else{throw new Error('Edit failed');}";
-    html += "}).then(r=>{if(r.ok){closeEditModal();let currentTab=document.querySelector('.tab.active');let tabIndex=Array.from(currentTab.parentNode.children).indexOf(currentTab);setTimeout(()=>showTab(tabIndex),100);}else{alert('Error moving item to new category');}}).catch(e=>{alert('Error: '+e.message);});";
-    html += "}else{";
-    html += "let params='cat='+editingCategory+'&item='+editingIndex+'&name='+encodeURIComponent(name)+'&livesInTrailer='+(trailer?'true':'false');";
-    html += "fetch('/inventory/edit-consumable?'+params).then(r=>{if(r.ok){closeEditModal();let currentTab=document.querySelector('.tab.active');let tabIndex=Array.from(currentTab.parentNode.children).indexOf(currentTab);setTimeout(()=>showTab(tabIndex),100);}else{alert('Edit failed');}});";
-    html += "}";
-    html += "}else{";
-    html += "if(newCategory!==editingCategory){";
-    html += "let editParams='cat='+editingCategory+'&item='+editingIndex+'&name='+encodeURIComponent(name);";
-    html += "fetch('/inventory/rename?'+editParams).then(r=>{if(r.ok){let moveParams='cat='+editingCategory+'&item='+editingIndex+'&target='+newCategory;return fetch('/inventory/move-item',{method:'POST',headers:{'Content-Type':'application/x-www-form-urlencoded'},body:moveParams});}else{throw new Error('Rename failed');}}).then(r=>{if(r.ok){closeEditModal();let currentTab=document.querySelector('.tab.active');let tabIndex=Array.from(currentTab.parentNode.children).indexOf(currentTab);setTimeout(()=>showTab(tabIndex),100);}else{alert('Error moving item to new category');}}).catch(e=>{alert('Error: '+e.message);});";
-    html += "}else{";
-    html += "let params='cat='+editingCategory+'&item='+editingIndex+'&name='+encodeURIComponent(name);";
-    html += "fetch('/inventory/rename?'+params).then(r=>{if(r.ok){closeEditModal();let currentTab=document.querySelector('.tab.active');let tabIndex=Array.from(currentTab.parentNode.children).indexOf(currentTab);setTimeout(()=>showTab(tabIndex),100);}else{alert('Rename failed');}});";
-    html += "}";
-    html += "}";
-    html += "}";
+bool inventoryItemRef(JsonVariant ref, int& cat, int& item) {
+    if (!ref["id"].isNull()) return inventoryIndex.find(jsonInt(ref["id"]), cat, item);
+    if (ref["cat"].isNull() || ref["item"].isNull()) return false;
+    cat = jsonInt(ref["cat"]);
+    item = jsonInt(ref["item"]);
+    return true;
+}
 
-    html += "function removeItem(cat,item){";
-    html += "if(!confirm('Delete this item? This cannot be undone.'))return;";
-    html += "fetch('/inventory/remove?cat='+cat+'&item='+item).then(r=>{";
-    html += "if(r.ok){let currentTab=document.querySelector('.tab.active');";
-    html += "let tabIndex=Array.from(currentTab.parentNode.children).indexOf(currentTab);";
-    html += "setTimeout(()=>showTab(tabIndex),100);}else{alert('Failed to remove item');}});}";
-
-    html += "function refreshShoppingList(){";
-    html += "fetch('/inventory/shopping').then(r=>r.json()).then(data=>{";
-    html += "let container=document.getElementById('cat99');";
-    html += "let header=document.getElementById('shop-count');";
-    html += "if(data.count==0){";
-    html += "header.innerHTML='0 items';";
-    html += "container.innerHTML='<div class=\"empty\"><h3>\u{2713} All stocked up!</h3><p>No items need purchasing</p></div>';";
-    html += "container.classList.add('expanded');";
-    html += "}else{";
-    html += "let countHTML='';";
-    html += "if(data.outCount>0){countHTML+='<span style=\"color:#ef4444\">'+data.outCount+' OUT</span>';";
-    html += "if(data.lowCount>0)countHTML+=' + ';}";
-    html += "if(data.lowCount>0)countHTML+='<span style=\"color:#f59e0b\">'+data.lowCount+' LOW</span>';";
-    html += "header.innerHTML=countHTML;";
-    html += "let shopHtml='<div style=\"margin-bottom:10px;display:flex;gap:6px;flex-wrap:wrap\">';";
-    html += "shopHtml+='<button onclick=\"selectItems(\\'all\\')\" style=\"padding:6px 12px;background:rgba(255,255,255,0.2);border:none;border-radius:6px;color:#fff;font-size:12px;cursor:pointer\">Select All</button>';";
-    html += "shopHtml+='<button onclick=\"selectItems(\\'out\\')\" style=\"padding:6px 12px;background:rgba(239,68,68,0.3);border:none;border-radius:6px;color:#fff;font-size:12px;cursor:pointer\">Select Out Only</button>';";
-    html += "shopHtml+='<button onclick=\"selectItems(\\'low\\')\" style=\"padding:6px 12px;background:rgba(245,158,11,0.3);border:none;border-radius:6px;color:#fff;font-size:12px;cursor:pointer\">Select Low Only</button>';";
-    html += "shopHtml+='<button onclick=\"selectItems(\\'none\\')\" style=\"padding:6px 12px;background:rgba(255,255,255,0.1);border:none;border-radius:6px;color:#fff;font-size:12px;cursor:pointer\">Deselect All</button></div>';";
-    html += "data.items.forEach(item=>{";
-    html += "let statusClass=item.status==2?'out':'low';";
-    html += "let badge=item.status==2?'OUT':'LOW';";
-    html += "shopHtml+='<div class=\"shop-item '+statusClass+'\" data-cat=\"'+item.cat+'\" data-item=\"'+item.item+'\" data-status=\"'+item.status+'\" data-trailer=\"'+item.livesInTrailer+'\">';";
-    html += "shopHtml+='<input type=\"checkbox\" class=\"shop-check\" style=\"width:18px;height:18px;margin-right:10px;cursor:pointer\">';";
-    html += "shopHtml+='<span style=\"margin-right:8px;font-size:14px\">'+(item.livesInTrailer?'🚚':'🛒')+'</span>';";
-    html += "shopHtml+='<div style=\"flex:1\"><div style=\"font-weight:bold;margin-bottom:2px\">'+item.name+'</div>';";
-    html += "shopHtml+='<div style=\"font-size:13px;opacity:0.8\">'+item.category+'</div></div>';";
-    html += "shopHtml+='<span class=\"badge '+statusClass+'\">'+badge+'</span></div>';});";
-    html += "container.innerHTML=shopHtml;container.classList.add('expanded');";
-    html += "setTimeout(updateShoppingTileCounts,100);}});}";
-
-    // Add Category Dialog Functions
-    html += "function showTab(n){";
-    html += "let type=isConsumable?'consumable':'equipment';";
-    html += "let typeLabel=isConsumable?'Consumable':'Equipment';";
-    html += "let name=prompt('Enter '+typeLabel+' category name:');";
-    html += "if(!name||name.trim()=='')return;";
-    html += "name=name.trim();";
-    html += "let icon=prompt('Enter emoji icon (e.g., 🍝 or 🏕️):','📦');";
-    html += "if(!icon||icon.trim()=='')icon='📦';";
-    html += "icon=icon.trim();";
-    html += "if(name.length>50){alert('Category name too long (max 50 chars)');return;}";
-    html += "if(icon.length>10){alert('Icon too long (max 10 chars)');return;}";
-    html += "let url='/inventory/add-category?name='+encodeURIComponent(name)+'&type='+type+'&icon='+encodeURIComponent(icon);";
-    html += "if(!isConsumable){";
-    html += "let subcategory=prompt('Choose subcategory:\\n\\n1 = TRAILER (always packed)\\n2 = ESSENTIALS (must pack every trip)\\n3 = OPTIONAL (extra items)\\n\\nEnter 1, 2, or 3:');";
-    html += "if(subcategory=='1')subcategory='trailer';";
-    html += "else if(subcategory=='2')subcategory='essentials';";
-    html += "else if(subcategory=='3')subcategory='optional';";
-    html += "else{alert('Invalid selection. Please choose 1, 2, or 3.');return;}";
-    html += "url+='&subcategory='+subcategory;}";
-    html += "fetch(url).then(r=>{if(r.ok){alert('✅ Category \"'+name+'\" created!');let currentTab=document.querySelector('.tab.active');let tabIndex=Array.from(currentTab.parentNode.children).indexOf(currentTab);loadTabContent(tabIndex);}";
-    html += "else{r.text().then(msg=>alert('❌ Error: '+msg));}});}";  
-    html += "}";  // Close showAddCategoryDialog function
-    html += "</script></body></html>";
-    server.send(200, "text/html", html);
+// Set every consumable listed in a posted body to `status`. Accepts a bare
+// array or {"items":[...]}; returns the number of items changed, or -1 if
+// the body is not valid JSON.
+int setListedConsumables(const String& body, ItemStatus status) {
+    JsonDocument doc;
+    if (deserializeJson(doc, body)) return -1;
+    JsonArray refs = doc.is<JsonArray>() ? doc.as<JsonArray>() : doc["items"].as<JsonArray>();
+
+    int changed = 0;
+    for (JsonVariant ref : refs) {
+        int cat, item;
+        if (!inventoryItemRef(ref, cat, item)) continue;
+        if (cat >= 0 && cat < (int)inventory.size() && inventory[cat].isConsumable &&
+            item >= 0 && item < (int)inventory[cat].consumables.size()) {
+            inventoryStats.remove(cat, inventory[cat].consumables[item]);
+            inventory[cat].consumables[item].status = status;
+            inventoryStats.add(cat, inventory[cat].consumables[item]);
+            changed++;
+        }
+    }
+    return changed;
 }
 
 void handleInventorySet() {
     Serial.printf("[INVENTORY] handleInventorySet called\n");
-    if (!server.hasArg("cat") || !server.hasArg("item") || !server.hasArg("status")) {
+    int cat, item;
+    if (!inventoryItemArg(cat, item) || !server.hasArg("status")) {
         Serial.printf("[INVENTORY] Missing parameters\n");
         server.send(400, "text/plain", "Missing parameters");
         return;
     }
 
-    int cat = server.arg("cat").toInt();
-    int item = server.arg("item").toInt();
     int status = server.arg("status").toInt();
     
     Serial.printf("[INVENTORY] Setting status: cat=%d, item=%d, status=%d\n", cat, item, status);
 
     if (cat >= 0 && cat < (int)inventory.size() && item >= 0 && status >= 0 && status <= 3) {
         if (inventory[cat].isConsumable && item < (int)inventory[cat].consumables.size()) {
-            String itemName = inventory[cat].consumables[item].name;
-            String catName = inventory[cat].name;
+            String itemName = inventory[cat].consumables[item].name.c_str();
+            String catName = inventory[cat].name.c_str();
+            inventoryStats.remove(cat, inventory[cat].consumables[item]);
             inventory[cat].consumables[item].status = (ItemStatus)status;
+            inventoryStats.add(cat, inventory[cat].consumables[item]);
             Serial.printf("[INVENTORY] Changed '%s' in '%s' to status %d\n", itemName.c_str(), catName.c_str(), status);
-            saveInventoryToSPIFFS();  // Auto-save on every change
+            journalInventoryChange(JOURNAL_SET_STATUS, inventory[cat].consumables[item].id, status);
             server.send(200, "text/plain", "OK");
             return;
         } else {
@@ -2489,18 +1977,18 @@ void handleInventorySet() {
 }
 
 void handleInventoryCheck() {
-    if (!server.hasArg("cat") || !server.hasArg("item") || !server.hasArg("type") || !server.hasArg("val")) {
+    int cat, item;
+    if (!inventoryItemArg(cat, item) || !server.hasArg("type") || !server.hasArg("val")) {
         server.send(400, "text/plain", "Missing parameters");
         return;
     }
 
-    int cat = server.arg("cat").toInt();
-    int item = server.arg("item").toInt();
     int type = server.arg("type").toInt();
     int val = server.arg("val").toInt();
 
     if (cat >= 0 && cat < (int)inventory.size() && item >= 0 && type >= 0 && type <= 2) {
         if (!inventory[cat].isConsumable && item < (int)inventory[cat].equipment.size()) {
+            inventoryStats.remove(cat, inventory[cat].equipment[item]);
             if (type == 0) {
                 inventory[cat].equipment[item].checked = (val == 1);
             } else if (type == 1) {
@@ -2508,7 +1996,9 @@ void handleInventoryCheck() {
             } else if (type == 2) {
                 inventory[cat].equipment[item].taking = (val == 1);
             }
-            saveInventoryToSPIFFS();  // Auto-save on every change
+            inventoryStats.add(cat, inventory[cat].equipment[item]);
+            static const InventoryJournalOp ops[] = {JOURNAL_SET_CHECKED, JOURNAL_SET_PACKED, JOURNAL_SET_TAKING};
+            journalInventoryChange(ops[type], inventory[cat].equipment[item].id, val == 1);
             server.send(200, "text/plain", "OK");
             return;
         }
@@ -2517,9 +2007,179 @@ void handleInventoryCheck() {
     server.send(400, "text/plain", "Invalid parameters");
 }
 
-// Helper function to save inventory to SPIFFS using ArduinoJson
+// Record a tap in the journal; the snapshot is written later by
+// serviceInventoryJournal(). Falls back to a full save if the append fails.
+void journalInventoryChange(InventoryJournalOp op, uint16_t id, int value) {
+    if (!inventoryJournal.append(op, id, value)) {
+        saveInventoryToSPIFFS();
+    }
+}
+
+// Compact the journal into the snapshot once taps have settled (called from httpTask)
+void serviceInventoryJournal() {
+    if (inventoryJournal.compactDue()) {
+        Serial.printf("[JOURNAL] Compacting %u changes\n", inventoryJournal.records());
+        saveInventoryToSPIFFS();
+    }
+}
+
+// ============ INVENTORY BATCH API ============
+// POST /api/inventory/batch with a JSON array of [op, id, value] tuples:
+//   ["status", id, -1..2]          consumable status
+//   ["check"|"pack"|"take", id, 0|1]
+//   ["rename", id, "name"]
+//   ["move", id, targetCat]
+//   ["delete", id]
+// Ops run in order and all-or-nothing: if one fails the inventory is rolled
+// back. A batch of flag changes costs one journal write; anything structural
+// one snapshot. Responds {"applied":N}, or 400 with the failing op.
+#define INVENTORY_BATCH_MAX_OPS 64
+
+// Apply one op. Returns nullptr on success, else an error message. Flag
+// changes are queued on `changes`; renames, moves and deletes set `structural`.
+const char* applyInventoryOp(JsonVariant op, std::vector<InventoryJournalChange>& changes, bool& structural) {
+    const char* kind = op[0].as<const char*>();
+    if (!kind) return "missing op";
+    uint16_t id = jsonInt(op[1]);
+    int cat, item;
+    if (!inventoryIndex.find(id, cat, item)) return "unknown item";
+    DynamicCategory& category = inventory[cat];
+
+    if (strcmp(kind, "status") == 0) {
+        int status = jsonInt(op[2]);
+        if (!category.isConsumable || status < STATUS_FULL || status > STATUS_OUT) return "invalid status";
+        inventoryStats.remove(cat, category.consumables[item]);
+        category.consumables[item].status = (ItemStatus)status;
+        inventoryStats.add(cat, category.consumables[item]);
+        changes.push_back({JOURNAL_SET_STATUS, id, status});
+        return nullptr;
+    }
+
+    static const char* flagOps[] = {"check", "pack", "take"};
+    static const InventoryJournalOp flagJournal[] = {JOURNAL_SET_CHECKED, JOURNAL_SET_PACKED, JOURNAL_SET_TAKING};
+    for (int f = 0; f < 3; f++) {
+        if (strcmp(kind, flagOps[f]) != 0) continue;
+        if (category.isConsumable) return "not equipment";
+        bool val = jsonInt(op[2]) == 1;
+        EquipmentItem& equipment = category.equipment[item];
+        inventoryStats.remove(cat, equipment);
+        if (f == 0) equipment.checked = val;
+        else if (f == 1) equipment.packed = val;
+        else equipment.taking = val;
+        inventoryStats.add(cat, equipment);
+        changes.push_back({flagJournal[f], id, val});
+        return nullptr;
+    }
+
+    if (strcmp(kind, "rename") == 0) {
+        String name = op[2].as<const char*>() ? op[2].as<const char*>() : "";
+        name.trim();
+        if (name.length() == 0 || name.length() > 100) return "invalid name";
+        if (category.isConsumable) category.consumables[item].name = name;
+        else category.equipment[item].name = name;
+        sortCategoryItems(category);
+        structural = true;
+        return nullptr;
+    }
+
+    if (strcmp(kind, "move") == 0) {
+        int target = jsonInt(op[2]);
+        if (target < 0 || target >= (int)inventory.size() || target == cat) return "invalid target";
+        if (inventory[target].isConsumable != category.isConsumable) return "cannot move between consumable and equipment";
+        if (category.isConsumable) {
+            inventory[target].consumables.push_back(category.consumables[item]);
+            category.consumables.erase(category.consumables.begin() + item);
+        } else {
+            inventory[target].equipment.push_back(category.equipment[item]);
+            category.equipment.erase(category.equipment.begin() + item);
+        }
+        inventoryIndex.placeCategory(cat);
+        sortCategoryItems(inventory[target]);
+        structural = true;
+        return nullptr;
+    }
+
+    if (strcmp(kind, "delete") == 0) {
+        if (category.isConsumable) category.consumables.erase(category.consumables.begin() + item);
+        else category.equipment.erase(category.equipment.begin() + item);
+        inventoryIndex.remove(id);
+        inventoryIndex.placeCategory(cat);
+        structural = true;
+        return nullptr;
+    }
+
+    return "unknown op";
+}
+
+void handleApiInventoryBatch() {
+    JsonDocument doc;
+    if (!server.hasArg("plain") || deserializeJson(doc, server.arg("plain")) || !doc.is<JsonArray>()) {
+        server.send(400, "text/plain", "Expected a JSON array of ops");
+        return;
+    }
+    JsonArray ops = doc.as<JsonArray>();
+    if (ops.size() > INVENTORY_BATCH_MAX_OPS) {
+        server.send(400, "text/plain", "Too many ops");
+        return;
+    }
+
+    // Items only hold interned name pointers, so a copy is cheap
+    std::vector<DynamicCategory> undo = inventory;
+    std::vector<InventoryJournalChange> changes;
+    bool structural = false;
+    int applied = 0;
+    for (JsonVariant op : ops) {
+        const char* error = applyInventoryOp(op, changes, structural);
+        if (error) {
+            inventory.swap(undo);
+            inventoryIndex.invalidate();
+            inventoryStats.invalidate();
+            undo.clear();
+            compactInventoryNames();    // Names the rejected ops interned
+            Serial.printf("[INVENTORY] Batch rejected at op %d: %s\n", applied, error);
+            server.send(400, "text/plain", "op " + String(applied) + ": " + error);
+            return;
+        }
+        applied++;
+    }
+
+    if (structural) inventoryStats.invalidate();     // Moves and deletes
+    if (structural || !inventoryJournal.append(changes.data(), changes.size())) {
+        saveInventoryToSPIFFS();
+    }
+    undo.clear();
+    compactInventoryNames();
+    Serial.printf("[INVENTORY] Batch applied %d ops (%s)\n", applied, structural ? "snapshot" : "journal");
+    ChunkedResponse out(server);
+    out.begin(200, "application/json");
+    JsonWriter<ChunkedResponse>(out).beginObject().member("applied", applied).endObject();
+    out.end();
+}
+
+// Save inventory as a binary snapshot (see InventorySnapshot.h). Written to a
+// temp file first so a power cut mid-write never leaves a torn snapshot.
 bool saveInventoryToSPIFFS() {
-    File file = SPIFFS.open("/inventory.json", "w");
+    if (!writeInventorySnapshot(INVENTORY_SNAPSHOT_TMP)) {
+        Serial.println("[INVENTORY] Failed to write snapshot");
+        SPIFFS.remove(INVENTORY_SNAPSHOT_TMP);
+        return false;
+    }
+    SPIFFS.remove(INVENTORY_SNAPSHOT_PATH);
+    if (!SPIFFS.rename(INVENTORY_SNAPSHOT_TMP, INVENTORY_SNAPSHOT_PATH)) {
+        Serial.println("[INVENTORY] Failed to rename snapshot");
+        return false;
+    }
+    inventoryJournal.clear();   // Snapshot now holds every journaled change
+    if (SPIFFS.exists(INVENTORY_LEGACY_PATH)) SPIFFS.remove(INVENTORY_LEGACY_PATH);
+
+    Serial.printf("[INVENTORY] Auto-saved %d categories to SPIFFS\n", inventory.size());
+    return true;
+}
+
+#ifdef INVENTORY_LOAD_BENCH
+// Legacy ArduinoJson writer, only kept to produce input for the load benchmark
+bool saveInventoryJson(const char* path) {
+    File file = SPIFFS.open(path, "w");
     if (!file) {
         Serial.println("[INVENTORY] Failed to open file for writing");
         return false;
@@ -2530,8 +2190,8 @@ bool saveInventoryToSPIFFS() {
 
     for (size_t i = 0; i < inventory.size(); i++) {
         JsonObject category = categories.add<JsonObject>();
-        category["name"] = inventory[i].name;
-        category["icon"] = inventory[i].icon;
+        category["name"] = inventory[i].name.c_str();
+        category["icon"] = inventory[i].icon.c_str();
         category["isConsumable"] = inventory[i].isConsumable;
         category["subcategory"] = inventory[i].subcategory;
         
@@ -2540,19 +2200,19 @@ bool saveInventoryToSPIFFS() {
         if (inventory[i].isConsumable) {
             for (size_t j = 0; j < inventory[i].consumables.size(); j++) {
                 JsonObject item = items.add<JsonObject>();
-                item["name"] = inventory[i].consumables[j].name;
+                item["name"] = inventory[i].consumables[j].name.c_str();
                 item["status"] = inventory[i].consumables[j].status;
-                item["livesInTrailer"] = inventory[i].consumables[j].livesInTrailer;
+                item["livesInTrailer"] = (bool)inventory[i].consumables[j].livesInTrailer;
                 item["lastUpdated"] = inventory[i].consumables[j].lastUpdated;
             }
         } else {
             for (size_t j = 0; j < inventory[i].equipment.size(); j++) {
                 JsonObject item = items.add<JsonObject>();
-                item["name"] = inventory[i].equipment[j].name;
-                item["checked"] = inventory[i].equipment[j].checked;
-                item["packed"] = inventory[i].equipment[j].packed;
-                item["taking"] = inventory[i].equipment[j].taking;
-                item["livesInTrailer"] = inventory[i].equipment[j].livesInTrailer;
+                item["name"] = inventory[i].equipment[j].name.c_str();
+                item["checked"] = (bool)inventory[i].equipment[j].checked;
+                item["packed"] = (bool)inventory[i].equipment[j].packed;
+                item["taking"] = (bool)inventory[i].equipment[j].taking;
+                item["livesInTrailer"] = (bool)inventory[i].equipment[j].livesInTrailer;
                 item["lastUpdated"] = inventory[i].equipment[j].lastUpdated;
             }
         }
@@ -2560,11 +2220,10 @@ bool saveInventoryToSPIFFS() {
 
     serializeJson(doc, file);
     file.close();
-    
-    Serial.printf("[INVENTORY] Auto-saved %d categories to SPIFFS\n", inventory.size());
-    Serial.printf("[DEBUG] JSON size: %u bytes\n", measureJson(doc));
     return true;
 }
+#endif
+
 
 void handleInventorySave() {
     if (saveInventoryToSPIFFS()) {
@@ -2582,52 +2241,11 @@ void handleInventoryResetAll() {
         String body = server.arg("plain");
         Serial.printf("[INVENTORY] Reset filtered items body: %s\n", body.c_str());
         
-        // Simple JSON parsing for {items:[{cat:0,item:1},{cat:0,item:2}]}
-        int itemsStart = body.indexOf("\"items\":[");
-        if (itemsStart >= 0) {
-            itemsStart += 9; // Skip "items":["
-            int itemsEnd = body.indexOf(']', itemsStart);
-            if (itemsEnd > itemsStart) {
-                String itemsStr = body.substring(itemsStart, itemsEnd);
-                Serial.printf("[INVENTORY] Items string: %s\n", itemsStr.c_str());
-                
-                // Parse each {cat:X,item:Y} object
-                int pos = 0;
-                while (pos < itemsStr.length()) {
-                    int objStart = itemsStr.indexOf('{', pos);
-                    if (objStart < 0) break;
-                    int objEnd = itemsStr.indexOf('}', objStart);
-                    if (objEnd < 0) break;
-                    
-                    String obj = itemsStr.substring(objStart, objEnd + 1);
-                    Serial.printf("[INVENTORY] Processing object: %s\n", obj.c_str());
-                    
-                    // Extract cat and item numbers
-                    int catPos = obj.indexOf("\"cat\":");
-                    int itemPos = obj.indexOf("\"item\":");
-                    if (catPos >= 0 && itemPos >= 0) {
-                        int catStart = catPos + 7; // Skip "cat":" and opening quote
-                        int catEnd = obj.indexOf('"', catStart); // Find closing quote
-                        
-                        int itemStart = itemPos + 8; // Skip "item":" and opening quote
-                        int itemEnd = obj.indexOf('"', itemStart); // Find closing quote
-                        
-                        int catNum = obj.substring(catStart, catEnd).toInt();
-                        int itemNum = obj.substring(itemStart, itemEnd).toInt();
-                        
-                        Serial.printf("[INVENTORY] Parsed cat:%d, item:%d\n", catNum, itemNum);
-                        
-                        if (catNum < inventory.size() && inventory[catNum].isConsumable && 
-                            itemNum < inventory[catNum].consumables.size()) {
-                            inventory[catNum].consumables[itemNum].status = STATUS_FULL;
-                            reset++;
-                            Serial.printf("[INVENTORY] Set item to FULL: cat:%d, item:%d\n", catNum, itemNum);
-                        }
-                    }
-                    
-                    pos = objEnd + 1;
-                }
-            }
+        // {items:[{id:N},...]}; older pages send {cat,item} pairs instead
+        reset = setListedConsumables(body, STATUS_FULL);
+        if (reset < 0) {
+            server.send(400, "text/plain", "Invalid JSON");
+            return;
         }
         Serial.printf("[INVENTORY] Reset %d filtered items to Full\n", reset);
     } else {
@@ -2639,6 +2257,7 @@ void handleInventoryResetAll() {
                 reset++;
             }
         }
+        inventoryStats.invalidate();
         Serial.printf("[INVENTORY] Reset all %d consumables to Full\n", reset);
     }
     
@@ -2652,68 +2271,11 @@ void handleInventoryRestock() {
         String body = server.arg("plain");
         Serial.printf("[INVENTORY] Restock body: %s\n", body.c_str());
 
-        // Parse JSON array of selected items
-        int startIdx = 0;
-        int count = 0;
-        while (startIdx < body.length()) {
-            // Look for cat and item values (they might not have quotes around numbers)
-            int catStart = body.indexOf("\"cat\":\"", startIdx);
-            int itemStart = body.indexOf("\"item\":\"", startIdx);
-
-            // Also try without quotes (JavaScript might send numbers without quotes)
-            if (catStart == -1) {
-                catStart = body.indexOf("\"cat\":", startIdx);
-                if (catStart != -1) catStart += 6; // Skip past "cat":
-            } else {
-                catStart += 7; // Skip past "cat":"
-            }
-
-            if (itemStart == -1) {
-                itemStart = body.indexOf("\"item\":", startIdx);
-                if (itemStart != -1) itemStart += 7; // Skip past "item":
-            } else {
-                itemStart += 8; // Skip past "item":"
-            }
-
-            if (catStart == -1 || itemStart == -1) break;
-
-            // Find the end of the value (could be comma, } or end of string)
-            int catEnd = body.length();
-            for (int i = catStart; i < body.length(); i++) {
-                if (body[i] == ',' || body[i] == '}' || body[i] == '"') {
-                    catEnd = i;
-                    break;
-                }
-            }
-
-            int itemEnd = body.length();
-            for (int i = itemStart; i < body.length(); i++) {
-                if (body[i] == ',' || body[i] == '}' || body[i] == '"') {
-                    itemEnd = i;
-                    break;
-                }
-            }
-
-            String catStr = body.substring(catStart, catEnd);
-            String itemStr = body.substring(itemStart, itemEnd);
-            catStr.trim();
-            itemStr.trim();
-
-            int cat = catStr.toInt();
-            int item = itemStr.toInt();
-
-            Serial.printf("[INVENTORY] Parsing: cat=%d, item=%d\n", cat, item);
-
-            if (cat >= 0 && cat < (int)inventory.size()) {
-                if (inventory[cat].isConsumable && item >= 0 && item < (int)inventory[cat].consumables.size()) {
-                    Serial.printf("[INVENTORY] Restocking: %s (cat %d, item %d)\n",
-                                  inventory[cat].consumables[item].name.c_str(), cat, item);
-                    inventory[cat].consumables[item].status = STATUS_FULL;
-                    count++;
-                }
-            }
-
-            startIdx = itemEnd + 1;
+        // JSON array of selected items, each {id} or {cat,item}
+        int count = setListedConsumables(body, STATUS_FULL);
+        if (count < 0) {
+            server.send(400, "text/plain", "Invalid JSON");
+            return;
         }
 
         Serial.printf("[INVENTORY] Restocked %d selected items\n", count);
@@ -2729,47 +2291,43 @@ void handleInventoryShopping() {
     // Check for filter parameter: "trailer", "trip", or "all"
     String filter = server.hasArg("filter") ? server.arg("filter") : "all";
     
-    String json = "{\"count\":0,\"lowCount\":0,\"outCount\":0,\"items\":[";
-
-    int totalCount = 0;
-    int lowCount = 0;
-    int outCount = 0;
-    bool first = true;
-
-    for (size_t i = 0; i < inventory.size(); i++) {
-        if (!inventory[i].isConsumable) continue;
-        for (size_t j = 0; j < inventory[i].consumables.size(); j++) {
-            if (inventory[i].consumables[j].status == STATUS_LOW || inventory[i].consumables[j].status == STATUS_OUT) {
-                // Apply trailer filter
-                bool includeItem = true;
-                if (filter == "trailer" && !inventory[i].consumables[j].livesInTrailer) includeItem = false;
-                else if (filter == "trip" && inventory[i].consumables[j].livesInTrailer) includeItem = false;
-                
-                if (includeItem) {
-                    if (!first) json += ",";
-                    first = false;
-
-                    json += "{\"cat\":" + String(i);
-                    json += ",\"item\":" + String(j);
-                    json += ",\"name\":\"" + inventory[i].consumables[j].name + "\"";
-                    json += ",\"category\":\"" + inventory[i].name + "\"";
-                    json += ",\"status\":" + String(inventory[i].consumables[j].status);
-                    json += ",\"livesInTrailer\":" + String(inventory[i].consumables[j].livesInTrailer ? "true" : "false") + "}";
-
-                    totalCount++;
-                    if (inventory[i].consumables[j].status == STATUS_LOW) lowCount++;
-                    else outCount++;
-                }
-            }
-        }
+    bool trailerOnly = filter == "trailer", tripOnly = filter == "trip";
+    StockCounts stock = trailerOnly ? inventoryStats.consumables(true)
+                      : tripOnly ? inventoryStats.consumables(false) : inventoryStats.consumables();
+    int lowCount = stock.low;
+    int outCount = stock.out;
+    int totalCount = lowCount + outCount;
+
+    ChunkedResponse out(server);
+    out.begin(200, "application/json");
+    JsonWriter<ChunkedResponse> json(out);
+    json.beginObject().key("items").beginArray();
+
+    for (const ShoppingEntry& entry : inventoryStats.shopping()) {
+        size_t i = entry.cat, j = entry.item;
+        // Apply trailer filter
+        if (trailerOnly && !inventory[i].consumables[j].livesInTrailer) continue;
+        if (tripOnly && inventory[i].consumables[j].livesInTrailer) continue;
+
+        const ConsumableItem& item = inventory[i].consumables[j];
+        json.beginObject()
+            .member("cat", i)
+            .member("item", j)
+            .member("id", item.id)
+            .member("name", item.name.c_str())
+            .member("category", inventory[i].name.c_str())
+            .member("status", (int)item.status)
+            .member("livesInTrailer", (bool)item.livesInTrailer)
+            .endObject();
     }
 
-    json += "],\"count\":" + String(totalCount);
-    json += ",\"lowCount\":" + String(lowCount);
-    json += ",\"outCount\":" + String(outCount);
-    json += ",\"filter\":\"" + filter + "\"}";
-
-    server.send(200, "application/json", json);
+    json.endArray()
+        .member("count", totalCount)
+        .member("lowCount", lowCount)
+        .member("outCount", outCount)
+        .member("filter", filter.c_str())
+        .endObject();
+    out.end();
 }
 
 void handleInventoryStats() {
@@ -2777,156 +2335,216 @@ void handleInventoryStats() {
         int tabNum = server.arg("tab").toInt();
         int total = 0, checked = 0, packed = 0, taking = 0;
         
-        if (tabNum == 2) { // Trailer
-            for (size_t i = 0; i < inventory.size(); i++) {
-                if (inventory[i].isConsumable || inventory[i].subcategory != SUBCATEGORY_TRAILER) continue;
-                total += inventory[i].equipment.size();
-                for (size_t j = 0; j < inventory[i].equipment.size(); j++) {
-                    if (inventory[i].equipment[j].checked) checked++;
-                    if (inventory[i].equipment[j].packed) packed++;
-                }
-            }
-        } else if (tabNum == 3) { // Essentials
-            for (size_t i = 0; i < inventory.size(); i++) {
-                if (inventory[i].isConsumable || inventory[i].subcategory != SUBCATEGORY_ESSENTIALS) continue;
-                total += inventory[i].equipment.size();
-                for (size_t j = 0; j < inventory[i].equipment.size(); j++) {
-                    if (inventory[i].equipment[j].checked) checked++;
-                    if (inventory[i].equipment[j].packed) packed++;
-                }
-            }
+        if (tabNum == 2 || tabNum == 3) { // Trailer, Essentials
+            const PackCounts& pack = inventoryStats.equipment(tabNum == 2 ? SUBCATEGORY_TRAILER : SUBCATEGORY_ESSENTIALS);
+            total = pack.total;
+            checked = pack.checked;
+            packed = pack.packed;
         } else if (tabNum == 4) { // Optional
-            for (size_t i = 0; i < inventory.size(); i++) {
-                if (inventory[i].isConsumable || inventory[i].subcategory != SUBCATEGORY_OPTIONAL) continue;
-                total += inventory[i].equipment.size();
-                for (size_t j = 0; j < inventory[i].equipment.size(); j++) {
-                    if (inventory[i].equipment[j].taking) taking++;
-                    if (inventory[i].equipment[j].taking && inventory[i].equipment[j].checked) checked++;
-                    if (inventory[i].equipment[j].taking && inventory[i].equipment[j].packed) packed++;
-                }
-            }
+            const PackCounts& pack = inventoryStats.equipment(SUBCATEGORY_OPTIONAL);
+            total = pack.total;
+            taking = pack.taking;
+            checked = pack.takingChecked;
+            packed = pack.takingPacked;
         }
         
-        String json = "{\"total\":" + String(total) + ",\"taking\":" + String(taking) + 
-                     ",\"needCheck\":" + String(taking > 0 ? taking - checked : total - checked) + 
-                     ",\"needPack\":" + String(taking > 0 ? taking - packed : total - packed) + "}";
-        server.send(200, "application/json", json);
+        ChunkedResponse out(server);
+        out.begin(200, "application/json");
+        JsonWriter<ChunkedResponse>(out).beginObject()
+            .member("total", total)
+            .member("taking", taking)
+            .member("needCheck", taking > 0 ? taking - checked : total - checked)
+            .member("needPack", taking > 0 ? taking - packed : total - packed)
+            .endObject();
+        out.end();
     } else {
         // Original consumables stats
-        int okCount = 0, lowCount = 0, outCount = 0;
-        for (size_t i = 0; i < inventory.size(); i++) {
-            if (!inventory[i].isConsumable) continue;
-            for (size_t j = 0; j < inventory[i].consumables.size(); j++) {
-                if (inventory[i].consumables[j].status <= STATUS_OK) okCount++;
-                else if (inventory[i].consumables[j].status == STATUS_LOW) lowCount++;
-                else if (inventory[i].consumables[j].status == STATUS_OUT) outCount++;
-            }
+        StockCounts stock = inventoryStats.consumables();
+        ChunkedResponse out(server);
+        out.begin(200, "application/json");
+        JsonWriter<ChunkedResponse>(out).beginObject()
+            .member("ok", stock.inStock())
+            .member("low", stock.low)
+            .member("out", stock.out)
+            .endObject();
+        out.end();
+    }
+}
+
+void handleInventoryDownload() {
+    server.sendHeader("Content-Disposition", "attachment; filename=shopping-list.txt");
+    ChunkedResponse txt(server);
+    txt.begin(200, "text/plain");
+    txt += "SHOPPING LIST\n";
+    txt += "=============\n\n";
+
+    // Entries come grouped by category
+    int lastCat = -1;
+    for (const ShoppingEntry& entry : inventoryStats.shopping()) {
+        const DynamicCategory& category = inventory[entry.cat];
+        if (entry.cat != lastCat) {
+            if (lastCat >= 0) txt += "\n";
+            txt += category.name;
+            txt += ":\n";
+            lastCat = entry.cat;
         }
+        txt += "  - ";
+        txt += category.consumables[entry.item].name;
+        txt += " [";
+        txt += getStatusName(category.consumables[entry.item].status);
+        txt += "]\n";
+    }
+    if (lastCat >= 0) {
+        txt += "\n";
+    } else {
+        txt += "All items in stock!\n";
+    }
+    txt.end();
+}
+
+// ============ CSV EXPORT/IMPORT HANDLERS ============
 
-        String json = "{\"ok\":" + String(okCount) + ",\"low\":" + String(lowCount) + ",\"out\":" + String(outCount) + "}";
-        server.send(200, "application/json", json);
+// Category Type column: which tab an equipment category appears on
+static const char* csvCategoryType(const DynamicCategory& category) {
+    if (category.isConsumable) return "CONSUMABLES"; // Clear indication this goes in Consumables tab
+    switch (category.subcategory) {
+        case SUBCATEGORY_TRAILER: return "TRAILER";
+        case SUBCATEGORY_ESSENTIALS: return "ESSENTIALS";
+        case SUBCATEGORY_OPTIONAL: return "OPTIONAL";
+        default: return "UNKNOWN";
     }
 }
 
-void handleInventoryDownload() {
-    String txt = "SHOPPING LIST\n";
-    txt += "=============\n\n";
+// Quoted CSV field with embedded quotes doubled, written without a copy
+static void csvQuoted(ChunkedResponse& out, const char* s) {
+    out += '"';
+    for (const char* quote; (quote = strchr(s, '"')); s = quote + 1) {
+        out.write((const uint8_t*)s, quote - s + 1);
+        out += '"';
+    }
+    out += s;
+    out += '"';
+}
 
-    for (size_t i = 0; i < inventory.size(); i++) {
-        if (!inventory[i].isConsumable) continue;
-        bool hasItems = false;
-        String categoryItems = "";
-
-        for (size_t j = 0; j < inventory[i].consumables.size(); j++) {
-            if (inventory[i].consumables[j].status == STATUS_LOW || inventory[i].consumables[j].status == STATUS_OUT) {
-                if (!hasItems) {
-                    categoryItems += inventory[i].name + ":\n";
-                    hasItems = true;
-                }
-                categoryItems += "  - " + inventory[i].consumables[j].name;
-                categoryItems += " [" + String(getStatusName(inventory[i].consumables[j].status)) + "]\n";
-            }
+// Streams row by row: memory use is the 1 KB chunk buffer whatever the inventory size
+void handleInventoryExportCSV() {
+    server.sendHeader("Content-Disposition", "attachment; filename=trailer-inventory.csv");
+    ChunkedResponse csv(server);
+    csv.begin(200, "text/csv");
+    csv += "Category Type,Category,Item Name,Status,Lives in Trailer,Checked,Packed,Taking,Last Updated\n";
+
+    for (const DynamicCategory& category : inventory) {
+        const char* categoryType = csvCategoryType(category);
+
+        // Export consumable items
+        for (const ConsumableItem& item : category.consumables) {
+            csv += categoryType;
+            csv += ',';
+            csvQuoted(csv, category.name);
+            csv += ',';
+            csvQuoted(csv, item.name);
+            csv += ',';
+            csv += getStatusName(item.status);
+            csv += ',';
+            csv += item.livesInTrailer ? "Yes" : "No";
+            csv += ",N/A,N/A,N/A,"; // Consumables don't have checked/packed/taking
+            csv.print(item.lastUpdated);
+            csv += '\n';
         }
 
-        if (hasItems) {
-            txt += categoryItems + "\n";
+        // Export equipment items
+        for (const EquipmentItem& item : category.equipment) {
+            csv += categoryType;
+            csv += ',';
+            csvQuoted(csv, category.name);
+            csv += ',';
+            csvQuoted(csv, item.name);
+            csv += ",OK,"; // Equipment always has OK status
+            csv += item.livesInTrailer ? "Yes" : "No";
+            csv += ',';
+            csv += item.checked ? "Yes" : "No";
+            csv += ',';
+            csv += item.packed ? "Yes" : "No";
+            csv += ',';
+            csv += item.taking ? "Yes" : "No";
+            csv += ',';
+            csv.print(item.lastUpdated);
+            csv += '\n';
         }
     }
+    csv.end();
+}
 
-    if (txt.length() <= 25) {
-        txt += "All items in stock!\n";
+// Everything the snapshot holds (IDs, icons, tabs, flags, timestamps) as JSON.
+// The loaded inventory is the decoded snapshot with pooled names, so this
+// streams from it rather than re-parsing the file.
+void handleInventoryExportJSON() {
+    server.sendHeader("Content-Disposition", "attachment; filename=trailer-inventory.json");
+    ChunkedResponse out(server);
+    out.begin(200, "application/json");
+    JsonWriter<ChunkedResponse> json(out);
+    json.beginObject()
+        .member("version", INVENTORY_SNAPSHOT_VERSION)
+        .member("nextItemId", nextItemId)
+        .key("categories").beginArray();
+    for (const DynamicCategory& category : inventory) {
+        json.beginObject()
+            .member("name", category.name.c_str())
+            .member("icon", category.icon.c_str())
+            .member("consumable", category.isConsumable)
+            .member("subcategory", (int)category.subcategory)
+            .key("items").beginArray();
+        for (const ConsumableItem& item : category.consumables) {
+            json.beginObject()
+                .member("id", item.id)
+                .member("name", item.name.c_str())
+                .member("status", getStatusName(item.status))
+                .member("livesInTrailer", (bool)item.livesInTrailer)
+                .member("lastUpdated", item.lastUpdated)
+                .endObject();
+        }
+        for (const EquipmentItem& item : category.equipment) {
+            json.beginObject()
+                .member("id", item.id)
+                .member("name", item.name.c_str())
+                .member("livesInTrailer", (bool)item.livesInTrailer)
+                .member("checked", (bool)item.checked)
+                .member("packed", (bool)item.packed)
+                .member("taking", (bool)item.taking)
+                .member("lastUpdated", item.lastUpdated)
+                .endObject();
+        }
+        json.endArray().endObject();
     }
+    json.endArray().endObject();
+    out.end();
+}
 
-    server.sendHeader("Content-Disposition", "attachment; filename=shopping-list.txt");
-    server.send(200, "text/plain", txt);
+// The binary snapshot itself, sent file-to-socket by streamFile()
+void handleInventoryExportSnapshot() {
+    if (inventoryJournal.pending() || !SPIFFS.exists(INVENTORY_SNAPSHOT_PATH)) saveInventoryToSPIFFS();
+    File file = SPIFFS.open(INVENTORY_SNAPSHOT_PATH, "r");
+    if (!file) {
+        server.send(500, "text/plain", "Snapshot not available");
+        return;
+    }
+    server.sendHeader("Content-Disposition", "attachment; filename=inventory.bin");
+    server.streamFile(file, "application/octet-stream");
+    file.close();
 }
 
-// ============ CSV EXPORT/IMPORT HANDLERS ============
+// Free heap and largest free block when the import request arrived, sampled
+// before any of the upload is parsed (0 until then)
+static uint32_t csvImportHeapBefore = 0;
+static uint32_t csvImportBlockBefore = 0;
 
-void handleInventoryExportCSV() {
-    String csv = "Category Type,Category,Item Name,Status,Lives in Trailer,Checked,Packed,Taking,Last Updated\n";
-    
-    for (size_t i = 0; i < inventory.size(); i++) {
-        String categoryType;
-        if (inventory[i].isConsumable) {
-            categoryType = "CONSUMABLES"; // Clear indication this goes in Consumables tab
-        } else {
-            // For equipment, show which tab it appears in
-            switch (inventory[i].subcategory) {
-                case SUBCATEGORY_TRAILER: categoryType = "TRAILER"; break;
-                case SUBCATEGORY_ESSENTIALS: categoryType = "ESSENTIALS"; break;
-                case SUBCATEGORY_OPTIONAL: categoryType = "OPTIONAL"; break;
-                default: categoryType = "UNKNOWN"; break;
-            }
-        }
-        
-        String categoryName = inventory[i].name;
-        categoryName.replace("\"", "\"\""); // Escape quotes
-        
-        // Export consumable items
-        if (inventory[i].isConsumable) {
-            for (size_t j = 0; j < inventory[i].consumables.size(); j++) {
-                String itemName = inventory[i].consumables[j].name;
-                itemName.replace("\"", "\"\""); // Escape quotes
-                
-                csv += categoryType + ",";
-                csv += "\"" + categoryName + "\",";
-                csv += "\"" + itemName + "\",";
-                csv += getStatusName(inventory[i].consumables[j].status);
-                csv += ",";
-                csv += (inventory[i].consumables[j].livesInTrailer ? "Yes" : "No");
-                csv += ",N/A,N/A,N/A,"; // Consumables don't have checked/packed/taking
-                csv += String(inventory[i].consumables[j].lastUpdated) + "\n";
-            }
-        } else {
-            // Export equipment items
-            for (size_t j = 0; j < inventory[i].equipment.size(); j++) {
-                String itemName = inventory[i].equipment[j].name;
-                itemName.replace("\"", "\"\""); // Escape quotes
-                
-                csv += categoryType + ",";
-                csv += "\"" + categoryName + "\",";
-                csv += "\"" + itemName + "\",";
-                csv += "OK,"; // Equipment always has OK status
-                csv += (inventory[i].equipment[j].livesInTrailer ? "Yes" : "No");
-                csv += ",";
-                csv += (inventory[i].equipment[j].checked ? "Yes" : "No");
-                csv += ",";
-                csv += (inventory[i].equipment[j].packed ? "Yes" : "No");
-                csv += ",";
-                csv += (inventory[i].equipment[j].taking ? "Yes" : "No");
-                csv += ",";
-                csv += String(inventory[i].equipment[j].lastUpdated) + "\n";
-            }
-        }
-    }
-    
-    server.sendHeader("Content-Disposition", "attachment; filename=trailer-inventory.csv");
-    server.send(200, "text/csv", csv);
+static void sampleCsvImportHeap() {
+    csvImportHeapBefore = ESP.getFreeHeap();
+    csvImportBlockBefore = ESP.getMaxAllocHeap();
 }
 
 void handleInventoryImportCSV() {
-    if (!server.hasArg("csvdata")) {
+    if (server.method() != HTTP_POST) {
         String html = "<!DOCTYPE html><html><head><meta charset='UTF-8'><title>Import CSV</title>";
         html += "<meta name='viewport' content='width=device-width,initial-scale=1'>";
         html += "<style>body{font-family:Arial;padding:20px;background:#000;color:#fff}";
@@ -2939,9 +2557,13 @@ void handleInventoryImportCSV() {
         html += "<h2>📊 Import Complete Inventory from CSV</h2>";
         html += "<div class='warning'>⚠️ <strong>Warning:</strong> This will completely replace your current inventory with the CSV data. Make sure you have a backup!</div>";
         
-        html += "<form method='post'>";
+        html += "<form method='post' enctype='multipart/form-data'>";
         html += "<div class='form-group'>";
-        html += "<label>Paste CSV Data:</label>";
+        html += "<label>Upload CSV File:</label>";
+        html += "<input type='file' name='csvfile' accept='.csv,text/csv'>";
+        html += "</div>";
+        html += "<div class='form-group'>";
+        html += "<label>Or Paste CSV Data:</label>";
         html += "<textarea name='csvdata' placeholder='Category Type,Category,Item Name,Status,Lives in Trailer,Checked,Packed,Taking,Last Updated&#10;TRAILER,Kitchen Equipment,Coffee Maker,OK,Yes,Yes,Yes,Yes,1728238800000&#10;ESSENTIALS,Food & Beverages,Milk,Out,No,N/A,N/A,N/A,1728238900000'></textarea>";
         html += "</div>";
         html += "<button type='submit' class='btn'>Import CSV Data</button>";
@@ -2972,164 +2594,62 @@ void handleInventoryImportCSV() {
         html += "<p>Simply use a new Category name in the CSV - it will be created automatically!</p>";
         html += "<p><strong>Status:</strong> Full/OK/Low/Out (consumables), OK (equipment)</p>";
         html += "<p><strong>Boolean fields:</strong> Yes/No or N/A for not applicable</p>";
+        html += "<h4>Camping Stock List:</h4>";
+        html += "<p>The printable stock list imports as it is: a heading row per category (<em>Kitchen:;Full;OK;Low;Repl</em> for consumables, <em>Lighting;Checked;;Packed;;Trailer;Optional</em> for equipment, <em>Essentials list:</em> for the Essentials tab), then one row per item. TRUE marks the status or Checked/Packed; 'y' under Trailer keeps an item in the trailer.</p>";
         
         html += "</body></html>";
         server.send(200, "text/html", html);
         return;
     }
     
-    // Process CSV data
-    String csvData = server.arg("csvdata");
+    // A file upload has already been streamed into csvImport by
+    // handleInventoryImportUpload(); pasted text arrives as a form field.
     Serial.println("[CSV] Starting import...");
-    
-    // Clear existing inventory
-    inventory.clear();
-    
-    // Detect separator from header line
-    char separator = ',';
-    int firstLineEnd = csvData.indexOf('\n');
-    if (firstLineEnd > 0) {
-        String headerLine = csvData.substring(0, firstLineEnd);
-        int commas = 0, semicolons = 0;
-        for (int i = 0; i < headerLine.length(); i++) {
-            if (headerLine.charAt(i) == ',') commas++;
-            else if (headerLine.charAt(i) == ';') semicolons++;
-        }
-        separator = (semicolons > commas) ? ';' : ',';
-        Serial.printf("[CSV] Detected separator: '%c' (commas: %d, semicolons: %d)\n", separator, commas, semicolons);
+    if (!csvImportHeapBefore) sampleCsvImportHeap();    // Not a multipart post
+    uint32_t heapBefore = csvImportHeapBefore;
+    uint32_t blockBefore = csvImportBlockBefore;
+    csvImportHeapBefore = csvImportBlockBefore = 0;
+    if (!csvImport.active()) {
+        String csvData = server.arg("csvdata");
+        csvImport.begin();
+        csvImport.write(csvData.c_str(), csvData.length());
     }
-    
-    // Parse CSV line by line
-    int lineNum = 0;
-    int startPos = 0;
-    int imported = 0;
-    
-    while (startPos < csvData.length()) {
-        int endPos = csvData.indexOf('\n', startPos);
-        if (endPos == -1) endPos = csvData.length();
-        
-        String line = csvData.substring(startPos, endPos);
-        line.trim();
-        
-        if (lineNum > 0 && line.length() > 0) { // Skip header and empty lines
-            // Parse CSV line - using detected separator
-            std::vector<String> fields;
-            int fieldStart = 0;
-            bool inQuotes = false;
-            
-            for (int i = 0; i <= line.length(); i++) {
-                char c = (i < line.length()) ? line.charAt(i) : separator;
-                
-                if (c == '"') {
-                    inQuotes = !inQuotes;
-                } else if (c == separator && !inQuotes) {
-                    String field = line.substring(fieldStart, i);
-                    field.trim();
-                    if (field.startsWith("\"") && field.endsWith("\"")) {
-                        field = field.substring(1, field.length() - 1);
-                        field.replace("\"\"", "\""); // Unescape quotes
-                    }
-                    fields.push_back(field);
-                    fieldStart = i + 1;
-                }
-            }
-            
-            if (fields.size() >= 8) {
-                String categoryTypeStr = fields[0];
-                String categoryName = fields[1];
-                String itemName = fields[2];
-                String statusStr = fields[3];
-                String livesInTrailerStr = fields[4];
-                String checkedStr = fields[5];
-                String packedStr = fields[6];
-                String takingStr = fields[7];
-                
-                // Find or create category
-                int categoryIndex = -1;
-                for (size_t i = 0; i < inventory.size(); i++) {
-                    if (inventory[i].name == categoryName) {
-                        categoryIndex = i;
-                        break;
-                    }
-                }
-                
-                if (categoryIndex == -1) {
-                    // Create new category
-                    DynamicCategory newCategory;
-                    newCategory.name = categoryName;
-                    newCategory.icon = "📦"; // Default icon
-                    
-                    // Determine if consumable and set subcategory
-                    if (categoryTypeStr == "CONSUMABLES") {
-                        newCategory.isConsumable = true;
-                        newCategory.subcategory = SUBCATEGORY_TRAILER; // Consumables always use SUBCATEGORY_TRAILER
-                    } else {
-                        newCategory.isConsumable = false; // Equipment
-                        if (categoryTypeStr == "TRAILER") newCategory.subcategory = SUBCATEGORY_TRAILER;
-                        else if (categoryTypeStr == "ESSENTIALS") newCategory.subcategory = SUBCATEGORY_ESSENTIALS;
-                        else if (categoryTypeStr == "OPTIONAL") newCategory.subcategory = SUBCATEGORY_OPTIONAL;
-                        else {
-                            // Fallback: auto-detect based on status
-                            newCategory.isConsumable = (statusStr != "OK" || checkedStr == "N/A");
-                            newCategory.subcategory = newCategory.isConsumable ? SUBCATEGORY_TRAILER : SUBCATEGORY_OPTIONAL;
-                        }
-                    }
-                    
-                    inventory.push_back(newCategory);
-                    categoryIndex = inventory.size() - 1;
-                } else {
-                    // Update existing category's subcategory based on CSV data
-                    if (categoryTypeStr == "CONSUMABLES") {
-                        inventory[categoryIndex].isConsumable = true;
-                        inventory[categoryIndex].subcategory = SUBCATEGORY_TRAILER; // Consumables always use SUBCATEGORY_TRAILER
-                    } else {
-                        inventory[categoryIndex].isConsumable = false; // Equipment
-                        if (categoryTypeStr == "TRAILER") inventory[categoryIndex].subcategory = SUBCATEGORY_TRAILER;
-                        else if (categoryTypeStr == "ESSENTIALS") inventory[categoryIndex].subcategory = SUBCATEGORY_ESSENTIALS;
-                        else if (categoryTypeStr == "OPTIONAL") inventory[categoryIndex].subcategory = SUBCATEGORY_OPTIONAL;
-                        else {
-                            // Fallback: auto-detect based on status
-                            inventory[categoryIndex].isConsumable = (statusStr != "OK" || checkedStr == "N/A");
-                            inventory[categoryIndex].subcategory = inventory[categoryIndex].isConsumable ? SUBCATEGORY_TRAILER : SUBCATEGORY_OPTIONAL;
-                        }
-                    }
-                }
-                
-                // Add item to category
-                if (inventory[categoryIndex].isConsumable) {
-                    ConsumableItem item;
-                    item.name = itemName;
-                    item.livesInTrailer = (livesInTrailerStr == "Yes");
-                    
-                    // Parse status
-                    if (statusStr == "Low") item.status = STATUS_LOW;
-                    else if (statusStr == "Out") item.status = STATUS_OUT;
-                    else item.status = STATUS_OK;
-                    
-                    item.lastUpdated = millis();
-                    inventory[categoryIndex].consumables.push_back(item);
-                } else {
-                    EquipmentItem item;
-                    item.name = itemName;
-                    item.livesInTrailer = (livesInTrailerStr == "Yes");
-                    item.checked = (checkedStr == "Yes");
-                    item.packed = (packedStr == "Yes");
-                    item.taking = (takingStr == "Yes");
-                    item.lastUpdated = millis();
-                    inventory[categoryIndex].equipment.push_back(item);
-                }
-                
-                imported++;
-            }
+
+    if (!csvImport.finish()) {
+        Serial.printf("[CSV] Import rejected: %u errors\n", (unsigned)csvImport.errorCount());
+        String html = "<!DOCTYPE html><html><head><meta charset='UTF-8'><title>Import CSV</title>";
+        html += "<meta name='viewport' content='width=device-width,initial-scale=1'>";
+        html += "<style>body{font-family:Arial;padding:20px;background:#000;color:#fff}.warning{background:#ff6b35;color:#fff;padding:15px;border-radius:5px;margin:15px 0}a{color:#4af}</style></head><body>";
+        html += "<h2>📊 Import failed</h2>";
+        html += "<div class='warning'>" + String(csvImport.errorCount()) + " problem(s) found. Your inventory has not been changed.</div><ul>";
+        for (const CsvImportError& e : csvImport.errors()) {
+            String message = e.message;
+            message.replace("&", "&amp;");
+            message.replace("<", "&lt;");
+            html += e.line ? "<li>Line " + String(e.line) + ": " + message + "</li>" : "<li>" + message + "</li>";
         }
-        
-        lineNum++;
-        startPos = endPos + 1;
+        if (csvImport.errorCount() > csvImport.errors().size()) html += "<li>...</li>";
+        html += "</ul><p><a href='/inventory/import-csv'>Back to import</a></p></body></html>";
+        csvImport.reset();
+        compactInventoryNames(true);    // Drop the names of the rejected rows
+        server.send(400, "text/html", html);
+        return;
     }
-    
+
+    // Swap the staged inventory in, then drop the old items' names
+    size_t imported = csvImport.imported();
+    inventory.swap(csvImport.categories());
+    csvImport.reset();
+    compactInventoryNames(true);
+    assignItemIds();
+    inventoryStats.invalidate();
+
     // Save to SPIFFS
     if (saveInventoryToSPIFFS()) {
-        Serial.printf("[CSV] Import complete: %d items imported\n", imported);
+        Serial.printf("[CSV] Import complete: %u items imported\n", (unsigned)imported);
+        Serial.printf("[CSV] Heap free %u -> %u, largest block %u -> %u, %u names in %u bytes\n",
+                      heapBefore, ESP.getFreeHeap(), blockBefore, ESP.getMaxAllocHeap(),
+                      (unsigned)inventoryNames.count(), (unsigned)inventoryNames.bytesReserved());
         server.sendHeader("Location", "/inventory?imported=" + String(imported));
         server.send(303);
     } else {
@@ -3137,6 +2657,22 @@ void handleInventoryImportCSV() {
     }
 }
 
+// Multipart upload callback for /inventory/import-csv: parses the file as it
+// arrives, before handleInventoryImportCSV() runs.
+void handleInventoryImportUpload() {
+    HTTPUpload& upload = server.upload();
+    if (upload.status == UPLOAD_FILE_START) {
+        sampleCsvImportHeap();
+        if (upload.filename.length()) csvImport.begin();    // No file chosen: use the pasted text
+    } else if (upload.status == UPLOAD_FILE_WRITE && csvImport.active()) {
+        csvImport.write((const char*)upload.buf, upload.currentSize);
+    } else if (upload.status == UPLOAD_FILE_ABORTED) {
+        csvImport.reset();
+        compactInventoryNames(true);
+        csvImportHeapBefore = csvImportBlockBefore = 0;
+    }
+}
+
 void handleInventoryAddItem() {
     if (!server.hasArg("cat") || !server.hasArg("name")) {
         server.send(400, "text/plain", "Missing parameters");
@@ -3165,6 +2701,7 @@ void handleInventoryAddItem() {
             Serial.printf("[INVENTORY] Added equipment '%s' to category %d\n", name.c_str(), cat);
         }
         sortCategoryItems(inventory[cat]);  // Sort alphabetically after adding
+        inventoryStats.invalidate();
         saveInventoryToSPIFFS();  // Auto-save on add
         server.send(200, "text/plain", "OK");
         return;
@@ -3174,27 +2711,35 @@ void handleInventoryAddItem() {
 }
 
 void handleInventoryRemoveItem() {
-    if (!server.hasArg("cat") || !server.hasArg("item")) {
+    int cat, item;
+    if (!inventoryItemArg(cat, item)) {
         server.send(400, "text/plain", "Missing parameters");
         return;
     }
 
-    int cat = server.arg("cat").toInt();
-    int item = server.arg("item").toInt();
-
     if (cat >= 0 && cat < (int)inventory.size() && item >= 0) {
         if (inventory[cat].isConsumable && item < (int)inventory[cat].consumables.size()) {
-            String itemName = inventory[cat].consumables[item].name;
+            String itemName = inventory[cat].consumables[item].name.c_str();
+            uint16_t id = inventory[cat].consumables[item].id;
             inventory[cat].consumables.erase(inventory[cat].consumables.begin() + item);
+            inventoryIndex.remove(id);
+            inventoryIndex.placeCategory(cat);
+            inventoryStats.invalidate();
             Serial.printf("[INVENTORY] Removed consumable '%s' from category %d\n", itemName.c_str(), cat);
             saveInventoryToSPIFFS();  // Auto-save on remove
+            compactInventoryNames();
             server.send(200, "text/plain", "OK");
             return;
         } else if (!inventory[cat].isConsumable && item < (int)inventory[cat].equipment.size()) {
-            String itemName = inventory[cat].equipment[item].name;
+            String itemName = inventory[cat].equipment[item].name.c_str();
+            uint16_t id = inventory[cat].equipment[item].id;
             inventory[cat].equipment.erase(inventory[cat].equipment.begin() + item);
+            inventoryIndex.remove(id);
+            inventoryIndex.placeCategory(cat);
+            inventoryStats.invalidate();
             Serial.printf("[INVENTORY] Removed equipment '%s' from category %d\n", itemName.c_str(), cat);
             saveInventoryToSPIFFS();  // Auto-save on remove
+            compactInventoryNames();
             server.send(200, "text/plain", "OK");
             return;
         }
@@ -3264,13 +2809,11 @@ void handleInventoryAddCategory() {
 }
 
 void handleInventoryRenameItem() {
-    if (!server.hasArg("cat") || !server.hasArg("item") || !server.hasArg("name")) {
+    int cat, item;
+    if (!inventoryItemArg(cat, item) || !server.hasArg("name")) {
         server.send(400, "text/plain", "Missing parameters");
         return;
     }
-
-    int cat = server.arg("cat").toInt();
-    int item = server.arg("item").toInt();
     String newName = server.arg("name");
     newName.trim();
 
@@ -3281,19 +2824,21 @@ void handleInventoryRenameItem() {
 
     if (cat >= 0 && cat < (int)inventory.size() && item >= 0) {
         if (inventory[cat].isConsumable && item < (int)inventory[cat].consumables.size()) {
-            String oldName = inventory[cat].consumables[item].name;
+            String oldName = inventory[cat].consumables[item].name.c_str();
             inventory[cat].consumables[item].name = newName;
             Serial.printf("[INVENTORY] Renamed consumable '%s' to '%s' in category %d\n", oldName.c_str(), newName.c_str(), cat);
             sortCategoryItems(inventory[cat]);  // Re-sort after rename
             saveInventoryToSPIFFS();  // Auto-save on rename
+            compactInventoryNames();
             server.send(200, "text/plain", "OK");
             return;
         } else if (!inventory[cat].isConsumable && item < (int)inventory[cat].equipment.size()) {
-            String oldName = inventory[cat].equipment[item].name;
+            String oldName = inventory[cat].equipment[item].name.c_str();
             inventory[cat].equipment[item].name = newName;
             Serial.printf("[INVENTORY] Renamed equipment '%s' to '%s' in category %d\n", oldName.c_str(), newName.c_str(), cat);
             sortCategoryItems(inventory[cat]);  // Re-sort after rename
             saveInventoryToSPIFFS();  // Auto-save on rename
+            compactInventoryNames();
             server.send(200, "text/plain", "OK");
             return;
         }
@@ -3303,13 +2848,11 @@ void handleInventoryRenameItem() {
 }
 
 void handleInventoryEditConsumable() {
-    if (!server.hasArg("cat") || !server.hasArg("item") || !server.hasArg("name") || !server.hasArg("livesInTrailer")) {
+    int cat, item;
+    if (!inventoryItemArg(cat, item) || !server.hasArg("name") || !server.hasArg("livesInTrailer")) {
         server.send(400, "text/plain", "Missing parameters");
         return;
     }
-
-    int cat = server.arg("cat").toInt();
-    int item = server.arg("item").toInt();
     String newName = server.arg("name");
     bool livesInTrailer = (server.arg("livesInTrailer") == "true");
     newName.trim();
@@ -3321,11 +2864,13 @@ void handleInventoryEditConsumable() {
 
     if (cat >= 0 && cat < (int)inventory.size() && item >= 0) {
         if (inventory[cat].isConsumable && item < (int)inventory[cat].consumables.size()) {
-            String oldName = inventory[cat].consumables[item].name;
+            String oldName = inventory[cat].consumables[item].name.c_str();
             bool oldTrailer = inventory[cat].consumables[item].livesInTrailer;
             
+            inventoryStats.remove(cat, inventory[cat].consumables[item]);
             inventory[cat].consumables[item].name = newName;
             inventory[cat].consumables[item].livesInTrailer = livesInTrailer;
+            inventoryStats.add(cat, inventory[cat].consumables[item]);
             
             Serial.printf("[INVENTORY] Updated consumable '%s' to '%s', livesInTrailer: %s->%s in category %d\n", 
                          oldName.c_str(), newName.c_str(), 
@@ -3334,6 +2879,7 @@ void handleInventoryEditConsumable() {
             
             sortCategoryItems(inventory[cat]);  // Re-sort after edit
             saveInventoryToSPIFFS();  // Auto-save on edit
+            compactInventoryNames();
             server.send(200, "text/plain", "OK");
             return;
         }
@@ -3343,13 +2889,12 @@ void handleInventoryEditConsumable() {
 }
 
 void handleInventoryMoveItem() {
-    if (!server.hasArg("cat") || !server.hasArg("item") || !server.hasArg("target")) {
+    int sourceCat, itemIndex;
+    if (!inventoryItemArg(sourceCat, itemIndex) || !server.hasArg("target")) {
         server.send(400, "text/plain", "Missing parameters");
         return;
     }
 
-    int sourceCat = server.arg("cat").toInt();
-    int itemIndex = server.arg("item").toInt();
     int targetCat = server.arg("target").toInt();
 
     if (sourceCat >= 0 && sourceCat < (int)inventory.size() && 
@@ -3382,6 +2927,7 @@ void handleInventoryMoveItem() {
         // Re-sort both categories
         sortCategoryItems(inventory[sourceCat]);
         sortCategoryItems(inventory[targetCat]);
+        inventoryStats.invalidate();    // The tabs may differ
         saveInventoryToSPIFFS();  // Auto-save on move
         server.send(200, "text/plain", "OK");
         return;
@@ -3391,27 +2937,35 @@ void handleInventoryMoveItem() {
 }
 
 void handleInventoryDeleteItem() {
-    if (!server.hasArg("cat") || !server.hasArg("item")) {
+    int cat, item;
+    if (!inventoryItemArg(cat, item)) {
         server.send(400, "text/plain", "Missing parameters");
         return;
     }
 
-    int cat = server.arg("cat").toInt();
-    int item = server.arg("item").toInt();
-
     if (cat >= 0 && cat < (int)inventory.size() && item >= 0) {
         if (inventory[cat].isConsumable && item < (int)inventory[cat].consumables.size()) {
-            String itemName = inventory[cat].consumables[item].name;
+            String itemName = inventory[cat].consumables[item].name.c_str();
+            uint16_t id = inventory[cat].consumables[item].id;
             inventory[cat].consumables.erase(inventory[cat].consumables.begin() + item);
+            inventoryIndex.remove(id);
+            inventoryIndex.placeCategory(cat);
+            inventoryStats.invalidate();
             Serial.printf("[INVENTORY] Deleted consumable '%s' from category %d\n", itemName.c_str(), cat);
             saveInventoryToSPIFFS();
+            compactInventoryNames();
             server.send(200, "text/plain", "OK");
             return;
         } else if (!inventory[cat].isConsumable && item < (int)inventory[cat].equipment.size()) {
-            String itemName = inventory[cat].equipment[item].name;
+            String itemName = inventory[cat].equipment[item].name.c_str();
+            uint16_t id = inventory[cat].equipment[item].id;
             inventory[cat].equipment.erase(inventory[cat].equipment.begin() + item);
+            inventoryIndex.remove(id);
+            inventoryIndex.placeCategory(cat);
+            inventoryStats.invalidate();
             Serial.printf("[INVENTORY] Deleted equipment '%s' from category %d\n", itemName.c_str(), cat);
             saveInventoryToSPIFFS();
+            compactInventoryNames();
             server.send(200, "text/plain", "OK");
             return;
         }
@@ -3436,10 +2990,11 @@ void handleCategoryRename() {
     }
 
     if (cat >= 0 && cat < (int)inventory.size()) {
-        String oldName = inventory[cat].name;
+        String oldName = inventory[cat].name.c_str();
         inventory[cat].name = newName;
         Serial.printf("[INVENTORY] Renamed category '%s' to '%s'\n", oldName.c_str(), newName.c_str());
         saveInventoryToSPIFFS();
+        compactInventoryNames();
         server.send(200, "text/plain", "OK");
         return;
     }
@@ -3462,12 +3017,15 @@ void handleCategoryDelete() {
             return;
         }
 
-        String catName = inventory[cat].name;
+        String catName = inventory[cat].name.c_str();
         int itemCount = inventory[cat].isConsumable ? inventory[cat].consumables.size() : inventory[cat].equipment.size();
         
         inventory.erase(inventory.begin() + cat);
+        inventoryIndex.invalidate();    // Later categories have shifted down
+        inventoryStats.invalidate();
         Serial.printf("[INVENTORY] Deleted category '%s' with %d items\n", catName.c_str(), itemCount);
         saveInventoryToSPIFFS();
+        compactInventoryNames();
         server.send(200, "text/plain", "OK");
         return;
     }
@@ -3477,27 +3035,21 @@ void handleCategoryDelete() {
 
 // ============ SORTING FUNCTIONS ============
 
-// Sort items alphabetically within a category (case-insensitive)
+// Sort items alphabetically within a category (case-insensitive). `category`
+// must be an element of `inventory`; its items are re-indexed in place.
 void sortCategoryItems(DynamicCategory& category) {
     if (category.isConsumable) {
         std::sort(category.consumables.begin(), category.consumables.end(),
                   [](const ConsumableItem& a, const ConsumableItem& b) {
-                      String aLower = a.name;
-                      String bLower = b.name;
-                      aLower.toLowerCase();
-                      bLower.toLowerCase();
-                      return aLower < bLower;
+                      return strcasecmp(a.name, b.name) < 0;
                   });
     } else {
         std::sort(category.equipment.begin(), category.equipment.end(),
                   [](const EquipmentItem& a, const EquipmentItem& b) {
-                      String aLower = a.name;
-                      String bLower = b.name;
-                      aLower.toLowerCase();
-                      bLower.toLowerCase();
-                      return aLower < bLower;
+                      return strcasecmp(a.name, b.name) < 0;
                   });
     }
+    inventoryIndex.placeCategory(&category - inventory.data());
 }
 
 // Sort all categories alphabetically
@@ -3518,7 +3070,7 @@ void handleInventoryReset() {
     Serial.println("[INVENTORY] Current state saved with backup");
     
     // Clear memory and reload from saved data
-    inventory.clear();
+    clearInventory();
     loadInventoryFromSPIFFS();
     Serial.printf("[INVENTORY] Reset complete - %d categories loaded\n", inventory.size());
     String html = createStyledConfirmationPage(
@@ -3533,70 +3085,39 @@ void handleInventoryReset() {
 }
 
 bool createBackup(String backupName) {
-    if (!SPIFFS.exists("/inventory.json")) {
-        Serial.println("[BACKUP] No inventory.json to backup");
+    // Include taps not yet compacted (and convert a legacy JSON file)
+    if (inventoryJournal.pending() || !SPIFFS.exists(INVENTORY_SNAPSHOT_PATH)) saveInventoryToSPIFFS();
+
+    // Backups reference the snapshot's contents; restore sniffs binary vs legacy JSON
+    if (!SPIFFS.exists(INVENTORY_SNAPSHOT_PATH)) {
+        Serial.println("[BACKUP] No inventory snapshot to backup");
         return false;
     }
     
-    // Add timestamp to backup name for better identification
-    String timestamp = String(millis() / 1000);  // Simple timestamp
-    String backupPath = "/backup_" + backupName + ".json";
-    
-    // Check available space before creating backup
-    size_t totalBytes = SPIFFS.totalBytes();
-    size_t usedBytes = SPIFFS.usedBytes();
-    size_t freeBytes = totalBytes - usedBytes;
-    
-    // Estimate backup size (same as inventory.json)
-    File tempCheck = SPIFFS.open("/inventory.json", "r");
-    size_t inventorySize = 0;
-    if (tempCheck) {
-        inventorySize = tempCheck.size();
-        tempCheck.close();
-    }
-    
-    Serial.printf("[BACKUP] SPIFFS: %d/%d bytes used (%.1f%%), need ~%d bytes\n", 
-                  usedBytes, totalBytes, (usedBytes * 100.0 / totalBytes), inventorySize);
-    
-    // Auto-cleanup if low on space (less than 10KB free or backup won't fit)
-    if (freeBytes < 10240 || freeBytes < (inventorySize + 1024)) {
+    // Auto-cleanup if low on space (less than 10KB free). Only a snapshot
+    // not already in the store takes any room.
+    size_t freeBytes = SPIFFS.totalBytes() - SPIFFS.usedBytes();
+    if (freeBytes < 10240) {
         Serial.println("[BACKUP] Low on space, attempting cleanup...");
         cleanupOldBackups();
     }
     
-    // Read current inventory
-    File sourceFile = SPIFFS.open("/inventory.json", "r");
-    if (!sourceFile) {
-        Serial.println("[BACKUP] Failed to open source file");
-        return false;
-    }
-    
-    // Create backup file  
-    File backupFile = SPIFFS.open(backupPath, "w");
-    if (!backupFile) {
-        sourceFile.close();
-        Serial.println("[BACKUP] Failed to create backup file");
+    unsigned long start = millis();
+    if (!backupStore.put(backupName.c_str(), INVENTORY_SNAPSHOT_PATH)) {
+        Serial.printf("[BACKUP] Failed to create backup: %s\n", backupName.c_str());
         return false;
     }
     
-    // Copy data
-    while (sourceFile.available()) {
-        backupFile.write(sourceFile.read());
-    }
-    
-    sourceFile.close();
-    backupFile.close();
-    
-    Serial.printf("[BACKUP] Created backup: %s (%.1fKB)\n", backupPath.c_str(), inventorySize/1024.0);
+    Serial.printf("[BACKUP] Created backup: %s in %lums (%u backups, %.1fKB stored)\n", backupName.c_str(),
+                  millis() - start, (unsigned)backupStore.list().size(), backupStore.bytesStored() / 1024.0);
     return true;
 }
 
 void cleanupOldBackups() {
     // Clean up old numbered backups first (backup2, backup3, etc.)
     for (int i = 5; i >= 3; i--) {
-        String oldBackup = "/backup_backup" + String(i) + ".json";
-        if (SPIFFS.exists(oldBackup)) {
-            SPIFFS.remove(oldBackup);
+        String oldBackup = "backup" + String(i);
+        if (backupStore.remove(oldBackup.c_str())) {
             Serial.printf("[CLEANUP] Removed old backup: %s\n", oldBackup.c_str());
         }
     }
@@ -3604,8 +3125,7 @@ void cleanupOldBackups() {
     // If still low on space, remove backup2
     size_t freeBytes = SPIFFS.totalBytes() - SPIFFS.usedBytes();
     if (freeBytes < 8192) {  // Less than 8KB free
-        if (SPIFFS.exists("/backup_backup2.json")) {
-            SPIFFS.remove("/backup_backup2.json");
+        if (backupStore.remove("backup2")) {
             Serial.println("[CLEANUP] Removed backup2 due to low space");
         }
     }
@@ -3680,16 +3200,11 @@ void rotateBackups() {
     // Keep 3 backups: current, backup1, backup2
     
     // Remove oldest backup
-    SPIFFS.remove("/backup_backup2.json");
-    
-    // Shift backups
-    if (SPIFFS.exists("/backup_backup1.json")) {
-        SPIFFS.rename("/backup_backup1.json", "/backup_backup2.json");
-    }
+    backupStore.remove("backup2");
     
-    if (SPIFFS.exists("/backup_current.json")) {
-        SPIFFS.rename("/backup_current.json", "/backup_backup1.json");
-    }
+    // Shift backups (only the references move; contents stay where they are)
+    backupStore.rename("backup1", "backup2");
+    backupStore.rename("current", "backup1");
     
     Serial.println("[BACKUP] Backup rotation complete");
 }
@@ -3818,70 +3333,63 @@ void handleInventoryBackups() {
     html += "</div>";
     html += "<div style='font-size:0.8em;opacity:0.7;margin-top:4px'>";
     html += String(usedPercent, 1) + "% of " + String(totalBytes/1024) + "KB total";
+    html += " · backups " + String(backupStore.bytesStored()/1024.0, 1) + "KB";
     html += "</div></div>";
     
-    // Backup files
-    bool hasBackups = false;
-    File root = SPIFFS.open("/");
-    File file = root.openNextFile();
-    
+    // Backups
     struct BackupInfo {
         String name;
         String description;
         String cssClass;
         size_t size;
+        size_t shares;
         bool isSpecial;
     };
     
     std::vector<BackupInfo> backups;
     
-    while (file) {
-        String fileName = file.name();
-        Serial.printf("[BACKUP] Found file: %s\n", fileName.c_str());
-        if (fileName.startsWith("backup_") && fileName.endsWith(".json")) {
-            hasBackups = true;
-            String backupName = fileName.substring(7, fileName.length() - 5);
-            Serial.printf("[BACKUP] Valid backup: %s\n", backupName.c_str());
-            
-            BackupInfo info;
-            info.name = backupName;
-            info.size = file.size();
-            info.isSpecial = true;
-            
-            if (backupName == "current") {
-                info.description = "💾 Latest manual save - Your most recent saved state";
-                info.cssClass = "current";
-            } else if (backupName == "auto_reset") {
-                info.description = "🔄 Smart reset backup - Created before last reset";
-                info.cssClass = "auto";
-            } else if (backupName == "before_restore") {
-                info.description = "↩️ Pre-restore backup - Saved before last restore operation";
-                info.cssClass = "auto";
-            } else if (backupName.startsWith("daily_")) {
-                info.description = "📅 Daily auto-backup - Saved automatically each day";
-                info.cssClass = "daily";
-            } else if (backupName.startsWith("weekly_")) {
-                info.description = "📊 Weekly auto-backup - Saved every Sunday";
-                info.cssClass = "weekly";
-            } else if (backupName.startsWith("monthly_")) {
-                info.description = "🗓️ Monthly auto-backup - Saved on 1st of month";
-                info.cssClass = "monthly";
-            } else if (backupName.startsWith("quarterly_")) {
-                info.description = "📈 Quarterly auto-backup - Long-term archive";
-                info.cssClass = "quarterly";
-            } else if (backupName.startsWith("backup")) {
-                info.description = "📦 Rotated backup - Automatically managed";
-                info.cssClass = "old";
-            } else {
-                info.description = "📝 Manual backup";
-                info.cssClass = "";
-                info.isSpecial = false;
-            }
-            
-            backups.push_back(info);
+    for (const BackupRef& ref : backupStore.list()) {
+        String backupName = ref.name;
+        
+        BackupInfo info;
+        info.name = backupName;
+        info.size = ref.size;
+        info.shares = backupStore.shares(ref);
+        info.isSpecial = true;
+        
+        if (backupName == "current") {
+            info.description = "💾 Latest manual save - Your most recent saved state";
+            info.cssClass = "current";
+        } else if (backupName == "auto_reset") {
+            info.description = "🔄 Smart reset backup - Created before last reset";
+            info.cssClass = "auto";
+        } else if (backupName == "before_restore") {
+            info.description = "↩️ Pre-restore backup - Saved before last restore operation";
+            info.cssClass = "auto";
+        } else if (backupName.startsWith("daily_")) {
+            info.description = "📅 Daily auto-backup - Saved automatically each day";
+            info.cssClass = "daily";
+        } else if (backupName.startsWith("weekly_")) {
+            info.description = "📊 Weekly auto-backup - Saved every Sunday";
+            info.cssClass = "weekly";
+        } else if (backupName.startsWith("monthly_")) {
+            info.description = "🗓️ Monthly auto-backup - Saved on 1st of month";
+            info.cssClass = "monthly";
+        } else if (backupName.startsWith("quarterly_")) {
+            info.description = "📈 Quarterly auto-backup - Long-term archive";
+            info.cssClass = "quarterly";
+        } else if (backupName.startsWith("backup")) {
+            info.description = "📦 Rotated backup - Automatically managed";
+            info.cssClass = "old";
+        } else {
+            info.description = "📝 Manual backup";
+            info.cssClass = "";
+            info.isSpecial = false;
         }
-        file = root.openNextFile();
+        
+        backups.push_back(info);
     }
+    bool hasBackups = !backups.empty();
     
     Serial.printf("[BACKUP] Total backups found: %d\n", backups.size());
     
@@ -3896,7 +3404,9 @@ void handleInventoryBackups() {
             else html += "📦 ";
             html += backup.name;
             html += "</div>";
-            html += "<div class='backup-size'>" + String(backup.size) + "B</div>";
+            html += "<div class='backup-size'>" + String(backup.size) + "B";
+            if (backup.shares > 1) html += " · shared ×" + String(backup.shares);
+            html += "</div>";
             html += "</div>";
             html += "<div class='backup-desc'>" + backup.description + "</div>";
             html += "<div class='backup-actions'>";
@@ -3934,6 +3444,17 @@ void handleInventoryBackups() {
     html += "<a href='/inventory/reset' class='btn btn-secondary' onclick='return confirm(\"Smart Reset will:\\n\\n✓ Create backup first\\n✓ Preserve all customizations\\n✓ Refresh the system\\n\\nProceed?\")'>🔄 Smart Reset</a>";
     html += "</div>";
     
+    html += "<div class='action-card'>";
+    html += "<div class='action-desc'>";
+    html += "<div class='action-title'>Export</div>";
+    html += "<div class='action-subtitle'>Download the inventory to keep off the device</div>";
+    html += "</div>";
+    html += "<div class='backup-actions'>";
+    html += "<a href='/inventory/export-csv' class='btn btn-secondary'>CSV</a>";
+    html += "<a href='/inventory/export-json' class='btn btn-secondary'>JSON</a>";
+    html += "<a href='/inventory/export-snapshot' class='btn btn-secondary'>Snapshot</a>";
+    html += "</div></div>";
+    
     html += "</div></div>";
     
     // Navigation buttons
@@ -3954,9 +3475,8 @@ void handleInventoryRestore() {
     }
     
     String backupName = server.arg("backup");
-    String backupPath = "/backup_" + backupName + ".json";
     
-    if (!SPIFFS.exists(backupPath)) {
+    if (!backupStore.exists(backupName.c_str())) {
         String html = createStyledConfirmationPage(
             "Backup Not Found", 
             "🔍", 
@@ -3969,16 +3489,24 @@ void handleInventoryRestore() {
         return;
     }
     
-    Serial.printf("[BACKUP] Restoring from backup: %s\n", backupPath.c_str());
+    Serial.printf("[BACKUP] Restoring from backup: %s\n", backupName.c_str());
     
-    // Create backup of current state before restoring
-    createBackup("before_restore");
+    // Copy the backup out first: restoring "before_restore" itself would
+    // otherwise replace it with the current state below
+    bool copied = backupStore.restore(backupName.c_str(), BACKUP_RESTORE_TMP);
     
-    // Copy backup to main inventory file
-    File backupFile = SPIFFS.open(backupPath, "r");
-    File inventoryFile = SPIFFS.open("/inventory.json", "w");
+    if (copied) {
+        // Create backup of current state before restoring
+        createBackup("before_restore");
+        
+        // Move backup into place as the main inventory file (journal refers to the old state)
+        inventoryJournal.clear();
+        SPIFFS.remove(INVENTORY_SNAPSHOT_PATH);
+        copied = SPIFFS.rename(BACKUP_RESTORE_TMP, INVENTORY_SNAPSHOT_PATH);
+    }
     
-    if (!backupFile || !inventoryFile) {
+    if (!copied) {
+        SPIFFS.remove(BACKUP_RESTORE_TMP);
         String html = createStyledConfirmationPage(
             "Restore Failed", 
             "❌", 
@@ -3991,16 +3519,8 @@ void handleInventoryRestore() {
         return;
     }
     
-    // Copy data
-    while (backupFile.available()) {
-        inventoryFile.write(backupFile.read());
-    }
-    
-    backupFile.close();
-    inventoryFile.close();
-    
     // Reload inventory
-    inventory.clear();
+    clearInventory();
     loadInventoryFromSPIFFS();
     
     Serial.printf("[BACKUP] ✓ Restored from backup: %s\n", backupName.c_str());
@@ -4022,9 +3542,8 @@ void handleInventoryDeleteBackup() {
     }
     
     String backupName = server.arg("backup");
-    String backupPath = "/backup_" + backupName + ".json";
     
-    if (!SPIFFS.exists(backupPath)) {
+    if (!backupStore.exists(backupName.c_str())) {
         String html = createStyledConfirmationPage(
             "Backup Not Found", 
             "🔍", 
@@ -4051,9 +3570,9 @@ void handleInventoryDeleteBackup() {
         return;
     }
     
-    Serial.printf("[BACKUP] Deleting backup: %s\n", backupPath.c_str());
+    Serial.printf("[BACKUP] Deleting backup: %s\n", backupName.c_str());
     
-    if (SPIFFS.remove(backupPath)) {
+    if (backupStore.remove(backupName.c_str())) {
         Serial.printf("[BACKUP] ✓ Deleted backup: %s\n", backupName.c_str());
         String html = createStyledConfirmationPage(
             "Backup Deleted Successfully", 
@@ -4082,18 +3601,13 @@ void handleInventoryFactoryReset() {
     Serial.println("[INVENTORY] FACTORY RESET - Wiping ALL data including backups...");
     
     // Remove all inventory and backup files
-    File root = SPIFFS.open("/");
-    File file = root.openNextFile();
-    while (file) {
-        String fileName = file.name();
-        if (fileName.equals("/inventory.json") || fileName.startsWith("/backup_")) {
-            SPIFFS.remove(fileName);
-            Serial.printf("[FACTORY] Deleted: %s\n", fileName.c_str());
-        }
-        file = root.openNextFile();
-    }
+    backupStore.clear();
+    Serial.println("[FACTORY] Deleted all backups");
+    SPIFFS.remove(INVENTORY_SNAPSHOT_PATH);
+    SPIFFS.remove(INVENTORY_LEGACY_PATH);
+    inventoryJournal.clear();
     
-    inventory.clear();
+    clearInventory();
     initializeDefaultInventory();
     Serial.println("[INVENTORY] Factory reset complete - all data wiped");
     String html = createStyledConfirmationPage(
@@ -4109,7 +3623,7 @@ void handleInventoryFactoryReset() {
 
 void initializeDefaultInventory() {
     Serial.println("[INVENTORY] Initializing default inventory structure...");
-    inventory.clear();
+    clearInventory();
     
     // Default trailer inventory - you can customize this or load from external source
     DynamicCategory food("Food & Beverages", "🍽️", true, SUBCATEGORY_TRAILER);
@@ -4132,32 +3646,17 @@ void initializeDefaultInventory() {
     Serial.printf("[INVENTORY] Created default inventory with %d categories\n", inventory.size());
 }
 
-void loadInventoryFromSPIFFS() {
-    if (!SPIFFS.exists("/inventory.json")) {
-        Serial.println("[INVENTORY] No saved data, initializing defaults");
-        initializeDefaultInventory();
-        return;
-    }
-
-    File file = SPIFFS.open("/inventory.json", "r");
-    if (!file) {
-        Serial.println("[INVENTORY] Failed to open file, initializing defaults");
-        initializeDefaultInventory();
-        return;
-    }
-
+// Legacy /inventory.json reader (also used for backups taken before the binary format)
+bool loadInventoryFromJson(File& file) {
     JsonDocument doc;
     DeserializationError error = deserializeJson(doc, file);
-    file.close();
 
     if (error) {
         Serial.printf("[INVENTORY] JSON parse error: %s\n", error.c_str());
-        Serial.println("[INVENTORY] Initializing defaults");
-        initializeDefaultInventory();
-        return;
+        return false;
     }
 
-    inventory.clear();
+    clearInventory();
     JsonArray categories = doc.as<JsonArray>();
     
     for (JsonObject categoryObj : categories) {
@@ -4187,7 +3686,7 @@ void loadInventoryFromSPIFFS() {
                                  livesInTrailer ? "Yes" : "No");
                 }
                 
-                unsigned long lastUpdated = itemObj["lastUpdated"] | millis();
+                unsigned long lastUpdated = itemObj["lastUpdated"] | (unsigned long)wallClock.now();
                 
                 ConsumableItem item(itemName, (ItemStatus)status, livesInTrailer);
                 item.lastUpdated = lastUpdated;
@@ -4202,7 +3701,7 @@ void loadInventoryFromSPIFFS() {
                 
                 // Load or set livesInTrailer (always true for equipment by default)
                 bool livesInTrailer = itemObj["livesInTrailer"] | true;
-                unsigned long lastUpdated = itemObj["lastUpdated"] | millis();
+                unsigned long lastUpdated = itemObj["lastUpdated"] | (unsigned long)wallClock.now();
                 
                 EquipmentItem item(itemName, checked, packed, taking);
                 item.livesInTrailer = livesInTrailer;
@@ -4213,18 +3712,102 @@ void loadInventoryFromSPIFFS() {
         
         inventory.push_back(category);
     }
+    return true;
+}
+
+void loadInventoryFromSPIFFS() {
+    // A save interrupted between remove and rename leaves only the temp file
+    if (!SPIFFS.exists(INVENTORY_SNAPSHOT_PATH) && SPIFFS.exists(INVENTORY_SNAPSHOT_TMP)) {
+        SPIFFS.rename(INVENTORY_SNAPSHOT_TMP, INVENTORY_SNAPSHOT_PATH);
+    }
+
+    const char* path = SPIFFS.exists(INVENTORY_SNAPSHOT_PATH) ? INVENTORY_SNAPSHOT_PATH
+                     : SPIFFS.exists(INVENTORY_LEGACY_PATH) ? INVENTORY_LEGACY_PATH : nullptr;
+    if (!path) {
+        Serial.println("[INVENTORY] No saved data, initializing defaults");
+        inventoryJournal.clear();
+        initializeDefaultInventory();
+        return;
+    }
+
+    File file = SPIFFS.open(path, "r");
+    if (!file) {
+        Serial.println("[INVENTORY] Failed to open file, initializing defaults");
+        inventoryJournal.clear();
+        initializeDefaultInventory();
+        return;
+    }
+
+    // Sniff the format rather than trust the name: restored backups may be either
+    bool binary = isInventorySnapshot(file);
+    bool loaded = binary ? readInventorySnapshot(file) : loadInventoryFromJson(file);
+    file.close();
+    if (!loaded) {
+        Serial.println("[INVENTORY] Initializing defaults");
+        inventoryJournal.clear();
+        initializeDefaultInventory();
+        return;
+    }
 
     Serial.printf("[INVENTORY] Loaded %d categories from SPIFFS\n", inventory.size());
     if (inventory.size() == 0) {
         Serial.println("[INVENTORY] Empty file, initializing defaults");
+        inventoryJournal.clear();
         initializeDefaultInventory();
     }
     sortAllInventory();  // Ensure alphabetical order after loading
+    inventoryJournal.replay();  // Taps made after the snapshot was written
+    inventoryStats.invalidate();
+    if (!binary) saveInventoryToSPIFFS();   // Convert to the binary snapshot
+}
+
+#ifdef INVENTORY_LOAD_BENCH
+// Boot-time comparison of the binary and legacy JSON loaders on the current
+// inventory. Enable with -DINVENTORY_LOAD_BENCH in build_flags. Peak heap
+// comes from the free-heap watermark, so it is only exact when the load
+// sets a new low (reported as ">=" otherwise).
+void benchmarkInventoryLoad() {
+    const char* jsonPath = "/bench_inventory.json";
+    const char* binPath = "/bench_inventory.bin";
+    if (!saveInventoryJson(jsonPath) || !writeInventorySnapshot(binPath)) {
+        Serial.println("[BENCH] ✗ Could not write benchmark files");
+        return;
+    }
+
+    struct { const char* name; const char* path; bool binary; } runs[] = {
+        {"binary", binPath, true},
+        {"json", jsonPath, false},
+    };
+    for (auto& run : runs) {
+        File file = SPIFFS.open(run.path, "r");
+        size_t bytes = file.size();
+        clearInventory();
+        inventory.shrink_to_fit();
+
+        uint32_t freeBefore = ESP.getFreeHeap();
+        uint32_t lowBefore = ESP.getMinFreeHeap();
+        unsigned long start = micros();
+        bool ok = run.binary ? readInventorySnapshot(file) : loadInventoryFromJson(file);
+        unsigned long elapsed = micros() - start;
+        uint32_t lowAfter = ESP.getMinFreeHeap();
+        uint32_t kept = freeBefore - ESP.getFreeHeap();
+        file.close();
+
+        Serial.printf("[BENCH] %-6s %5u bytes  %7lu us  heap kept %6u  peak %s%u  %s\n",
+                      run.name, (unsigned)bytes, elapsed, kept,
+                      lowAfter < lowBefore ? "" : ">=", lowAfter < lowBefore ? freeBefore - lowAfter : kept,
+                      ok ? "ok" : "FAILED");
+    }
+
+    SPIFFS.remove(jsonPath);
+    SPIFFS.remove(binPath);
+    loadInventoryFromSPIFFS();
 }
+#endif
 
 void handleInventoryReload() {
     Serial.println("[INVENTORY] Reloading from SPIFFS...");
-    inventory.clear();
+    clearInventory();
     loadInventoryFromSPIFFS();
     Serial.printf("[INVENTORY] Reload complete - %d categories loaded\n", inventory.size());
     server.send(200, "text/html", "<html><body><h1>Inventory Reloaded</h1><p>Loaded " + String(inventory.size()) + " categories from saved data.</p><p><a href='/inventory'>Return to Inventory</a></p></body></html>");
@@ -4240,7 +3823,7 @@ void handleInventoryFixTabs() {
             inventory[i].subcategory = SUBCATEGORY_TRAILER;
         } else {
             // Equipment assignments based on actual category names
-            String catName = inventory[i].name;
+            String catName = inventory[i].name.c_str();
             
             if (catName == "Trailer Systems" || catName == "Kitchen Basics" || 
                 catName == "Crockery and Cutlery" || catName == "Tools and Utilities") {
@@ -4259,6 +3842,8 @@ void handleInventoryFixTabs() {
         }
     }
     
+    inventoryStats.invalidate();
+
     // Save the corrected assignments
     if (saveInventoryToSPIFFS()) {
         Serial.println("[FIX] Tab assignments corrected and saved!");
@@ -4327,52 +3912,11 @@ void handleInventoryClearAll() {
             String body = server.arg("plain");
             Serial.printf("[INVENTORY] Clear filtered items body: %s\n", body.c_str());
             
-            // Simple JSON parsing for {items:[{cat:0,item:1},{cat:0,item:2}]}
-            int itemsStart = body.indexOf("\"items\":[");
-            if (itemsStart >= 0) {
-                itemsStart += 9; // Skip "items":["
-                int itemsEnd = body.indexOf(']', itemsStart);
-                if (itemsEnd > itemsStart) {
-                    String itemsStr = body.substring(itemsStart, itemsEnd);
-                    Serial.printf("[INVENTORY] Items string: %s\n", itemsStr.c_str());
-                    
-                    // Parse each {cat:X,item:Y} object
-                    int pos = 0;
-                    while (pos < itemsStr.length()) {
-                        int objStart = itemsStr.indexOf('{', pos);
-                        if (objStart < 0) break;
-                        int objEnd = itemsStr.indexOf('}', objStart);
-                        if (objEnd < 0) break;
-                        
-                        String obj = itemsStr.substring(objStart, objEnd + 1);
-                        Serial.printf("[INVENTORY] Processing object: %s\n", obj.c_str());
-                        
-                        // Extract cat and item numbers
-                        int catPos = obj.indexOf("\"cat\":");
-                        int itemPos = obj.indexOf("\"item\":");
-                        if (catPos >= 0 && itemPos >= 0) {
-                            int catStart = catPos + 7; // Skip "cat":" and opening quote
-                            int catEnd = obj.indexOf('"', catStart); // Find closing quote
-                            
-                            int itemStart = itemPos + 8; // Skip "item":" and opening quote
-                            int itemEnd = obj.indexOf('"', itemStart); // Find closing quote
-                            
-                            int catNum = obj.substring(catStart, catEnd).toInt();
-                            int itemNum = obj.substring(itemStart, itemEnd).toInt();
-                            
-                            Serial.printf("[INVENTORY] Parsed cat:%d, item:%d\n", catNum, itemNum);
-                            
-                            if (catNum < inventory.size() && inventory[catNum].isConsumable && 
-                                itemNum < inventory[catNum].consumables.size()) {
-                                inventory[catNum].consumables[itemNum].status = STATUS_OUT;
-                                cleared++;
-                                Serial.printf("[INVENTORY] Set item to OUT: cat:%d, item:%d\n", catNum, itemNum);
-                            }
-                        }
-                        
-                        pos = objEnd + 1;
-                    }
-                }
+            // {items:[{id:N},...]}; older pages send {cat,item} pairs instead
+            cleared = setListedConsumables(body, STATUS_OUT);
+            if (cleared < 0) {
+                server.send(400, "text/plain", "Invalid JSON");
+                return;
             }
             Serial.printf("[INVENTORY] Cleared %d filtered consumables to OUT\n", cleared);
         } else {
@@ -4391,6 +3935,7 @@ void handleInventoryClearAll() {
         return;
     }
 
+    inventoryStats.invalidate();
     saveInventoryToSPIFFS();
     server.send(200, "text/plain", "OK");
 }
@@ -4414,8 +3959,10 @@ void checkDailyBackup() {
     }
     lastBackupCheck = millis();
     
-    // Get current day (days since boot)
-    unsigned long currentDay = millis() / 86400000;
+    // Days are calendar days from the persisted wall clock, so retention
+    // survives power cycles. Until a browser has ever set it there is no date.
+    if (!wallClock.valid()) return;
+    unsigned long currentDay = wallClock.now() / 86400;
     
     // Check if we need a daily backup (once per day)
     if (currentDay != lastBackupDay) {
@@ -4434,240 +3981,97 @@ void checkDailyBackup() {
     }
 }
 
+// One backup per week/month/quarter, taken on the first day the device is on
+// in that period (a reference to the same snapshot as the daily, so free)
 void checkWeeklyMonthlyBackups(unsigned long currentDay) {
-    // Create weekly backup every 7 days (simulating Sunday)
-    if (currentDay % 7 == 0) {
-        String weeklyName = "weekly_" + String(currentDay / 7);
+    String weeklyName = "weekly_" + String(currentDay / 7);
+    if (!backupStore.exists(weeklyName.c_str())) {
         createBackup(weeklyName);
         Serial.printf("[AUTO-BACKUP] ✓ Weekly: %s\n", weeklyName.c_str());
     }
     
-    // Create monthly backup every 30 days (simulating 1st of month)
-    if (currentDay % 30 == 0) {
-        String monthlyName = "monthly_" + String(currentDay / 30);
+    String monthlyName = "monthly_" + String(currentDay / 30);
+    if (!backupStore.exists(monthlyName.c_str())) {
         createBackup(monthlyName);
         Serial.printf("[AUTO-BACKUP] ✓ Monthly: %s\n", monthlyName.c_str());
     }
     
-    // Create quarterly backup every 90 days
-    if (currentDay % 90 == 0) {
-        String quarterlyName = "quarterly_" + String(currentDay / 90);
+    String quarterlyName = "quarterly_" + String(currentDay / 90);
+    if (!backupStore.exists(quarterlyName.c_str())) {
         createBackup(quarterlyName);
         Serial.printf("[AUTO-BACKUP] ✓ Quarterly: %s\n", quarterlyName.c_str());
     }
 }
 
 void smartBackupCleanup(unsigned long currentDay) {
-    File root = SPIFFS.open("/");
-    File file = root.openNextFile();
+    // Retention only drops references; a snapshot's contents go once nothing points at them
+    std::vector<String> expired;
     
-    while (file) {
-        String fileName = file.name();
-        bool shouldDelete = false;
+    for (const BackupRef& ref : backupStore.list()) {
+        String name = ref.name;
         
         // Daily backups: keep last 7 days
-        if (fileName.startsWith("/backup_daily_")) {
-            unsigned long day = fileName.substring(14, fileName.indexOf(".json")).toInt();
-            if (currentDay - day > 7) {
-                shouldDelete = true;
-                Serial.printf("[CLEANUP] Daily backup expired: %s\n", fileName.c_str());
-            }
+        if (name.startsWith("daily_")) {
+            unsigned long day = name.substring(6).toInt();
+            if (currentDay - day > 7) expired.push_back(name);
         }
         
         // Weekly backups: keep last 4 weeks
-        else if (fileName.startsWith("/backup_weekly_")) {
-            unsigned long week = fileName.substring(15, fileName.indexOf(".json")).toInt();
-            if (currentDay / 7 - week > 4) {
-                shouldDelete = true;
-                Serial.printf("[CLEANUP] Weekly backup expired: %s\n", fileName.c_str());
-            }
+        else if (name.startsWith("weekly_")) {
+            unsigned long week = name.substring(7).toInt();
+            if (currentDay / 7 - week > 4) expired.push_back(name);
         }
         
         // Monthly backups: keep last 6 months
-        else if (fileName.startsWith("/backup_monthly_")) {
-            unsigned long month = fileName.substring(16, fileName.indexOf(".json")).toInt();
-            if (currentDay / 30 - month > 6) {
-                shouldDelete = true;
-                Serial.printf("[CLEANUP] Monthly backup expired: %s\n", fileName.c_str());
-            }
+        else if (name.startsWith("monthly_")) {
+            unsigned long month = name.substring(8).toInt();
+            if (currentDay / 30 - month > 6) expired.push_back(name);
         }
         
         // Quarterly backups: keep last 4 quarters
-        else if (fileName.startsWith("/backup_quarterly_")) {
-            unsigned long quarter = fileName.substring(18, fileName.indexOf(".json")).toInt();
-            if (currentDay / 90 - quarter > 4) {
-                shouldDelete = true;
-                Serial.printf("[CLEANUP] Quarterly backup expired: %s\n", fileName.c_str());
-            }
-        }
-        
-        if (shouldDelete) {
-            SPIFFS.remove(fileName);
+        else if (name.startsWith("quarterly_")) {
+            unsigned long quarter = name.substring(10).toInt();
+            if (currentDay / 90 - quarter > 4) expired.push_back(name);
         }
-        
-        file = root.openNextFile();
     }
-}
-
-void handleMonitor() {
-    // Get system information
-    uint32_t freeHeap = ESP.getFreeHeap();
-    uint32_t heapSize = ESP.getHeapSize();
-    uint32_t maxAllocHeap = ESP.getMaxAllocHeap();
-    uint32_t freeSketchSpace = ESP.getFreeSketchSpace();
-    uint32_t chipRev = ESP.getChipRevision();
-    uint32_t cpuFreq = ESP.getCpuFreqMHz();
-    unsigned long uptime = millis() / 1000;
-    
-    // Calculate memory usage percentage
-    float heapUsage = ((float)(heapSize - freeHeap) / heapSize) * 100;
     
-    // Determine alert level and status
-    String alertLevel = "Normal";
-    String alertColor = "#4ade80";
-    String statusIndicator = "●";
-    if (freeHeap < 20000) { 
-        alertLevel = "Critical"; 
-        alertColor = "#ef4444"; 
+    for (const String& name : expired) {
+        backupStore.remove(name.c_str());
+        Serial.printf("[CLEANUP] Backup expired: %s\n", name.c_str());
     }
-    else if (freeHeap < 40000) { 
-        alertLevel = "Warning"; 
-        alertColor = "#f97316"; 
-    }
-    else if (freeHeap < 60000) { 
-        alertLevel = "Caution"; 
-        alertColor = "#eab308"; 
-    }
-
-    String html = "<!DOCTYPE html><html><head>";
-    html += "<meta charset='UTF-8'>";
-    html += "<meta name='viewport' content='width=device-width,initial-scale=1,viewport-fit=cover'>";
-    html += "<title>System Monitor - Trailer Dashboard</title>";
-    
-    // Use the same styling as main dashboard
-    html += "<style>";
-    html += "*{-webkit-touch-callout:none;-webkit-user-select:none;user-select:none}";
-    html += "body{background:#000;color:#fff;font-family:-apple-system,BlinkMacSystemFont,'Segoe UI',Arial,sans-serif;margin:0;padding:8px;line-height:1.3;font-size:15px}";
-
-    // Same card styling as main dashboard
-    html += ".c{background:linear-gradient(135deg,#1a1a1a 0%,#111 100%);margin:8px 0;padding:10px;border-radius:12px;border-left:3px solid #333;box-shadow:0 4px 6px rgba(0,0,0,0.3);position:relative}";
-    html += ".c.online{border-left-color:#4f4;box-shadow:0 4px 6px rgba(79,244,79,0.2)}";
-    html += ".c.warn{border-left-color:#f80;box-shadow:0 4px 6px rgba(255,136,0,0.2)}";
-    html += ".c.critical{border-left-color:#f22;box-shadow:0 4px 6px rgba(255,34,34,0.2)}";
-
-    // Headers with icons - same as main dashboard
-    html += "h2{margin:0 0 6px;font-size:1.05em;color:#ddd;display:flex;align-items:center;gap:8px;font-weight:600}";
-    html += ".icon{font-size:1.3em;filter:drop-shadow(0 2px 4px rgba(0,0,0,0.5))}";
-
-    // Main values with gradient backgrounds
-    html += ".v{font-size:1.5em;font-weight:bold;margin:4px 0;line-height:1;padding:5px 8px;border-radius:8px;display:inline-block;background:linear-gradient(135deg,#4f4,#2d2);color:#000;box-shadow:0 2px 4px rgba(79,244,79,0.3)}";
-    html += ".v.warn{background:linear-gradient(135deg,#f80,#d60);color:#000;box-shadow:0 2px 4px rgba(255,136,0,0.3)}";
-    html += ".v.critical{background:linear-gradient(135deg,#f22,#d00);color:#fff;box-shadow:0 2px 4px rgba(255,34,34,0.3)}";
-
-    // Grid layout for metrics - same as main dashboard
-    html += ".content{display:flex;gap:15px;align-items:center}";
-    html += ".grid{display:grid;grid-template-columns:1fr 1fr;gap:6px 12px;font-size:0.95em;flex:1}";
-    html += ".item{display:flex;flex-direction:column}";
-    html += ".label{color:#999;font-size:0.8em;margin-bottom:2px;font-weight:500}";
-    html += ".value{color:#fff;font-size:1.05em;font-weight:500}";
-
-    // Navigation back button
-    html += ".nav-back{display:inline-block;margin-bottom:10px;padding:8px 16px;background:linear-gradient(135deg,#4facfe,#00f2fe);";
-    html += "border-radius:8px;color:#fff;text-decoration:none;font-size:0.9em;font-weight:600}";
-
-    // Navigation buttons (same as main page)
-    html += ".nav-buttons{margin-top:15px;display:flex;gap:6px}";
-    html += ".nav-btn{flex:1;padding:10px;border-radius:8px;text-align:center;color:#fff;font-weight:600;cursor:pointer;font-size:0.9em}";
-    html += ".nav-btn.fridge{background:linear-gradient(135deg,#667eea,#764ba2)}";
-    html += ".nav-btn.monitor{background:linear-gradient(135deg,#4facfe,#00f2fe)}";
-    html += ".nav-btn.inventory{background:linear-gradient(135deg,#667eea,#764ba2)}";
-
-    // Refresh button - smaller and in corner like dashboard
-    html += ".refresh-btn{position:fixed;bottom:15px;right:15px;width:40px;height:40px;";
-    html += "border-radius:20px;background:linear-gradient(135deg,#4facfe,#00f2fe);border:none;color:#fff;font-size:1em;cursor:pointer;";
-    html += "box-shadow:0 4px 8px rgba(0,0,0,0.3)}";
-
-    // Tablet/iPad optimization - same as main dashboard
-    html += "@media(min-width:768px){";
-    html += "body{padding:10px 15px;max-width:1200px;margin:0 auto;font-size:16px}";
-    html += ".c{margin:8px 0;padding:12px;border-radius:12px;border-left-width:4px}";
-    html += "h2{font-size:1.15em;margin-bottom:6px}";
-    html += ".v{font-size:2em;padding:6px 12px}";
-    html += ".nav-btn{padding:14px!important;font-size:1.1em!important}";
-    html += "}";
-    
-    html += "</style>";
-    html += "<meta http-equiv='refresh' content='5'>";
-    html += "</head><body>";
-    
-    // Memory Status Card (same style as main dashboard cards)
-    String cardClass = "c";
-    if (freeHeap < 20000) cardClass += " critical";
-    else if (freeHeap < 60000) cardClass += " warn";
-    else cardClass += " online";
-    
-    html += "<div class='" + cardClass + "'>";
-    html += "<h2><span class='icon'>\u{1F4CA}</span>SYSTEM MONITOR<span style='background:#444;padding:2px 6px;border-radius:6px;font-size:0.68em;color:#aaa;margin-left:5px'>ESP32</span></h2>";
-    
-    html += "<div class='content'>";
-    
-    // Main memory value (same style as dashboard)
-    String valueClass = "v";
-    if (freeHeap < 20000) valueClass += " critical";
-    else if (freeHeap < 60000) valueClass += " warn";
-    html += "<div class='" + valueClass + "'>" + String(freeHeap / 1024) + " KB</div>";
-    
-    // Grid with system metrics
-    html += "<div class='grid'>";
-    html += "<div class='item'><div class='label'>Memory Used</div><div class='value'>" + String(heapUsage, 1) + "%</div></div>";
-    
-    int hours = uptime / 3600;
-    int minutes = (uptime % 3600) / 60;
-    html += "<div class='item'><div class='label'>Uptime</div><div class='value'>" + String(hours) + "h " + String(minutes) + "m</div></div>";
-    
-    bool dataRecent = (millis() - lastReceived) < 60000;
-    html += "<div class='item'><div class='label'>Data Status</div><div class='value' style='color:" + String(dataRecent ? "#4f4" : "#f22") + "'>";
-    html += String(dataRecent ? "Active" : "Stale") + "</div></div>";
-    
-    html += "<div class='item'><div class='label'>ESP32 Packets</div><div class='value'>" + String(packetsReceived) + "</div></div>";
-    html += "</div></div></div>";
-    
-    // System Details Card
-    html += "<div class='c'>";
-    html += "<h2><span class='icon'>\u{2699}\u{FE0F}</span>SYSTEM INFO</h2>";
-    html += "<div class='content'>";
-    html += "<div class='v' style='background:linear-gradient(135deg,#4facfe,#00f2fe);color:#000'>" + String(cpuFreq) + " MHz</div>";
-    
-    html += "<div class='grid'>";
-    html += "<div class='item'><div class='label'>Chip Rev</div><div class='value'>v" + String(chipRev) + "</div></div>";
-    html += "<div class='item'><div class='label'>Max Alloc</div><div class='value'>" + String(maxAllocHeap / 1024) + " KB</div></div>";
-    html += "<div class='item'><div class='label'>Alert Level</div><div class='value' style='color:" + alertColor + "'>" + alertLevel + "</div></div>";
-    html += "<div class='item'><div class='label'>Free Flash</div><div class='value'>" + String(freeSketchSpace / 1024) + " KB</div></div>";
-    html += "</div></div></div>";
-    
-    // Navigation buttons - change to Dashboard, Fridge, Inventory
-    html += "<div class='nav-buttons'>";
-    html += "<div class='nav-btn fridge' onclick=\"window.location.href='/'\">\u{1F3E0} Dashboard</div>";
-    html += "<div class='nav-btn fridge' onclick=\"window.location.href='/fridge'\">\u{1F9CA} Fridge</div>";
-    html += "<div class='nav-btn inventory' onclick=\"window.location.href='/inventory'\">\u{1F69A} Inventory</div>";
-    html += "</div>";
+}
 
-    // Footer (same as main dashboard)
-    html += "<div style='margin-top:10px;padding:6px;background:#111;border-radius:4px;font-size:0.7em;color:#666;text-align:center'>";
-    unsigned long secondsAgo = (millis() - lastReceived) / 1000;
-    html += "Memory: " + String(freeHeap / 1024) + "KB free | ";
-    if (secondsAgo < 60) {
-        html += "Updated " + String(secondsAgo) + "s ago";
-    } else {
-        html += "Updated " + String(secondsAgo / 60) + "m ago";
-    }
-    html += "</div>";
-    
-    // Refresh button (smaller, in corner)
-    html += "<button class='refresh-btn' onclick='location.reload()'>↻</button>";
-    
-    html += "</body></html>";
-    server.send(200, "text/html", html);
+void handleMonitor() {
+    MonitorPageView view;
+    view.now = millis();
+    view.freeHeap = ESP.getFreeHeap();
+    view.heapSize = ESP.getHeapSize();
+    view.maxAllocHeap = ESP.getMaxAllocHeap();
+    view.freeSketchSpace = ESP.getFreeSketchSpace();
+    view.chipRev = ESP.getChipRevision();
+    view.cpuFreq = ESP.getCpuFreqMHz();
+
+    view.dataRecent = peerRegistry.freshSections(view.now, &view.lastUpdate) != 0;
+    view.packetsReceived = packetsReceived;
+    view.ringOverruns = packetRing.overruns();
+    view.ringDelayAvgMs = ringDelayCount ? ringDelayTotalMs / ringDelayCount : 0UL;
+    view.ringDelayMaxMs = ringDelayMaxMs;
+    view.framesReceived = framesReceived;
+    view.frameBytes = frameBytes;
+    view.framesRejected = framesRejected;
+    view.deltaFramesDropped = deltaFramesDropped;
+
+    view.inventoryNameCount = inventoryNames.count();
+    view.inventoryNameBytes = inventoryNames.bytesReserved();
+
+    view.commands = &commandTracker;
+    view.queue = &commandQueue;
+    view.peers = &peerRegistry;
+
+    ChunkedResponse html(server);
+    html.begin(200, "text/html");
+    renderMonitorPage(html, view);
+    html.end();
 }
 
 // ============ SETUP ============
@@ -4679,6 +4083,9 @@ void setup() {
     Serial.println("   Victron Master ESP32 (ESP-NOW + Web)");
     Serial.println("========================================\n");
 
+    // Wall clock lives in NVS, so it resumes even if SPIFFS won't mount
+    wallClock.begin();
+
     // CRITICAL: Use AP_STA mode for ESP-NOW + Web Server
     WiFi.mode(WIFI_AP_STA);
     delay(100);
@@ -4711,19 +4118,7 @@ void setup() {
     esp_now_register_send_cb(onDataSent);
     esp_now_register_recv_cb(onDataReceive);
     Serial.println("✓ ESP-NOW callbacks registered");
-
-    // Add Victron ESP32 as peer (channel 1 = default AP channel)
-    esp_now_peer_info_t peerInfo = {};
-    memcpy(peerInfo.peer_addr, victronMAC, 6);
-    peerInfo.channel = 1;
-    peerInfo.encrypt = false;
-
-    if (esp_now_add_peer(&peerInfo) == ESP_OK) {
-        Serial.printf("✓ Added Victron as peer: %02X:%02X:%02X:%02X:%02X:%02X\n\n",
-                     victronMAC[0], victronMAC[1], victronMAC[2], victronMAC[3], victronMAC[4], victronMAC[5]);
-    } else {
-        Serial.println("✗ Failed to add Victron as peer!\n");
-    }
+    Serial.println("✓ Waiting for ESP-NOW peers (added as they report)\n");
 
     // Initialize SPIFFS
     if (!SPIFFS.begin(true)) {
@@ -4732,6 +4127,13 @@ void setup() {
         Serial.println("✓ SPIFFS initialized");
         // Load inventory from SPIFFS
         loadInventoryFromSPIFFS();
+        backupStore.begin();
+#ifdef INVENTORY_LOAD_BENCH
+        benchmarkInventoryLoad();
+#endif
+        history.begin();
+        wallClock.setFloor(history.now());      // Never behind the newest history row
+        history.setTimeSource([]() { return wallClock.now(); });
     }
 
     // PWA support endpoints
@@ -4740,6 +4142,14 @@ void setup() {
     server.on("/icon-192.png", handleIcon192);
     server.on("/icon-512.png", handleIcon512);
 
+    // Embedded CSS/JS (see web/ and tools/embed_assets.py)
+    for (size_t i = 0; i < STATIC_ASSET_COUNT; i++) {
+        const StaticAsset* asset = &STATIC_ASSETS[i];
+        server.on(asset->path, HTTP_GET, [asset]() { handleStaticAsset(*asset); });
+    }
+    const char* headerKeys[] = {"If-None-Match"};
+    server.collectHeaders(headerKeys, 1);
+
     // Setup web server routes
     server.on("/", handleRoot);
     server.on("/test", handleTest);
@@ -4749,6 +4159,13 @@ void setup() {
     server.on("/fridge/eco", handleFridgeEco);
     server.on("/fridge/battery", handleFridgeBattery);
     server.on("/fridge/status", handleFridgeStatus);
+    server.on("/api/live", HTTP_GET, handleApiLive);
+    server.on("/api/commands", HTTP_GET, handleApiCommands);
+    server.on("/api/peers", HTTP_GET, handleApiPeers);
+    server.on("/api/time", handleApiTime);
+    server.on("/api/history", HTTP_GET, handleApiHistory);
+    server.on("/api/inventory/batch", HTTP_POST, handleApiInventoryBatch);
+    server.on("/events", HTTP_GET, handleEvents);
     server.on("/inventory", handleInventory);
     server.on("/inventory/set", handleInventorySet);
     server.on("/inventory/check", handleInventoryCheck);
@@ -4759,8 +4176,10 @@ void setup() {
     server.on("/inventory/restock", handleInventoryRestock);
     server.on("/inventory/download", handleInventoryDownload);
     server.on("/inventory/export-csv", handleInventoryExportCSV);
+    server.on("/inventory/export-json", handleInventoryExportJSON);
+    server.on("/inventory/export-snapshot", handleInventoryExportSnapshot);
     server.on("/inventory/import-csv", HTTP_GET, handleInventoryImportCSV);
-    server.on("/inventory/import-csv", HTTP_POST, handleInventoryImportCSV);
+    server.on("/inventory/import-csv", HTTP_POST, handleInventoryImportCSV, handleInventoryImportUpload);
     server.on("/inventory/add", handleInventoryAddItem);
     server.on("/inventory/add-category", handleInventoryAddCategory);
     server.on("/inventory/remove", handleInventoryRemoveItem);
@@ -4787,7 +4206,7 @@ void setup() {
     server.on("/inventory/additem", handleInventoryAddItem);    // Add item
     server.on("/inventory/force-new-structure", []() {
         Serial.println("[DEBUG] Force loading new 12-category structure...");
-        inventory.clear();
+        clearInventory();
         initializeDefaultInventory();
         saveInventoryToSPIFFS();
         Serial.printf("[DEBUG] Loaded %d categories, saved to SPIFFS\n", inventory.size());
@@ -4822,11 +4241,44 @@ void setup() {
         
         server.send(200, "text/plain", response);
     });
-    
+
+    // Debug endpoint: history codec benchmark (same workload as tools/codec_bench.cpp)
+    server.on("/debug/codec", []() {
+        const uint32_t count = 720;
+        int16_t* rows = (int16_t*)malloc(count * CODEC_BENCH_SERIES * sizeof(int16_t));
+        uint32_t* times = (uint32_t*)malloc(count * sizeof(uint32_t));
+        uint8_t* encoded = (uint8_t*)malloc(count * (5 + 3 * CODEC_BENCH_SERIES));
+        if (!rows || !times || !encoded) {
+            free(rows); free(times); free(encoded);
+            server.send(503, "text/plain", "Not enough heap for codec benchmark");
+            return;
+        }
+
+        String response = "run          rows  raw B  enc B  B/row  B/sample  enc ns/row  dec ns/row  round trip\n";
+        const uint32_t intervals[] = {10, 60, 900};
+        for (uint32_t interval : intervals) {
+            CodecBenchResult r = runCodecBench(rows, times, count, interval, encoded,
+                                               []() { return (uint64_t)esp_timer_get_time() * 1000; });
+            char line[120];
+            snprintf(line, sizeof(line), "%4lus tier   %4lu %6lu %6lu %6.2f %9.2f %11.0f %11.0f  %s\n",
+                     (unsigned long)interval, (unsigned long)r.rows, (unsigned long)r.rawBytes,
+                     (unsigned long)r.encodedBytes, r.bytesPerRow, r.bytesPerSample,
+                     r.encodeNsPerRow, r.decodeNsPerRow, r.roundTripOk ? "ok" : "FAILED");
+            response += line;
+        }
+        free(rows); free(times); free(encoded);
+        server.send(200, "text/plain", response);
+    });
+
     server.onNotFound(handleNotFound);
     server.begin();
     Serial.println("✓ Web server started\n");
 
+    // Command dispatch on core 0 alongside WiFi, HTTP on core 1
+    nextCommandId = (esp_random() & 0x3FFFFFFF) + 1;
+    xTaskCreatePinnedToCore(commandTask, "commands", 4096, NULL, COMMAND_TASK_PRIORITY, &commandTaskHandle, 0);
+    xTaskCreatePinnedToCore(httpTask, "http", HTTP_TASK_STACK, NULL, HTTP_TASK_PRIORITY, &httpTaskHandle, 1);
+
     Serial.println("========================================");
     Serial.println("Connect to WiFi: PowerMonitor / 12345678");
     Serial.println("Then browse to: http://192.168.4.1");
@@ -4834,10 +4286,22 @@ void setup() {
 }
 
 // ============ LOOP ============
+// Everything that touches inventory or SPIFFS stays on this one task
+void httpTask(void* param) {
+    for (;;) {
+        drainPacketRing();     // Apply packets received since last pass
+        expireStaleSections(); // Drop data from peers that went quiet
+        server.handleClient();
+        serviceSseClients();   // Push new packets to /events listeners
+        serviceInventoryJournal();  // Snapshot inventory once taps settle
+        wallClock.service();   // Persist the clock every few minutes
+        checkDailyBackup();    // Auto-backup once per day
+        vTaskDelay(1);         // Let lower-priority tasks (and the idle watchdog) run
+    }
+}
+
 void loop() {
-    server.handleClient();
-    processMasterQueue();  // Send queued commands when Victron is ready
-    checkDailyBackup();    // Auto-backup once per day
-    yield();
+    // Work is done by httpTask and commandTask (started in setup)
+    vTaskDelete(NULL);
 }
 
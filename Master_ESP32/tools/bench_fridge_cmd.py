@@ -0,0 +1,96 @@
+"""
+Latency benchmark for the /fridge/cmd path.
+
+Opens N concurrent clients (default 4, the softAP max_conn) against the
+Master and fires /fridge/cmd requests, measuring HTTP round-trip time.
+Afterwards it reads /api/commands for the on-device queue-to-radio wait.
+
+    python tools/bench_fridge_cmd.py --host 192.168.4.1 --requests 25
+
+NOTE: this sends real commands. Every request sets the LEFT zone to
+--temp (default 4°C), so run it with the fridge at that setpoint. Only 10
+commands fit in the queue, so expect "Queue full" in the serial log; the
+HTTP side still answers and is what's being measured.
+"""
+
+import argparse
+import http.client
+import json
+import statistics
+import threading
+import time
+
+
+def client_worker(host, count, temp, results, errors):
+    conn = http.client.HTTPConnection(host, 80, timeout=10)
+    for _ in range(count):
+        start = time.perf_counter()
+        try:
+            conn.request("GET", "/fridge/cmd?zone=0&temp=%d" % temp)
+            resp = conn.getresponse()
+            resp.read()
+            if resp.status not in (200, 303):
+                errors.append("HTTP %d" % resp.status)
+                continue
+        except (OSError, http.client.HTTPException) as e:
+            errors.append(str(e))
+            conn.close()
+            conn = http.client.HTTPConnection(host, 80, timeout=10)
+            continue
+        results.append((time.perf_counter() - start) * 1000.0)
+    conn.close()
+
+
+def percentile(values, p):
+    ordered = sorted(values)
+    index = min(len(ordered) - 1, int(round(p / 100.0 * (len(ordered) - 1))))
+    return ordered[index]
+
+
+def fetch_json(host, path):
+    conn = http.client.HTTPConnection(host, 80, timeout=10)
+    conn.request("GET", path)
+    body = conn.getresponse().read()
+    conn.close()
+    return json.loads(body)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--host", default="192.168.4.1")
+    parser.add_argument("--clients", type=int, default=4)
+    parser.add_argument("--requests", type=int, default=25, help="requests per client")
+    parser.add_argument("--temp", type=int, default=4)
+    args = parser.parse_args()
+
+    results, errors = [], []
+    threads = [threading.Thread(target=client_worker, args=(args.host, args.requests, args.temp, results, errors))
+               for _ in range(args.clients)]
+
+    wall = time.perf_counter()
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join()
+    wall = time.perf_counter() - wall
+
+    print("/fridge/cmd  clients=%d  requests=%d  errors=%d  wall=%.1fs"
+          % (args.clients, len(results), len(errors), wall))
+    if results:
+        print("HTTP latency ms: min %.1f  p50 %.1f  p95 %.1f  p99 %.1f  max %.1f  mean %.1f"
+              % (min(results), percentile(results, 50), percentile(results, 95),
+                 percentile(results, 99), max(results), statistics.mean(results)))
+    for e in sorted(set(errors)):
+        print("  error: %s (x%d)" % (e, errors.count(e)))
+
+    try:
+        stats = fetch_json(args.host, "/api/commands")
+        print("Queue-to-radio ms: avg %s  max %s  (dispatched %s, coalesced %s, still queued %s, victron ready %s)"
+              % (stats["waitAvgMs"], stats["waitMaxMs"], stats["dispatched"], stats.get("coalesced", 0),
+                 stats["queued"], stats["ready"]))
+    except (OSError, ValueError, KeyError) as e:
+        print("Could not read /api/commands: %s" % e)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,38 @@
+// Host benchmark for include/TelemetryCodec.h
+//
+//   g++ -O2 -std=c++17 -Iinclude tools/codec_bench.cpp -o codec_bench && ./codec_bench
+//
+// The same workload runs on the device at GET /debug/codec.
+
+#include <chrono>
+#include <stdio.h>
+#include <vector>
+#include "TelemetryCodecBench.h"
+
+static uint64_t nowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+int main() {
+    struct { const char* name; uint32_t interval; uint32_t rows; } runs[] = {
+        {"10 s tier",   10,  8640},
+        {"1 min tier",  60,  1440},
+        {"15 min tier", 900, 96 * 30},
+    };
+
+    printf("%-12s %6s %8s %8s %9s %10s %10s %10s %s\n",
+           "run", "rows", "raw B", "enc B", "B/row", "B/sample", "enc ns/row", "dec ns/row", "round trip");
+    for (auto& run : runs) {
+        std::vector<int16_t> rows(run.rows * CODEC_BENCH_SERIES);
+        std::vector<uint32_t> times(run.rows);
+        std::vector<uint8_t> encoded(run.rows * (5 + 3 * CODEC_BENCH_SERIES));
+        CodecBenchResult r = runCodecBench(rows.data(), times.data(), run.rows, run.interval,
+                                           encoded.data(), nowNs);
+        printf("%-12s %6u %8u %8u %9.2f %10.2f %10.1f %10.1f %s\n",
+               run.name, r.rows, r.rawBytes, r.encodedBytes, r.bytesPerRow, r.bytesPerSample,
+               r.encodeNsPerRow, r.decodeNsPerRow, r.roundTripOk ? "ok" : "FAILED");
+        if (!r.roundTripOk) return 1;
+    }
+    return 0;
+}
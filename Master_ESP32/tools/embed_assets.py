@@ -0,0 +1,102 @@
+"""
+Embed web/ assets into the firmware.
+
+Gzips every file in web/ and writes include/StaticAssets.h with one PROGMEM
+array per file plus a lookup table (path, MIME type, data, length, ETag).
+Runs automatically before each PlatformIO build (extra_scripts = pre:...),
+or by hand:  python tools/embed_assets.py
+
+Edit the files in web/, never StaticAssets.h.
+"""
+
+import gzip
+import hashlib
+import os
+import re
+
+try:
+    Import("env")  # noqa: F821 - provided by PlatformIO/SCons
+    PROJECT_DIR = env["PROJECT_DIR"]  # noqa: F821
+except NameError:
+    PROJECT_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+WEB_DIR = os.path.join(PROJECT_DIR, "web")
+OUT_FILE = os.path.join(PROJECT_DIR, "include", "StaticAssets.h")
+
+MIME_TYPES = {
+    ".css": "text/css",
+    ".js": "application/javascript",
+    ".html": "text/html",
+    ".json": "application/json",
+    ".svg": "image/svg+xml",
+    ".png": "image/png",
+}
+
+
+def symbol_for(name):
+    return re.sub(r"[^A-Za-z0-9]", "_", name).upper()
+
+
+def build_header():
+    lines = [
+        "// Generated by tools/embed_assets.py from web/ - do not edit by hand",
+        "#pragma once",
+        "",
+        "#include <Arduino.h>",
+        "",
+        "struct StaticAsset {",
+        "    const char* path;          // URL path, e.g. /static/inventory.js",
+        "    const char* contentType;",
+        "    const uint8_t* data;       // gzip-compressed body",
+        "    size_t length;",
+        "    const char* etag;          // Short content hash, also used as ?v= cache buster",
+        "};",
+        "",
+    ]
+    entries = []
+
+    for name in sorted(os.listdir(WEB_DIR)):
+        path = os.path.join(WEB_DIR, name)
+        ext = os.path.splitext(name)[1]
+        if not os.path.isfile(path) or ext not in MIME_TYPES:
+            continue
+
+        with open(path, "rb") as f:
+            raw = f.read()
+        # mtime=0 keeps the output byte-identical between builds
+        packed = gzip.compress(raw, compresslevel=9, mtime=0)
+        etag = hashlib.sha1(raw).hexdigest()[:8]
+        sym = symbol_for(name)
+
+        lines.append("// %s: %d bytes, %d gzipped" % (name, len(raw), len(packed)))
+        lines.append("static const uint8_t ASSET_%s[] PROGMEM = {" % sym)
+        for i in range(0, len(packed), 16):
+            lines.append("    " + ",".join("0x%02x" % b for b in packed[i:i + 16]) + ",")
+        lines.append("};")
+        lines.append('#define ASSET_URL_%s "/static/%s?v=%s"' % (sym, name, etag))
+        lines.append("")
+        entries.append('    {"/static/%s", "%s", ASSET_%s, sizeof(ASSET_%s), "%s"},'
+                       % (name, MIME_TYPES[ext], sym, sym, etag))
+
+    lines.append("static const StaticAsset STATIC_ASSETS[] = {")
+    lines.extend(entries)
+    lines.append("};")
+    lines.append("static const size_t STATIC_ASSET_COUNT = sizeof(STATIC_ASSETS) / sizeof(STATIC_ASSETS[0]);")
+    lines.append("")
+    return "\n".join(lines)
+
+
+def main():
+    header = build_header()
+    old = None
+    if os.path.exists(OUT_FILE):
+        with open(OUT_FILE, "r") as f:
+            old = f.read()
+    # Only touch the file when content changed, so the build doesn't recompile main.cpp every time
+    if header != old:
+        with open(OUT_FILE, "w", newline="\n") as f:
+            f.write(header)
+        print("[embed_assets] Wrote %s" % OUT_FILE)
+
+
+main()
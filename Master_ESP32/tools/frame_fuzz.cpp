@@ -0,0 +1,273 @@
+// Host fuzz test for the ESP-NOW frame decoder (Shared/EspNowProtocol.h,
+// include/VictronFrames.h)
+//
+//   g++ -O1 -g -std=c++17 -fsanitize=address,undefined -Iinclude -I../Shared -Itools/host tools/frame_fuzz.cpp -o frame_fuzz
+//   ./frame_fuzz [iterations] [seed]
+//
+// 1. Round trip: random packets survive encode -> decode to within their
+//    fixed-point resolution, as keyframes and as deltas against one, and a
+//    delta whose keyframe was lost is refused.
+// 2. Mutation: valid frames are bit-flipped, truncated, extended and spliced,
+//    half of them with the CRC fixed up so the section walker sees the damage,
+//    and fed to the decoder from exact-size heap buffers, so the sanitizers
+//    catch any read past the end.
+// 3. Noise: random bytes, with and without a valid header in front.
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <random>
+#include <vector>
+#include "VictronFrames.h"
+
+static std::mt19937 rng;
+
+static uint32_t rnd(uint32_t n) { return n ? rng() % n : 0; }
+static float rndf(float lo, float hi) { return lo + (hi - lo) * (rng() / 4294967296.0f); }
+
+static int failures = 0;
+#define CHECK(cond, ...) do { if (!(cond)) { failures++; if (failures < 20) { printf("FAIL %s:%d: ", __FILE__, __LINE__); printf(__VA_ARGS__); printf("\n"); } } } while (0)
+
+static void randomString(char* out, size_t size) {
+    size_t n = rnd(size);
+    for (size_t i = 0; i < n; i++) out[i] = (char)(' ' + rnd(95));
+    out[n] = '\0';
+}
+
+static VictronPacket randomPacket() {
+    VictronPacket p;
+    memset(&p, 0, sizeof(p));
+    p.bmv = {rndf(0, 60), rndf(-300, 300), rndf(0, 100), rndf(-500, 0), rndf(0, 30),
+             (uint16_t)rnd(65536), (bool)rnd(2), (bool)rnd(2), (bool)rnd(2), 0, (bool)rnd(2)};
+    p.mppt.batteryVoltage = rndf(0, 60);
+    p.mppt.batteryCurrent = rndf(-50, 50);
+    p.mppt.solarPower = rnd(2000);
+    p.mppt.yieldToday = rndf(0, 100);
+    p.mppt.state = rnd(8);
+    p.mppt.error = rnd(256);
+    p.mppt.valid = rnd(2);
+    p.ip22.batteryVoltage = rndf(0, 60);
+    p.ip22.batteryCurrent = rndf(-30, 30);
+    p.ip22.temperature = rndf(-20, 80);
+    p.ip22.loadCurrent = rndf(0, 30);
+    p.ip22.power = rnd(1000);
+    p.ip22.state = rnd(8);
+    p.ip22.valid = rnd(2);
+    p.ecoflow.batteryPercent = rnd(101);
+    p.ecoflow.rssi = -(int)rnd(100);
+    p.ecoflow.valid = rnd(2);
+    randomString(p.ecoflow.serialNumber, sizeof(p.ecoflow.serialNumber));
+    randomString(p.ecoflow.macAddress, sizeof(p.ecoflow.macAddress));
+    p.fridge.left_actual = (int8_t)rnd(256);
+    p.fridge.left_setpoint = (int8_t)rnd(256);
+    p.fridge.right_actual = (int8_t)rnd(256);
+    p.fridge.right_setpoint = (int8_t)rnd(256);
+    p.fridge.eco_mode = rnd(2);
+    p.fridge.battery_protection = rnd(3);
+    p.fridge.connected = rnd(2);
+    p.fridge.valid = rnd(2);
+    p.fridge.rssi = -(int)rnd(100);
+    p.senderTime = rng();
+    p.readyForCommand = rnd(2);
+    return p;
+}
+
+static bool near(float a, float b, float step) { return fabsf(a - b) <= step / 2 + 1e-3f; }
+
+static void compare(const VictronPacket& a, const VictronPacket& b) {
+    CHECK(near(a.bmv.voltage, b.bmv.voltage, 0.01f), "bmv.voltage %f %f", a.bmv.voltage, b.bmv.voltage);
+    CHECK(near(a.bmv.current, b.bmv.current, 0.001f), "bmv.current %f %f", a.bmv.current, b.bmv.current);
+    CHECK(near(a.bmv.soc, b.bmv.soc, 0.1f), "bmv.soc");
+    CHECK(a.bmv.valid == b.bmv.valid && a.bmv.hasLowSOCAlarm == b.bmv.hasLowSOCAlarm, "bmv flags");
+    CHECK(near(a.mppt.batteryCurrent, b.mppt.batteryCurrent, 0.01f), "mppt.batteryCurrent");
+    CHECK(a.mppt.solarPower == b.mppt.solarPower && a.mppt.error == b.mppt.error, "mppt");
+    CHECK(near(a.ip22.temperature, b.ip22.temperature, 0.1f), "ip22.temperature");
+    CHECK(strcmp(a.ecoflow.serialNumber, b.ecoflow.serialNumber) == 0, "ecoflow.serialNumber");
+    CHECK(strcmp(a.ecoflow.macAddress, b.ecoflow.macAddress) == 0, "ecoflow.macAddress");
+    CHECK(a.ecoflow.rssi == b.ecoflow.rssi && a.ecoflow.batteryPercent == b.ecoflow.batteryPercent, "ecoflow");
+    CHECK(memcmp(&a.fridge, &b.fridge, offsetof(FridgeData, rssi)) == 0 && a.fridge.rssi == b.fridge.rssi, "fridge");
+    CHECK(a.senderTime == b.senderTime && a.readyForCommand == b.readyForCommand, "header fields");
+}
+
+// Everything the Master does with a received frame
+static bool decode(const uint8_t* data, size_t len, DeltaDecoder& decoder, VictronPacket& state) {
+    FrameReader frame(data, len);
+    if (!frame.valid()) return false;
+    bool applied = true;
+    switch (frame.header().type) {
+        case MSG_TELEMETRY: {
+            applied = decoder.decode(frame, [&](uint8_t tag, const int32_t* values, SectionReader& section) {
+                applyTelemetrySection(tag, values, section, state);
+            });
+            CHECK(memchr(state.ecoflow.serialNumber, 0, sizeof(state.ecoflow.serialNumber)), "serial unterminated");
+            CHECK(memchr(state.ecoflow.macAddress, 0, sizeof(state.ecoflow.macAddress)), "address unterminated");
+            break;
+        }
+        case MSG_COMMAND: {
+            ControlCommand cmd;
+            decodeCommand(frame, cmd);
+            break;
+        }
+        case MSG_COMMAND_ACK: {
+            CommandAck ack;
+            decodeCommandAck(frame, ack);
+            break;
+        }
+        default: {
+            uint8_t tag;
+            SectionReader section(nullptr, 0);
+            while (frame.next(tag, section)) section.u32();
+            break;
+        }
+    }
+    return applied;
+}
+
+static void decodeExact(const std::vector<uint8_t>& bytes, DeltaDecoder& decoder, VictronPacket& state) {
+    uint8_t* copy = (uint8_t*)malloc(bytes.size() ? bytes.size() : 1);   // No slack for overreads
+    if (!bytes.empty()) memcpy(copy, bytes.data(), bytes.size());
+    decode(copy, bytes.size(), decoder, state);
+    free(copy);
+}
+
+static void fixCrc(std::vector<uint8_t>& f) {
+    if (f.size() < ESPNOW_HEADER_SIZE) return;
+    size_t payload = f.size() - ESPNOW_HEADER_SIZE;
+    f[8] = (uint8_t)payload;
+    f[9] = (uint8_t)(payload >> 8);
+    f[10] = f[11] = 0;
+    uint16_t crc = espnowCrc16(f.data(), f.size());
+    f[10] = (uint8_t)crc;
+    f[11] = (uint8_t)(crc >> 8);
+}
+
+static std::vector<uint8_t> seedFrame(DeltaEncoder& encoder, VictronPacket& last, uint16_t& seq) {
+    uint8_t buf[ESPNOW_MAX_FRAME];
+    size_t len = 0;
+    switch (rnd(4)) {
+        case 0: {
+            // Mostly small changes so delta frames dominate, as on the air
+            if (rnd(4) == 0) last = randomPacket();
+            else last.bmv.current += rndf(-1, 1);
+            last.senderTime += 1000;
+            len = encodeTelemetryFrame(last, buf, seq++, &encoder);
+            break;
+        }
+        case 1: {
+            ControlCommand cmd = {(uint32_t)rng(), (uint8_t)rng(), (uint8_t)rng(), (int16_t)rng(), (int16_t)rng(), (unsigned long)rng()};
+            len = encodeCommandFrame(cmd, buf, rng());
+            break;
+        }
+        case 2: {
+            CommandAck ack = {(uint32_t)rng(), (bool)rnd(2), (bool)rnd(2), (uint8_t)rng(), (unsigned long)rng()};
+            len = encodeAckFrame(ack, buf, rng());
+            break;
+        }
+        default: len = encodeStatusFrame(rnd(2), buf, rng()); break;
+    }
+    return std::vector<uint8_t>(buf, buf + len);
+}
+
+static void mutate(std::vector<uint8_t>& f) {
+    for (uint32_t n = 1 + rnd(4); n > 0; n--) {
+        switch (rnd(6)) {
+            case 0: if (!f.empty()) f[rnd(f.size())] ^= 1 << rnd(8); break;
+            case 1: if (!f.empty()) f[rnd(f.size())] = rng(); break;
+            case 2: f.resize(rnd(f.size() + 1)); break;
+            case 3: if (f.size() < 300) f.insert(f.begin() + rnd(f.size() + 1), (uint8_t)rng()); break;
+            case 4: if (f.size() > ESPNOW_HEADER_SIZE + 1) f[ESPNOW_HEADER_SIZE + 1 + rnd(f.size() - ESPNOW_HEADER_SIZE - 1)] = rng(); break;
+            default: if (!f.empty()) f.erase(f.begin() + rnd(f.size())); break;
+        }
+    }
+    if (rnd(2)) fixCrc(f);
+}
+
+int main(int argc, char** argv) {
+    uint32_t iterations = argc > 1 ? strtoul(argv[1], nullptr, 10) : 200000;
+    uint32_t seed = argc > 2 ? strtoul(argv[2], nullptr, 10) : 1;
+    rng.seed(seed);
+
+    // 1. Round trip
+    for (uint32_t i = 0; i < 2000; i++) {
+        VictronPacket sent = randomPacket(), received;
+        memset(&received, 0, sizeof(received));
+        DeltaDecoder decoder;
+        uint8_t buf[ESPNOW_MAX_FRAME];
+        size_t len = encodeTelemetryFrame(sent, buf, i, nullptr);
+        CHECK(len <= ESPNOW_MAX_FRAME, "frame too long: %zu", len);
+        CHECK(decode(buf, len, decoder, received), "plain keyframe refused");
+        compare(sent, received);
+
+        // Deltas against the keyframe rebuild the whole packet
+        DeltaEncoder encoder;
+        decoder.reset();
+        memset(&received, 0, sizeof(received));
+        uint16_t seq = rng();
+        len = encodeTelemetryFrame(sent, buf, seq++, &encoder);
+        CHECK(decode(buf, len, decoder, received), "keyframe refused");
+        compare(sent, received);
+
+        VictronPacket next = sent;
+        next.fridge.left_actual++;
+        next.senderTime++;
+        len = encodeTelemetryFrame(next, buf, seq++, &encoder);
+        CHECK(len < 40, "unchanged fields were resent (%zu bytes)", len);
+        CHECK(decode(buf, len, decoder, received), "delta refused");
+        compare(next, received);
+
+        // A field back at its keyframe value drops out of the delta and is
+        // restored from the keyframe
+        next.fridge.left_actual--;
+        next.bmv.soc = sent.bmv.soc > 50 ? sent.bmv.soc - 1 : sent.bmv.soc + 1;
+        next.senderTime++;
+        len = encodeTelemetryFrame(next, buf, seq++, &encoder);
+        CHECK(decode(buf, len, decoder, received), "delta refused");
+        compare(next, received);
+
+        // Lose the next keyframe: its deltas are refused until another arrives
+        encoder.forceKeyframe();
+        next.mppt.solarPower++;
+        encodeTelemetryFrame(next, buf, seq++, &encoder);
+        next.mppt.solarPower++;
+        len = encodeTelemetryFrame(next, buf, seq++, &encoder);
+        CHECK(!decode(buf, len, decoder, received), "delta against a lost keyframe applied");
+        CHECK(decoder.missedBase() == 1, "missed keyframe not counted");
+        encoder.forceKeyframe();
+        len = encodeTelemetryFrame(next, buf, seq++, &encoder);
+        CHECK(decode(buf, len, decoder, received), "keyframe refused");
+        compare(next, received);
+    }
+    printf("round trip: %s\n", failures ? "FAILED" : "ok");
+
+    // 2. Mutated frames and 3. noise
+    DeltaEncoder encoder;
+    DeltaDecoder decoder;
+    VictronPacket state, last = randomPacket();
+    uint16_t seq = 0;
+    memset(&state, 0, sizeof(state));
+    uint32_t framed = 0;
+    for (uint32_t i = 0; i < iterations; i++) {
+        std::vector<uint8_t> f;
+        if (rnd(8) == 0) {
+            f.resize(rnd(ESPNOW_MAX_FRAME + 1));
+            for (uint8_t& b : f) b = rng();
+            if (rnd(2) && f.size() >= ESPNOW_HEADER_SIZE) {
+                f[0] = ESPNOW_MAGIC0;
+                f[1] = ESPNOW_MAGIC1;
+                f[2] = ESPNOW_PROTOCOL_VERSION;
+                fixCrc(f);
+            }
+        } else {
+            f = seedFrame(encoder, last, seq);
+            mutate(f);
+        }
+        framed += FrameReader(f.data(), f.size()).valid();
+        decodeExact(f, decoder, state);
+    }
+    printf("fuzz: %u inputs, %u passed the header checks, %u deltas without their keyframe\n",
+           iterations, framed, decoder.missedBase());
+
+    printf("%s\n", failures ? "FAILED" : "ok");
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,85 @@
+// Minimal stand-in for <Arduino.h> so host tools and tests can build the
+// Arduino-free parts of the firmware (include/, and src/ modules that only
+// need String, Serial, millis() and the FreeRTOS spinlock)
+#pragma once
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <string>
+#include <type_traits>
+
+#define PROGMEM
+
+struct String : std::string {
+    String(const char* s = "") : std::string(s ? s : "") {}
+    String(const std::string& s) : std::string(s) {}
+    String(char c) : std::string(1, c) {}
+    String(int v) : std::string(std::to_string(v)) {}
+    String(unsigned v) : std::string(std::to_string(v)) {}
+    String(long v) : std::string(std::to_string(v)) {}
+    String(unsigned long v) : std::string(std::to_string(v)) {}
+    String(double v, unsigned char decimals = 2) {
+        char buf[32];
+        snprintf(buf, sizeof(buf), "%.*f", decimals, v);
+        assign(buf);
+    }
+    size_t length() const { return size(); }
+    bool equals(const char* o) const { return *this == o; }
+    int toInt() const { return atoi(c_str()); }
+    bool startsWith(const char* p) const { return compare(0, strlen(p), p) == 0; }
+    bool endsWith(const char* p) const {
+        size_t n = strlen(p);
+        return size() >= n && compare(size() - n, n, p) == 0;
+    }
+    String substring(size_t from, size_t to = npos) const {
+        return from >= size() ? String() : String(substr(from, to == npos ? npos : to - from));
+    }
+};
+
+// By value: decltype(a < b ? a : b) is A& for two A's, a reference to the
+// parameter that dies on return
+template <typename A, typename B>
+inline typename std::common_type<A, B>::type min(A a, B b) { return a < b ? a : b; }
+template <typename A, typename B>
+inline typename std::common_type<A, B>::type max(A a, B b) { return a < b ? b : a; }
+
+// Tests move time by assigning hostMillis
+inline unsigned long hostMillis = 0;
+inline unsigned long millis() { return hostMillis; }
+inline int64_t esp_timer_get_time() { return (int64_t)hostMillis * 1000; }
+
+// Set hostQuiet to keep firmware log lines out of test output
+inline bool hostQuiet = true;
+struct HostSerial {
+    void printf(const char* fmt, ...) {
+        if (hostQuiet) return;
+        va_list args;
+        va_start(args, fmt);
+        vprintf(fmt, args);
+        va_end(args);
+    }
+    void println(const char* s = "") { if (!hostQuiet) puts(s); }
+    void println(const String& s) { println(s.c_str()); }
+    void print(const char* s) { if (!hostQuiet) fputs(s, stdout); }
+};
+inline HostSerial Serial;
+
+class Print {
+public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t* data, size_t size) {
+        for (size_t i = 0; i < size; i++) write(data[i]);
+        return size;
+    }
+    size_t write(const char* s) { return write((const uint8_t*)s, strlen(s)); }
+};
+
+// One core on the host: the spinlock only has to exist
+typedef struct { int owner; } portMUX_TYPE;
+#define portMUX_INITIALIZER_UNLOCKED {0}
+inline void portENTER_CRITICAL(portMUX_TYPE*) {}
+inline void portEXIT_CRITICAL(portMUX_TYPE*) {}
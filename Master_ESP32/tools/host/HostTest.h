@@ -0,0 +1,22 @@
+// Tiny check harness for the host tests in this directory
+#pragma once
+#include <stdio.h>
+
+inline int hostFailures = 0;
+
+#define CHECK(cond, ...) do { \
+    if (!(cond)) { \
+        hostFailures++; \
+        if (hostFailures <= 20) { \
+            printf("FAIL %s:%d: %s: ", __FILE__, __LINE__, #cond); \
+            printf(__VA_ARGS__); \
+            printf("\n"); \
+        } \
+    } \
+} while (0)
+
+// Print the verdict and return main()'s exit code
+inline int hostTestResult(const char* name) {
+    printf("%s: %s\n", name, hostFailures ? "FAILED" : "ok");
+    return hostFailures ? 1 : 0;
+}
@@ -0,0 +1,82 @@
+// Host stand-in for the ESP32 SPIFFS library: a flat directory on disk.
+// Tests point hostFsRoot at an empty temp directory before using it.
+#pragma once
+#include <dirent.h>
+#include <memory>
+#include <string>
+#include <vector>
+#include "Arduino.h"
+
+inline std::string hostFsRoot = "/tmp/host_spiffs";
+
+class File {
+public:
+    File() {}
+    File(FILE* f, const std::string& name) : _f(f, fclose), _name(name) {}
+    explicit File(const std::vector<std::string>& entries) : _dir(true), _entries(entries) {}
+
+    explicit operator bool() const { return _f || _dir; }
+    size_t read(uint8_t* buf, size_t size) { return _f ? fread(buf, 1, size, _f.get()) : 0; }
+    size_t write(const uint8_t* buf, size_t size) { return _f ? fwrite(buf, 1, size, _f.get()) : 0; }
+    size_t size() const {
+        if (!_f) return 0;
+        long pos = ftell(_f.get());
+        fseek(_f.get(), 0, SEEK_END);
+        long end = ftell(_f.get());
+        fseek(_f.get(), pos, SEEK_SET);
+        return end;
+    }
+    const char* name() const { return _name.c_str(); }
+    void close() {
+        _f.reset();
+        _dir = false;
+    }
+    File openNextFile() {
+        while (_next < _entries.size()) {
+            const std::string& name = _entries[_next++];
+            if (FILE* f = fopen((hostFsRoot + "/" + name).c_str(), "rb")) return File(f, name);
+        }
+        return File();
+    }
+
+private:
+    std::shared_ptr<FILE> _f;
+    std::string _name;
+    bool _dir = false;
+    std::vector<std::string> _entries;
+    size_t _next = 0;
+};
+
+class HostSpiffs {
+public:
+    File open(const char* path, const char* mode = "r") {
+        if (strcmp(path, "/") == 0) {
+            std::vector<std::string> entries;
+            if (DIR* dir = opendir(hostFsRoot.c_str())) {
+                while (dirent* e = readdir(dir)) {
+                    if (e->d_name[0] != '.') entries.push_back(e->d_name);
+                }
+                closedir(dir);
+            }
+            return File(entries);
+        }
+        const char* m = mode[0] == 'w' ? "wb" : mode[0] == 'a' ? "ab" : "rb";
+        FILE* f = fopen(full(path).c_str(), m);
+        return f ? File(f, path) : File();
+    }
+    File open(const String& path, const char* mode = "r") { return open(path.c_str(), mode); }
+    bool exists(const char* path) {
+        FILE* f = fopen(full(path).c_str(), "rb");
+        if (f) fclose(f);
+        return f != nullptr;
+    }
+    bool exists(const String& path) { return exists(path.c_str()); }
+    bool remove(const char* path) { return ::remove(full(path).c_str()) == 0; }
+    bool remove(const String& path) { return remove(path.c_str()); }
+    bool rename(const char* from, const char* to) { return ::rename(full(from).c_str(), full(to).c_str()) == 0; }
+
+private:
+    static std::string full(const char* path) { return hostFsRoot + path; }
+};
+
+inline HostSpiffs SPIFFS;
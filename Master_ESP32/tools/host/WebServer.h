@@ -0,0 +1,33 @@
+// Host stand-in for the ESP32 WebServer: records what a handler sends
+#pragma once
+#include <string>
+#include <vector>
+#include "Arduino.h"
+
+#define CONTENT_LENGTH_UNKNOWN ((size_t)-1)
+
+class WebServer {
+public:
+    int code = 0;
+    std::string contentType;
+    size_t contentLength = 0;
+    std::string body;                   // All content, chunk framing removed
+    std::vector<size_t> chunks;         // Size of each sendContent() call
+    bool terminated = false;            // Zero-length chunk seen
+
+    void setContentLength(size_t length) { contentLength = length; }
+    void send(int status, const char* type, const String& content) {
+        code = status;
+        contentType = type;
+        body += content;
+    }
+    void sendContent(const char* data, size_t length) {
+        if (length == 0) {
+            terminated = true;
+            return;
+        }
+        body.append(data, length);
+        chunks.push_back(length);
+    }
+    void sendContent(const String& content) { sendContent(content.c_str(), content.length()); }
+};
@@ -0,0 +1,211 @@
+// Host test for the gzipped static assets (include/StaticAssets.h) and the
+// chunked page streaming (include/ChunkedResponse.h, src/StatusPages.cpp)
+//
+//   g++ -std=c++17 -Isrc -Iinclude -I../Shared -Itools/host tools/host/asset_stream_test.cpp
+//       src/StatusPages.cpp src/PeerRegistry.cpp src/LinkStats.cpp src/CommandTracker.cpp
+//       src/CommandQueue.cpp -o asset_stream_test -lz
+//   ./asset_stream_test            (from Master_ESP32/, after tools/embed_assets.py)
+//
+// 1. Every embedded asset gunzips to exactly the bytes of its web/ file, so
+//    a stale StaticAssets.h or a bad gzip stream fails here, not in a
+//    browser.
+// 2. Each asset body, written through ChunkedResponse in the uneven pieces
+//    a page builder produces (single chars, short strings, long runs), comes
+//    out of the server byte-for-byte, in chunks no bigger than the buffer,
+//    with the terminating zero-length chunk.
+// 3. The dashboard and /monitor pages, rendered once into a String (the way
+//    the handlers built them before streaming) and once through
+//    ChunkedResponse, come out byte-for-byte the same for each alert state,
+//    with peers, link stats and a command latency histogram on the monitor.
+//
+// Sources: src/StatusPages.cpp src/PeerRegistry.cpp src/LinkStats.cpp src/CommandTracker.cpp src/CommandQueue.cpp
+// Libs: -lz
+
+#include <stdio.h>
+#include <string>
+#include <vector>
+#include <zlib.h>
+#include "HostTest.h"
+#include "ChunkedResponse.h"
+#include "StaticAssets.h"
+#include "StatusPages.h"
+
+static bool readFile(const std::string& path, std::string& out) {
+    FILE* f = fopen(path.c_str(), "rb");
+    if (!f) return false;
+    char buf[4096];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), f)) > 0) out.append(buf, n);
+    fclose(f);
+    return true;
+}
+
+static bool gunzip(const uint8_t* data, size_t length, std::string& out) {
+    z_stream z = {};
+    if (inflateInit2(&z, 16 + MAX_WBITS) != Z_OK) return false;
+    z.next_in = (Bytef*)data;
+    z.avail_in = length;
+    char buf[4096];
+    int rc;
+    do {
+        z.next_out = (Bytef*)buf;
+        z.avail_out = sizeof(buf);
+        rc = inflate(&z, Z_NO_FLUSH);
+        out.append(buf, sizeof(buf) - z.avail_out);
+    } while (rc == Z_OK);
+    inflateEnd(&z);
+    return rc == Z_STREAM_END && z.avail_in == 0;
+}
+
+// Write `body` the way page builders do: a mix of +=, single chars and
+// long runs that straddle the buffer boundary
+static void streamBody(ChunkedResponse& out, const std::string& body) {
+    static const size_t pieces[] = {1, 7, 80, 1, 300, 1500, 3, 1024};
+    size_t pos = 0, i = 0;
+    while (pos < body.size()) {
+        size_t n = min(pieces[i++ % 8], body.size() - pos);
+        if (n == 1) {
+            out += body[pos];
+        } else if (n < 100) {
+            out += String(body.substr(pos, n));
+        } else {
+            out.write((const uint8_t*)body.data() + pos, n);
+        }
+        pos += n;
+    }
+}
+
+static void assets() {
+    size_t rawTotal = 0, gzTotal = 0;
+    for (size_t i = 0; i < STATIC_ASSET_COUNT; i++) {
+        const StaticAsset& asset = STATIC_ASSETS[i];
+        std::string name = std::string(asset.path).substr(strlen("/static/"));
+        std::string source, unpacked;
+        if (!readFile("web/" + name, source)) {
+            CHECK(false, "web/%s missing (run from Master_ESP32/)", name.c_str());
+            continue;
+        }
+        CHECK(gunzip(asset.data, asset.length, unpacked), "%s: bad gzip stream", name.c_str());
+        CHECK(unpacked == source, "%s: embedded copy differs from web/ (rerun tools/embed_assets.py)", name.c_str());
+        rawTotal += source.size();
+        gzTotal += asset.length;
+
+        WebServer server;
+        {
+            ChunkedResponse out(server);
+            out.begin(200, asset.contentType);
+            streamBody(out, source);
+            CHECK(out.length() == source.size(), "%s: length() %zu", name.c_str(), out.length());
+        }   // Destructor ends the response
+        CHECK(server.code == 200 && server.contentLength == CONTENT_LENGTH_UNKNOWN, "%s: headers", name.c_str());
+        CHECK(server.body == source, "%s: streamed bytes differ", name.c_str());
+        CHECK(server.terminated, "%s: no terminating chunk", name.c_str());
+        for (size_t n : server.chunks) {
+            CHECK(n <= ChunkedResponse::BUFFER_SIZE, "%s: %zu-byte chunk", name.c_str(), n);
+        }
+    }
+    printf("%zu assets, %zu bytes, %zu gzipped\n", STATIC_ASSET_COUNT, rawTotal, gzTotal);
+}
+
+// What the handlers built before streaming: the whole page in one String
+class StringSink : public Print {
+public:
+    String out;
+    size_t write(uint8_t c) override {
+        out += (char)c;
+        return 1;
+    }
+    size_t write(const uint8_t* data, size_t size) override {
+        out.append((const char*)data, size);
+        return size;
+    }
+};
+
+template <typename View>
+static std::string streamPage(void (*render)(Print&, const View&), const View& view, const char* name) {
+    StringSink whole;
+    render(whole, view);
+
+    WebServer server;
+    ChunkedResponse html(server);
+    html.begin(200, "text/html");
+    render(html, view);
+    html.end();
+    CHECK(server.body == whole.out, "%s: streamed page differs from the String build (%zu vs %zu bytes)", name,
+          server.body.size(), whole.out.size());
+    CHECK(server.terminated && server.chunks.size() > 1, "%s: %zu chunks", name, server.chunks.size());
+    for (size_t n : server.chunks) CHECK(n <= ChunkedResponse::BUFFER_SIZE, "%s: %zu-byte chunk", name, n);
+    return whole.out;
+}
+
+static bool has(const std::string& page, const char* text) { return page.find(text) != std::string::npos; }
+
+static void pages() {
+    RootPageView root;
+    root.freeHeap = 120000;
+    root.packetsReceived = 4321;
+    std::string page = streamPage(renderRootPage, root, "/ (no data)");
+    CHECK(has(page, "Data Connection Lost") && has(page, CLOCK_SYNC_SCRIPT), "/ without data");
+
+    root.dataRecent = true;
+    root.clockSynced = true;
+    root.data.bmv.valid = true;
+    root.data.bmv.soc = 8;
+    page = streamPage(renderRootPage, root, "/ (battery)");
+    CHECK(has(page, "Critical: Battery 8%") && !has(page, "/api/time"), "/ with a flat battery");
+
+    root.data.bmv.soc = 90;
+    root.freeHeap = 30000;
+    page = streamPage(renderRootPage, root, "/ (memory)");
+    CHECK(has(page, "Warning: Memory Low (29KB)") && has(page, "Pkts: 4321"), "/ with low memory");
+
+    CommandTracker commands;
+    CommandQueue queue;
+    PeerRegistry peers;
+    const uint8_t relay[6] = {0x24, 0x6F, 0x28, 0x01, 0x02, 0x03};
+    const uint8_t ecoflow[6] = {0xC8, 0x2E, 0x18, 0xAA, 0x41, 0x7E};
+    for (unsigned long t = 0; t < 60000; t += 1000) {
+        peers.observe(relay, SRC_VICTRON, true, -55, t);
+        if (t % 5000 == 0) peers.observe(ecoflow, SRC_ECOFLOW, false, -70, t);
+    }
+    for (uint32_t id = 1; id <= 40; id++) {
+        ControlCommand cmd = {};
+        cmd.commandId = id;
+        cmd.device = 1;
+        cmd.command = (uint8_t)id;
+        commands.track(cmd, 0);
+        CommandAck ack = {};
+        ack.commandId = id;
+        ack.received = ack.executed = true;
+        commands.acknowledge(ack, id * 25);
+    }
+    queue.push(1, CMD_FRIDGE_SET_ECO, 1, 0, 59000);
+
+    MonitorPageView monitor;
+    monitor.now = 60000;
+    monitor.freeHeap = 150000;
+    monitor.heapSize = 300000;
+    monitor.maxAllocHeap = 110000;
+    monitor.cpuFreq = 240;
+    monitor.dataRecent = true;
+    monitor.lastUpdate = 59000;
+    monitor.packetsReceived = 60;
+    monitor.framesReceived = 60;
+    monitor.frameBytes = 3000;
+    monitor.inventoryNameCount = 312;
+    monitor.inventoryNameBytes = 6144;
+    monitor.commands = &commands;
+    monitor.queue = &queue;
+    monitor.peers = &peers;
+    page = streamPage(renderMonitorPage, monitor, "/monitor");
+    CHECK(has(page, "victron 01:02:03") && has(page, "class='hist'") && has(page, "312 / 6.0 KB") &&
+          has(page, "Framed v"), "/monitor content");
+    printf("pages: dashboard %zu bytes, monitor %zu bytes, streamed in %zu-byte chunks\n",
+           streamPage(renderRootPage, root, "/").size(), page.size(), ChunkedResponse::BUFFER_SIZE);
+}
+
+int main() {
+    assets();
+    pages();
+    return hostTestResult("asset_stream_test");
+}
@@ -0,0 +1,133 @@
+// Host test for src/BackupStore.cpp, on a temp directory standing in for
+// SPIFFS (tools/host/SPIFFS.h)
+//
+//   g++ -std=c++17 -Isrc -Iinclude -Itools/host tools/host/backup_store_test.cpp
+//       src/BackupStore.cpp -o backup_store_test
+//
+// 1. Normal use: legacy adoption, shared blobs, replace/remove/rename
+//    collecting the blobs nothing points at, reload and restore.
+// 2. A power cut between saveIndex()'s remove and rename leaves only
+//    /backups.tmp; begin() must adopt it and keep every backup.
+// 3. With the index gone, or unreadable, begin() must keep every blob (as
+//    recovered_<hash>) and still restore it, rather than deleting them all.
+//
+// Sources: src/BackupStore.cpp
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include "HostTest.h"
+#include "BackupStore.h"
+#include <SPIFFS.h>
+
+static void writeFile(const char* path, const std::string& data) {
+    File f = SPIFFS.open(path, "w");
+    f.write((const uint8_t*)data.data(), data.size());
+    f.close();
+}
+
+static std::string readFile(const char* path) {
+    File f = SPIFFS.open(path, "r");
+    if (!f) return "";
+    std::string s(f.size(), '\0');
+    f.read((uint8_t*)&s[0], s.size());
+    return s;
+}
+
+static int blobCount() {
+    int n = 0;
+    File root = SPIFFS.open("/");
+    for (File f = root.openNextFile(); f; f = root.openNextFile()) n += strncmp(f.name(), "blob_", 5) == 0;
+    return n;
+}
+
+static void freshFs() {
+    char dir[] = "/tmp/backup_store_XXXXXX";
+    hostFsRoot = mkdtemp(dir);
+}
+
+// Three backups over two blobs, saved and reloaded
+static void populate(const std::string& a, const std::string& b) {
+    backupStore.begin();
+    writeFile("/inventory.bin", a);
+    backupStore.put("daily_1", "/inventory.bin");
+    backupStore.put("weekly_1", "/inventory.bin");
+    writeFile("/inventory.bin", b);
+    backupStore.put("daily_2", "/inventory.bin");
+}
+
+static bool restores(const char* name, const std::string& expected) {
+    return backupStore.restore(name, "/restored.bin") && readFile("/restored.bin") == expected;
+}
+
+static void normalUse() {
+    freshFs();
+    std::string a(3000, 'a'), b(2000, 'b');
+    writeFile("/backup_old.json", "legacy");
+    backupStore.begin();
+    CHECK(backupStore.exists("old") && !SPIFFS.exists("/backup_old.json") && blobCount() == 1, "legacy not adopted");
+
+    populate(a, b);
+    CHECK(blobCount() == 3, "%d blobs after populate", blobCount());
+    CHECK(backupStore.shares(backupStore.list()[1]) == 2, "daily_1/weekly_1 do not share");
+    CHECK(backupStore.bytesStored() == 6 + 3000 + 2000, "%zu bytes stored", backupStore.bytesStored());
+
+    backupStore.remove("weekly_1");
+    CHECK(blobCount() == 3, "shared blob collected while daily_1 uses it");
+    backupStore.remove("daily_1");
+    CHECK(blobCount() == 2, "unused blob kept");
+    backupStore.rename("daily_2", "old");
+    CHECK(blobCount() == 1 && backupStore.list().size() == 1, "rename over old: %d blobs", blobCount());
+
+    backupStore.begin();
+    CHECK(backupStore.list().size() == 1 && restores("old", b), "reload");
+    backupStore.clear();
+    CHECK(blobCount() == 0 && backupStore.list().empty(), "clear");
+}
+
+static void interruptedSave() {
+    freshFs();
+    std::string a(1000, 'x'), b(700, 'y');
+    populate(a, b);
+    // What saveIndex() leaves if power is cut after the remove
+    SPIFFS.rename(BACKUP_INDEX_PATH, BACKUP_INDEX_TMP);
+
+    backupStore.begin();
+    CHECK(backupStore.list().size() == 3, "%zu backups after interrupted save", backupStore.list().size());
+    CHECK(blobCount() == 2, "%d blobs after interrupted save", blobCount());
+    CHECK(SPIFFS.exists(BACKUP_INDEX_PATH) && !SPIFFS.exists(BACKUP_INDEX_TMP), "temp index not adopted");
+    CHECK(restores("daily_1", a) && restores("weekly_1", a) && restores("daily_2", b), "restore after adoption");
+}
+
+static void lostIndex(bool corrupt) {
+    const char* what = corrupt ? "unreadable index" : "missing index";
+    freshFs();
+    std::string a(1000, 'x'), b(700, 'y');
+    populate(a, b);
+    if (corrupt) writeFile(BACKUP_INDEX_PATH, "garbage");
+    else SPIFFS.remove(BACKUP_INDEX_PATH);
+    writeFile(BACKUP_BLOB_TMP, "half a copy");
+
+    backupStore.begin();
+    CHECK(blobCount() == 2, "%s: %d blobs left", what, blobCount());
+    CHECK(!SPIFFS.exists(BACKUP_BLOB_TMP), "%s: blob temp file kept", what);
+    CHECK(backupStore.list().size() == 2, "%s: %zu backups", what, backupStore.list().size());
+    int restored = 0;
+    for (const BackupRef& ref : backupStore.list()) {
+        CHECK(strncmp(ref.name, "recovered_", 10) == 0, "%s: backup named %s", what, ref.name);
+        restored += restores(ref.name, a) || restores(ref.name, b);
+    }
+    CHECK(restored == 2, "%s: %d backups restore", what, restored);
+
+    // The recovered names were saved, so the next boot is a normal one
+    backupStore.begin();
+    CHECK(backupStore.list().size() == 2 && blobCount() == 2, "%s: second boot", what);
+}
+
+int main() {
+    normalUse();
+    interruptedSave();
+    lostIndex(false);
+    lostIndex(true);
+    return hostTestResult("backup_store_test");
+}
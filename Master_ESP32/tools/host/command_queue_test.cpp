@@ -0,0 +1,163 @@
+// Host test for src/CommandQueue.cpp and how it works with the tracker
+//
+//   g++ -std=c++17 -Isrc -Iinclude -Itools/host tools/host/command_queue_test.cpp
+//       src/CommandQueue.cpp src/CommandTracker.cpp -o command_queue_test
+//
+// 1. Five taps on one setpoint coalesce into one command with the last
+//    value, the battery command jumps the queue, and the wait stats add up.
+// 2. A newer setpoint while the old one is still unACKed: the old one is
+//    not retransmitted once the new one is queued, and is dropped when the
+//    new one is sent, so its late ACK is only a duplicate.
+// 3. A lossy link, driven the way processMasterQueue() drives it: the relay
+//    must never apply an older setpoint after a newer one.
+//
+// Sources: src/CommandQueue.cpp src/CommandTracker.cpp
+
+#include <stdio.h>
+#include <vector>
+#include "HostTest.h"
+#include "CommandQueue.h"
+#include "CommandTracker.h"
+
+static const uint8_t FRIDGE = 1;
+
+static void coalesceAndLanes() {
+    CommandQueue q;
+    for (int i = 0; i < 5; i++) {
+        QueueResult r = q.push(FRIDGE, CMD_FRIDGE_SET_LEFT_TEMP, 0, i, 100 + i);
+        CHECK(r == (i ? QUEUE_REPLACED : QUEUE_ADDED), "tap %d: result %d", i, r);
+    }
+    q.push(FRIDGE, CMD_FRIDGE_SET_ECO, 1, 0, 200);
+    q.push(FRIDGE, CMD_FRIDGE_SET_BATTERY, 2, 0, 300);
+    CHECK(q.depth() == 3 && q.coalesced() == 4 && q.depth(LANE_URGENT) == 1, "depth %u coalesced %u",
+          q.depth(), q.coalesced());
+    CHECK(q.waiting(FRIDGE, CMD_FRIDGE_SET_ECO) && !q.waiting(FRIDGE, CMD_FRIDGE_SET_RIGHT_TEMP), "waiting()");
+
+    QueuedCommand c;
+    CHECK(q.pop(c, 400) && c.command == CMD_FRIDGE_SET_BATTERY, "urgent lane not first");
+    CHECK(q.pop(c, 400) && c.command == CMD_FRIDGE_SET_LEFT_TEMP && c.value2 == 4 && c.queuedAt == 100,
+          "coalesced setpoint: value %d queued at %lu", c.value2, c.queuedAt);
+    CHECK(q.pop(c, 400) && c.command == CMD_FRIDGE_SET_ECO, "eco");
+    CHECK(!q.pop(c, 400) && !q.waiting(FRIDGE, CMD_FRIDGE_SET_ECO), "queue not empty");
+    CHECK(q.dispatched() == 3 && q.waitMaxMs() == 300 && q.waitAvgMs() == 200 && q.maxDepth() == 3,
+          "stats: %u sent, max %lu avg %lu", q.dispatched(), q.waitMaxMs(), q.waitAvgMs());
+
+    for (uint8_t cmd = 0; cmd < COMMAND_QUEUE_SIZE; cmd++) q.push(2, cmd, 0, 0, 500);
+    CHECK(q.push(2, 99, 0, 0, 500) == QUEUE_FULL && q.dropped() == 1, "full queue");
+}
+
+static ControlCommand toCommand(const QueuedCommand& q, uint32_t id) {
+    ControlCommand cmd = {};
+    cmd.commandId = id;
+    cmd.device = q.device;
+    cmd.command = q.command;
+    cmd.value1 = q.value1;
+    cmd.value2 = q.value2;
+    return cmd;
+}
+
+static CommandAck ackFor(uint32_t id) {
+    CommandAck a = {};
+    a.commandId = id;
+    a.received = a.executed = true;
+    return a;
+}
+
+static void newerSetpointWhileUnacked() {
+    CommandQueue q;
+    CommandTracker t;
+    QueuedCommand qc;
+    ControlCommand out;
+
+    // 4 degrees goes out and its ACK is lost; 5 is tapped before the retransmit
+    q.push(FRIDGE, CMD_FRIDGE_SET_LEFT_TEMP, 0, 4, 0);
+    q.pop(qc, 0);
+    t.track(toCommand(qc, 1), 0);
+    q.push(FRIDGE, CMD_FRIDGE_SET_LEFT_TEMP, 0, 5, 100);
+    CHECK(!t.nextRetransmit(300, out, q), "4 degrees retransmitted while 5 is queued");
+    CHECK(t.superseded() == 1 && t.inFlight() == 0, "old setpoint still in flight");
+
+    q.pop(qc, 300);
+    t.track(toCommand(qc, 2), 300);
+    CHECK(t.nextRetransmit(600, out, q) && out.commandId == 2 && out.value2 == 5, "5 degrees not retransmitted");
+    CHECK(!t.acknowledge(ackFor(1), 650) && t.duplicateAcks() == 1, "late ACK of the old setpoint");
+    CHECK(t.acknowledge(ackFor(2), 660) && t.lastResult().value2 == 5, "ACK of the new setpoint");
+
+    // Sent straight away (no retransmit came due in between): dropped on track()
+    t.track(toCommand(qc, 3), 1000);
+    qc.value2 = 6;
+    t.track(toCommand(qc, 4), 1100);
+    CHECK(t.superseded() == 2 && t.inFlight() == 1, "#3 not dropped when #4 was sent");
+    CHECK(t.nextRetransmit(1400, out, q) && out.commandId == 4, "retransmitted #%u", out.commandId);
+
+    // Other settings are left alone
+    ControlCommand eco = toCommand(qc, 5);
+    eco.command = CMD_FRIDGE_SET_ECO;
+    t.track(eco, 2000);
+    CHECK(t.inFlight() == 2 && t.superseded() == 2, "a different setting was superseded");
+}
+
+// Drives the queue and tracker the way processMasterQueue() does, over a
+// link that loses frames and ACKs
+static void lossyLink() {
+    uint32_t seed = 99;
+    auto rnd = [&seed](int n) {
+        seed = seed * 1103515245u + 12345u;
+        return (int)((seed >> 16) % n);
+    };
+
+    const int RUNS = 200;
+    int violations = 0, endedOnLast = 0;
+    uint32_t superseded = 0, retransmits = 0;
+    for (int run = 0; run < RUNS; run++) {
+        CommandQueue q;
+        CommandTracker t;
+        uint32_t nextId = 1;
+        int16_t tapped = 0, applied = -1;
+        std::vector<uint32_t> seen;          // Relay's repeat filter
+        std::vector<CommandAck> acks;        // In the air back to the master
+        int taps = 0;
+
+        for (unsigned long now = 0; now < 20000; now += 100) {
+            if (taps < 12 && rnd(4) == 0) {
+                q.push(FRIDGE, CMD_FRIDGE_SET_LEFT_TEMP, 0, ++tapped, now);
+                taps++;
+            }
+            for (const CommandAck& a : acks) t.acknowledge(a, now);
+            acks.clear();
+            t.expire(now);
+
+            ControlCommand cmd;
+            bool send = t.nextRetransmit(now, cmd, q);
+            QueuedCommand qc;
+            if (!send && !t.full() && q.pop(qc, now)) {
+                cmd = toCommand(qc, nextId++);
+                t.track(cmd, now);
+                send = true;
+            }
+            if (!send || rnd(3) == 0) continue;     // Lost on the way out
+
+            bool repeat = false;
+            for (uint32_t id : seen) repeat = repeat || id == cmd.commandId;
+            if (!repeat) {
+                seen.push_back(cmd.commandId);
+                if (cmd.value2 < applied) violations++;
+                applied = cmd.value2;
+            }
+            if (rnd(3) != 0) acks.push_back(ackFor(cmd.commandId));
+        }
+        endedOnLast += applied == tapped;
+        superseded += t.superseded();
+        retransmits += t.retransmits();
+    }
+    CHECK(violations == 0, "%d older setpoints applied after newer ones", violations);
+    printf("lossy link: %d runs, %u retransmits, %u superseded, %d ended on the last tap\n",
+           RUNS, retransmits, superseded, endedOnLast);
+}
+
+int main() {
+    coalesceAndLanes();
+    newerSetpointWhileUnacked();
+    lossyLink();
+    return hostTestResult("command_queue_test");
+}
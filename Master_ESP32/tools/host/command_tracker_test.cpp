@@ -0,0 +1,134 @@
+// Host test for src/CommandTracker.cpp
+//
+//   g++ -std=c++17 -Isrc -Iinclude -Itools/host tools/host/command_tracker_test.cpp
+//       src/CommandTracker.cpp src/CommandQueue.cpp -o command_tracker_test
+//
+// 1. An ACK finishes the command with its latency and lands in the right
+//    histogram bucket; an error ACK counts as failed.
+// 2. Without an ACK the same commandId is retransmitted at 300, 900 and
+//    2100 ms (backoff doubling from COMMAND_ACK_TIMEOUT_MS), and times out
+//    2400 ms after the fourth send, not before.
+// 3. Repeat ACKs for a finished command count as duplicates; ACKs for ids
+//    never sent do not.
+// 4. A relay that never gets to retransmit (stuck scanning) still times out
+//    after COMMAND_EXPIRE_MS, and the table refuses a ninth command.
+// 5. p50/p95 come out as the bucket limits of the 50th/95th sample, and the
+//    schedule holds across the millis() wrap.
+//
+// Sources: src/CommandTracker.cpp src/CommandQueue.cpp
+
+#include <limits.h>
+#include <stdio.h>
+#include "HostTest.h"
+#include "CommandTracker.h"
+
+static CommandQueue idle;     // Nothing waiting, so nothing is superseded
+
+static ControlCommand command(uint32_t id, int16_t value = 0) {
+    ControlCommand cmd = {};
+    cmd.commandId = id;
+    cmd.device = 1;
+    cmd.command = CMD_FRIDGE_SET_LEFT_TEMP;
+    cmd.value1 = 0;
+    cmd.value2 = value;
+    return cmd;
+}
+
+static CommandAck ack(uint32_t id, bool executed = true, uint8_t errorCode = 0) {
+    CommandAck a = {};
+    a.commandId = id;
+    a.received = true;
+    a.executed = executed;
+    a.errorCode = errorCode;
+    return a;
+}
+
+static void acked() {
+    CommandTracker t;
+    t.track(command(1, 4), 1000);
+    CHECK(t.inFlight() == 1, "in flight %u", t.inFlight());
+    CHECK(t.acknowledge(ack(1), 1042), "ACK not matched");
+    CommandResult r = t.lastResult();
+    CHECK(r.commandId == 1 && r.outcome == CMD_OUTCOME_OK && r.latencyMs == 42 && r.attempts == 1 && r.value2 == 4,
+          "result #%u %s %ums x%u", r.commandId, commandOutcomeName(r.outcome), r.latencyMs, r.attempts);
+    CHECK(t.inFlight() == 0 && t.acked() == 1, "not released");
+    CHECK(t.bucketCount(3) == 1, "42 ms not in the 35-50 ms bucket");
+
+    t.track(command(2), 2000);
+    CHECK(t.acknowledge(ack(2, false, 3), 2010), "error ACK not matched");
+    r = t.lastResult();
+    CHECK(r.outcome == CMD_OUTCOME_FAILED && r.errorCode == 3 && t.failed() == 1, "error ACK: %s",
+          commandOutcomeName(r.outcome));
+}
+
+static void retransmits() {
+    CommandTracker t;
+    t.track(command(7), 0);
+    const unsigned long due[] = {300, 900, 2100};
+    ControlCommand out;
+    for (unsigned long d : due) {
+        CHECK(!t.nextRetransmit(d - 1, out, idle), "retransmit before %lu ms", d);
+        CHECK(t.nextRetransmit(d, out, idle) && out.commandId == 7, "no retransmit of #7 at %lu ms", d);
+        CHECK(!t.nextRetransmit(d, out, idle), "second retransmit at %lu ms", d);
+    }
+    CHECK(!t.nextRetransmit(10000, out, idle), "fifth send");
+    CHECK(t.retransmits() == 3, "%u retransmits", t.retransmits());
+
+    t.expire(4499);
+    CHECK(t.inFlight() == 1, "gave up before the last backoff ran out");
+    t.expire(4500);
+    CommandResult r = t.lastResult();
+    CHECK(t.inFlight() == 0 && r.outcome == CMD_OUTCOME_TIMEOUT && r.attempts == COMMAND_MAX_ATTEMPTS &&
+          t.timedOut() == 1, "timeout: %s after %u sends", commandOutcomeName(r.outcome), r.attempts);
+
+    // The relay ACKs each copy; only the first one counts
+    t.track(command(8), 5000);
+    t.nextRetransmit(5300, out, idle);
+    CHECK(t.acknowledge(ack(8), 5310), "first ACK of #8");
+    CHECK(!t.acknowledge(ack(8), 5320) && t.duplicateAcks() == 1, "repeat ACK: %u duplicates", t.duplicateAcks());
+    CHECK(t.lastResult().latencyMs == 310 && t.lastResult().attempts == 2, "latency from the first send");
+    CHECK(!t.acknowledge(ack(99), 5400) && t.duplicateAcks() == 1, "unknown id counted as duplicate");
+}
+
+static void stuckAndFull() {
+    CommandTracker t;
+    t.track(command(1), 0);
+    t.expire(COMMAND_EXPIRE_MS - 1);
+    CHECK(t.inFlight() == 1, "expired early");
+    t.expire(COMMAND_EXPIRE_MS);
+    CHECK(t.inFlight() == 0 && t.lastResult().attempts == 1, "not expired after %d ms", COMMAND_EXPIRE_MS);
+
+    for (uint32_t id = 10; id < 10 + COMMAND_INFLIGHT_MAX; id++) {
+        ControlCommand cmd = command(id);
+        cmd.command = id;       // Distinct settings
+        CHECK(t.track(cmd, 100), "track #%u", id);
+    }
+    ControlCommand extra = command(50);
+    extra.command = 50;
+    CHECK(t.full() && !t.track(extra, 100), "ninth command accepted");
+}
+
+static void percentilesAndWrap() {
+    CommandTracker t;
+    CHECK(t.latencyPercentile(50) == 0, "percentile with no samples");
+    for (uint32_t ms = 1; ms <= 100; ms++) {
+        t.track(command(ms), 0);
+        t.acknowledge(ack(ms), ms);
+    }
+    CHECK(t.latencyPercentile(50) == 50 && t.latencyPercentile(95) == 100 && t.latencyPercentile(100) == 100,
+          "p50 %u p95 %u", t.latencyPercentile(50), t.latencyPercentile(95));
+
+    unsigned long start = ULONG_MAX - 100;
+    t.track(command(500), start);
+    ControlCommand out;
+    CHECK(!t.nextRetransmit(start + 299, out, idle) && t.nextRetransmit(start + 300, out, idle), "retransmit across wrap");
+    CHECK(t.acknowledge(ack(500), start + 350) && t.lastResult().latencyMs == 350, "latency across wrap");
+}
+
+int main() {
+    acked();
+    retransmits();
+    stuckAndFull();
+    percentilesAndWrap();
+    return hostTestResult("command_tracker_test");
+}
@@ -0,0 +1,282 @@
+// Host test for the streaming CSV import (include/CsvReader.h and
+// src/InventoryCsv.cpp), using the repo's own CSV files as fixtures
+//
+//   g++ -std=c++17 -Isrc -Iinclude -Itools/host tools/host/csv_import_test.cpp
+//       src/InventoryCsv.cpp src/InventoryIndex.cpp src/StringPool.cpp -o csv_import_test
+//   ./csv_import_test              (from Master_ESP32/)
+//
+// 1. ../inventory_import.csv (';'-separated, as Excel writes it) imports
+//    the same 119 items in 17 categories whatever size the upload chunks
+//    are, from 1 byte to the whole file, and every row matches an
+//    independent split of the file.
+// 2. "../Check List/Camping Stock List.csv", the printable stock list
+//    (heading rows per category, TRUE/FALSE tick columns, 'y' under
+//    Trailer), imports its 164 items in 14 categories for every chunk size,
+//    each matching an independent reading of its row: consumable headings
+//    map the ticked column to the status, equipment headings the ticks to
+//    checked/packed, and "Essentials list:" to the Essentials tab.
+// 3. RFC 4180 details: quoted separators, doubled quotes, a line break
+//    inside quotes, CRLF, and errors reported against the right line.
+//
+// Sources: src/InventoryCsv.cpp src/InventoryIndex.cpp src/StringPool.cpp
+
+#include <stdio.h>
+#include <string>
+#include <vector>
+#include "HostTest.h"
+#include "DynamicInventory.h"
+#include "InventoryCsv.h"
+
+StringPool inventoryNames;
+std::vector<DynamicCategory> inventory;
+WallClock wallClock;
+
+void clearInventory() {
+    inventory.clear();
+    inventoryNames.clear();
+    inventoryIndex.invalidate();
+}
+
+static bool readFile(const char* path, std::string& out) {
+    FILE* f = fopen(path, "rb");
+    if (!f) return false;
+    char buf[4096];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), f)) > 0) out.append(buf, n);
+    fclose(f);
+    return true;
+}
+
+// Feed `data` in `chunk`-sized pieces, as the upload callback does
+static bool import(const std::string& data, size_t chunk) {
+    csvImport.begin();
+    for (size_t i = 0; i < data.size(); i += chunk) {
+        csvImport.write(data.data() + i, min(chunk, data.size() - i));
+    }
+    return csvImport.finish();
+}
+
+// Split an unquoted line, trimming spaces around fields as CsvReader does
+static std::vector<std::string> split(const std::string& line, char sep) {
+    std::vector<std::string> fields(1);
+    for (char c : line) {
+        if (c == sep) fields.emplace_back();
+        else if (c != '\r') fields.back() += c;
+    }
+    for (std::string& f : fields) {
+        f.erase(0, f.find_first_not_of(" \t"));
+        f.erase(f.find_last_not_of(" \t") + 1);
+    }
+    return fields;
+}
+
+static const DynamicCategory* findCategory(const std::vector<DynamicCategory>& categories, const std::string& name) {
+    for (const DynamicCategory& c : categories) {
+        if (c.name == name.c_str()) return &c;
+    }
+    return nullptr;
+}
+
+// Every data row of the fixture (which has no quoting) against the import
+static void compareRows(const std::string& data) {
+    const std::vector<DynamicCategory>& categories = csvImport.categories();
+    size_t rows = 0, start = data.find('\n') + 1;
+    while (start < data.size()) {
+        size_t end = data.find('\n', start);
+        if (end == std::string::npos) end = data.size();
+        std::vector<std::string> f = split(data.substr(start, end - start), ';');
+        start = end + 1;
+        if (f.size() < 8) continue;
+        rows++;
+
+        const DynamicCategory* c = findCategory(categories, f[1]);
+        CHECK(c, "category %s missing", f[1].c_str());
+        if (!c) continue;
+        bool consumable = f[0] == "CONSUMABLES";
+        CHECK(c->isConsumable == consumable, "%s: consumable flag", f[1].c_str());
+        bool found = false;
+        if (consumable) {
+            for (const ConsumableItem& item : c->consumables) {
+                if (item.name != f[2].c_str()) continue;
+                found = true;
+                CHECK(strcmp(getStatusName(item.status), f[3].c_str()) == 0, "%s: status %s, expected %s",
+                      f[2].c_str(), getStatusName(item.status), f[3].c_str());
+                CHECK(item.livesInTrailer == (f[4] == "Yes"), "%s: livesInTrailer", f[2].c_str());
+            }
+        } else {
+            Subcategory sub = f[0] == "TRAILER" ? SUBCATEGORY_TRAILER
+                            : f[0] == "ESSENTIALS" ? SUBCATEGORY_ESSENTIALS : SUBCATEGORY_OPTIONAL;
+            CHECK(c->subcategory == sub, "%s: subcategory %d", f[1].c_str(), c->subcategory);
+            for (const EquipmentItem& item : c->equipment) {
+                if (item.name != f[2].c_str()) continue;
+                found = true;
+                CHECK(item.checked == (f[5] == "Yes") && item.packed == (f[6] == "Yes") &&
+                      item.taking == (f[7] == "Yes"), "%s: flags", f[2].c_str());
+            }
+        }
+        CHECK(found, "%s / %s not imported", f[1].c_str(), f[2].c_str());
+    }
+    CHECK(rows == csvImport.imported(), "%zu rows in the file, %zu imported", rows, csvImport.imported());
+}
+
+static void inventoryFixture() {
+    std::string data;
+    if (!readFile("../inventory_import.csv", data)) {
+        CHECK(false, "../inventory_import.csv missing (run from Master_ESP32/)");
+        return;
+    }
+    const size_t chunks[] = {1, 2, 3, 7, 64, 1436, data.size()};
+    for (size_t chunk : chunks) {
+        CHECK(import(data, chunk), "chunk %zu: rejected with %zu errors", chunk, csvImport.errorCount());
+        CHECK(csvImport.imported() == 119, "chunk %zu: %zu items", chunk, csvImport.imported());
+        CHECK(csvImport.categories().size() == 17, "chunk %zu: %zu categories", chunk, csvImport.categories().size());
+        compareRows(data);
+    }
+    printf("inventory_import.csv: %zu items in %zu categories, %zu chunk sizes\n",
+           csvImport.imported(), csvImport.categories().size(), sizeof(chunks) / sizeof(chunks[0]));
+}
+
+// Every item row of the stock list against the import, reading the file
+// the way a person would: a heading row starts a category, a name starts an item
+static void compareChecklist(const std::string& data) {
+    const std::vector<DynamicCategory>& categories = csvImport.categories();
+    const DynamicCategory* c = nullptr;
+    bool trailerTab = false;
+    size_t rows = 0, start = data.find('\n') + 1;   // After the Date: line
+    while (start < data.size()) {
+        size_t end = data.find('\n', start);
+        if (end == std::string::npos) end = data.size();
+        std::vector<std::string> f = split(data.substr(start, end - start), ';');
+        start = end + 1;
+        f.resize(8);
+        bool stock = f[1] == "Full" && f[4] == "Repl";
+        bool ticked = f[1] == "Checked" && f[3] == "Packed";
+        bool list = !f[0].empty() && f[0].back() == ':' && f[1].empty() && f[5].empty() && f[6].empty();
+        if (stock || ticked || list) {
+            if (c && !c->isConsumable && c->subcategory != SUBCATEGORY_ESSENTIALS) {
+                CHECK(c->subcategory == (trailerTab ? SUBCATEGORY_TRAILER : SUBCATEGORY_OPTIONAL), "%s: tab %d",
+                      c->name.c_str(), c->subcategory);
+            }
+            std::string name = f[0].back() == ':' ? f[0].substr(0, f[0].size() - 1) : f[0];
+            c = findCategory(categories, name);
+            CHECK(c && c->isConsumable == stock, "heading %s", name.c_str());
+            CHECK(!c || !list || c->subcategory == SUBCATEGORY_ESSENTIALS, "%s not on the Essentials tab", name.c_str());
+            trailerTab = false;
+            continue;
+        }
+        if (f[0].empty() || !c) continue;
+        rows++;
+        bool found = false;
+        if (c->isConsumable) {
+            const char* expected = f[1] == "TRUE" ? "Full" : f[3] == "TRUE" ? "Low" : f[4] == "TRUE" ? "Out" : "OK";
+            for (const ConsumableItem& item : c->consumables) {
+                if (item.name != f[0].c_str()) continue;
+                found = true;
+                CHECK(strcmp(getStatusName(item.status), expected) == 0 && item.livesInTrailer, "%s: status %s, expected %s",
+                      f[0].c_str(), getStatusName(item.status), expected);
+            }
+        } else {
+            trailerTab = trailerTab || f[5] == "y";
+            for (const EquipmentItem& item : c->equipment) {
+                if (item.name != f[0].c_str()) continue;
+                found = true;
+                CHECK(item.checked == (f[1] == "TRUE") && item.packed == (f[3] == "TRUE") &&
+                      item.livesInTrailer == (f[5] == "y") && !item.taking, "%s: flags", f[0].c_str());
+            }
+        }
+        CHECK(found, "%s / %s not imported", c->name.c_str(), f[0].c_str());
+    }
+    CHECK(rows == csvImport.imported(), "%zu item rows in the file, %zu imported", rows, csvImport.imported());
+}
+
+static void replace(std::string& data, const char* from, const char* to) {
+    size_t at = data.find(from);
+    CHECK(at != std::string::npos, "fixture row %s missing", from);
+    if (at != std::string::npos) data.replace(at, strlen(from), to);
+}
+
+static void checklistFixture() {
+    std::string data;
+    if (!readFile("../Check List/Camping Stock List.csv", data)) {
+        CHECK(false, "Camping Stock List.csv missing (run from Master_ESP32/)");
+        return;
+    }
+
+    const size_t chunks[] = {1, 13, 1436, data.size()};
+    for (size_t chunk : chunks) {
+        CHECK(import(data, chunk), "chunk %zu: rejected with %zu errors (first: line %u: %s)", chunk,
+              csvImport.errorCount(), csvImport.errors().empty() ? 0 : csvImport.errors()[0].line,
+              csvImport.errors().empty() ? "" : csvImport.errors()[0].message.c_str());
+        CHECK(csvImport.imported() == 164 && csvImport.categories().size() == 14, "chunk %zu: %zu items in %zu categories",
+              chunk, csvImport.imported(), csvImport.categories().size());
+        compareChecklist(data);
+    }
+    const std::vector<DynamicCategory>& c = csvImport.categories();
+    const DynamicCategory* kitchen = findCategory(c, "Kitchen");
+    const DynamicCategory* tents = findCategory(c, "Tents & Gazebo's");
+    const DynamicCategory* essentials = findCategory(c, "Essentials list");
+    CHECK(kitchen && kitchen->isConsumable && kitchen->consumables.size() == 11 &&
+          kitchen->consumables[0].name == "Roller towel", "Kitchen consumables");
+    CHECK(tents && tents->subcategory == SUBCATEGORY_TRAILER && tents->equipment.size() == 8 &&
+          tents->equipment[1].name == "Nylon Tent & Poles" && !tents->equipment[1].livesInTrailer, "Tents");
+    CHECK(essentials && essentials->subcategory == SUBCATEGORY_ESSENTIALS && essentials->equipment.size() == 18 &&
+          essentials->equipment[0].name == "Sunblock", "Essentials");
+    printf("Camping Stock List.csv: %zu items in %zu categories, %zu chunk sizes\n",
+           csvImport.imported(), c.size(), sizeof(chunks) / sizeof(chunks[0]));
+
+    // The sheet as filled in: ticks in the status and checked/packed columns
+    replace(data, "Salt;FALSE;FALSE;FALSE;FALSE", "Salt;FALSE;FALSE;TRUE;FALSE");
+    replace(data, "Matches;FALSE;FALSE;FALSE;FALSE", "Matches;FALSE;FALSE;FALSE;TRUE");
+    replace(data, "Ziploc bags;FALSE;FALSE;FALSE;FALSE", "Ziploc bags;TRUE;FALSE;FALSE;FALSE");
+    replace(data, "Axe;FALSE;;FALSE", "Axe;TRUE;;TRUE");
+    replace(data, "Headlamps;FALSE;FALSE;FALSE;FALSE", "Headlamps;TRUE;FALSE;FALSE;FALSE");
+    CHECK(import(data, 64), "ticked sheet rejected");
+    compareChecklist(data);
+
+    replace(data, "Mallet;FALSE", "Mallet;maybe");
+    CHECK(!import(data, 64) && csvImport.errorCount() == 1 &&
+          csvImport.errors()[0].message == "Expected TRUE or FALSE, found \"maybe\"", "bad tick accepted");
+}
+
+static void rfc4180() {
+    std::string data =
+        "Category Type,Category,Item Name,Status,Lives in Trailer,Checked,Packed,Taking,Last Updated\r\n"
+        "CONSUMABLES,\"Kit, chen\",\"Say \"\"hi\"\"\",Full,Yes,N/A,N/A,N/A,1\r\n"
+        "TRAILER,Gear,\"multi\nline\",OK,Yes,Yes,No,Yes,2\r\n"
+        "CONSUMABLES,Kit,x,Bogus,Yes,N/A,N/A,N/A\n"
+        "short,row\n"
+        "\"unterminated,x";
+    // A live inventory the failed import must not touch
+    clearInventory();
+    inventory.push_back(DynamicCategory("Kitchen", "🍴", true, SUBCATEGORY_TRAILER));
+    inventory[0].consumables.push_back(ConsumableItem("Salt"));
+
+    for (size_t chunk : {1, 3, 1000}) {
+        CHECK(!import(data, chunk), "chunk %zu: bad rows accepted", chunk);
+        const std::vector<CsvImportError>& errors = csvImport.errors();
+        CHECK(errors.size() == 3, "chunk %zu: %zu errors", chunk, errors.size());
+        if (errors.size() != 3) continue;
+        // The quoted line break makes the Bogus row line 5
+        CHECK(errors[0].line == 5 && errors[0].message == "Unknown status \"Bogus\"", "error 0: %u %s",
+              errors[0].line, errors[0].message.c_str());
+        CHECK(errors[1].line == 6, "error 1 on line %u", errors[1].line);
+        CHECK(errors[2].line == 7 && errors[2].message == "Row too long or unterminated quote", "error 2: %u %s",
+              errors[2].line, errors[2].message.c_str());
+
+        const std::vector<DynamicCategory>& c = csvImport.categories();
+        CHECK(c.size() == 2 && c[0].name == "Kit, chen" && c[0].consumables[0].name == "Say \"hi\"" &&
+              c[0].consumables[0].status == STATUS_FULL, "chunk %zu: quoted fields", chunk);
+        CHECK(c.size() == 2 && c[1].equipment[0].name == "multi\nline" && c[1].equipment[0].taking &&
+              !c[1].equipment[0].packed, "chunk %zu: multi-line field", chunk);
+    }
+    CHECK(inventory.size() == 1 && inventory[0].consumables.size() == 1 && inventory[0].consumables[0].name == "Salt",
+          "live inventory changed");
+}
+
+int main() {
+    inventoryFixture();
+    checklistFixture();
+    rfc4180();
+    csvImport.reset();
+    return hostTestResult("csv_import_test");
+}
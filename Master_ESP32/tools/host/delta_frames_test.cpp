@@ -0,0 +1,185 @@
+// Host test for keyframe / delta telemetry (Shared/EspNowProtocol.h,
+// include/VictronFrames.h) on a realistic stream, as opposed to the random
+// packets of tools/frame_fuzz.cpp
+//
+//   g++ -std=c++17 -Iinclude -I../Shared -Itools/host tools/host/delta_frames_test.cpp -o delta_frames_test
+//
+// 1. An hour of telemetry that drifts the way the real readings do (noisy
+//    currents, slow voltages and SOC, fridge temperatures stepping now and
+//    then) decodes frame by frame to exactly the quantised fields that were
+//    sent, and the average frame is a fraction of sizeof(VictronPacket).
+// 2. The same stream over a link that loses 20% of frames: every frame the
+//    decoder accepts still rebuilds the sent packet exactly, and deltas are
+//    only refused when their keyframe was the frame lost.
+// 3. A change to the EcoFlow strings forces a keyframe that carries them.
+
+#include <algorithm>
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+#include "HostTest.h"
+#include "VictronFrames.h"
+
+static uint32_t seed = 7;
+static int rnd(int n) {
+    seed = seed * 1103515245u + 12345u;
+    return (int)((seed >> 16) % n);
+}
+static float jitter(float range) { return (rnd(2001) - 1000) / 1000.0f * range; }
+
+static VictronPacket startPacket() {
+    VictronPacket p;
+    memset(&p, 0, sizeof(p));
+    p.bmv.voltage = 12.84f;
+    p.bmv.current = -3.2f;
+    p.bmv.soc = 87.5f;
+    p.bmv.consumedAh = -24.1f;
+    p.bmv.timeToGo = 1440;
+    p.bmv.valid = true;
+    p.mppt.batteryVoltage = 12.9f;
+    p.mppt.solarPower = 180;
+    p.mppt.yieldToday = 0.42f;
+    p.mppt.state = 3;
+    p.mppt.valid = true;
+    p.ip22.batteryVoltage = 12.85f;
+    p.ip22.temperature = 24.5f;
+    p.ip22.valid = true;
+    p.ecoflow.batteryPercent = 76;
+    p.ecoflow.rssi = -71;
+    p.ecoflow.valid = true;
+    strcpy(p.ecoflow.serialNumber, "R351ZEB4HF6R0471");
+    strcpy(p.ecoflow.macAddress, "c8:2e:18:aa:41:7e");
+    p.fridge.left_actual = 4;
+    p.fridge.left_setpoint = 3;
+    p.fridge.right_actual = -17;
+    p.fridge.right_setpoint = -18;
+    p.fridge.connected = true;
+    p.fridge.valid = true;
+    p.fridge.rssi = -64;
+    p.readyForCommand = true;
+    return p;
+}
+
+// One send interval later
+static void drift(VictronPacket& p) {
+    p.senderTime += 2000;
+    p.bmv.current += jitter(0.15f);
+    p.bmv.voltage += jitter(0.004f);
+    p.mppt.batteryCurrent = p.mppt.solarPower / 13.0f;
+    p.mppt.batteryVoltage = p.bmv.voltage + 0.05f;
+    if (rnd(3) == 0) p.mppt.solarPower = std::max(0, (int)p.mppt.solarPower + rnd(21) - 10);
+    if (rnd(30) == 0) p.bmv.soc += 0.1f;
+    if (rnd(20) == 0) p.ip22.temperature += jitter(0.3f);
+    if (rnd(15) == 0) p.fridge.left_actual += rnd(3) - 1;
+    if (rnd(4) == 0) p.fridge.rssi = -60 - rnd(10);
+    if (rnd(200) == 0) p.ecoflow.batteryPercent--;
+}
+
+// Decoded fields, strings and time must match what was sent, after quantising
+static bool same(const VictronPacket& a, const VictronPacket& b) {
+    for (const SectionLayout& layout : ESPNOW_SECTIONS) {
+        int32_t va[ESPNOW_MAX_FIELDS], vb[ESPNOW_MAX_FIELDS];
+        packetFields(layout.tag, a, va);
+        packetFields(layout.tag, b, vb);
+        if (memcmp(va, vb, layout.count * sizeof(int32_t)) != 0) return false;
+    }
+    return a.senderTime == b.senderTime && strcmp(a.ecoflow.serialNumber, b.ecoflow.serialNumber) == 0 &&
+           strcmp(a.ecoflow.macAddress, b.ecoflow.macAddress) == 0;
+}
+
+static bool receive(const uint8_t* buf, size_t len, DeltaDecoder& decoder, VictronPacket& state) {
+    FrameReader frame(buf, len);
+    if (!frame.valid()) return false;
+    return decoder.decode(frame, [&](uint8_t tag, const int32_t* values, SectionReader& section) {
+        applyTelemetrySection(tag, values, section, state);
+    });
+}
+
+static const int FRAMES = 1800;     // An hour at one frame per 2 s
+
+static void steadyStream() {
+    VictronPacket sent = startPacket(), state;
+    memset(&state, 0, sizeof(state));
+    DeltaEncoder encoder;
+    DeltaDecoder decoder;
+    uint8_t buf[ESPNOW_MAX_FRAME];
+    size_t total = 0, keyBytes = 0, deltaBytes = 0, keys = 0, biggestDelta = 0;
+    for (int i = 0; i < FRAMES; i++) {
+        drift(sent);
+        size_t len = encodeTelemetryFrame(sent, buf, i, &encoder);
+        bool key = buf[5] & ESPNOW_FLAG_KEYFRAME;
+        total += len;
+        if (key) {
+            keys++;
+            keyBytes += len;
+        } else {
+            deltaBytes += len;
+            biggestDelta = std::max(biggestDelta, len);
+        }
+        CHECK(receive(buf, len, decoder, state), "frame %d refused", i);
+        CHECK(same(sent, state), "frame %d (%s) decoded differently", i, key ? "keyframe" : "delta");
+    }
+    CHECK(keys == FRAMES / ESPNOW_KEYFRAME_EVERY, "%zu keyframes in %d frames", keys, FRAMES);
+    double avg = (double)total / FRAMES;
+    CHECK(avg < sizeof(VictronPacket) / 3.0, "average frame %.1f bytes", avg);
+    printf("steady stream: %d frames, keyframe %zu B, delta avg %.1f B (max %zu), overall %.1f B against %zu B raw\n",
+           FRAMES, keyBytes / keys, (double)deltaBytes / (FRAMES - keys), biggestDelta, avg, sizeof(VictronPacket));
+}
+
+static void lossyStream() {
+    VictronPacket sent = startPacket(), state;
+    memset(&state, 0, sizeof(state));
+    DeltaEncoder encoder;
+    DeltaDecoder decoder;
+    uint8_t buf[ESPNOW_MAX_FRAME];
+    int lost = 0, lostKeys = 0, refused = 0, refusedExpected = 0;
+    bool keyLost = true;        // Nothing received yet
+    for (int i = 0; i < FRAMES; i++) {
+        drift(sent);
+        size_t len = encodeTelemetryFrame(sent, buf, i, &encoder);
+        bool key = buf[5] & ESPNOW_FLAG_KEYFRAME;
+        if (rnd(5) == 0) {
+            lost++;
+            if (key) {
+                lostKeys++;
+                keyLost = true;
+            }
+            continue;
+        }
+        if (key) keyLost = false;
+        else refusedExpected += keyLost;
+        if (!receive(buf, len, decoder, state)) {
+            refused++;
+            continue;
+        }
+        CHECK(same(sent, state), "frame %d accepted but decoded differently", i);
+    }
+    CHECK(refused == refusedExpected && decoder.missedBase() == (uint32_t)refused,
+          "%d deltas refused, %d expected (lost keyframes %d)", refused, refusedExpected, lostKeys);
+    printf("lossy stream: %d lost (%d keyframes), %d deltas refused for a lost keyframe, the rest exact\n",
+           lost, lostKeys, refused);
+}
+
+static void stringChange() {
+    VictronPacket sent = startPacket(), state;
+    memset(&state, 0, sizeof(state));
+    DeltaEncoder encoder;
+    DeltaDecoder decoder;
+    uint8_t buf[ESPNOW_MAX_FRAME];
+    receive(buf, encodeTelemetryFrame(sent, buf, 0, &encoder), decoder, state);
+    size_t len = encodeTelemetryFrame(sent, buf, 1, &encoder);
+    CHECK(!(buf[5] & ESPNOW_FLAG_KEYFRAME) && receive(buf, len, decoder, state), "second frame not a delta");
+
+    strcpy(sent.ecoflow.macAddress, "c8:2e:18:aa:41:7f");
+    len = encodeTelemetryFrame(sent, buf, 2, &encoder);
+    CHECK(buf[5] & ESPNOW_FLAG_KEYFRAME, "new address sent in a delta");
+    CHECK(receive(buf, len, decoder, state) && strcmp(state.ecoflow.macAddress, "c8:2e:18:aa:41:7f") == 0,
+          "new address not received: %s", state.ecoflow.macAddress);
+}
+
+int main() {
+    steadyStream();
+    lossyStream();
+    stringChange();
+    return hostTestResult("delta_frames_test");
+}
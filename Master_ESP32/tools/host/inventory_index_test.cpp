@@ -0,0 +1,178 @@
+// Host test for src/InventoryIndex.cpp
+//
+//   g++ -std=c++17 -Isrc -Iinclude -Itools/host tools/host/inventory_index_test.cpp
+//       src/InventoryIndex.cpp src/StringPool.cpp -o inventory_index_test
+//
+// Applies thousands of random adds, deletes, moves and sorts the way the
+// handlers in main.cpp do (placeCategory() / remove() after each edit, and
+// invalidate() when a category is deleted), and after every edit checks
+// find() against a linear scan for every live ID plus a few deleted ones.
+// The small table sizes make probe runs wrap, which exercises remove()'s
+// backward shift.
+//
+// Sources: src/InventoryIndex.cpp src/StringPool.cpp
+
+#include <algorithm>
+#include <stdio.h>
+#include <vector>
+#include "HostTest.h"
+#include "DynamicInventory.h"
+
+StringPool inventoryNames;
+std::vector<DynamicCategory> inventory;
+WallClock wallClock;
+
+void clearInventory() {
+    inventory.clear();
+    inventoryNames.clear();
+    inventoryIndex.invalidate();
+}
+
+static uint32_t seed = 2024;
+static int rnd(int n) {
+    seed = seed * 1103515245u + 12345u;
+    return (int)((seed >> 16) % (uint32_t)n);
+}
+
+static size_t itemCount(const DynamicCategory& c) {
+    return c.isConsumable ? c.consumables.size() : c.equipment.size();
+}
+
+static uint16_t itemId(const DynamicCategory& c, size_t i) {
+    return c.isConsumable ? c.consumables[i].id : c.equipment[i].id;
+}
+
+// Position of `id` by brute force
+static bool scan(uint16_t id, int& cat, int& item) {
+    for (size_t c = 0; c < inventory.size(); c++) {
+        for (size_t i = 0; i < itemCount(inventory[c]); i++) {
+            if (itemId(inventory[c], i) == id) {
+                cat = c;
+                item = i;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+static void sortCategory(int cat) {
+    DynamicCategory& c = inventory[cat];
+    if (c.isConsumable) {
+        std::sort(c.consumables.begin(), c.consumables.end(),
+                  [](const ConsumableItem& a, const ConsumableItem& b) { return strcmp(a.name, b.name) < 0; });
+    } else {
+        std::sort(c.equipment.begin(), c.equipment.end(),
+                  [](const EquipmentItem& a, const EquipmentItem& b) { return strcmp(a.name, b.name) < 0; });
+    }
+    inventoryIndex.placeCategory(cat);
+}
+
+static void addItem(int cat) {
+    String name = "item" + String(rnd(100000));
+    DynamicCategory& c = inventory[cat];
+    if (c.isConsumable) c.consumables.push_back(ConsumableItem(name));
+    else c.equipment.push_back(EquipmentItem(name));
+    sortCategory(cat);
+}
+
+static void deleteItem(int cat, int item) {
+    DynamicCategory& c = inventory[cat];
+    uint16_t id = itemId(c, item);
+    if (c.isConsumable) c.consumables.erase(c.consumables.begin() + item);
+    else c.equipment.erase(c.equipment.begin() + item);
+    inventoryIndex.remove(id);
+    inventoryIndex.placeCategory(cat);
+}
+
+static void moveItem(int cat, int item, int target) {
+    DynamicCategory& c = inventory[cat];
+    if (c.isConsumable) {
+        inventory[target].consumables.push_back(c.consumables[item]);
+        c.consumables.erase(c.consumables.begin() + item);
+    } else {
+        inventory[target].equipment.push_back(c.equipment[item]);
+        c.equipment.erase(c.equipment.begin() + item);
+    }
+    inventoryIndex.placeCategory(cat);
+    sortCategory(target);
+}
+
+static void checkAll(int step, const std::vector<uint16_t>& deleted) {
+    for (size_t c = 0; c < inventory.size(); c++) {
+        for (size_t i = 0; i < itemCount(inventory[c]); i++) {
+            uint16_t id = itemId(inventory[c], i);
+            int cat = -1, item = -1;
+            bool found = inventoryIndex.find(id, cat, item);
+            CHECK(found && cat == (int)c && item == (int)i,
+                  "step %d: id %u at %zu/%zu, index says %d %d/%d", step, id, c, i, found, cat, item);
+        }
+    }
+    for (uint16_t id : deleted) {
+        int cat, item;
+        CHECK(!inventoryIndex.find(id, cat, item) || !scan(id, cat, item),
+              "step %d: deleted id %u still found", step, id);
+    }
+}
+
+int main() {
+    for (int c = 0; c < 6; c++) {
+        inventory.push_back(DynamicCategory("cat" + String(c), "", c % 2 == 0, SUBCATEGORY_TRAILER));
+        for (int i = 0; i < 4; i++) inventory[c].isConsumable ? inventory[c].consumables.push_back(ConsumableItem("seed" + String(i)))
+                                                              : inventory[c].equipment.push_back(EquipmentItem("seed" + String(i)));
+    }
+    assignItemIds();
+
+    std::vector<uint16_t> deleted;
+    int adds = 0, deletes = 0, moves = 0, categoryDeletes = 0;
+    for (int step = 0; step < 4000; step++) {
+        int cat = rnd(inventory.size());
+        size_t n = itemCount(inventory[cat]);
+        int op = rnd(10);
+        if (op < 4 || n == 0) {
+            addItem(cat);
+            adds++;
+        } else if (op < 7) {
+            int item = rnd(n);
+            deleted.push_back(itemId(inventory[cat], item));
+            if (deleted.size() > 8) deleted.erase(deleted.begin());
+            deleteItem(cat, item);
+            deletes++;
+        } else if (op < 9) {
+            int target = rnd(inventory.size());
+            if (target == cat || inventory[target].isConsumable != inventory[cat].isConsumable) continue;
+            moveItem(cat, rnd(n), target);
+            moves++;
+        } else if (rnd(20) == 0 && inventory.size() > 2) {
+            for (size_t i = 0; i < n; i++) deleted.push_back(itemId(inventory[cat], i));
+            while (deleted.size() > 8) deleted.erase(deleted.begin());
+            inventory.erase(inventory.begin() + cat);
+            inventoryIndex.invalidate();
+            inventory.push_back(DynamicCategory("new", "", rnd(2), SUBCATEGORY_TRAILER));
+            categoryDeletes++;
+        }
+        checkAll(step, deleted);
+    }
+
+    // Unknown IDs miss cleanly
+    int cat, item;
+    CHECK(!inventoryIndex.find(INVENTORY_NO_ID, cat, item), "NO_ID found");
+    CHECK(!inventoryIndex.find(nextItemId, cat, item), "unissued id found");
+
+    // An edit that forgets the index still resolves (one rebuild)
+    inventory[0].isConsumable ? inventory[0].consumables.push_back(ConsumableItem("zz-unindexed"))
+                              : inventory[0].equipment.push_back(EquipmentItem("zz-unindexed"));
+    uint16_t stray = itemId(inventory[0], itemCount(inventory[0]) - 1);
+    CHECK(inventoryIndex.find(stray, cat, item) && cat == 0, "unindexed add not found");
+    std::reverse(inventory[0].equipment.begin(), inventory[0].equipment.end());
+    std::reverse(inventory[0].consumables.begin(), inventory[0].consumables.end());
+    checkAll(-1, deleted);
+
+    printf("%d adds, %d deletes, %d moves, %d category deletes, %zu items at the end\n",
+           adds, deletes, moves, categoryDeletes, [] {
+               size_t n = 0;
+               for (const DynamicCategory& c : inventory) n += itemCount(c);
+               return n;
+           }());
+    return hostTestResult("inventory_index_test");
+}
@@ -0,0 +1,150 @@
+// Host test for include/JsonWriter.h
+//
+//   g++ -std=c++17 -Iinclude -Itools/host tools/host/json_writer_test.cpp -o json_writer_test
+//
+// 1. Commas and nesting: exact output for objects in arrays in objects,
+//    empty containers and a member after a nested container.
+// 2. Escaping: every byte from 0x01 to 0xFF inside a string, and inside a
+//    key, decodes back to the original. Control characters never appear
+//    raw, and UTF-8 (item names with emoji) passes through untouched.
+// 3. Numbers: int/long extremes, unsigned long max, decimals, and
+//    NaN/infinity written as null.
+// 4. Nesting deeper than the 32-level limit still closes every bracket.
+
+#include <limits.h>
+#include <math.h>
+#include <string>
+#include "HostTest.h"
+#include "JsonWriter.h"
+
+struct StringOut {
+    std::string s;
+    void write(const uint8_t* data, size_t n) { s.append((const char*)data, n); }
+};
+
+// Decode the JSON string literal at s[pos] (which must be '"'); returns the
+// index after the closing quote, or 0 if it is malformed
+static size_t decodeString(const std::string& s, size_t pos, std::string& out) {
+    if (pos >= s.size() || s[pos] != '"') return 0;
+    for (size_t i = pos + 1; i < s.size(); i++) {
+        unsigned char c = s[i];
+        if (c == '"') return i + 1;
+        if (c < 0x20) return 0;     // Raw control character
+        if (c != '\\') {
+            out += (char)c;
+            continue;
+        }
+        if (++i >= s.size()) return 0;
+        switch (s[i]) {
+            case '"': out += '"'; break;
+            case '\\': out += '\\'; break;
+            case '/': out += '/'; break;
+            case 'n': out += '\n'; break;
+            case 'r': out += '\r'; break;
+            case 't': out += '\t'; break;
+            case 'b': out += '\b'; break;
+            case 'f': out += '\f'; break;
+            case 'u': {
+                if (i + 4 >= s.size()) return 0;
+                unsigned long code = strtoul(s.substr(i + 1, 4).c_str(), nullptr, 16);
+                if (code > 0x7F) return 0;      // The writer only escapes ASCII
+                out += (char)code;
+                i += 4;
+                break;
+            }
+            default: return 0;
+        }
+    }
+    return 0;
+}
+
+static void structure() {
+    StringOut out;
+    JsonWriter<StringOut> json(out);
+    json.beginObject()
+        .member("name", "list")
+        .key("items").beginArray()
+            .beginObject().member("id", 1).member("ok", true).endObject()
+            .beginObject().endObject()
+            .beginArray().endArray()
+            .null()
+        .endArray()
+        .member("count", 3)
+        .key("empty").beginObject().endObject()
+        .member("last", (const char*)nullptr)
+        .endObject();
+    const char* expected =
+        "{\"name\":\"list\",\"items\":[{\"id\":1,\"ok\":true},{},[],null],"
+        "\"count\":3,\"empty\":{},\"last\":null}";
+    CHECK(out.s == expected, "structure:\n  got      %s\n  expected %s", out.s.c_str(), expected);
+
+    StringOut seq;
+    JsonWriter<StringOut> top(seq);
+    top.beginArray().value(1).value(2).endArray();
+    CHECK(seq.s == "[1,2]", "array: %s", seq.s.c_str());
+}
+
+static void escaping() {
+    std::string all;
+    for (int c = 1; c < 256; c++) all += (char)c;
+    all += "\xF0\x9F\x8D\xB4 Crockery";    // 🍴, as in the category icons
+
+    StringOut out;
+    JsonWriter<StringOut> json(out);
+    json.beginObject().member(all.c_str(), all.c_str()).endObject();
+
+    std::string key, value;
+    size_t pos = decodeString(out.s, 1, key);
+    CHECK(pos && out.s[pos] == ':', "key did not decode");
+    size_t end = pos ? decodeString(out.s, pos + 1, value) : 0;
+    CHECK(end && end + 1 == out.s.size() && out.s[end] == '}', "value did not decode");
+    CHECK(key == all, "key round trip differs");
+    CHECK(value == all, "value round trip differs");
+
+    // Characters that need no escape are not escaped
+    StringOut plain;
+    JsonWriter<StringOut>(plain).value("Salt & Pepper <50g> 'fine'");
+    CHECK(plain.s == "\"Salt & Pepper <50g> 'fine'\"", "plain: %s", plain.s.c_str());
+
+    StringOut quoted;
+    JsonWriter<StringOut>(quoted).value("Say \"hi\"\\\n");
+    CHECK(quoted.s == "\"Say \\\"hi\\\"\\\\\\n\"", "quoted: %s", quoted.s.c_str());
+}
+
+static void numbers() {
+    StringOut out;
+    JsonWriter<StringOut> json(out);
+    json.beginArray()
+        .value(0).value(-1).value(INT_MAX).value(INT_MIN)
+        .value(LONG_MIN).value(ULONG_MAX).value(40000u)
+        .value(12.3456).value(-0.5, 1).value(3.0, 0)
+        .value(NAN).value(INFINITY).value(-INFINITY)
+        .endArray();
+    std::string expected = "[0,-1," + std::to_string(INT_MAX) + "," + std::to_string(INT_MIN) + "," +
+                           std::to_string(LONG_MIN) + "," + std::to_string(ULONG_MAX) +
+                           ",40000,12.35,-0.5,3,null,null,null]";
+    CHECK(out.s == expected, "numbers:\n  got      %s\n  expected %s", out.s.c_str(), expected.c_str());
+}
+
+static void deepNesting() {
+    StringOut out;
+    JsonWriter<StringOut> json(out);
+    for (int i = 0; i < 40; i++) json.beginArray().value(i);
+    for (int i = 0; i < 40; i++) json.endArray();
+    int depth = 0, minDepth = 0;
+    for (char c : out.s) {
+        if (c == '[') depth++;
+        if (c == ']') depth--;
+        if (depth < minDepth) minDepth = depth;
+    }
+    CHECK(depth == 0 && minDepth == 0, "unbalanced brackets: %s", out.s.c_str());
+    CHECK(out.s.compare(0, 8, "[0,[1,[2") == 0, "deep nesting starts %s", out.s.substr(0, 8).c_str());
+}
+
+int main() {
+    structure();
+    escaping();
+    numbers();
+    deepNesting();
+    return hostTestResult("json_writer_test");
+}
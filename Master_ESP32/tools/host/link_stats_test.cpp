@@ -0,0 +1,143 @@
+// Host test for src/LinkStats.cpp
+//
+//   g++ -std=c++17 -Isrc -Iinclude -Itools/host tools/host/link_stats_test.cpp src/LinkStats.cpp -o link_stats_test
+//
+// 1. Late and duplicate timed frames: seq 1, 3, 2 gives LINK_LATE for 2 (its
+//    senderTime is older, which is not a reboot), a repeat of any frame in
+//    the window is LINK_DUPLICATE, and neither disturbs the window, jitter
+//    or clock offset.
+// 2. Loss: gaps inside the window, a long outage, and the 16-bit wrap.
+// 3. Reboots: the sequence number jumping back past the window, and a new
+//    frame whose clock went back, both restart the statistics.
+// 4. A shuffled stream (frames delayed by up to a few places, some sent
+//    twice) never counts a reboot and reports every frame exactly once as
+//    new or late.
+//
+// Sources: src/LinkStats.cpp
+
+#include <algorithm>
+#include <stdio.h>
+#include <vector>
+#include "HostTest.h"
+#include "LinkStats.h"
+
+static const char* name(LinkArrival a) {
+    return a == LINK_NEW ? "new" : a == LINK_LATE ? "late" : "duplicate";
+}
+
+static void lateAndDuplicate() {
+    LinkStats l;
+    LinkSummary s;
+    // Frames every 1000 ms of sender time, arriving 5 ms later
+    CHECK(l.record(1, true, 1000, 10005) == LINK_NEW, "seq 1");
+    CHECK(l.record(3, true, 3000, 12005) == LINK_NEW, "seq 3");
+    LinkArrival a = l.record(2, true, 2000, 12010);
+    l.summary(s);
+    CHECK(a == LINK_LATE && s.reboots == 0 && s.late == 1, "seq 2 after 3: %s, reboots=%u late=%u",
+          name(a), s.reboots, s.late);
+    CHECK(s.windowSize == 3 && s.windowLost == 0, "window %u lost %u after the late frame", s.windowSize, s.windowLost);
+
+    a = l.record(2, true, 2000, 12020);
+    CHECK(a == LINK_DUPLICATE, "second copy of 2: %s", name(a));
+    a = l.record(3, true, 3000, 12030);
+    CHECK(a == LINK_DUPLICATE, "second copy of 3: %s", name(a));
+    a = l.record(1, true, 1000, 12040);
+    CHECK(a == LINK_DUPLICATE, "second copy of 1: %s", name(a));
+
+    l.summary(s);
+    CHECK(s.reboots == 0 && s.duplicates == 3 && s.received == 3 && s.late == 1,
+          "reboots=%u duplicates=%u received=%u", s.reboots, s.duplicates, s.received);
+    CHECK(s.clockOffsetMs == 9005 && s.jitterMs == 0 && s.latencyMs == 0,
+          "offset %d jitter %u latency %u disturbed", s.clockOffsetMs, s.jitterMs, s.latencyMs);
+
+    // The stream carries on from 3
+    CHECK(l.record(4, true, 4000, 13005) == LINK_NEW, "seq 4");
+    l.summary(s);
+    CHECK(s.windowSize == 4 && s.windowLost == 0 && s.reboots == 0, "window after resuming");
+}
+
+static void loss() {
+    LinkStats l;
+    LinkSummary s;
+    for (uint16_t seq = 0; seq < 10; seq++) l.record(seq, false, 0, 0);
+    l.record(12, false, 0, 0);                     // 10 and 11 missing
+    CHECK(l.record(10, false, 0, 0) == LINK_LATE, "10 late");
+    l.summary(s);
+    CHECK(s.windowSize == 13 && s.windowLost == 1 && s.lost == 0, "gap: window %u lost %u", s.windowSize, s.windowLost);
+
+    LinkStats w;
+    for (uint32_t i = 65530; i < 65540; i++) CHECK(w.record((uint16_t)i, false, 0, 0) == LINK_NEW, "wrap at %u", i);
+    w.summary(s);
+    CHECK(s.windowLost == 0 && s.reboots == 0, "wrap counted as loss or reboot");
+    w.record((uint16_t)(65539 + 201), false, 0, 0);   // 200 frames lost
+    for (int i = 1; i <= 100; i++) w.record((uint16_t)(65540 + 200 + i), false, 0, 0);
+    w.summary(s);
+    CHECK(s.lost == 200 && s.windowLost == 0, "outage: %u lost", s.lost);
+}
+
+static void reboots() {
+    LinkStats l;
+    LinkSummary s;
+    for (uint16_t seq = 1000; seq < 1100; seq++) l.record(seq, true, seq * 1000u, seq * 1000u + 7);
+    CHECK(l.record(0, true, 50, 200000) == LINK_NEW, "seq back to 0 not new");
+    l.summary(s);
+    CHECK(s.reboots == 1 && s.windowSize == 1 && s.clockOffsetMs == 199950, "seq reset: reboots=%u window %u",
+          s.reboots, s.windowSize);
+
+    // Sequence carries on (persisted by the sender) but its clock restarted
+    LinkStats c;
+    c.record(5, true, 100000, 1000);
+    c.record(6, true, 101000, 2000);
+    CHECK(c.record(7, true, 300, 2100) == LINK_NEW, "clock reset frame not new");
+    c.summary(s);
+    CHECK(s.reboots == 1 && s.clockOffsetMs == 1800, "clock reset: reboots=%u offset %d", s.reboots, s.clockOffsetMs);
+}
+
+static void shuffled() {
+    uint32_t seed = 3;
+    auto rnd = [&seed](int n) {
+        seed = seed * 1103515245u + 12345u;
+        return (int)((seed >> 16) % n);
+    };
+
+    // 5000 frames from 65000 (so the stream wraps), each delayed by 0-4
+    // places, 5% of them delivered twice
+    struct Frame { uint16_t seq; uint32_t senderTime; };
+    std::vector<Frame> air;
+    for (uint32_t i = 0; i < 5000; i++) {
+        Frame f = {(uint16_t)(65000 + i), 500000 + i * 1000};
+        air.push_back(f);
+        if (rnd(20) == 0) air.push_back(f);
+    }
+    for (size_t i = 0; i + 1 < air.size(); i++) {
+        size_t j = i + rnd(5);
+        if (j < air.size()) std::swap(air[i], air[j]);
+    }
+
+    LinkStats l;
+    std::vector<int> firstCopies(5000);
+    int news = 0, lates = 0, duplicates = 0;
+    for (const Frame& f : air) {
+        LinkArrival a = l.record(f.seq, true, f.senderTime, f.senderTime + 20);
+        if (a == LINK_NEW) news++;
+        else if (a == LINK_LATE) lates++;
+        else duplicates++;
+        if (a != LINK_DUPLICATE) firstCopies[(uint16_t)(f.seq - 65000)]++;
+    }
+    LinkSummary s;
+    l.summary(s);
+    CHECK(s.reboots == 0, "%u reboots in a shuffled stream", s.reboots);
+    CHECK(std::count(firstCopies.begin(), firstCopies.end(), 1) == 5000, "a frame was accepted twice or never");
+    CHECK(duplicates == (int)(air.size() - 5000) && s.lost == 0 && s.windowLost == 0,
+          "%d duplicates for %zu repeats, lost %u", duplicates, air.size() - 5000, s.lost);
+    printf("shuffled: %zu frames on the air, %d new, %d late, %d duplicate, %u reboots\n",
+           air.size(), news, lates, duplicates, s.reboots);
+}
+
+int main() {
+    lateAndDuplicate();
+    loss();
+    reboots();
+    shuffled();
+    return hostTestResult("link_stats_test");
+}
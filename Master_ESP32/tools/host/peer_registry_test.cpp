@@ -0,0 +1,156 @@
+// Host test for the command target and section ownership in src/PeerRegistry.cpp
+//
+//   g++ -std=c++17 -Isrc -Iinclude -I../Shared -Itools/host tools/host/peer_registry_test.cpp
+//       src/PeerRegistry.cpp src/LinkStats.cpp -o peer_registry_test
+//
+// 1. The first framed relay stays the command target while it is live:
+//    a legacy-sized packet from a new MAC, or a second framed relay, does
+//    not take fridge commands away from it.
+// 2. Once the pinned relay goes stale, the next relay heard takes over, and
+//    a framed relay takes the pin back from a legacy one.
+// 3. With only old (legacy) relay firmware around, its first relay is used.
+// 4. A live fridge reporting directly beats any relay; an evicted relay
+//    stops being the target.
+// 5. A section is fresh only while its owner is live: the EcoFlow bridge's
+//    section goes stale with the bridge even though the relay that also
+//    reports it is still sending, a fridge reporting directly stays fresh
+//    after the relay goes quiet, and an evicted owner's sections are
+//    neither fresh nor seen.
+//
+// Sources: src/PeerRegistry.cpp src/LinkStats.cpp
+
+#include <stdio.h>
+#include "HostTest.h"
+#include "PeerRegistry.h"
+
+static const uint8_t RELAY[6] = {0x24, 0x6F, 0x28, 0x01, 0x02, 0x03};
+static const uint8_t STRAY[6] = {0xDE, 0xAD, 0xBE, 0xEF, 0x00, 0x01};
+static const uint8_t RELAY2[6] = {0x24, 0x6F, 0x28, 0x09, 0x09, 0x09};
+static const uint8_t FRIDGE_MAC[6] = {0x30, 0xAE, 0xA4, 0x11, 0x22, 0x33};
+
+static bool targetIs(PeerRegistry& r, const uint8_t* mac, unsigned long now) {
+    PeerInfo t;
+    return r.commandTarget(1, t, now) && memcmp(t.mac, mac, 6) == 0;
+}
+
+// A relay sending every second from `from` to `to`
+static void relayTraffic(PeerRegistry& r, const uint8_t* mac, bool framed, unsigned long from, unsigned long to) {
+    for (unsigned long t = from; t <= to; t += 1000) r.observe(mac, SRC_VICTRON, framed, -55, t);
+}
+
+static void pinnedWhileLive() {
+    PeerRegistry r;
+    relayTraffic(r, RELAY, true, 0, 10000);
+    CHECK(targetIs(r, RELAY, 10000), "first framed relay not the target");
+
+    // Newer packets from other MACs, interleaved with the relay's own
+    for (unsigned long t = 10500; t < 30000; t += 1000) {
+        r.observe(STRAY, SRC_VICTRON, false, -80, t);
+        CHECK(targetIs(r, RELAY, t), "legacy packet took the target at %lu ms", t);
+        r.observe(RELAY2, SRC_VICTRON, true, -60, t + 100);
+        CHECK(targetIs(r, RELAY, t + 100), "second framed relay took the target at %lu ms", t);
+        r.observe(RELAY, SRC_VICTRON, true, -55, t + 500);
+    }
+}
+
+static void takeoverAndReturn() {
+    PeerRegistry r;
+    relayTraffic(r, RELAY, true, 0, 10000);
+    // The relay goes quiet; a legacy sender keeps talking
+    relayTraffic(r, STRAY, false, 10500, 14500);
+    CHECK(targetIs(r, RELAY, 14500), "target moved before the relay went stale");
+    relayTraffic(r, STRAY, false, 15500, 20500);
+    CHECK(targetIs(r, STRAY, 20500), "stale relay still the target");
+
+    // The framed relay comes back and takes the pin from the legacy sender
+    r.observe(RELAY, SRC_VICTRON, true, -55, 21000);
+    CHECK(targetIs(r, RELAY, 21000), "framed relay did not take the pin back");
+    r.observe(STRAY, SRC_VICTRON, false, -80, 21500);
+    CHECK(targetIs(r, RELAY, 21500), "legacy packet took the pin again");
+}
+
+static void legacyOnly() {
+    PeerRegistry r;
+    relayTraffic(r, STRAY, false, 0, 5000);
+    CHECK(targetIs(r, STRAY, 5000), "legacy relay not used when it is the only one");
+    relayTraffic(r, RELAY2, false, 5500, 9500);
+    CHECK(targetIs(r, STRAY, 9500), "second legacy relay took the pin");
+    r.observe(RELAY, SRC_VICTRON, true, -55, 9800);
+    CHECK(targetIs(r, RELAY, 9800), "framed relay did not replace the legacy one");
+}
+
+static void fridgeAndEviction() {
+    PeerRegistry r;
+    relayTraffic(r, RELAY, true, 0, 3000);
+    r.observe(FRIDGE_MAC, SRC_FRIDGE, true, -60, 3000);
+    r.observe(FRIDGE_MAC, SRC_FRIDGE, true, -60, 4000);
+    CHECK(targetIs(r, FRIDGE_MAC, 4000), "live fridge not preferred");
+    relayTraffic(r, RELAY, true, 4000, 12000);
+    CHECK(targetIs(r, RELAY, 12000), "stale fridge still the target");
+
+    // Fill the table with live peers; the relay, stale by then, is evicted
+    for (uint8_t i = 0; i < PEER_MAX; i++) {
+        uint8_t mac[6] = {0x10, 0, 0, 0, 0, i};
+        r.observe(mac, SRC_ECOFLOW, true, -70, 100000 + i);
+    }
+    PeerInfo t;
+    CHECK(!r.commandTarget(1, t, 100010), "evicted relay still the target");
+}
+
+static uint32_t bit(uint8_t tag) { return 1u << espnowSectionIndex(tag); }
+
+static void sectionFreshness() {
+    PeerRegistry r;
+    const int bmv = espnowSectionIndex(TAG_BMV), eco = espnowSectionIndex(TAG_ECOFLOW);
+    const int fridge = espnowSectionIndex(TAG_FRIDGE);
+    int relay = -1, bridge = -1, direct = -1;
+    for (unsigned long t = 0; t <= 10000; t += 1000) {
+        relay = r.observe(RELAY, SRC_VICTRON, true, -55, t);
+        r.claimSection(bmv, relay, true, t);
+        r.claimSection(eco, relay, false, t);
+        if (t % 2000 == 0) {
+            bridge = r.observe(STRAY, SRC_ECOFLOW, true, -70, t);
+            r.claimSection(eco, bridge, true, t);
+        }
+    }
+    CHECK(r.sectionOwner(eco) == bridge, "relay's invalid copy took EcoFlow from the bridge");
+    CHECK(r.freshSections(10000) == (bit(TAG_BMV) | bit(TAG_ECOFLOW)), "sections not fresh while both peers are live");
+
+    // The bridge goes quiet; the relay's invalid copy doesn't keep it fresh
+    unsigned long newest = 0;
+    for (unsigned long t = 11000; t <= 20000; t += 1000) {
+        r.observe(RELAY, SRC_VICTRON, true, -55, t);
+        r.claimSection(bmv, relay, true, t);
+    }
+    CHECK(r.freshSections(20000, &newest) == bit(TAG_BMV), "EcoFlow still fresh after its bridge went quiet");
+    CHECK(newest == 20000, "newest owner seen at %lu, expected 20000", newest);
+    r.claimSection(eco, relay, false, 20000);
+    CHECK(r.sectionOwner(eco) == relay && (r.freshSections(20000) & bit(TAG_ECOFLOW)),
+          "live relay did not take EcoFlow from the stale bridge");
+
+    // A fridge reporting directly outlives the relay
+    for (unsigned long t = 20500; t <= 40500; t += 1000) {
+        direct = r.observe(FRIDGE_MAC, SRC_FRIDGE, true, -60, t);
+        r.claimSection(fridge, direct, true, t);
+    }
+    unsigned long seen = 0;
+    CHECK(r.freshSections(40500, &newest) == bit(TAG_FRIDGE), "only the fridge should be fresh");
+    CHECK(newest == 40500 && r.sectionSeen(fridge, seen) && seen == 40500, "fridge section not seen at 40500");
+    CHECK(r.sectionSeen(bmv, seen) && seen == 20000, "BMV owner seen at %lu, expected 20000", seen);
+
+    // Evicting the relay frees its sections
+    for (uint8_t i = 0; i < PEER_MAX; i++) {
+        uint8_t mac[6] = {0x10, 0, 0, 0, 0, i};
+        r.observe(mac, SRC_ECOFLOW, true, -70, 100000 + i);
+    }
+    CHECK(!r.sectionSeen(bmv, seen) && r.freshSections(100010) == 0, "evicted owner's sections still owned");
+}
+
+int main() {
+    pinnedWhileLive();
+    takeoverAndReturn();
+    legacyOnly();
+    fridgeAndEviction();
+    sectionFreshness();
+    return hostTestResult("peer_registry_test");
+}
@@ -0,0 +1,131 @@
+// Two-thread stress test for include/SpscRing.h and include/SeqLock.h,
+// built with the thread sanitizer by run_tests.sh
+//
+//   g++ -std=c++17 -O1 -g -fsanitize=thread -Iinclude -Itools/host
+//       tools/host/ring_stress_test.cpp -o ring_stress_test
+//   ./ring_stress_test
+//
+// 1. Lossless ring: the producer retries when the ring is full, so the
+//    consumer must see every item exactly once, in order, never torn.
+// 2. Lossy ring: the producer never waits (like the ESP-NOW callback), so
+//    every item is either popped, in order and whole, or counted as an
+//    overrun, and the two add up.
+// 3. SeqLock: one writer storing as fast as it can while a reader loads;
+//    every copy must come from a single store and versions never go back.
+//
+// Threads
+
+#include <atomic>
+#include <stdio.h>
+#include <thread>
+#include "HostTest.h"
+#include "SeqLock.h"
+#include "SpscRing.h"
+
+// Big enough that a torn copy is likely if the ordering is wrong
+struct Item {
+    uint32_t id;
+    uint32_t words[15];
+};
+
+static Item makeItem(uint32_t id) {
+    Item item;
+    item.id = id;
+    for (uint32_t& w : item.words) w = id * 2654435761u;
+    return item;
+}
+
+static bool whole(const Item& item) {
+    for (uint32_t w : item.words) {
+        if (w != item.id * 2654435761u) return false;
+    }
+    return true;
+}
+
+static const uint32_t COUNT = 200000;
+
+static void losslessRing() {
+    SpscRing<Item, 8> ring;
+    std::thread producer([&] {
+        for (uint32_t i = 1; i <= COUNT; i++) {
+            Item item = makeItem(i);
+            while (!ring.push(item)) std::this_thread::yield();
+        }
+    });
+    uint32_t expected = 1, torn = 0;
+    Item item;
+    while (expected <= COUNT) {
+        if (!ring.pop(item)) {
+            std::this_thread::yield();
+            continue;
+        }
+        if (!whole(item)) torn++;
+        CHECK(item.id == expected, "lossless: got %u, expected %u", item.id, expected);
+        expected = item.id + 1;
+    }
+    producer.join();
+    CHECK(torn == 0, "lossless: %u torn items", torn);
+    CHECK(ring.empty(), "lossless: %zu items left over", ring.size());
+    printf("lossless ring: %u items in order, %u full-ring retries counted as overruns\n",
+           COUNT, ring.overruns());
+}
+
+static void lossyRing() {
+    SpscRing<Item, 8> ring;
+    std::atomic<bool> done{false};
+    std::thread producer([&] {
+        for (uint32_t i = 1; i <= COUNT; i++) ring.push(makeItem(i));
+        done.store(true, std::memory_order_release);
+    });
+    uint32_t popped = 0, last = 0, torn = 0, backwards = 0;
+    Item item;
+    for (;;) {
+        if (ring.pop(item)) {
+            if (!whole(item)) torn++;
+            if (item.id <= last) backwards++;
+            last = item.id;
+            popped++;
+        } else if (done.load(std::memory_order_acquire) && ring.empty()) {
+            break;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+    CHECK(torn == 0, "lossy: %u torn items", torn);
+    CHECK(backwards == 0, "lossy: %u items out of order", backwards);
+    CHECK(popped + ring.overruns() == COUNT, "lossy: %u popped + %u overruns != %u",
+          popped, ring.overruns(), COUNT);
+    printf("lossy ring: %u popped + %u overruns = %u pushed\n", popped, ring.overruns(), COUNT);
+}
+
+static void seqLock() {
+    SeqLock<Item> lock;
+    std::atomic<bool> done{false};
+    std::thread writer([&] {
+        for (uint32_t i = 1; i <= COUNT; i++) lock.store(makeItem(i));
+        done.store(true, std::memory_order_release);
+    });
+    uint32_t loads = 0, torn = 0, backwards = 0, last = 0;
+    while (!done.load(std::memory_order_acquire)) {
+        Item item = lock.load();
+        if (item.id == 0) continue;     // Before the first store
+        if (!whole(item)) torn++;
+        if (item.id < last) backwards++;
+        last = item.id;
+        loads++;
+    }
+    writer.join();
+    CHECK(torn == 0, "seqlock: %u torn copies", torn);
+    CHECK(backwards == 0, "seqlock: went back %u times", backwards);
+    CHECK(lock.version() == COUNT, "seqlock: version %u", lock.version());
+    CHECK(lock.load().id == COUNT, "seqlock: final value %u", lock.load().id);
+    printf("seqlock: %u loads during %u stores, %u retries\n", loads, COUNT, lock.retries());
+}
+
+int main() {
+    losslessRing();
+    lossyRing();
+    seqLock();
+    return hostTestResult("ring_stress_test");
+}
@@ -0,0 +1,126 @@
+// Host test for include/TelemetryCodec.h
+//
+//   g++ -std=c++17 -Iinclude -Itools/host tools/host/telemetry_codec_test.cpp -o telemetry_codec_test
+//
+// 1. Edge rows round-trip exactly: int16 extremes, swings from one extreme
+//    to the other, missing readings, timestamps that jump and wrap.
+// 2. No row encodes to more than maxRowBytes().
+// 3. A row cut short at any byte decodes to 0 and leaves the decoder's state
+//    alone, so the complete row that follows still decodes.
+// 4. Random walks at the history scales round-trip, and steady rows cost
+//    one byte per value.
+
+#include <algorithm>
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+#include "HostTest.h"
+#include "TelemetryCodec.h"
+
+static const uint8_t SERIES = 6;
+
+struct Row {
+    uint32_t t;
+    int16_t v[SERIES];
+};
+
+// Encode all rows, then decode them back and compare
+static size_t roundTrip(const std::vector<Row>& rows, const char* name) {
+    TelemetryEncoder enc(SERIES);
+    std::vector<uint8_t> buf(rows.size() * enc.maxRowBytes());
+    size_t len = 0;
+    for (const Row& r : rows) {
+        size_t n = enc.encode(r.t, r.v, buf.data() + len);
+        CHECK(n <= enc.maxRowBytes(), "%s: %zu-byte row", name, n);
+        len += n;
+    }
+
+    TelemetryDecoder dec(SERIES);
+    size_t pos = 0;
+    for (size_t i = 0; i < rows.size(); i++) {
+        Row out;
+        size_t used = dec.decode(buf.data() + pos, len - pos, out.t, out.v);
+        CHECK(used > 0, "%s: row %zu did not decode", name, i);
+        if (used == 0) return len;
+        CHECK(out.t == rows[i].t, "%s: row %zu time %u, expected %u", name, i, out.t, rows[i].t);
+        CHECK(memcmp(out.v, rows[i].v, sizeof(out.v)) == 0, "%s: row %zu values differ", name, i);
+        pos += used;
+    }
+    CHECK(pos == len, "%s: %zu bytes left over", name, len - pos);
+    return len;
+}
+
+static void edgeRows() {
+    const int16_t M = TELEMETRY_MISSING;
+    std::vector<Row> rows = {
+        {0,           {32767, -32767, 0, M, 5, 1}},
+        {4000000000u, {-32767, 32767, M, 1, 5, 1}},
+        {4000000900u, {32767, -32767, 0, M, M, M}},
+        {4000000901u, {0, 0, 0, 0, 0, 0}},
+        {0xFFFFFFF0u, {1, 2, 3, 4, 5, 6}},
+        {5,           {M, M, M, M, M, M}},      // Wrapped past 2^32
+        {10,          {1, 2, 3, 4, 5, 6}},      // Values carry over the all-missing row
+    };
+    roundTrip(rows, "edge rows");
+}
+
+static void truncatedRows() {
+    TelemetryEncoder enc(SERIES);
+    uint8_t buf[64];
+    Row first = {1000, {1250, -300, 870, 45, 12, 0}};
+    Row second = {1010, {-32767, 32767, 870, TELEMETRY_MISSING, 13, 0}};
+    size_t a = enc.encode(first.t, first.v, buf);
+    size_t b = enc.encode(second.t, second.v, buf + a);
+
+    TelemetryDecoder dec(SERIES);
+    Row out;
+    CHECK(dec.decode(buf, a, out.t, out.v) == a, "first row");
+    for (size_t cut = 0; cut < b; cut++) {
+        CHECK(dec.decode(buf + a, cut, out.t, out.v) == 0, "second row cut at %zu decoded", cut);
+    }
+    CHECK(dec.decode(buf + a, b, out.t, out.v) == b, "second row after failed attempts");
+    CHECK(out.t == second.t && memcmp(out.v, second.v, sizeof(out.v)) == 0,
+          "second row corrupted by failed attempts");
+}
+
+static void randomWalks() {
+    uint32_t seed = 12345;
+    auto rnd = [&seed](int range) {
+        seed = seed * 1103515245u + 12345u;
+        return (int)((seed >> 16) % (2 * range + 1)) - range;
+    };
+
+    // Voltage 0.01 V, current 0.01 A, SOC 0.1 %, power 1 W, as HistoryStore scales them
+    std::vector<Row> rows;
+    int16_t v[SERIES] = {1280, -250, 870, 120, 30, 0};
+    const int step[SERIES] = {3, 40, 1, 25, 10, 300};
+    uint32_t t = 1700000000u;
+    for (int i = 0; i < 20000; i++) {
+        t += 10 + (rnd(20) == 0 ? rnd(30) : 0);      // Mostly steady, occasional jitter
+        Row r = {t, {}};
+        for (uint8_t s = 0; s < SERIES; s++) {
+            v[s] = (int16_t)std::max(-32767, std::min(32767, v[s] + rnd(step[s])));
+            r.v[s] = rnd(200) == 0 ? TELEMETRY_MISSING : v[s];
+        }
+        rows.push_back(r);
+    }
+    size_t len = roundTrip(rows, "random walk");
+    printf("random walk: %zu rows, %.2f B/row against %zu raw\n",
+           rows.size(), (double)len / rows.size(), 4 + 2 * (size_t)SERIES);
+
+    // Once the interval is established, an unchanged row is one byte per field
+    TelemetryEncoder enc(SERIES);
+    uint8_t buf[64];
+    const int16_t same[SERIES] = {1300, -120, 950, 60, 0, 0};
+    for (uint32_t i = 0; i < 100; i++) {
+        size_t n = enc.encode(600 * i, same, buf);
+        if (i >= 2) CHECK(n == 1 + SERIES, "steady row %u took %zu bytes", i, n);
+    }
+}
+
+int main() {
+    edgeRows();
+    truncatedRows();
+    randomWalks();
+    return hostTestResult("telemetry_codec_test");
+}
@@ -0,0 +1,126 @@
+// Host benchmark for include/JsonWriter.h
+//
+//   g++ -O2 -std=c++17 -Iinclude tools/json_bench.cpp -o json_bench && ./json_bench
+//
+// Serialises a shopping list the way handleInventoryShopping() used to
+// (String concatenation, emulated here with std::string and its
+// temporaries) and with JsonWriter into a fixed buffer that is flushed when
+// full, as ChunkedResponse does. Counts heap allocations for both.
+
+#include <chrono>
+#include <new>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+#include "JsonWriter.h"
+
+static size_t allocations = 0;
+
+void* operator new(size_t size) {
+    allocations++;
+    if (void* p = malloc(size)) return p;
+    throw std::bad_alloc();
+}
+void operator delete(void* p) noexcept { free(p); }
+void operator delete(void* p, size_t) noexcept { free(p); }
+
+struct Item {
+    int cat;
+    int item;
+    int id;
+    const char* name;
+    const char* category;
+    int status;
+    bool livesInTrailer;
+};
+
+// Stand-in for ChunkedResponse: 1 KB buffer, "sent" (summed) when full
+struct BufferSink {
+    char buffer[1024];
+    size_t used = 0;
+    size_t sent = 0;
+
+    void write(const uint8_t* data, size_t size) {
+        while (size) {
+            if (used == sizeof(buffer)) flush();
+            size_t n = size < sizeof(buffer) - used ? size : sizeof(buffer) - used;
+            memcpy(buffer + used, data, n);
+            used += n;
+            data += n;
+            size -= n;
+        }
+    }
+    void flush() {
+        sent += used;
+        used = 0;
+    }
+};
+
+static size_t concatShopping(const std::vector<Item>& items) {
+    std::string json = "{\"items\":[";
+    bool first = true;
+    for (const Item& it : items) {
+        if (!first) json += ",";
+        first = false;
+        json += "{\"cat\":" + std::to_string(it.cat);
+        json += ",\"item\":" + std::to_string(it.item);
+        json += ",\"id\":" + std::to_string(it.id);
+        json += ",\"name\":\"";
+        json += it.name;
+        json += "\"";
+        json += ",\"category\":\"";
+        json += it.category;
+        json += "\"";
+        json += ",\"status\":" + std::to_string(it.status);
+        json += ",\"livesInTrailer\":" + std::string(it.livesInTrailer ? "true" : "false") + "}";
+    }
+    json += "],\"count\":" + std::to_string(items.size()) + "}";
+    return json.size();
+}
+
+static size_t writerShopping(const std::vector<Item>& items) {
+    BufferSink sink;
+    JsonWriter<BufferSink> json(sink);
+    json.beginObject().key("items").beginArray();
+    for (const Item& it : items) {
+        json.beginObject()
+            .member("cat", it.cat)
+            .member("item", it.item)
+            .member("id", it.id)
+            .member("name", it.name)
+            .member("category", it.category)
+            .member("status", it.status)
+            .member("livesInTrailer", it.livesInTrailer)
+            .endObject();
+    }
+    json.endArray().member("count", (unsigned long)items.size()).endObject();
+    sink.flush();
+    return sink.sent;
+}
+
+template <typename F>
+static void run(const char* name, const std::vector<Item>& items, F fn) {
+    const int reps = 2000;
+    size_t bytes = fn(items);
+    size_t before = allocations;
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < reps; r++) bytes = fn(items);
+    double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    printf("%-8s %6zu %10.1f %12.1f %12.2f\n", name, bytes, ns / reps / 1000,
+           ns / reps / items.size(), (double)(allocations - before) / reps / items.size());
+}
+
+int main() {
+    static const char* names[] = {"Paper Towels", "Dish Soap", "Coffee \"Beans\"", "Milk", "Tin foil\\baking"};
+    static const char* categories[] = {"Kitchen", "Non-Perishables", "General"};
+    std::vector<Item> items;
+    for (int i = 0; i < 60; i++) {
+        items.push_back({i % 3, i / 3, 100 + i, names[i % 5], categories[i % 3], 1 + i % 2, i % 4 != 0});
+    }
+
+    printf("%-8s %6s %10s %12s %12s\n", "method", "bytes", "us/list", "ns/item", "allocs/item");
+    run("concat", items, concatShopping);
+    run("writer", items, writerShopping);
+    return 0;
+}
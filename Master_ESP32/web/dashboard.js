@@ -0,0 +1,111 @@
+if('serviceWorker' in navigator){
+navigator.serviceWorker.register('/sw.js').catch(e=>console.log('SW registration failed'));
+}
+function showAlert(type,message,duration=3000){
+let bar=document.getElementById('alertBar');
+if(!bar){bar=document.createElement('div');bar.id='alertBar';bar.className='alert-bar';document.body.appendChild(bar);}
+bar.className='alert-bar '+type;bar.innerHTML=message;
+document.body.classList.add('alert-active');
+setTimeout(()=>bar.classList.add('show'),100);
+if(type==='normal'){setTimeout(()=>{bar.classList.remove('show');
+setTimeout(()=>document.body.classList.remove('alert-active'),500);},duration);}
+bar.onclick=()=>{if(type!=='normal')window.location.href='/monitor';};
+}
+// Live data: poll /api/live and patch the cards in place
+function item(label,cls,val){return "<div class='item'><div class='label'>"+label+"</div><div class='value"+(cls?' '+cls:'')+"'>"+val+"</div></div>";}
+var OFFLINE="<div class='v'>--</div><div style='font-size:0.9em;color:#888'>Offline</div>";
+var STATES={0:"<span class='badge'>Off</span>",2:"<span class='badge on'>Storage</span>",3:"<span class='badge charging'>Bulk</span>",4:"<span class='badge charging'>Absorption</span>",5:"<span class='badge on'>Float</span>"};
+function setCard(id,level,body,state){
+var c=document.getElementById(id);if(!c)return;
+c.className='c '+level;
+var b=c.querySelector('.body');if(b.innerHTML!==body)b.innerHTML=body;
+var s=c.querySelector('.state');if(s&&s.innerHTML!==(state||''))s.innerHTML=state||'';
+}
+function bmvLevel(b){var t=b.ttg;
+if(b.soc<=10||(t>0&&t<=30))return 'emergency';
+if(b.soc<=20||(t>0&&t<=60))return 'critical';
+if(b.soc<=50||(t>0&&t<=120))return 'warn';
+return '';}
+function pctLevel(p){return p<=10?'emergency':p<=20?'critical':p<=50?'warn':'';}
+function tempStyle(diff,cold){
+if(diff>=10)return 'background:linear-gradient(135deg,#f22,#d00);color:#fff';
+if(diff>=5)return 'background:linear-gradient(135deg,#f80,#d60);color:#000';
+return cold;}
+function fridgeBlock(label,bg,actual,set,cold){
+return "<div style='flex:1;text-align:center;background:"+bg+";padding:8px;border-radius:8px'>"+
+"<div class='label' style='font-size:0.75em;margin-bottom:4px'>"+label+"</div>"+
+"<div class='temp-value' style='font-size:1.4em;font-weight:bold;margin:2px 0;padding:4px 8px;border-radius:6px;display:inline-block;"+tempStyle(Math.abs(actual-set),cold)+"'>"+actual+"°C</div>"+
+"<div class='temp-setpoint' style='font-size:0.75em;color:#aaa;margin-top:4px'>→ "+set+"°C</div></div>";}
+function renderLive(d){
+var b=d.bmv;
+if(b){var lv=bmvLevel(b);
+var ttg=(b.ttg>0&&b.ttg<1440)?Math.floor(b.ttg/60)+'h '+(b.ttg%60)+'m':'--';
+setCard('bmv',lv||'online',"<div class='content'><div class='v"+(lv?' '+lv:'')+"'>"+b.soc.toFixed(0)+"%</div><div class='grid'>"+
+item('Voltage','voltage',b.v.toFixed(2)+'V')+item('Current','current',b.a.toFixed(2)+'A')+item('Time remaining','',ttg)+item('Consumed','',b.ah.toFixed(1)+'Ah')+"</div></div>");}
+else setCard('bmv','offline',OFFLINE);
+var m=d.mppt;
+if(m)setCard('mppt','online',"<div class='content'><div class='v'>"+m.w+"W</div><div class='grid'>"+
+item('Voltage','voltage',m.v.toFixed(2)+'V')+item('Current','current',m.a.toFixed(2)+'A')+item('Yield today','power',m.kwh.toFixed(2)+'kWh')+"</div></div>",m.state==2?'':STATES[m.state]);
+else setCard('mppt','offline',OFFLINE);
+var p=d.ip22;
+if(p)setCard('ip22','online',"<div class='content'><div class='v'>"+p.w.toFixed(0)+"W</div><div class='grid'>"+
+item('Voltage','voltage',p.v.toFixed(2)+'V')+item('Current','current',p.a.toFixed(2)+'A')+(p.temp>0?item('Temp','temp',p.temp.toFixed(0)+'°C'):'')+"</div></div>",STATES[p.state]);
+else setCard('ip22','offline',OFFLINE);
+var e=d.ecoflow;
+if(e){var el=pctLevel(e.pct);
+setCard('ecoflow',el||'online',"<div class='content'><div class='v"+(el?' '+el:'')+"'>"+e.pct+"%</div><div class='grid'>"+
+item('RSSI','current',e.rssi+' dBm')+(e.serial?"<div class='item'><div class='label'>Serial</div><div class='value' style='font-size:0.8em'>"+e.serial+"</div></div>":'')+"</div></div>");}
+else setCard('ecoflow','offline',OFFLINE);
+var f=d.fridge;
+if(f){var diff=Math.max(Math.abs(f.leftActual-f.leftSet),Math.abs(f.rightActual-f.rightSet));
+var eco=f.eco;
+setCard('fridge',diff>=10?'critical':diff>=5?'warn':'online',"<div class='fridge-blocks' style='display:flex;gap:8px;justify-content:space-between'>"+
+fridgeBlock('LEFT','rgba(79,244,79,0.05)',f.leftActual,f.leftSet,'background:linear-gradient(135deg,#4af,#28d);color:#000')+
+fridgeBlock('RIGHT','rgba(68,170,255,0.05)',f.rightActual,f.rightSet,'background:linear-gradient(135deg,#0ff,#0dd);color:#000')+
+"<div style='flex:1;text-align:center;padding:8px;border-radius:8px;"+(eco?'background:linear-gradient(135deg,#282,#161)':'background:#f8f8f8')+"'>"+
+"<div class='icon-block' style='font-size:1.8em;margin-bottom:2px'>\u{1F343}</div>"+
+"<div class='icon-label' style='font-size:0.85em;font-weight:600;"+(eco?'color:#4f4':'color:#333')+"'>ECO</div>"+
+"<div class='icon-status' style='font-size:0.7em;"+(eco?'color:#4f4':'color:#666')+"'>"+(eco?'ON':'OFF')+"</div></div>"+
+"<div style='flex:1;text-align:center;background:#222;padding:8px;border-radius:8px'>"+
+"<div class='icon-block' style='font-size:1.8em;margin-bottom:2px'>\u{1F50B}</div>"+
+"<div class='icon-label' style='font-size:0.85em;font-weight:600;color:#4af'>BAT</div>"+
+"<div class='icon-status' style='font-size:0.7em;color:#aaa'>"+(f.bat==0?'L':f.bat==1?'M':'H')+"</div></div></div>");}
+else setCard('fridge','offline',OFFLINE);
+renderFooter();
+}
+// Age and uptime keep counting between updates
+function renderFooter(){
+if(live.pkts===undefined)return;
+var since=Math.floor((Date.now()-liveAt)/1000),age=live.age+since,up=live.up+since;
+var days=Math.floor(up/86400),hours=Math.floor((up%86400)/3600);
+document.getElementById('footer').innerText='Pkts: '+live.pkts+' | '+(age<60?age+'s':Math.floor(age/60)+'m')+' | Up: '+(days>0?days+'d ':'')+hours+'h';
+}
+// Merge a full snapshot or an /events delta into the current state
+var live={},liveAt=0;
+function applyLive(d){
+for(var k in d){
+if(d[k]&&typeof d[k]==='object')live[k]=Object.assign(live[k]||{},d[k]);
+else live[k]=d[k];
+}
+liveAt=Date.now();renderLive(live);
+}
+var liveBusy=false;
+function refreshLive(){
+if(liveBusy)return;liveBusy=true;
+fetch('/api/live',{cache:'no-store'}).then(r=>r.json()).then(applyLive).catch(e=>{}).finally(()=>{liveBusy=false;});
+}
+// Prefer the /events push stream; poll if it's unavailable or the server is full
+var pollTimer=null;
+function startPolling(){if(!pollTimer){refreshLive();pollTimer=setInterval(refreshLive,2000);}}
+function startLive(){
+if(!window.EventSource){startPolling();return;}
+var es=new EventSource('/events');
+es.onmessage=function(e){applyLive(JSON.parse(e.data));};
+es.onerror=function(){if(es.readyState===EventSource.CLOSED)startPolling();};
+}
+window.onload=function(){
+startLive();setInterval(renderFooter,1000);
+let isNavigation=!document.referrer||document.referrer.indexOf(window.location.origin)==-1||document.referrer.indexOf('/monitor')>-1||document.referrer.indexOf('/fridge')>-1||document.referrer.indexOf('/inventory')>-1;
+if(!isNavigation)return;
+if(alertType)showAlert(alertType,alertMessage);
+};
@@ -0,0 +1,58 @@
+function selectZone(zone){currentZone=zone;updateDisplay();}
+function updateTemp(val){if(currentZone=='left'){leftTemp=parseInt(val);}else{rightTemp=parseInt(val);}updateDisplay();}
+function adjustTemp(delta){var newTemp;if(currentZone=='left'){newTemp=Math.max(-20,Math.min(20,leftTemp+delta));leftTemp=newTemp;}else{newTemp=Math.max(-20,Math.min(20,rightTemp+delta));rightTemp=newTemp;}updateDisplay();}
+function updateDisplay(){document.getElementById('leftCard').className=currentZone=='left'?'zcard sel':'zcard unsel';
+document.getElementById('rightCard').className=currentZone=='right'?'zcard sel':'zcard unsel';
+var temp=currentZone=='left'?leftTemp:rightTemp;document.getElementById('slider').value=temp;document.getElementById('tempDisp').innerText=temp+'°C';}
+function setTemp(){var zone=currentZone=='left'?0:1;var temp=currentZone=='left'?leftTemp:rightTemp;
+showStatus('Setting temperature...');setTimeout(function(){window.location.href='/fridge/cmd?zone='+zone+'&temp='+temp;},100);}
+function toggleEco(){ecoState=ecoState=='1'?'0':'1';document.getElementById('ecoBtn').className='tbtn '+(ecoState=='1'?'on':'off');}
+function setEco(){showStatus('Setting ECO mode...');setTimeout(function(){window.location.href='/fridge/eco?state='+ecoState;},100);}
+function selectBat(level){batLevel=level;document.getElementById('batL').className='tbtn '+(level==0?'on':'off');
+document.getElementById('batM').className='tbtn '+(level==1?'on':'off');
+document.getElementById('batH').className='tbtn '+(level==2?'on':'off');}
+function setBat(){showStatus('Setting battery protection...');setTimeout(function(){window.location.href='/fridge/battery?level='+batLevel;},100);}
+function showStatus(msg,color){var s=document.getElementById('status');if(s){s.innerText=msg;s.style.backgroundColor=color||'#248';s.style.display='block';}}
+function refresh(){refreshLive();}
+// Live data: poll /api/live and update readings without reloading
+var liveBusy=false;
+function refreshLive(){
+if(liveBusy)return;liveBusy=true;
+fetch('/api/live',{cache:'no-store'}).then(r=>r.json()).then(d=>{
+var f=d.fridge;
+document.getElementById('leftNow').innerText='Left '+(f?f.leftActual:0)+'°C';
+document.getElementById('rightNow').innerText='Right '+(f?f.rightActual:0)+'°C';
+var info=document.getElementById('fridgeInfo');
+if(f){info.className='finfo';info.innerText='Last update: '+d.age+'s ago';}
+else{info.className='foff';info.innerText='⚠ Fridge offline';}
+}).catch(e=>{}).finally(()=>{liveBusy=false;});
+}
+window.addEventListener('load',function(){setInterval(refreshLive,2000);});
+var checkCount=0;
+var checkType='';
+var checkStart=Date.now();
+function checkUpdate(){
+checkCount++;
+if(checkCount>12){showStatus('Update timeout - please refresh manually','#f44');return;}
+fetch('/fridge/status').then(r=>r.json()).then(data=>{
+var updated=false;
+// A command for this setting that was rejected or never ACKed since the page loaded
+var lc=data.lastCommand,cmds={temp:[1,2],eco:[3],bat:[4]}[checkType];
+if(lc&&lc.result!='ok'&&cmds.indexOf(lc.cmd)>=0&&lc.ageMs<Date.now()-checkStart+1000){
+showStatus(lc.result=='timeout'?'Fridge did not respond - command lost after '+lc.attempts+' tries':'Fridge rejected the command (error '+lc.error+')','#f44');return;}
+if(checkType=='temp'){
+var currentTemp=currentZone=='left'?data.leftSet:data.rightSet;
+if(currentTemp==expectedTemp){updated=true;showStatus('Temperature updated!','#4a4');}
+}else if(checkType=='eco'){
+if((data.eco?'1':'0')==expectedEco){updated=true;showStatus('ECO mode updated!','#4a4');}
+}else if(checkType=='bat'){
+if(data.bat==expectedBat){updated=true;showStatus('Battery protection updated!','#4a4');}
+}
+if(updated){setTimeout(function(){history.replaceState(null,'','/fridge');refreshLive();},1500);}
+else{showStatus('Waiting for update... ('+checkCount+'/12)','#248');setTimeout(checkUpdate,2000);}
+}).catch(e=>{setTimeout(checkUpdate,2000);});
+}
+var params=new URLSearchParams(window.location.search);
+if(params.has('zone')){checkType='temp';expectedTemp=parseInt(params.get('temp'));showStatus('Setting temperature...');setTimeout(checkUpdate,3000);}
+else if(params.has('state')){checkType='eco';expectedEco=params.get('state');showStatus('Setting ECO mode...');setTimeout(checkUpdate,3000);}
+else if(params.has('level')){checkType='bat';expectedBat=parseInt(params.get('level'));showStatus('Setting battery protection...');setTimeout(checkUpdate,3000);}
@@ -0,0 +1,773 @@
+let editingCategory=-1;
+let editingIndex=-1;
+let editingIsConsumable=false;
+function itemId(cat,item){
+let row=null,container=document.getElementById('cat'+cat);
+if(container)row=container.querySelectorAll('.item')[item];
+if(!row)row=document.querySelector('.shop-item[data-cat="'+cat+'"][data-item="'+item+'"]');
+let id=row?row.getAttribute('data-id'):null;
+return id&&id!=='0'?parseInt(id):null;}
+function itemRef(cat,item){
+let id=itemId(cat,item);
+return id?'id='+id:'cat='+cat+'&item='+item;}
+const CHECK_OPS=['check','pack','take'];
+let pendingOps=[],batchTimer=null,batchDone=null,batchChain=Promise.resolve();
+function queueOp(op,done){
+pendingOps=pendingOps.filter(o=>o[0]!==op[0]||o[1]!==op[1]);
+pendingOps.push(op);
+if(done)batchDone=done;
+if(!batchTimer)batchTimer=setTimeout(flushOps,250);}
+function flushOps(){
+clearTimeout(batchTimer);batchTimer=null;
+let ops=pendingOps,done=batchDone;
+pendingOps=[];batchDone=null;
+if(ops.length==0)return batchChain;
+batchChain=batchChain.then(()=>fetch('/api/inventory/batch',{method:'POST',headers:{'Content-Type':'application/json'},body:JSON.stringify(ops)})).then(r=>{
+if(!r.ok)r.text().then(t=>alert('Update failed: '+t));
+if(done)done();}).catch(()=>alert('Update failed'));
+return batchChain;}
+window.addEventListener('pagehide',()=>{
+if(pendingOps.length)navigator.sendBeacon('/api/inventory/batch',JSON.stringify(pendingOps));});
+function closeEditModal(){
+let modal=document.getElementById('editModal');
+if(modal){modal.remove();return;}
+modal=document.querySelector('[style*="position:fixed"]');
+if(modal)modal.remove();}
+function closeAddModal(){
+let modal=document.getElementById('addModal');
+if(modal){modal.remove();return;}
+modal=document.querySelector('[style*="position:fixed"]');
+if(modal)modal.remove();}
+function deleteItemFromModal(){
+if(confirm('Delete this item? This cannot be undone.')){
+fetch('/inventory/remove?'+itemRef(editingCategory,editingIndex)).then(r=>{
+if(r.ok){closeEditModal();
+let currentTab=document.querySelector('.tab.active');
+let tabIndex=Array.from(currentTab.parentNode.children).indexOf(currentTab);
+setTimeout(()=>showTab(tabIndex),100);}else{alert('Delete failed');}});}}
+function saveItemEdit(){
+let name=document.getElementById('edit-name').value.trim();
+let newCategory=parseInt(document.getElementById('edit-category').value);
+if(!name){alert('Name cannot be empty');return;}
+if(editingIsConsumable){
+let trailer=document.getElementById('edit-trailer').value==='true';
+if(newCategory!==editingCategory){
+let editParams=itemRef(editingCategory,editingIndex)+'&name='+encodeURIComponent(name)+'&livesInTrailer='+(trailer?'true':'false');
+fetch('/inventory/edit-consumable?'+editParams).then(r=>{
+if(r.ok){let moveParams=itemRef(editingCategory,editingIndex)+'&target='+newCategory;return fetch('/inventory/move-item',{method:'POST',headers:{'Content-Type':'application/x-www-form-urlencoded'},body:moveParams});}else{throw new Error('Edit failed');}
+}).then(r=>{if(r.ok){closeEditModal();let currentTab=document.querySelector('.tab.active');let tabIndex=Array.from(currentTab.parentNode.children).indexOf(currentTab);setTimeout(()=>showTab(tabIndex),100);}else{alert('Error moving item to new category');}}).catch(e=>{alert('Error: '+e.message);});
+}else{
+let params=itemRef(editingCategory,editingIndex)+'&name='+encodeURIComponent(name)+'&livesInTrailer='+(trailer?'true':'false');
+fetch('/inventory/edit-consumable?'+params).then(r=>{if(r.ok){closeEditModal();let currentTab=document.querySelector('.tab.active');let tabIndex=Array.from(currentTab.parentNode.children).indexOf(currentTab);setTimeout(()=>showTab(tabIndex),100);}else{alert('Edit failed');}});
+}
+}else{
+if(newCategory!==editingCategory){
+let editParams=itemRef(editingCategory,editingIndex)+'&name='+encodeURIComponent(name);
+fetch('/inventory/rename?'+editParams).then(r=>{if(r.ok){let moveParams=itemRef(editingCategory,editingIndex)+'&target='+newCategory;return fetch('/inventory/move-item',{method:'POST',headers:{'Content-Type':'application/x-www-form-urlencoded'},body:moveParams});}else{throw new Error('Rename failed');}}).then(r=>{if(r.ok){closeEditModal();let currentTab=document.querySelector('.tab.active');let tabIndex=Array.from(currentTab.parentNode.children).indexOf(currentTab);setTimeout(()=>showTab(tabIndex),100);}else{alert('Error moving item to new category');}}).catch(e=>{alert('Error: '+e.message);});
+}else{
+let params=itemRef(editingCategory,editingIndex)+'&name='+encodeURIComponent(name);
+fetch('/inventory/rename?'+params).then(r=>{if(r.ok){closeEditModal();let currentTab=document.querySelector('.tab.active');let tabIndex=Array.from(currentTab.parentNode.children).indexOf(currentTab);setTimeout(()=>showTab(tabIndex),100);}else{alert('Rename failed');}});
+}
+}
+}
+function saveNewConsumable(){
+let name=document.getElementById('add-name').value.trim();
+let category=parseInt(document.getElementById('add-category').value);
+let trailer=document.getElementById('add-trailer').value;
+if(!name){alert('Name cannot be empty');return;}
+let params='cat='+category+'&name='+encodeURIComponent(name)+'&livesInTrailer='+trailer;
+fetch('/inventory/add?'+params).then(async r=>{
+if(r.ok){closeAddModal();
+let currentTab=document.querySelector('.tab.active');
+let tabIndex=Array.from(currentTab.parentNode.children).indexOf(currentTab);
+setTimeout(()=>showTab(tabIndex),100);}else{let t=await r.text();alert('Failed to add item: '+t);}});}
+function saveNewEquipment(){
+let name=document.getElementById('add-name').value.trim();
+let category=parseInt(document.getElementById('add-category').value);
+if(!name){alert('Name cannot be empty');return;}
+let params='cat='+category+'&name='+encodeURIComponent(name);
+fetch('/inventory/add?'+params).then(async r=>{
+if(r.ok){closeAddModal();
+let currentTab=document.querySelector('.tab.active');
+let tabIndex=Array.from(currentTab.parentNode.children).indexOf(currentTab);
+setTimeout(()=>showTab(tabIndex),100);}else{let t=await r.text();alert('Failed to add item: '+t);}});}
+function showAddConsumableModal(){
+let modal=document.createElement('div');
+modal.id='addModal';
+modal.style='position:fixed;top:0;left:0;width:100%;height:100%;background:rgba(0,0,0,0.8);display:flex;align-items:center;justify-content:center;z-index:1000';
+let modalContent=document.createElement('div');
+modalContent.style='background:#222;padding:20px;border-radius:10px;width:90%;max-width:400px;color:#fff';
+modalContent.innerHTML='<h3 style="margin:0 0 15px 0">Add Consumable Item</h3>';
+modalContent.innerHTML+='<div style="margin-bottom:15px"><label style="display:block;margin-bottom:5px">Item Name:</label>';
+modalContent.innerHTML+='<input type="text" id="add-name" style="width:100%;padding:8px;border:1px solid #444;background:#333;color:#fff;border-radius:4px" placeholder="Enter item name"></div>';
+modalContent.innerHTML+='<div style="margin-bottom:15px"><label style="display:block;margin-bottom:5px">Location:</label>';
+modalContent.innerHTML+='<select id="add-trailer" style="width:100%;padding:8px;border:1px solid #444;background:#333;color:#fff;border-radius:4px"><option value="false">🛒 Buy Each Trip</option><option value="true">🚚 Lives in Trailer</option></select></div>';
+modalContent.innerHTML+='<div style="margin-bottom:20px"><label style="display:block;margin-bottom:5px">Category:</label>';
+modalContent.innerHTML+='<select id="add-category" style="width:100%;padding:8px;border:1px solid #444;background:#333;color:#fff;border-radius:4px"></select></div>';
+modalContent.innerHTML+='<div style="display:flex;gap:10px;justify-content:flex-end">';
+modalContent.innerHTML+='<button onclick="closeAddModal()" style="padding:8px 16px;background:#666;border:none;border-radius:4px;color:#fff;cursor:pointer">Cancel</button>';
+modalContent.innerHTML+='<button onclick="saveNewConsumable()" style="padding:8px 16px;background:#22c55e;border:none;border-radius:4px;color:#000;cursor:pointer;font-weight:bold">Add Item</button>';
+modalContent.innerHTML+='</div>';
+modal.appendChild(modalContent);
+modal.onclick=(e)=>{if(e.target===modal)closeAddModal();};
+document.body.appendChild(modal);
+document.querySelectorAll('.cat-title').forEach((catEl,idx)=>{
+let catText=catEl.textContent.trim();
+let countEl=catEl.querySelector('.cat-count');
+if(countEl){catText=catText.replace(countEl.textContent,'').trim();}
+let option=document.createElement('option');
+let parent=catEl.closest('[data-category-index]')||catEl.closest('.c');
+let realIdx=(parent && parent.getAttribute('data-category-index')!==null)?parent.getAttribute('data-category-index'):idx;
+option.value=realIdx;
+option.textContent=catText;
+document.getElementById('add-category').appendChild(option);});
+document.getElementById('add-name').focus();}
+function showAddEquipmentModal(){
+let modal=document.createElement('div');
+modal.id='addModal';
+modal.style='position:fixed;top:0;left:0;width:100%;height:100%;background:rgba(0,0,0,0.8);display:flex;align-items:center;justify-content:center;z-index:1000';
+let modalContent=document.createElement('div');
+modalContent.style='background:#222;padding:20px;border-radius:10px;width:90%;max-width:400px;color:#fff';
+modalContent.innerHTML='<h3 style="margin:0 0 15px 0">Add Equipment Item</h3>';
+modalContent.innerHTML+='<div style="margin-bottom:15px"><label style="display:block;margin-bottom:5px">Item Name:</label>';
+modalContent.innerHTML+='<input type="text" id="add-name" style="width:100%;padding:8px;border:1px solid #444;background:#333;color:#fff;border-radius:4px" placeholder="Enter item name"></div>';
+modalContent.innerHTML+='<div style="margin-bottom:20px"><label style="display:block;margin-bottom:5px">Category:</label>';
+modalContent.innerHTML+='<select id="add-category" style="width:100%;padding:8px;border:1px solid #444;background:#333;color:#fff;border-radius:4px"></select></div>';
+modalContent.innerHTML+='<div style="display:flex;gap:10px;justify-content:flex-end">';
+modalContent.innerHTML+='<button onclick="closeAddModal()" style="padding:8px 16px;background:#666;border:none;border-radius:4px;color:#fff;cursor:pointer">Cancel</button>';
+modalContent.innerHTML+='<button onclick="saveNewEquipment()" style="padding:8px 16px;background:#22c55e;border:none;border-radius:4px;color:#000;cursor:pointer;font-weight:bold">Add Item</button>';
+modalContent.innerHTML+='</div>';
+modal.appendChild(modalContent);
+modal.onclick=(e)=>{if(e.target===modal)closeAddModal();};
+document.body.appendChild(modal);
+document.querySelectorAll('.cat-title').forEach((catEl,idx)=>{
+let catText=catEl.textContent.trim();
+let countEl=catEl.querySelector('.cat-count');
+if(countEl){catText=catText.replace(countEl.textContent,'').trim();}
+let option=document.createElement('option');
+let parent=catEl.closest('[data-category-index]')||catEl.closest('.c');
+let realIdx=(parent && parent.getAttribute('data-category-index')!==null)?parent.getAttribute('data-category-index'):idx;
+option.value=realIdx;
+option.textContent=catText;
+document.getElementById('add-category').appendChild(option);});
+document.getElementById('add-name').focus();}
+function showAddCategoryDialog(isConsumable){
+let modal=document.createElement('div');
+modal.id='addCategoryModal';
+modal.style='position:fixed;top:0;left:0;width:100%;height:100%;background:rgba(0,0,0,0.8);display:flex;align-items:center;justify-content:center;z-index:1000';
+let modalContent=document.createElement('div');
+modalContent.style='background:#222;padding:20px;border-radius:10px;width:90%;max-width:400px;color:#fff';
+let typeLabel=isConsumable?'Consumable':'Equipment';
+modalContent.innerHTML='<h3 style="margin:0 0 15px 0">Add '+typeLabel+' Category</h3>';
+modalContent.innerHTML+='<div style="margin-bottom:15px"><label style="display:block;margin-bottom:5px">Category Name:</label>';
+modalContent.innerHTML+='<input type="text" id="category-name" style="width:100%;padding:8px;border:1px solid #444;background:#333;color:#fff;border-radius:4px" placeholder="Enter category name"></div>';
+modalContent.innerHTML+='<div style="margin-bottom:15px"><label style="display:block;margin-bottom:5px">Icon:</label>';
+modalContent.innerHTML+='<input type="text" id="category-icon" style="width:100%;padding:8px;border:1px solid #444;background:#333;color:#fff;border-radius:4px" placeholder="📦" value="📦"></div>';
+if(!isConsumable){
+modalContent.innerHTML+='<div style="margin-bottom:20px"><label style="display:block;margin-bottom:5px">Trailer Category:</label>';
+modalContent.innerHTML+='<select id="category-subtype" style="width:100%;padding:8px;border:1px solid #444;background:#333;color:#fff;border-radius:4px">';
+modalContent.innerHTML+='<option value="trailer">🚚 TRAILER - Always packed items</option>';
+modalContent.innerHTML+='<option value="essentials">⭐ ESSENTIALS - Must pack every trip</option>';
+modalContent.innerHTML+='<option value="optional">🎒 OPTIONAL - Extra items</option>';
+modalContent.innerHTML+='</select></div>';}
+modalContent.innerHTML+='<div style="display:flex;gap:10px;justify-content:flex-end">';
+modalContent.innerHTML+='<button onclick="closeAddCategoryModal()" style="padding:8px 16px;background:#666;border:none;border-radius:4px;color:#fff;cursor:pointer">Cancel</button>';
+modalContent.innerHTML+='<button onclick="saveNewCategory('+isConsumable+')" style="padding:8px 16px;background:#22c55e;border:none;border-radius:4px;color:#000;cursor:pointer;font-weight:bold">Add Category</button>';
+modalContent.innerHTML+='</div>';
+modal.appendChild(modalContent);
+modal.onclick=(e)=>{if(e.target===modal)closeAddCategoryModal();};
+document.body.appendChild(modal);
+document.getElementById('category-name').focus();}
+function closeAddCategoryModal(){
+let modal=document.getElementById('addCategoryModal');
+if(modal)modal.remove();}
+function saveNewCategory(isConsumable){
+let name=document.getElementById('category-name').value.trim();
+let icon=document.getElementById('category-icon').value.trim();
+if(!name){alert('Category name cannot be empty');return;}
+if(!icon)icon='📦';
+if(name.length>50){alert('Category name too long (max 50 chars)');return;}
+if(icon.length>10){alert('Icon too long (max 10 chars)');return;}
+let type=isConsumable?'consumable':'equipment';
+let url='/inventory/add-category?name='+encodeURIComponent(name)+'&type='+type+'&icon='+encodeURIComponent(icon);
+if(!isConsumable){
+let subcategory=document.getElementById('category-subtype').value;
+url+='&subcategory='+subcategory;}
+fetch(url).then(r=>{if(r.ok){closeAddCategoryModal();alert('✅ Category "'+name+'" created!');let currentTab=document.querySelector('.tab.active');let tabIndex=Array.from(currentTab.parentNode.children).indexOf(currentTab);loadTabContent(tabIndex);}
+else{r.text().then(msg=>{closeAddCategoryModal();alert('❌ Error: '+msg);});}});}
+function showTab(n){
+document.querySelectorAll('.tab').forEach((t,i)=>t.classList.toggle('active',i==n));
+let mainTab=document.getElementById('tab0');
+let dynamicContent=document.getElementById('content');
+if(n==0){
+mainTab.style.display='block';
+dynamicContent.style.display='none';
+}else{
+mainTab.style.display='none';
+dynamicContent.style.display='block';
+dynamicContent.classList.add('no-transition');
+flushOps().then(()=>fetch('/inventory?tab='+n)).then(r=>r.text()).then(html=>{
+dynamicContent.innerHTML=html;
+setTimeout(()=>{dynamicContent.classList.remove('no-transition');},50);
+if(n==5)refreshShoppingList();});
+}}
+function loadTabContent(tab){showTab(tab);}
+function toggleCat(id){
+let el=document.getElementById('cat'+id);
+let hdr=el.previousElementSibling;
+let icon=hdr.querySelector('.expand-icon');
+if(el.classList.contains('expanded')){
+el.classList.remove('expanded');el.classList.add('collapsed');
+icon.innerHTML='\u25B6';}
+else{el.classList.remove('collapsed');el.classList.add('expanded');
+icon.innerHTML='\u25BC';}}
+function collapseAll(){
+document.querySelectorAll('.items-container').forEach(el=>{
+el.classList.remove('expanded');el.classList.add('collapsed');
+let hdr=el.previousElementSibling;
+let icon=hdr.querySelector('.expand-icon');
+if(icon)icon.innerHTML='\u25B6';});}
+function expandAll(){
+document.querySelectorAll('.items-container').forEach(el=>{
+el.classList.remove('collapsed');el.classList.add('expanded');
+let hdr=el.previousElementSibling;
+let icon=hdr.querySelector('.expand-icon');
+if(icon)icon.innerHTML='\u25BC';});}
+function setStatus(cat,item,status){
+queueOp(['status',itemId(cat,item),status],updateSummary);
+updateUI(cat,item,status);}
+function updateUI(cat,item,status){
+let container=document.getElementById('cat'+cat);
+let items=container.querySelectorAll('.item');
+items[item].setAttribute('data-status',status);
+let btns=items[item].querySelectorAll('.status-btn');
+btns.forEach((b,i)=>b.classList.toggle('active',i==status));
+updateFilteredTileCounts();applyAllFilters();}
+function updateConsumableTiles(){
+updateSummary();updateFilteredTileCounts();applyAllFilters();}
+function updateSummary(){
+fetch('/inventory/stats').then(r=>r.json()).then(d=>{
+document.querySelectorAll('.summary-card .value')[0].textContent=d.full;
+document.querySelectorAll('.summary-card .value')[1].textContent=d.low;
+document.querySelectorAll('.summary-card .value')[2].textContent=d.out;
+});}
+function setCheck(cat,item,type,val){
+queueOp([CHECK_OPS[type],itemId(cat,item),val?1:0]);}
+function toggleEquipmentStatus(cat,item,statusType,tab){
+let container=document.getElementById('cat'+cat);
+if(!container)return;
+let items=container.querySelectorAll('.item');
+if(!items[item])return;
+let btn=items[item].querySelector('.status-btn.'+statusType);
+if(!btn||btn.classList.contains('disabled'))return;
+let isActive=btn.classList.contains('active');
+let newVal=!isActive;
+btn.classList.toggle('active',newVal);
+if(statusType=='taking'){
+let checkedBtn=items[item].querySelector('.status-btn.checked');
+let packedBtn=items[item].querySelector('.status-btn.packed');
+if(newVal){
+checkedBtn.classList.remove('disabled');
+packedBtn.classList.remove('disabled');
+}else{
+checkedBtn.classList.add('disabled');
+checkedBtn.classList.remove('active');
+packedBtn.classList.add('disabled');
+packedBtn.classList.remove('active');
+setCheck(cat,item,0,false);
+setCheck(cat,item,1,false);
+}
+setCheck(cat,item,2,newVal);
+}else{
+setCheck(cat,item,statusType=='checked'?0:1,newVal);
+}
+updateEquipmentTiles(tab);
+}
+function updateEquipmentTiles(tabNum){
+batchDone=()=>showTab(tabNum);
+}
+function toggleTaking(cat,item,val){
+setCheck(cat,item,2,val);
+if(!val){setCheck(cat,item,0,false);setCheck(cat,item,1,false);}
+updateEquipmentTiles(4);}
+function clearAllEssentials(){
+if(!confirm('Clear all Taking, Checked, and Packed for Essentials?'))return;
+fetch('/inventory/clearall?type=essentials').then(r=>{
+if(r.ok){setTimeout(()=>showTab(3),100);}else{alert('Clear failed');}});}
+function clearAllOptional(){
+if(!confirm('Clear all Taking, Checked, and Packed for Optional items?'))return;
+fetch('/inventory/clearall?type=optional').then(r=>{
+if(r.ok){setTimeout(()=>showTab(4),100);}else{alert('Clear failed');}});}
+function clearAllTrailer(){
+if(!confirm('Clear all Checked and Packed for Trailer items?'))return;
+fetch('/inventory/clearall?type=trailer').then(r=>{
+if(r.ok){setTimeout(()=>showTab(2),100);}else{alert('Clear failed');}});}
+function clearAllConsumables(){
+let filteredCount=document.querySelectorAll('.inv-category .item:not([style*="display: none"])').length;
+let totalCount=document.querySelectorAll('.inv-category .item').length;
+let filterText=filteredCount===totalCount?'all consumables':'visible filtered items ('+filteredCount+' of '+totalCount+')';
+if(!confirm('Set '+filterText+' to OUT status for stocktaking?'))return;
+let visibleItems=[];
+document.querySelectorAll('.inv-category .item:not([style*="display: none"])').forEach(item=>{
+let catIndex=item.closest('.inv-category').getAttribute('data-category-index');
+let itemIndex=item.getAttribute('data-item-index');
+if(catIndex!==null&&itemIndex!==null)visibleItems.push({id:item.getAttribute('data-id'),cat:catIndex,item:itemIndex});});
+if(visibleItems.length===0){alert('No visible items to clear');return;}
+let payload=JSON.stringify({items:visibleItems});
+console.log('Sending clear payload:',payload);
+fetch('/inventory/clearall?type=consumables',{method:'POST',headers:{'Content-Type':'application/json'},body:payload}).then(r=>{
+console.log('Clear response:',r.status,r.ok);
+if(r.ok){let currentTab=document.querySelector('.tab.active');let tabIndex=Array.from(currentTab.parentNode.children).indexOf(currentTab);setTimeout(()=>showTab(tabIndex),100);}else{alert('Clear failed');}});}
+function saveInventory(){
+fetch('/inventory/save').then(r=>{if(r.ok){
+window.scrollTo({top:0,behavior:'smooth'});
+updateSummary();
+alert('✓ Saved!');}else{alert('Save failed');}});}
+function setCheckWithUpdate(cat,item,type,val,tabNum){
+queueOp([CHECK_OPS[type],itemId(cat,item),val?1:0],()=>{updateSummary();updateFilteredTileCounts();applyAllFilters();});}
+function showItemOptions(cat,item,name,isConsumable,currentTrailer){
+let action=prompt('Choose action for "'+name+'":\n\n1 - Edit Item\n2 - Delete\n3 - Move to different category\n\nEnter 1, 2, or 3:');
+if(action==='1'){
+editItem(cat,item,isConsumable,name,currentTrailer);
+}
+else if(action==='2'){
+if(confirm('Delete "'+name+'"?')){
+fetch('/inventory/delete?'+itemRef(cat,item)).then(r=>{
+if(r.ok){let currentTab=document.querySelector('.tab.active');let tabIndex=Array.from(currentTab.parentNode.children).indexOf(currentTab);setTimeout(()=>showTab(tabIndex),100);}else{alert('Delete failed');}});}}
+else if(action==='3'){
+let categories=[];
+document.querySelectorAll('.cat-title').forEach((el,idx)=>{
+categories.push(idx+' - '+el.textContent.trim());});
+let catList=categories.join('\n');
+let newCat=prompt('Select target category:\n\n'+catList+'\n\nEnter category number:');
+if(newCat&&newCat!==String(cat)){
+fetch('/inventory/move?'+itemRef(cat,item)+'&target='+newCat).then(r=>{
+if(r.ok){let currentTab=document.querySelector('.tab.active');let tabIndex=Array.from(currentTab.parentNode.children).indexOf(currentTab);setTimeout(()=>showTab(tabIndex),100);}else{alert('Move failed');}});}}
+}
+function showCategoryOptions(cat,name){
+let action=prompt('Choose action for category "'+name+'":\n\n1 - Rename Category\n2 - Delete Category\n\nEnter 1 or 2:');
+if(action==='1'){
+let newName=prompt('Enter new category name:',name);
+if(newName&&newName!==name){
+fetch('/inventory/renamecat?cat='+cat+'&name='+encodeURIComponent(newName)).then(r=>{
+if(r.ok){let currentTab=document.querySelector('.tab.active');let tabIndex=Array.from(currentTab.parentNode.children).indexOf(currentTab);setTimeout(()=>showTab(tabIndex),100);}else{alert('Rename failed');}});}}
+else if(action==='2'){
+if(confirm('Delete category "'+name+'" and ALL its items?\n\nThis cannot be undone!')){
+fetch('/inventory/deletecat?cat='+cat).then(r=>{
+if(r.ok){let currentTab=document.querySelector('.tab.active');let tabIndex=Array.from(currentTab.parentNode.children).indexOf(currentTab);setTimeout(()=>showTab(tabIndex),100);}else{alert('Delete failed');}});}}
+}
+function showAddItemDialog(subcategory){
+let name=prompt('Enter new item name:');
+if(!name)return;
+let categoryNum=prompt('Enter category number (0-' + (document.querySelectorAll('.c').length-1) + '):');
+if(categoryNum===null)return;
+let livesInTrailer='';
+if(subcategory==0){
+livesInTrailer=confirm('Does this item live in the trailer?\n\nYES = Stays in trailer (🚚)\nNO = Buy each trip (🛒)')?'true':'false';
+}
+fetch('/inventory/additem?cat=' + categoryNum + '&name=' + encodeURIComponent(name) + '&subcategory=' + subcategory + '&livesInTrailer=' + livesInTrailer).then(async r=>{if(r.ok){let currentTab=document.querySelector('.tab.active');let tabIndex=Array.from(currentTab.parentNode.children).indexOf(currentTab);loadTabContent(tabIndex);}else{let t=await r.text();alert('Add failed: '+t);}});}
+let activeFilter=-1;
+let activeEquipmentFilter=-1;
+let activeTrailerFilter=-1;
+function filterStatus(status){
+if(activeFilter==status){activeFilter=-1;status=-1;}else{activeFilter=status;}
+document.querySelectorAll('.inv-category .item').forEach(item=>{
+let itemStatus=parseInt(item.getAttribute('data-status'));
+item.style.display=(status==-1||itemStatus==status)?'flex':'none';});
+updateFilteredTileCounts();}
+function filterTrailer(trailerStatus){
+if(activeTrailerFilter==trailerStatus){activeTrailerFilter=-1;trailerStatus=-1;}else{activeTrailerFilter=trailerStatus;}
+document.querySelectorAll('.inv-category .item').forEach(item=>{
+let itemTrailer=parseInt(item.getAttribute('data-trailer'));
+let shouldShow=true;
+if(trailerStatus==-1)shouldShow=true;
+else if(trailerStatus==1)shouldShow=(itemTrailer==1);
+else if(trailerStatus==0)shouldShow=(itemTrailer==0);
+item.style.display=shouldShow?'flex':'none';});
+updateFilteredTileCounts();}
+function updateFilteredTileCounts(){
+let okCount=0,lowCount=0,outCount=0;
+document.querySelectorAll('.inv-category .item').forEach(item=>{
+if(item.style.display!=='none'){
+let status=parseInt(item.getAttribute('data-status'));
+if(status<=0)okCount++;
+else if(status==1)lowCount++;
+else if(status==2)outCount++;}});
+let cards=document.querySelectorAll('.summary-card .value');
+if(cards[0])cards[0].textContent=okCount;
+if(cards[1])cards[1].textContent=lowCount;
+if(cards[2])cards[2].textContent=outCount;}
+let currentLocationFilter='all';
+let currentStatusFilter='all';
+function applyLocationFilter(filter){
+currentLocationFilter=filter;
+document.querySelectorAll('#loc-all,#loc-trailer,#loc-trip').forEach(btn=>btn.classList.remove('active'));
+document.getElementById('loc-'+filter).classList.add('active');
+applyAllFilters();}
+function applyStatusFilter(filter){
+currentStatusFilter=filter;
+document.querySelectorAll('#status-all,#status-ok,#status-low,#status-out').forEach(btn=>btn.classList.remove('active'));
+document.getElementById('status-'+filter).classList.add('active');
+applyAllFilters();}
+function applyAllFilters(){
+document.querySelectorAll('.inv-category .item').forEach(item=>{
+let shouldShow=true;
+if(currentLocationFilter!=='all'){
+let itemTrailer=parseInt(item.getAttribute('data-trailer'));
+if(currentLocationFilter==='trailer'&&itemTrailer!==1)shouldShow=false;
+if(currentLocationFilter==='trip'&&itemTrailer!==0)shouldShow=false;}
+if(currentStatusFilter!=='all'&&shouldShow){
+let itemStatus=parseInt(item.getAttribute('data-status'));
+if(currentStatusFilter==='ok'&&itemStatus>0)shouldShow=false;
+if(currentStatusFilter==='low'&&itemStatus!==1)shouldShow=false;
+if(currentStatusFilter==='out'&&itemStatus!==2)shouldShow=false;}
+item.style.display=shouldShow?'flex':'none';});
+updateFilteredTileCounts();}
+function clearAllFilters(){
+currentLocationFilter='all';
+currentStatusFilter='all';
+document.querySelectorAll('.filter-btn').forEach(btn=>btn.classList.remove('active'));
+document.getElementById('loc-all').classList.add('active');
+document.getElementById('status-all').classList.add('active');
+applyAllFilters();}
+function filterEquipment(type,showCompleted){
+if(activeEquipmentFilter==type){activeEquipmentFilter=-1;type=-1;}else{activeEquipmentFilter=type;}
+document.querySelectorAll('.items-container').forEach(container=>{
+container.querySelectorAll('.item').forEach(item=>{
+let shouldShow=true;
+if(type==-1){shouldShow=true;}
+else if(type==0){
+let checkedBtn=item.querySelector('.status-btn.checked');
+let takingBtn=item.querySelector('.status-btn.taking');
+if(takingBtn){shouldShow=takingBtn.classList.contains('active')&&!checkedBtn.classList.contains('active');}
+else{shouldShow=!checkedBtn.classList.contains('active');}}
+else if(type==1){
+let packedBtn=item.querySelector('.status-btn.packed');
+let takingBtn=item.querySelector('.status-btn.taking');
+if(takingBtn){shouldShow=takingBtn.classList.contains('active')&&!packedBtn.classList.contains('active');}
+else{shouldShow=!packedBtn.classList.contains('active');}}
+else if(type==2){
+let takingBtn=item.querySelector('.status-btn.taking');
+shouldShow=takingBtn?takingBtn.classList.contains('active'):false;}
+item.style.display=shouldShow?'flex':'none';});});}
+function resetAll(){
+let filteredCount=document.querySelectorAll('.inv-category .item:not([style*="display: none"])').length;
+let totalCount=document.querySelectorAll('.inv-category .item').length;
+let filterText=filteredCount===totalCount?'ALL consumable items':'visible filtered items ('+filteredCount+' of '+totalCount+')';
+if(!confirm('Reset '+filterText+' to Full? This cannot be undone.'))return;
+let visibleItems=[];
+document.querySelectorAll('.inv-category .item:not([style*="display: none"])').forEach(item=>{
+let catIndex=item.closest('.inv-category').getAttribute('data-category-index');
+let itemIndex=item.getAttribute('data-item-index');
+if(catIndex!==null&&itemIndex!==null)visibleItems.push({id:item.getAttribute('data-id'),cat:catIndex,item:itemIndex});});
+if(visibleItems.length===0){alert('No visible items to reset');return;}
+let payload=JSON.stringify({items:visibleItems});
+console.log('Sending reset payload:',payload);
+fetch('/inventory/resetall',{method:'POST',headers:{'Content-Type':'application/json'},body:payload}).then(r=>{
+console.log('Reset response:',r.status,r.ok);
+if(r.ok){let currentTab=document.querySelector('.tab.active');let tabIndex=Array.from(currentTab.parentNode.children).indexOf(currentTab);setTimeout(()=>showTab(tabIndex),100);}else{alert('Reset failed');}});}
+let shoppingLocationFilter='all';
+let shoppingStatusFilter='all';
+function applyShoppingLocationFilter(filter){
+shoppingLocationFilter=filter;
+document.querySelectorAll('[id^="shop-loc-"]').forEach(btn=>btn.classList.remove('active'));
+document.getElementById('shop-loc-'+filter).classList.add('active');
+applyAllShoppingFilters();}
+function applyShoppingStatusFilter(filter){
+shoppingStatusFilter=filter;
+document.querySelectorAll('[id^="shop-status-"]').forEach(btn=>btn.classList.remove('active'));
+document.getElementById('shop-status-'+filter).classList.add('active');
+applyAllShoppingFilters();}
+function applyAllShoppingFilters(){
+document.querySelectorAll('.shop-item').forEach(item=>{
+let trailerAttr=item.getAttribute('data-trailer');
+let statusAttr=item.getAttribute('data-status');
+console.log('Item status attr:',statusAttr,'trailer:',trailerAttr);
+let locationMatch=shoppingLocationFilter=='all'||(shoppingLocationFilter=='trailer'&&trailerAttr=='true')||(shoppingLocationFilter=='trip'&&trailerAttr=='false');
+let statusMatch=shoppingStatusFilter=='all'||(shoppingStatusFilter=='low'&&statusAttr=='1')||(shoppingStatusFilter=='out'&&statusAttr=='2');
+item.style.display=(locationMatch&&statusMatch)?'flex':'none';});
+updateShoppingTileCounts();}
+function updateShoppingTileCounts(){
+let visibleLow=0,visibleOut=0;
+document.querySelectorAll('.shop-item').forEach(item=>{
+if(item.style.display=='none')return;
+let status=parseInt(item.getAttribute('data-status'));
+if(status==1)visibleLow++;
+else if(status==2)visibleOut++;});
+let countEl=document.getElementById('shop-count');
+if(countEl){
+let html='';
+if(visibleOut>0){html+='<span style="color:#ef4444">'+visibleOut+' OUT</span>';}
+if(visibleLow>0){if(html)html+=' + ';html+='<span style="color:#f59e0b">'+visibleLow+' LOW</span>';}
+if(visibleOut==0&&visibleLow==0)html='0 items';
+countEl.innerHTML=html;}}
+function filterShoppingTrailer(mode){
+document.querySelectorAll('.shop-item').forEach(item=>{
+let trailerAttr=item.getAttribute('data-trailer');
+let shouldShow=mode=='all'||(mode=='trailer'&&trailerAttr=='true')||(mode=='trip'&&trailerAttr=='false');
+item.style.display=shouldShow?'flex':'none';});
+document.querySelectorAll('[id^="shopping-filter-"]').forEach(btn=>btn.style.background='rgba(255,255,255,0.1)');
+document.getElementById('shopping-filter-'+mode).style.background='rgba(255,255,255,0.3)';
+updateShoppingTileCounts();}
+function selectItems(mode){
+let checkboxes=document.querySelectorAll('.shop-check');
+let visibleCount=0,selectedCount=0;
+checkboxes.forEach(cb=>{
+let item=cb.closest('.shop-item');
+if(!item)return;
+if(item.style.display=='none'){cb.checked=false;return;}
+visibleCount++;
+let status=parseInt(item.getAttribute('data-status'));
+let trailerAttr=item.getAttribute('data-trailer')||'false';
+let isTrailer=(trailerAttr=='true');
+console.log('SelectItems mode:'+mode+', status:'+status+', checking: low='+(status==1)+', out='+(status==2));
+let shouldSelect=false;
+if(mode=='all'){shouldSelect=true;}
+else if(mode=='none'){shouldSelect=false;}
+else if(mode=='out'){shouldSelect=(status==2);}
+else if(mode=='low'){shouldSelect=(status==1);}
+else if(mode=='trailer'){shouldSelect=isTrailer;}
+else if(mode=='trip'){shouldSelect=!isTrailer;}
+cb.checked=shouldSelect;
+if(shouldSelect)selectedCount++;});}
+function markRestocked(){
+let selected=[];
+document.querySelectorAll('.shop-check:checked').forEach(cb=>{
+let item=cb.closest('.shop-item');
+selected.push({id:item.getAttribute('data-id'),cat:item.getAttribute('data-cat'),item:item.getAttribute('data-item')});});
+if(selected.length==0){alert('Please select items to restock');return;}
+if(!confirm('Mark '+selected.length+' selected item(s) as Full?'))return;
+fetch('/inventory/restock',{method:'POST',headers:{'Content-Type':'application/json'},body:JSON.stringify(selected)}).then(r=>{if(r.ok){let msg=document.createElement('div');msg.textContent='✅ '+selected.length+' item(s) restocked!';msg.style.cssText='position:fixed;top:20px;right:20px;background:#22c55e;color:white;padding:10px 15px;border-radius:5px;z-index:9999;font-weight:bold';document.body.appendChild(msg);setTimeout(()=>msg.remove(),3000);refreshShoppingList();}else{alert('Restock failed');}});}
+function copyList(){
+let items=[];
+document.querySelectorAll('.shop-item').forEach(el=>{
+let nameEl=el.querySelector('div>div');
+if(nameEl)items.push('• '+nameEl.textContent);});
+if(items.length==0){alert('No items to copy');return;}
+let txt=items.join('\n');
+if(navigator.clipboard&&navigator.clipboard.writeText){
+navigator.clipboard.writeText(txt).then(()=>{alert('✓ Copied to clipboard!');},()=>{
+prompt('Copy this list:',txt);});}else{prompt('Copy this list:',txt);}}
+function downloadList(){
+window.location.href='/inventory/download';}
+function copyFilteredList(){
+let items=[];
+document.querySelectorAll('.shop-item').forEach(el=>{
+if(el.style.display=='none')return;
+let nameEl=el.querySelector('div>div');
+if(nameEl)items.push('• '+nameEl.textContent);});
+if(items.length==0){alert('No visible items to copy');return;}
+let txt=items.join('\n');
+if(navigator.clipboard&&navigator.clipboard.writeText){
+navigator.clipboard.writeText(txt).then(()=>{alert('✓ Copied '+items.length+' filtered items to clipboard!');},()=>{
+prompt('Copy this filtered list:',txt);});}else{prompt('Copy this filtered list:',txt);}}
+function markAllFilteredRestocked(){
+let visibleItems=[];
+document.querySelectorAll('.shop-item').forEach(item=>{
+if(item.style.display=='none')return;
+visibleItems.push({id:item.getAttribute('data-id'),cat:item.getAttribute('data-cat'),item:item.getAttribute('data-item')});});
+if(visibleItems.length==0){alert('No visible items to restock');return;}
+let filterText=shoppingLocationFilter=='all'?'':' ('+shoppingLocationFilter+' items)';
+filterText+=shoppingStatusFilter=='all'?'':' ('+shoppingStatusFilter+' status)';
+if(!confirm('Mark ALL '+visibleItems.length+' visible item(s)'+filterText+' as Full?'))return;
+fetch('/inventory/restock',{method:'POST',headers:{'Content-Type':'application/json'},body:JSON.stringify(visibleItems)}).then(r=>{if(r.ok){let msg=document.createElement('div');msg.textContent='✅ '+visibleItems.length+' filtered item(s) restocked!';msg.style.cssText='position:fixed;top:20px;right:20px;background:#22c55e;color:white;padding:10px 15px;border-radius:5px;z-index:9999;font-weight:bold';document.body.appendChild(msg);setTimeout(()=>msg.remove(),3000);refreshShoppingList();}else{alert('Bulk restock failed');}});}
+function addItem(cat){
+let name=prompt('Enter item name:');
+if(!name||name.trim()=='')return;
+fetch('/inventory/add?cat='+cat+'&name='+encodeURIComponent(name)).then(r=>{
+if(r.ok){let currentTab=document.querySelector('.tab.active');
+let tabIndex=Array.from(currentTab.parentNode.children).indexOf(currentTab);
+setTimeout(()=>showTab(tabIndex),100);}else{alert('Failed to add item');}});}
+function editItem(cat,item,isConsumable,currentName,currentTrailer){
+editingCategory=cat;
+editingIndex=item;
+editingIsConsumable=isConsumable;
+if(isConsumable){
+editingCategory=cat;
+editingIndex=item;
+let modal=document.createElement('div');
+modal.id='editModal';
+modal.style='position:fixed;top:0;left:0;width:100%;height:100%;background:rgba(0,0,0,0.8);display:flex;align-items:center;justify-content:center;z-index:1000';
+let modalContent=document.createElement('div');
+modalContent.style='background:#222;padding:20px;border-radius:10px;width:90%;max-width:400px;color:#fff';
+modalContent.innerHTML='<h3 style="margin:0 0 15px 0">Edit Item</h3>';
+modalContent.innerHTML+='<div style="margin-bottom:15px"><label style="display:block;margin-bottom:5px">Item Name:</label>';
+modalContent.innerHTML+='<input type="text" id="edit-name" style="width:100%;padding:8px;border:1px solid #444;background:#333;color:#fff;border-radius:4px"></div>';
+modalContent.innerHTML+='<div style="margin-bottom:20px"><label style="display:block;margin-bottom:5px">Location:</label>';
+modalContent.innerHTML+='<select id="edit-trailer" style="width:100%;padding:8px;border:1px solid #444;background:#333;color:#fff;border-radius:4px"></select></div>';
+modalContent.innerHTML+='<div style="margin-bottom:20px"><label style="display:block;margin-bottom:5px">Category:</label>';
+modalContent.innerHTML+='<select id="edit-category" style="width:100%;padding:8px;border:1px solid #444;background:#333;color:#fff;border-radius:4px"></select></div>';
+modalContent.innerHTML+='<div style="display:flex;gap:10px;justify-content:flex-end">';
+modalContent.innerHTML+='<button onclick="closeEditModal()" style="padding:8px 16px;background:#666;border:none;border-radius:4px;color:#fff;cursor:pointer">Cancel</button>';
+modalContent.innerHTML+='<button onclick="deleteItemFromModal()" style="padding:8px 16px;background:#ef4444;border:none;border-radius:4px;color:#fff;cursor:pointer">Delete Item</button>';
+modalContent.innerHTML+='<button onclick="saveItemEdit()" style="padding:8px 16px;background:#4af;border:none;border-radius:4px;color:#000;cursor:pointer;font-weight:bold">Save Changes</button>';
+modalContent.innerHTML+='</div>';
+modal.appendChild(modalContent);
+modal.onclick=(e)=>{if(e.target===modal)closeEditModal();};
+document.body.appendChild(modal);
+let trailerSelect=document.getElementById('edit-trailer');
+trailerSelect.innerHTML='<option value="true">🚚 Lives in Trailer</option><option value="false">🛒 Buy Each Trip</option>';
+trailerSelect.value=currentTrailer?'true':'false';
+let categorySelect=document.getElementById('edit-category');
+categorySelect.innerHTML='';
+document.querySelectorAll('.cat-title').forEach((catEl,idx)=>{
+let catText=catEl.textContent.trim();
+let countEl=catEl.querySelector('.cat-count');
+if(countEl){catText=catText.replace(countEl.textContent,'').trim();}
+let option=document.createElement('option');
+let parent=catEl.closest('[data-category-index]')||catEl.closest('.c');
+let realIdx=(parent && parent.getAttribute('data-category-index')!==null)?parent.getAttribute('data-category-index'):idx;
+option.value=realIdx;
+option.textContent=catText;
+if(String(realIdx)==String(editingCategory))option.selected=true;
+categorySelect.appendChild(option);});
+document.getElementById('edit-name').value=currentName;
+document.getElementById('edit-name').focus();
+}else{
+editingCategory=cat;editingIndex=item;editingIsConsumable=false;
+let modal=document.createElement('div');
+modal.id='editModal';
+modal.style='position:fixed;top:0;left:0;width:100%;height:100%;background:rgba(0,0,0,0.8);display:flex;align-items:center;justify-content:center;z-index:1000';
+let modalContent=document.createElement('div');
+modalContent.style='background:#222;padding:20px;border-radius:10px;width:90%;max-width:400px;color:#fff';
+modalContent.innerHTML='<h3 style="margin:0 0 15px 0">Edit Item</h3>';
+modalContent.innerHTML+='<div style="margin-bottom:15px"><label style="display:block;margin-bottom:5px">Item Name:</label>';
+modalContent.innerHTML+='<input type="text" id="edit-name" style="width:100%;padding:8px;border:1px solid #444;background:#333;color:#fff;border-radius:4px">';
+modalContent.innerHTML+='</div>';
+modalContent.innerHTML+='<div style="margin-bottom:20px"><label style="display:block;margin-bottom:5px">Category:</label>';
+modalContent.innerHTML+='<select id="edit-category" style="width:100%;padding:8px;border:1px solid #444;background:#333;color:#fff;border-radius:4px"></select></div>';
+modalContent.innerHTML+='<div style="display:flex;gap:10px;justify-content:flex-end">';
+modalContent.innerHTML+='<button onclick="closeEditModal()" style="padding:8px 16px;background:#666;border:none;border-radius:4px;color:#fff;cursor:pointer">Cancel</button>';
+modalContent.innerHTML+='<button onclick="deleteItemFromModal()" style="padding:8px 16px;background:#ef4444;border:none;border-radius:4px;color:#fff;cursor:pointer">Delete Item</button>';
+modalContent.innerHTML+='<button onclick="saveItemEdit()" style="padding:8px 16px;background:#4af;border:none;border-radius:4px;color:#000;cursor:pointer;font-weight:bold">Save Changes</button>';
+modalContent.innerHTML+='</div>';
+modal.appendChild(modalContent);
+modal.onclick=(e)=>{if(e.target===modal)closeEditModal();};
+document.body.appendChild(modal);
+let categorySelect=document.getElementById('edit-category');
+categorySelect.innerHTML='';
+document.querySelectorAll('.cat-title').forEach((catEl,idx)=>{
+let catText=catEl.textContent.trim();
+let countEl=catEl.querySelector('.cat-count');
+if(countEl){catText=catText.replace(countEl.textContent,'').trim();}
+let option=document.createElement('option');
+let parent=catEl.closest('[data-category-index]')||catEl.closest('.c');
+let realIdx=(parent && parent.getAttribute('data-category-index')!==null)?parent.getAttribute('data-category-index'):idx;
+option.value=realIdx;
+option.textContent=catText;
+if(String(realIdx)==String(editingCategory))option.selected=true;
+categorySelect.appendChild(option);});
+document.getElementById('edit-name').value=currentName;
+document.getElementById('edit-name').focus();
+}
+function saveNewConsumable(){
+let name=document.getElementById('add-name').value.trim();
+let category=parseInt(document.getElementById('add-category').value);
+let trailer=document.getElementById('add-trailer').value;
+if(!name){alert('Name cannot be empty');return;}
+let params='cat='+category+'&name='+encodeURIComponent(name)+'&livesInTrailer='+trailer;
+fetch('/inventory/add?'+params).then(async r=>{
+if(r.ok){closeAddModal();
+let currentTab=document.querySelector('.tab.active');
+let tabIndex=Array.from(currentTab.parentNode.children).indexOf(currentTab);
+setTimeout(()=>showTab(tabIndex),100);}else{let t=await r.text();alert('Failed to add item: '+t);}});}
+function saveNewEquipment(){
+let name=document.getElementById('add-name').value.trim();
+let category=parseInt(document.getElementById('add-category').value);
+if(!name){alert('Name cannot be empty');return;}
+let params='cat='+category+'&name='+encodeURIComponent(name);
+fetch('/inventory/add?'+params).then(async r=>{
+if(r.ok){closeAddModal();
+let currentTab=document.querySelector('.tab.active');
+let tabIndex=Array.from(currentTab.parentNode.children).indexOf(currentTab);
+setTimeout(()=>showTab(tabIndex),100);}else{let t=await r.text();alert('Failed to add item: '+t);}});}
+function deleteItemFromModal(){
+if(confirm('Delete this item? This cannot be undone.')){
+fetch('/inventory/remove?'+itemRef(editingCategory,editingIndex)).then(r=>{
+if(r.ok){closeEditModal();
+let currentTab=document.querySelector('.tab.active');
+let tabIndex=Array.from(currentTab.parentNode.children).indexOf(currentTab);
+setTimeout(()=>showTab(tabIndex),100);}else{alert('Delete failed');}});}}
+function saveItemEdit(){
+let name=document.getElementById('edit-name').value.trim();
+let newCategory=parseInt(document.getElementById('edit-category').value);
+if(!name){alert('Name cannot be empty');return;}
+if(editingIsConsumable){
+let trailer=document.getElementById('edit-trailer').value==='true';
+if(newCategory!==editingCategory){
+let editParams=itemRef(editingCategory,editingIndex)+'&name='+encodeURIComponent(name)+'&livesInTrailer='+(trailer?'true':'false');
+fetch('/inventory/edit-consumable?'+editParams).then(r=>{
+if(r.ok){let moveParams=itemRef(editingCategory,editingIndex)+'&target='+newCategory;return fetch('/inventory/move-item',{method:'POST',headers:{'Content-Type':'application/x-www-form-urlencoded'},body:moveParams});}else{throw new Error('Edit failed');}
+}).then(r=>{if(r.ok){closeEditModal();let currentTab=document.querySelector('.tab.active');let tabIndex=Array.from(currentTab.parentNode.children).indexOf(currentTab);setTimeout(()=>showTab(tabIndex),100);}else{alert('Error moving item to new category');}}).catch(e=>{alert('Error: '+e.message);});
+}else{
+let params=itemRef(editingCategory,editingIndex)+'&name='+encodeURIComponent(name)+'&livesInTrailer='+(trailer?'true':'false');
+fetch('/inventory/edit-consumable?'+params).then(r=>{if(r.ok){closeEditModal();let currentTab=document.querySelector('.tab.active');let tabIndex=Array.from(currentTab.parentNode.children).indexOf(currentTab);setTimeout(()=>showTab(tabIndex),100);}else{alert('Edit failed');}});
+}
+}else{
+if(newCategory!==editingCategory){
+let editParams=itemRef(editingCategory,editingIndex)+'&name='+encodeURIComponent(name);
+fetch('/inventory/rename?'+editParams).then(r=>{if(r.ok){let moveParams=itemRef(editingCategory,editingIndex)+'&target='+newCategory;return fetch('/inventory/move-item',{method:'POST',headers:{'Content-Type':'application/x-www-form-urlencoded'},body:moveParams});}else{throw new Error('Rename failed');}}).then(r=>{if(r.ok){closeEditModal();let currentTab=document.querySelector('.tab.active');let tabIndex=Array.from(currentTab.parentNode.children).indexOf(currentTab);setTimeout(()=>showTab(tabIndex),100);}else{alert('Error moving item to new category');}}).catch(e=>{alert('Error: '+e.message);});
+}else{
+let params=itemRef(editingCategory,editingIndex)+'&name='+encodeURIComponent(name);
+fetch('/inventory/rename?'+params).then(r=>{if(r.ok){closeEditModal();let currentTab=document.querySelector('.tab.active');let tabIndex=Array.from(currentTab.parentNode.children).indexOf(currentTab);setTimeout(()=>showTab(tabIndex),100);}else{alert('Rename failed');}});
+}
+}
+}
+function removeItem(cat,item){
+if(!confirm('Delete this item? This cannot be undone.'))return;
+fetch('/inventory/remove?'+itemRef(cat,item)).then(r=>{
+if(r.ok){let currentTab=document.querySelector('.tab.active');
+let tabIndex=Array.from(currentTab.parentNode.children).indexOf(currentTab);
+setTimeout(()=>showTab(tabIndex),100);}else{alert('Failed to remove item');}});}
+function refreshShoppingList(){
+fetch('/inventory/shopping').then(r=>r.json()).then(data=>{
+let container=document.getElementById('cat99');
+let header=document.getElementById('shop-count');
+if(data.count==0){
+header.innerHTML='0 items';
+container.innerHTML='<div class="empty"><h3>✓ All stocked up!</h3><p>No items need purchasing</p></div>';
+container.classList.add('expanded');
+}else{
+let countHTML='';
+if(data.outCount>0){countHTML+='<span style="color:#ef4444">'+data.outCount+' OUT</span>';
+if(data.lowCount>0)countHTML+=' + ';}
+if(data.lowCount>0)countHTML+='<span style="color:#f59e0b">'+data.lowCount+' LOW</span>';
+header.innerHTML=countHTML;
+let shopHtml='<div style="margin-bottom:10px;display:flex;gap:6px;flex-wrap:wrap">';
+shopHtml+='<button onclick="selectItems(\'all\')" style="padding:6px 12px;background:rgba(255,255,255,0.2);border:none;border-radius:6px;color:#fff;font-size:12px;cursor:pointer">Select All</button>';
+shopHtml+='<button onclick="selectItems(\'out\')" style="padding:6px 12px;background:rgba(239,68,68,0.3);border:none;border-radius:6px;color:#fff;font-size:12px;cursor:pointer">Select Out Only</button>';
+shopHtml+='<button onclick="selectItems(\'low\')" style="padding:6px 12px;background:rgba(245,158,11,0.3);border:none;border-radius:6px;color:#fff;font-size:12px;cursor:pointer">Select Low Only</button>';
+shopHtml+='<button onclick="selectItems(\'none\')" style="padding:6px 12px;background:rgba(255,255,255,0.1);border:none;border-radius:6px;color:#fff;font-size:12px;cursor:pointer">Deselect All</button></div>';
+data.items.forEach(item=>{
+let statusClass=item.status==2?'out':'low';
+let badge=item.status==2?'OUT':'LOW';
+shopHtml+='<div class="shop-item '+statusClass+'" data-cat="'+item.cat+'" data-item="'+item.item+'" data-id="'+item.id+'" data-status="'+item.status+'" data-trailer="'+item.livesInTrailer+'">';
+shopHtml+='<input type="checkbox" class="shop-check" style="width:18px;height:18px;margin-right:10px;cursor:pointer">';
+shopHtml+='<span style="margin-right:8px;font-size:14px">'+(item.livesInTrailer?'🚚':'🛒')+'</span>';
+shopHtml+='<div style="flex:1"><div style="font-weight:bold;margin-bottom:2px">'+item.name+'</div>';
+shopHtml+='<div style="font-size:13px;opacity:0.8">'+item.category+'</div></div>';
+shopHtml+='<span class="badge '+statusClass+'">'+badge+'</span></div>';});
+container.innerHTML=shopHtml;container.classList.add('expanded');
+setTimeout(updateShoppingTileCounts,100);}});}
+function showTab(n){
+let type=isConsumable?'consumable':'equipment';
+let typeLabel=isConsumable?'Consumable':'Equipment';
+let name=prompt('Enter '+typeLabel+' category name:');
+if(!name||name.trim()=='')return;
+name=name.trim();
+let icon=prompt('Enter emoji icon (e.g., 🍝 or 🏕️):','📦');
+if(!icon||icon.trim()=='')icon='📦';
+icon=icon.trim();
+if(name.length>50){alert('Category name too long (max 50 chars)');return;}
+if(icon.length>10){alert('Icon too long (max 10 chars)');return;}
+let url='/inventory/add-category?name='+encodeURIComponent(name)+'&type='+type+'&icon='+encodeURIComponent(icon);
+if(!isConsumable){
+let subcategory=prompt('Choose subcategory:\n\n1 = TRAILER (always packed)\n2 = ESSENTIALS (must pack every trip)\n3 = OPTIONAL (extra items)\n\nEnter 1, 2, or 3:');
+if(subcategory=='1')subcategory='trailer';
+else if(subcategory=='2')subcategory='essentials';
+else if(subcategory=='3')subcategory='optional';
+else{alert('Invalid selection. Please choose 1, 2, or 3.');return;}
+url+='&subcategory='+subcategory;}
+fetch(url).then(r=>{if(r.ok){alert('✅ Category "'+name+'" created!');let currentTab=document.querySelector('.tab.active');let tabIndex=Array.from(currentTab.parentNode.children).indexOf(currentTab);loadTabContent(tabIndex);}
+else{r.text().then(msg=>alert('❌ Error: '+msg));}});}
+}
@@ -0,0 +1,575 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/**
+ * ESP-NOW wire protocol shared by Master_ESP32, the Victron relay and
+ * EcoFlow_ESP32 (each adds -I../Shared to its build_flags).
+ *
+ * Every frame is a 12-byte header followed by TLV sections:
+ *
+ *   offset size
+ *     0     2   magic 'P' 'M'
+ *     2     1   version (ESPNOW_PROTOCOL_VERSION)
+ *     3     1   type (EspNowMsgType)
+ *     4     1   source (EspNowSource)
+ *     5     1   flags (ESPNOW_FLAG_*)
+ *     6     2   sequence, per sender, wraps at 65535
+ *     8     2   payload length
+ *    10     2   CRC-16/CCITT-FALSE of the header (CRC field zeroed) and payload
+ *    12     n   sections: tag (1 byte), length (1 byte), value
+ *
+ * All numbers are little-endian and values are fixed-point integers, so the
+ * layout doesn't depend on compiler padding or float format. Readers skip
+ * tags they don't know and read missing trailing bytes of a section as 0,
+ * so a section can grow new fields at its end without a version bump.
+ * The version only changes when an existing field changes meaning.
+ *
+ * Telemetry is sent as keyframes and delta frames (DeltaEncoder and
+ * DeltaDecoder below). A keyframe carries every section in full. The frames
+ * after it carry only the fields that differ from the keyframe, as zig-zag
+ * varints. Because every delta is against the keyframe and not the previous
+ * frame, a lost delta costs nothing. A lost keyframe makes the receiver skip
+ * deltas until the next one, at most ESPNOW_KEYFRAME_EVERY frames later.
+ * Strings (serial numbers, addresses) only travel in keyframes, and a change
+ * to them forces one.
+ *
+ * Plain C++, no Arduino dependencies, so the decoder can be fuzzed on the host.
+ */
+
+#define ESPNOW_MAGIC0 'P'
+#define ESPNOW_MAGIC1 'M'
+#define ESPNOW_PROTOCOL_VERSION 1
+#define ESPNOW_HEADER_SIZE 12
+#define ESPNOW_MAX_FRAME 250            // ESP-NOW payload limit
+#define ESPNOW_MAX_PAYLOAD (ESPNOW_MAX_FRAME - ESPNOW_HEADER_SIZE)
+#define ESPNOW_KEYFRAME_EVERY 10        // Frames per keyframe
+#define ESPNOW_MAX_FIELDS 12            // Fields per field section
+
+#define ESPNOW_FLAG_KEYFRAME 0x01       // Every section, absolute values
+#define ESPNOW_FLAG_DELTA 0x02          // TAG_BASE first, then TAG_DELTA sections
+
+enum EspNowMsgType : uint8_t {
+    MSG_TELEMETRY = 1,          // Sensor sections (sender -> Master)
+    MSG_STATUS = 2,             // TAG_READY (relay -> Master)
+    MSG_COMMAND = 3,            // TAG_COMMAND (Master -> relay)
+    MSG_COMMAND_ACK = 4         // TAG_ACK (relay -> Master)
+};
+
+enum EspNowSource : uint8_t {
+    SRC_MASTER = 0,
+    SRC_VICTRON = 1,            // Victron relay (also forwards fridge and EcoFlow)
+    SRC_ECOFLOW = 2,
+    SRC_FRIDGE = 3
+};
+
+/**
+ * Section tags and value layouts (s = signed, u = unsigned, bits in bytes).
+ * Scaled fields are value / scale, e.g. 1289 in a 10 mV field is 12.89 V.
+ */
+enum EspNowTag : uint8_t {
+    TAG_SENDER_TIME = 0x01,     // u32 sender millis()
+    TAG_READY = 0x02,           // u8  1 = ready for commands, 0 = scanning
+    TAG_BASE = 0x03,            // u16 sequence of the keyframe a delta frame is against
+    // u8 section tag | u16 changed-field bitmap | per set bit, zig-zag varint
+    // of (field - keyframe field)
+    TAG_DELTA = 0x04,
+
+    // u16 voltage 10mV | s32 current mA | u16 soc 0.1% | s16 consumed 0.1Ah |
+    // u16 aux voltage 10mV | u16 time to go min | u8 flags (SECTION_VALID, BMV_ALARM_*)
+    TAG_BMV = 0x10,
+    // u16 battery voltage 10mV | s16 battery current 10mA | u16 solar power W |
+    // u16 yield today 10Wh | u8 state | u8 error | u8 flags
+    TAG_MPPT = 0x11,
+    // u16 battery voltage 10mV | s16 battery current 10mA | s16 temperature 0.1C |
+    // s16 load current 10mA | u16 power W | u8 state | u8 error | u8 flags
+    TAG_IP22 = 0x12,
+    // u8 battery % | s8 rssi | u8 flags
+    TAG_ECOFLOW = 0x13,
+    TAG_ECOFLOW_SERIAL = 0x14,  // ASCII, no terminator
+    TAG_ECOFLOW_ADDRESS = 0x15, // ASCII "aa:bb:cc:dd:ee:ff", no terminator
+    // s8 left actual | s8 left setpoint | s8 right actual | s8 right setpoint |
+    // u8 battery protection | s8 rssi | u8 flags (SECTION_VALID, FRIDGE_*)
+    TAG_FRIDGE = 0x16,
+
+    // u32 command id | u8 device | u8 command | s16 value1 | s16 value2
+    TAG_COMMAND = 0x20,
+    // u32 command id | u8 flags (ACK_RECEIVED, ACK_EXECUTED) | u8 error code
+    TAG_ACK = 0x21
+};
+
+#define SECTION_VALID 0x01
+#define BMV_ALARM_LOW_VOLTAGE 0x02
+#define BMV_ALARM_HIGH_VOLTAGE 0x04
+#define BMV_ALARM_LOW_SOC 0x08
+#define FRIDGE_CONNECTED 0x02
+#define FRIDGE_ECO 0x04
+#define FRIDGE_LOCK 0x08
+#define FRIDGE_CELSIUS 0x10
+#define ACK_RECEIVED 0x01
+#define ACK_EXECUTED 0x02
+
+struct EspNowHeader {
+    uint8_t version;
+    EspNowMsgType type;
+    EspNowSource source;
+    uint8_t flags;
+    uint16_t seq;
+    uint16_t length;            // Payload bytes
+};
+
+/**
+ * Field sections as lists of integers, for delta encoding. Each entry is the
+ * layout documented on the tag above, in the same order.
+ */
+enum FieldType : uint8_t { F_U8, F_S8, F_U16, F_S16, F_U32, F_S32 };
+
+struct SectionLayout {
+    uint8_t tag;
+    uint8_t count;
+    FieldType fields[ESPNOW_MAX_FIELDS];
+};
+
+static const SectionLayout ESPNOW_SECTIONS[] = {
+    {TAG_READY, 1, {F_U8}},
+    {TAG_BMV, 7, {F_U16, F_S32, F_U16, F_S16, F_U16, F_U16, F_U8}},
+    {TAG_MPPT, 7, {F_U16, F_S16, F_U16, F_U16, F_U8, F_U8, F_U8}},
+    {TAG_IP22, 8, {F_U16, F_S16, F_S16, F_S16, F_U16, F_U8, F_U8, F_U8}},
+    {TAG_ECOFLOW, 3, {F_U8, F_S8, F_U8}},
+    {TAG_FRIDGE, 7, {F_S8, F_S8, F_S8, F_S8, F_U8, F_S8, F_U8}},
+};
+#define ESPNOW_FIELD_SECTIONS (sizeof(ESPNOW_SECTIONS) / sizeof(ESPNOW_SECTIONS[0]))
+
+// Index into ESPNOW_SECTIONS, -1 if `tag` isn't a field section
+inline int espnowSectionIndex(uint8_t tag) {
+    for (size_t i = 0; i < ESPNOW_FIELD_SECTIONS; i++) {
+        if (ESPNOW_SECTIONS[i].tag == tag) return i;
+    }
+    return -1;
+}
+
+inline uint32_t espnowZigzag(int32_t v) { return ((uint32_t)v << 1) ^ (uint32_t)(v >> 31); }
+inline int32_t espnowUnzigzag(uint32_t v) { return (int32_t)(v >> 1) ^ -(int32_t)(v & 1); }
+
+inline uint16_t espnowCrc16(const uint8_t* data, size_t len, uint16_t crc = 0xFFFF) {
+    for (size_t i = 0; i < len; i++) {
+        crc ^= (uint16_t)data[i] << 8;
+        for (uint8_t b = 0; b < 8; b++) crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+    }
+    return crc;
+}
+
+// Round and clamp a reading into a fixed-point field
+inline int32_t espnowQuantize(float value, float scale, int32_t lo, int32_t hi) {
+    float q = value * scale;
+    if (!(q >= lo)) return lo;      // Also catches NaN
+    if (q >= hi) return hi;
+    return (int32_t)(q < 0 ? q - 0.5f : q + 0.5f);
+}
+
+/**
+ * Builds one frame in a caller-supplied buffer (at least ESPNOW_MAX_FRAME
+ * bytes). Sections that don't fit are dropped and flagged by overflow().
+ */
+class FrameWriter {
+public:
+    FrameWriter(uint8_t* buf, EspNowMsgType type, EspNowSource source)
+        : _buf(buf), _len(ESPNOW_HEADER_SIZE) {
+        memset(_buf, 0, ESPNOW_HEADER_SIZE);
+        _buf[0] = ESPNOW_MAGIC0;
+        _buf[1] = ESPNOW_MAGIC1;
+        _buf[2] = ESPNOW_PROTOCOL_VERSION;
+        _buf[3] = type;
+        _buf[4] = source;
+    }
+
+    void setFlags(uint8_t flags) { _buf[5] = flags; }
+
+    FrameWriter& beginSection(uint8_t tag) {
+        _section = _len;
+        _sectionOk = _len + 2 <= ESPNOW_MAX_FRAME;
+        if (_sectionOk) {
+            _buf[_len++] = tag;
+            _buf[_len++] = 0;
+        }
+        return *this;
+    }
+
+    FrameWriter& u8(uint8_t v) { return put(&v, 1); }
+    FrameWriter& s8(int8_t v) { return u8((uint8_t)v); }
+    FrameWriter& u16(uint16_t v) {
+        uint8_t b[2] = {(uint8_t)v, (uint8_t)(v >> 8)};
+        return put(b, 2);
+    }
+    FrameWriter& s16(int16_t v) { return u16((uint16_t)v); }
+    FrameWriter& u32(uint32_t v) {
+        uint8_t b[4] = {(uint8_t)v, (uint8_t)(v >> 8), (uint8_t)(v >> 16), (uint8_t)(v >> 24)};
+        return put(b, 4);
+    }
+    FrameWriter& s32(int32_t v) { return u32((uint32_t)v); }
+    FrameWriter& varint(uint32_t v) {
+        while (v >= 0x80) {
+            u8((uint8_t)(v | 0x80));
+            v >>= 7;
+        }
+        return u8((uint8_t)v);
+    }
+    FrameWriter& field(FieldType type, int32_t v) {
+        switch (type) {
+            case F_U8: case F_S8: return u8((uint8_t)v);
+            case F_U16: case F_S16: return u16((uint16_t)v);
+            default: return u32((uint32_t)v);
+        }
+    }
+    FrameWriter& str(const char* s, size_t max) {
+        size_t n = 0;
+        while (n < max && s[n]) n++;
+        return put((const uint8_t*)s, n);
+    }
+
+    // Close the section; false if it didn't fit and was dropped
+    bool endSection() {
+        if (!_sectionOk) {
+            _len = _section;
+            _overflow = true;
+            return false;
+        }
+        _buf[_section + 1] = _len - _section - 2;
+        _sections++;
+        return true;
+    }
+
+    uint8_t sections() const { return _sections; }
+    bool overflow() const { return _overflow; }
+
+    // Fill in sequence, length and CRC; returns the frame size to send
+    size_t finish(uint16_t seq) {
+        uint16_t payload = _len - ESPNOW_HEADER_SIZE;
+        _buf[6] = (uint8_t)seq;
+        _buf[7] = (uint8_t)(seq >> 8);
+        _buf[8] = (uint8_t)payload;
+        _buf[9] = (uint8_t)(payload >> 8);
+        _buf[10] = _buf[11] = 0;
+        uint16_t crc = espnowCrc16(_buf, _len);
+        _buf[10] = (uint8_t)crc;
+        _buf[11] = (uint8_t)(crc >> 8);
+        return _len;
+    }
+
+private:
+    FrameWriter& put(const uint8_t* data, size_t n) {
+        if (!_sectionOk || _len + n > ESPNOW_MAX_FRAME || _len + n - _section - 2 > 255) {
+            _sectionOk = false;
+            return *this;
+        }
+        memcpy(_buf + _len, data, n);
+        _len += n;
+        return *this;
+    }
+
+    uint8_t* _buf;
+    size_t _len;
+    size_t _section = 0;
+    bool _sectionOk = false;
+    bool _overflow = false;
+    uint8_t _sections = 0;
+};
+
+/**
+ * Reads the fields of one section in order. Reading past the end of the
+ * section returns 0, so older senders' shorter sections decode cleanly.
+ */
+class SectionReader {
+public:
+    SectionReader(const uint8_t* data, uint8_t len) : _data(data), _len(len) {}
+
+    uint8_t u8() { return _pos < _len ? _data[_pos++] : (_pos++, 0); }
+    int8_t s8() { return (int8_t)u8(); }
+    uint16_t u16() {
+        uint16_t lo = u8();
+        return lo | (uint16_t)u8() << 8;
+    }
+    int16_t s16() { return (int16_t)u16(); }
+    uint32_t u32() {
+        uint32_t lo = u16();
+        return lo | (uint32_t)u16() << 16;
+    }
+    int32_t s32() { return (int32_t)u32(); }
+
+    uint32_t varint() {
+        uint32_t v = 0;
+        for (uint8_t shift = 0; shift < 35; shift += 7) {
+            uint8_t b = u8();
+            v |= (uint32_t)(b & 0x7F) << shift;
+            if (!(b & 0x80)) break;
+        }
+        return v;
+    }
+    int32_t field(FieldType type) {
+        switch (type) {
+            case F_U8: return u8();
+            case F_S8: return s8();
+            case F_U16: return u16();
+            case F_S16: return s16();
+            case F_U32: return (int32_t)u32();
+            default: return s32();
+        }
+    }
+
+    // Copy the rest of the section as a string, always terminated
+    void str(char* out, size_t size) {
+        size_t n = 0;
+        while (_pos < _len && n + 1 < size) out[n++] = (char)_data[_pos++];
+        out[n] = '\0';
+    }
+
+    uint8_t length() const { return _len; }
+
+private:
+    const uint8_t* _data;
+    uint8_t _len;
+    uint8_t _pos = 0;
+};
+
+/**
+ * Validates a received frame and walks its sections.
+ *
+ *   FrameReader frame(data, len);
+ *   if (!frame.valid()) return;
+ *   uint8_t tag; SectionReader section(nullptr, 0);
+ *   while (frame.next(tag, section)) { switch (tag) { ... } }
+ */
+class FrameReader {
+public:
+    enum Error : uint8_t { OK = 0, NOT_FRAMED, BAD_VERSION, TRUNCATED, BAD_CRC };
+
+    FrameReader(const uint8_t* data, size_t len) : _data(data) {
+        if (len < ESPNOW_HEADER_SIZE || data[0] != ESPNOW_MAGIC0 || data[1] != ESPNOW_MAGIC1) {
+            _error = NOT_FRAMED;
+            return;
+        }
+        _header.version = data[2];
+        _header.type = (EspNowMsgType)data[3];
+        _header.source = (EspNowSource)data[4];
+        _header.flags = data[5];
+        _header.seq = data[6] | (uint16_t)data[7] << 8;
+        _header.length = data[8] | (uint16_t)data[9] << 8;
+        if (_header.version != ESPNOW_PROTOCOL_VERSION) {
+            _error = BAD_VERSION;
+            return;
+        }
+        if ((size_t)ESPNOW_HEADER_SIZE + _header.length > len) {
+            _error = TRUNCATED;
+            return;
+        }
+        uint8_t zero[2] = {0, 0};
+        uint16_t crc = espnowCrc16(data, 10);
+        crc = espnowCrc16(zero, 2, crc);
+        crc = espnowCrc16(data + ESPNOW_HEADER_SIZE, _header.length, crc);
+        if (crc != (data[10] | (uint16_t)data[11] << 8)) {
+            _error = BAD_CRC;
+            return;
+        }
+        _pos = ESPNOW_HEADER_SIZE;
+        _end = ESPNOW_HEADER_SIZE + _header.length;
+    }
+
+    bool valid() const { return _error == OK; }
+    Error error() const { return _error; }
+    const EspNowHeader& header() const { return _header; }
+
+    // Next section; false at the end or if a section runs past the payload
+    bool next(uint8_t& tag, SectionReader& section) {
+        if (_error != OK || _pos + 2 > _end) return false;
+        uint8_t len = _data[_pos + 1];
+        if (_pos + 2 + len > _end) {
+            _pos = _end;
+            return false;
+        }
+        tag = _data[_pos];
+        section = SectionReader(_data + _pos + 2, len);
+        _pos += 2 + len;
+        return true;
+    }
+
+private:
+    const uint8_t* _data;
+    EspNowHeader _header = {};
+    Error _error = OK;
+    size_t _pos = 0;
+    size_t _end = 0;
+};
+
+// The frame's TAG_SENDER_TIME, if it has one. Takes a copy of the reader so
+// the caller can still walk the sections.
+inline bool espnowSenderTime(FrameReader frame, uint32_t& senderTime) {
+    uint8_t tag;
+    SectionReader section(nullptr, 0);
+    while (frame.next(tag, section)) {
+        if (tag == TAG_SENDER_TIME) {
+            senderTime = section.u32();
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Sender side of keyframe / delta telemetry. Per frame:
+ *
+ *   bool key = encoder.begin(writer, seq, checksumOfStrings);
+ *   encoder.section(writer, TAG_BMV, bmvFields);     // for each field section
+ *   if (key) ... write the string sections ...
+ */
+class DeltaEncoder {
+public:
+    // Start a frame; true if it is a keyframe. `text` is a checksum of the
+    // string sections, which only keyframes carry.
+    bool begin(FrameWriter& w, uint16_t seq, uint32_t text = 0) {
+        _key = _force || !_haveBase || _sinceKey + 1 >= ESPNOW_KEYFRAME_EVERY || text != _text;
+        if (_key) {
+            w.setFlags(ESPNOW_FLAG_KEYFRAME);
+            _baseSeq = seq;
+            _sinceKey = 0;
+            _text = text;
+            _present = 0;
+            _haveBase = true;
+            _force = false;
+        } else {
+            w.setFlags(ESPNOW_FLAG_DELTA);
+            w.beginSection(TAG_BASE).u16(_baseSeq).endSection();
+            _sinceKey++;
+        }
+        return _key;
+    }
+
+    // Add a field section (ESPNOW_SECTIONS layout): in full in a keyframe,
+    // otherwise only the fields that differ from the keyframe
+    void section(FrameWriter& w, uint8_t tag, const int32_t* values) {
+        int idx = espnowSectionIndex(tag);
+        if (idx < 0) return;
+        const SectionLayout& layout = ESPNOW_SECTIONS[idx];
+        if (_key || !(_present & (1u << idx))) {
+            w.beginSection(tag);
+            for (uint8_t i = 0; i < layout.count; i++) w.field(layout.fields[i], values[i]);
+            if (w.endSection() && _key) {
+                memcpy(_base[idx], values, layout.count * sizeof(int32_t));
+                _present |= 1u << idx;
+            } else if (!_key) {
+                _force = true;      // Not in the keyframe: give it a base next frame
+            }
+            return;
+        }
+        uint16_t changed = 0;
+        for (uint8_t i = 0; i < layout.count; i++) {
+            if (values[i] != _base[idx][i]) changed |= 1u << i;
+        }
+        if (!changed) return;
+        w.beginSection(TAG_DELTA).u8(tag).u16(changed);
+        for (uint8_t i = 0; i < layout.count; i++) {
+            if (changed & (1u << i)) w.varint(espnowZigzag((int32_t)((uint32_t)values[i] - (uint32_t)_base[idx][i])));
+        }
+        if (!w.endSection()) _force = true;
+    }
+
+    // Make the next frame a keyframe (e.g. the receiver is known to have rebooted)
+    void forceKeyframe() { _force = true; }
+
+private:
+    int32_t _base[ESPNOW_FIELD_SECTIONS][ESPNOW_MAX_FIELDS] = {};
+    uint32_t _present = 0;
+    uint32_t _text = 0;
+    uint16_t _baseSeq = 0;
+    uint8_t _sinceKey = 0;
+    bool _haveBase = false;
+    bool _key = false;
+    bool _force = false;
+};
+
+/**
+ * Receiver side, one per sender. decode() calls
+ * apply(tag, values, section) for each section of a telemetry frame:
+ * `values` holds the reconstructed fields of a field section, or is nullptr
+ * for other sections (read those from `section`). A delta frame re-applies
+ * the keyframe values of the field sections it leaves out, so a field that
+ * went back to its keyframe value is restored too.
+ *
+ * Returns false, and applies nothing, for a delta frame whose keyframe was
+ * missed.
+ */
+class DeltaDecoder {
+public:
+    template <typename F>
+    bool decode(FrameReader& frame, F apply) {
+        const EspNowHeader& header = frame.header();
+        bool key = header.flags & ESPNOW_FLAG_KEYFRAME;
+        bool delta = !key && (header.flags & ESPNOW_FLAG_DELTA);
+        uint8_t tag;
+        SectionReader section(nullptr, 0);
+
+        if (delta) {
+            if (!frame.next(tag, section) || tag != TAG_BASE || !_haveBase || section.u16() != _baseSeq) {
+                _missedBase++;
+                return false;
+            }
+        }
+        if (key) _present = 0;
+
+        uint32_t seen = 0;
+        int32_t values[ESPNOW_MAX_FIELDS];
+        while (frame.next(tag, section)) {
+            int idx;
+            if (tag == TAG_DELTA && delta) {
+                uint8_t target = section.u8();
+                uint16_t changed = section.u16();
+                idx = espnowSectionIndex(target);
+                if (idx < 0 || !(_present & (1u << idx))) continue;
+                const SectionLayout& layout = ESPNOW_SECTIONS[idx];
+                for (uint8_t i = 0; i < layout.count; i++) {
+                    uint32_t d = (changed & (1u << i)) ? (uint32_t)espnowUnzigzag(section.varint()) : 0;
+                    values[i] = (int32_t)((uint32_t)_base[idx][i] + d);
+                }
+                seen |= 1u << idx;
+                apply(target, (const int32_t*)values, section);
+            } else if ((idx = espnowSectionIndex(tag)) >= 0) {
+                const SectionLayout& layout = ESPNOW_SECTIONS[idx];
+                for (uint8_t i = 0; i < layout.count; i++) values[i] = section.field(layout.fields[i]);
+                if (key) {
+                    memcpy(_base[idx], values, layout.count * sizeof(int32_t));
+                    _present |= 1u << idx;
+                }
+                seen |= 1u << idx;
+                apply(tag, (const int32_t*)values, section);
+            } else {
+                apply(tag, (const int32_t*)nullptr, section);
+            }
+        }
+
+        if (delta) {
+            SectionReader none(nullptr, 0);
+            for (size_t idx = 0; idx < ESPNOW_FIELD_SECTIONS; idx++) {
+                if ((_present & ~seen) & (1u << idx)) apply(ESPNOW_SECTIONS[idx].tag, (const int32_t*)_base[idx], none);
+            }
+        }
+        if (key) {
+            _haveBase = true;
+            _baseSeq = header.seq;
+        }
+        return true;
+    }
+
+    // Delta frames dropped because their keyframe never arrived
+    uint32_t missedBase() const { return _missedBase; }
+
+    // Forget the keyframe (e.g. the sender rebooted)
+    void reset() { _haveBase = false; }
+
+private:
+    int32_t _base[ESPNOW_FIELD_SECTIONS][ESPNOW_MAX_FIELDS] = {};
+    uint32_t _present = 0;
+    uint32_t _missedBase = 0;
+    uint16_t _baseSeq = 0;
+    bool _haveBase = false;
+};